@@ -0,0 +1,817 @@
+/* Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "api_capture.h"
+
+#include <atomic>
+
+#include "layer_chassis_dispatch.h"
+#include "vk_layer_config.h"
+#include "vk_typemap_helper.h"
+
+using api_capture::Writer;
+
+ApiCapture::ApiCapture(const VkDeviceCreateInfo *pCreateInfo) {
+    container_type = LayerObjectTypeApiCapture;
+    for (uint32_t i = 0; i < pCreateInfo->enabledExtensionCount; ++i) {
+        enabled_extensions_.emplace_back(pCreateInfo->ppEnabledExtensionNames[i]);
+    }
+    const auto *features2 = lvl_find_in_chain<VkPhysicalDeviceFeatures2>(pCreateInfo->pNext);
+    if (features2) {
+        enabled_features_.reset(new VkPhysicalDeviceFeatures(features2->features));
+    } else if (pCreateInfo->pEnabledFeatures) {
+        enabled_features_.reset(new VkPhysicalDeviceFeatures(*pCreateInfo->pEnabledFeatures));
+    }
+}
+
+void ApiCapture::InitDeviceValidationObject(bool add_obj, ValidationObject *inst_obj, ValidationObject *dev_obj) {
+    // Only the first device is captured, a second one would overwrite the file
+    static std::atomic<bool> device_captured(false);
+    if (add_obj && !device_captured.exchange(true)) {
+        const char *filename = getLayerOption("khronos_validation.capture_file");
+        if (!filename || !*filename) filename = "vk_api_capture.bin";
+        FILE *file = fopen(filename, "wb");
+        if (file) writer_.reset(new Writer(file));
+    }
+    ValidationObject::InitDeviceValidationObject(writer_ != nullptr, inst_obj, dev_obj);
+    if (writer_) {
+        DispatchGetPhysicalDeviceMemoryProperties(physical_device, &memory_properties_);
+        Record record(*writer_, api_capture::kDevice);
+        record->Write(static_cast<uint32_t>(enabled_extensions_.size()));
+        for (const auto &extension : enabled_extensions_) record->WriteString(extension.c_str());
+        record->WriteOptional(enabled_features_.get());
+    }
+}
+
+void ApiCapture::WriteShaderStage(const VkPipelineShaderStageCreateInfo &stage) {
+    writer_->Write(stage);
+    writer_->WriteString(stage.pName);
+    writer_->WriteOptional(stage.pSpecializationInfo);
+    if (stage.pSpecializationInfo) {
+        writer_->WriteArray(stage.pSpecializationInfo->pMapEntries, stage.pSpecializationInfo->mapEntryCount);
+        writer_->WriteArray(static_cast<const uint8_t *>(stage.pSpecializationInfo->pData),
+                            static_cast<uint32_t>(stage.pSpecializationInfo->dataSize));
+    }
+}
+
+void ApiCapture::PostCallRecordGetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue *pQueue) {
+    Record record(*writer_, api_capture::kGetDeviceQueue);
+    record->Write(queueFamilyIndex);
+    record->Write(queueIndex);
+    record->WriteHandle(*pQueue);
+}
+
+void ApiCapture::PostCallRecordDeviceWaitIdle(VkDevice device, VkResult result) {
+    Record record(*writer_, api_capture::kDeviceWaitIdle);
+}
+
+void ApiCapture::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence,
+                                           VkResult result) {
+    if (result != VK_SUCCESS) return;
+    // Semaphores aren't captured, the replay waits for nothing but the order of the submissions
+    Record record(*writer_, api_capture::kQueueSubmit);
+    record->WriteHandle(queue);
+    record->Write(submitCount);
+    for (uint32_t i = 0; i < submitCount; ++i) {
+        record->WriteHandles(pSubmits[i].pCommandBuffers, pSubmits[i].commandBufferCount);
+    }
+    record->WriteHandle(fence);
+}
+
+void ApiCapture::PostCallRecordQueueWaitIdle(VkQueue queue, VkResult result) {
+    Record record(*writer_, api_capture::kQueueWaitIdle);
+    record->WriteHandle(queue);
+}
+
+void ApiCapture::PostCallRecordAllocateMemory(VkDevice device, const VkMemoryAllocateInfo *pAllocateInfo,
+                                              const VkAllocationCallbacks *pAllocator, VkDeviceMemory *pMemory, VkResult result) {
+    if (result != VK_SUCCESS) return;
+    // The replay device has other memory types, so the replay chooses one by its properties
+    const VkMemoryPropertyFlags property_flags = (pAllocateInfo->memoryTypeIndex < memory_properties_.memoryTypeCount)
+                                                     ? memory_properties_.memoryTypes[pAllocateInfo->memoryTypeIndex].propertyFlags
+                                                     : 0;
+    Record record(*writer_, api_capture::kAllocateMemory);
+    record->Write(*pAllocateInfo);
+    record->Write(property_flags);
+    record->WriteHandle(*pMemory);
+}
+
+void ApiCapture::PostCallRecordFreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks *pAllocator) {
+    Record record(*writer_, api_capture::kFreeMemory);
+    record->WriteHandle(memory);
+}
+
+void ApiCapture::PostCallRecordCreateBuffer(VkDevice device, const VkBufferCreateInfo *pCreateInfo,
+                                            const VkAllocationCallbacks *pAllocator, VkBuffer *pBuffer, VkResult result) {
+    if (result != VK_SUCCESS) return;
+    Record record(*writer_, api_capture::kCreateBuffer);
+    record->Write(*pCreateInfo);
+    record->WriteArray(pCreateInfo->pQueueFamilyIndices,
+                       (pCreateInfo->sharingMode == VK_SHARING_MODE_CONCURRENT) ? pCreateInfo->queueFamilyIndexCount : 0);
+    record->WriteHandle(*pBuffer);
+}
+
+void ApiCapture::PostCallRecordDestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks *pAllocator) {
+    Record record(*writer_, api_capture::kDestroyBuffer);
+    record->WriteHandle(buffer);
+}
+
+void ApiCapture::PostCallRecordBindBufferMemory(VkDevice device, VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset,
+                                                VkResult result) {
+    if (result != VK_SUCCESS) return;
+    Record record(*writer_, api_capture::kBindBufferMemory);
+    record->WriteHandle(buffer);
+    record->WriteHandle(memory);
+    record->Write(memoryOffset);
+}
+
+void ApiCapture::PostCallRecordCreateBufferView(VkDevice device, const VkBufferViewCreateInfo *pCreateInfo,
+                                                const VkAllocationCallbacks *pAllocator, VkBufferView *pView, VkResult result) {
+    if (result != VK_SUCCESS) return;
+    Record record(*writer_, api_capture::kCreateBufferView);
+    record->Write(*pCreateInfo);
+    record->WriteHandle(*pView);
+}
+
+void ApiCapture::PostCallRecordDestroyBufferView(VkDevice device, VkBufferView bufferView,
+                                                 const VkAllocationCallbacks *pAllocator) {
+    Record record(*writer_, api_capture::kDestroyBufferView);
+    record->WriteHandle(bufferView);
+}
+
+void ApiCapture::PostCallRecordCreateImage(VkDevice device, const VkImageCreateInfo *pCreateInfo,
+                                           const VkAllocationCallbacks *pAllocator, VkImage *pImage, VkResult result) {
+    if (result != VK_SUCCESS) return;
+    Record record(*writer_, api_capture::kCreateImage);
+    record->Write(*pCreateInfo);
+    record->WriteArray(pCreateInfo->pQueueFamilyIndices,
+                       (pCreateInfo->sharingMode == VK_SHARING_MODE_CONCURRENT) ? pCreateInfo->queueFamilyIndexCount : 0);
+    record->WriteHandle(*pImage);
+}
+
+void ApiCapture::PostCallRecordDestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks *pAllocator) {
+    Record record(*writer_, api_capture::kDestroyImage);
+    record->WriteHandle(image);
+}
+
+void ApiCapture::PostCallRecordBindImageMemory(VkDevice device, VkImage image, VkDeviceMemory memory, VkDeviceSize memoryOffset,
+                                               VkResult result) {
+    if (result != VK_SUCCESS) return;
+    Record record(*writer_, api_capture::kBindImageMemory);
+    record->WriteHandle(image);
+    record->WriteHandle(memory);
+    record->Write(memoryOffset);
+}
+
+void ApiCapture::PostCallRecordCreateImageView(VkDevice device, const VkImageViewCreateInfo *pCreateInfo,
+                                               const VkAllocationCallbacks *pAllocator, VkImageView *pView, VkResult result) {
+    if (result != VK_SUCCESS) return;
+    Record record(*writer_, api_capture::kCreateImageView);
+    record->Write(*pCreateInfo);
+    record->WriteHandle(*pView);
+}
+
+void ApiCapture::PostCallRecordDestroyImageView(VkDevice device, VkImageView imageView, const VkAllocationCallbacks *pAllocator) {
+    Record record(*writer_, api_capture::kDestroyImageView);
+    record->WriteHandle(imageView);
+}
+
+void ApiCapture::PostCallRecordCreateSampler(VkDevice device, const VkSamplerCreateInfo *pCreateInfo,
+                                             const VkAllocationCallbacks *pAllocator, VkSampler *pSampler, VkResult result) {
+    if (result != VK_SUCCESS) return;
+    Record record(*writer_, api_capture::kCreateSampler);
+    record->Write(*pCreateInfo);
+    record->WriteHandle(*pSampler);
+}
+
+void ApiCapture::PostCallRecordDestroySampler(VkDevice device, VkSampler sampler, const VkAllocationCallbacks *pAllocator) {
+    Record record(*writer_, api_capture::kDestroySampler);
+    record->WriteHandle(sampler);
+}
+
+void ApiCapture::PostCallRecordCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo *pCreateInfo,
+                                                  const VkAllocationCallbacks *pAllocator, VkShaderModule *pShaderModule,
+                                                  VkResult result) {
+    if (result != VK_SUCCESS) return;
+    Record record(*writer_, api_capture::kCreateShaderModule);
+    record->Write(*pCreateInfo);
+    record->WriteArray(pCreateInfo->pCode, static_cast<uint32_t>(pCreateInfo->codeSize / sizeof(uint32_t)));
+    record->WriteHandle(*pShaderModule);
+}
+
+void ApiCapture::PostCallRecordDestroyShaderModule(VkDevice device, VkShaderModule shaderModule,
+                                                   const VkAllocationCallbacks *pAllocator) {
+    Record record(*writer_, api_capture::kDestroyShaderModule);
+    record->WriteHandle(shaderModule);
+}
+
+void ApiCapture::PostCallRecordCreateDescriptorSetLayout(VkDevice device, const VkDescriptorSetLayoutCreateInfo *pCreateInfo,
+                                                         const VkAllocationCallbacks *pAllocator, VkDescriptorSetLayout *pSetLayout,
+                                                         VkResult result) {
+    if (result != VK_SUCCESS) return;
+    Record record(*writer_, api_capture::kCreateDescriptorSetLayout);
+    record->Write(*pCreateInfo);
+    for (uint32_t i = 0; i < pCreateInfo->bindingCount; ++i) {
+        const auto &binding = pCreateInfo->pBindings[i];
+        const bool has_samplers = (binding.descriptorType == VK_DESCRIPTOR_TYPE_SAMPLER) ||
+                                  (binding.descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
+        record->Write(binding);
+        record->WriteHandles(binding.pImmutableSamplers, has_samplers ? binding.descriptorCount : 0);
+    }
+    record->WriteHandle(*pSetLayout);
+}
+
+void ApiCapture::PostCallRecordDestroyDescriptorSetLayout(VkDevice device, VkDescriptorSetLayout descriptorSetLayout,
+                                                          const VkAllocationCallbacks *pAllocator) {
+    Record record(*writer_, api_capture::kDestroyDescriptorSetLayout);
+    record->WriteHandle(descriptorSetLayout);
+}
+
+void ApiCapture::PostCallRecordCreatePipelineLayout(VkDevice device, const VkPipelineLayoutCreateInfo *pCreateInfo,
+                                                    const VkAllocationCallbacks *pAllocator, VkPipelineLayout *pPipelineLayout,
+                                                    VkResult result) {
+    if (result != VK_SUCCESS) return;
+    Record record(*writer_, api_capture::kCreatePipelineLayout);
+    record->Write(*pCreateInfo);
+    record->WriteHandles(pCreateInfo->pSetLayouts, pCreateInfo->setLayoutCount);
+    record->WriteArray(pCreateInfo->pPushConstantRanges, pCreateInfo->pushConstantRangeCount);
+    record->WriteHandle(*pPipelineLayout);
+}
+
+void ApiCapture::PostCallRecordDestroyPipelineLayout(VkDevice device, VkPipelineLayout pipelineLayout,
+                                                     const VkAllocationCallbacks *pAllocator) {
+    Record record(*writer_, api_capture::kDestroyPipelineLayout);
+    record->WriteHandle(pipelineLayout);
+}
+
+void ApiCapture::PostCallRecordCreateDescriptorPool(VkDevice device, const VkDescriptorPoolCreateInfo *pCreateInfo,
+                                                    const VkAllocationCallbacks *pAllocator, VkDescriptorPool *pDescriptorPool,
+                                                    VkResult result) {
+    if (result != VK_SUCCESS) return;
+    Record record(*writer_, api_capture::kCreateDescriptorPool);
+    record->Write(*pCreateInfo);
+    record->WriteArray(pCreateInfo->pPoolSizes, pCreateInfo->poolSizeCount);
+    record->WriteHandle(*pDescriptorPool);
+}
+
+void ApiCapture::PostCallRecordDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
+                                                     const VkAllocationCallbacks *pAllocator) {
+    Record record(*writer_, api_capture::kDestroyDescriptorPool);
+    record->WriteHandle(descriptorPool);
+}
+
+void ApiCapture::PostCallRecordResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
+                                                   VkDescriptorPoolResetFlags flags, VkResult result) {
+    if (result != VK_SUCCESS) return;
+    Record record(*writer_, api_capture::kResetDescriptorPool);
+    record->WriteHandle(descriptorPool);
+    record->Write(flags);
+}
+
+void ApiCapture::PostCallRecordAllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo *pAllocateInfo,
+                                                      VkDescriptorSet *pDescriptorSets, VkResult result) {
+    if (result != VK_SUCCESS) return;
+    Record record(*writer_, api_capture::kAllocateDescriptorSets);
+    record->WriteHandle(pAllocateInfo->descriptorPool);
+    record->WriteHandles(pAllocateInfo->pSetLayouts, pAllocateInfo->descriptorSetCount);
+    record->WriteHandles(pDescriptorSets, pAllocateInfo->descriptorSetCount);
+}
+
+void ApiCapture::PostCallRecordFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount,
+                                                  const VkDescriptorSet *pDescriptorSets, VkResult result) {
+    if (result != VK_SUCCESS) return;
+    Record record(*writer_, api_capture::kFreeDescriptorSets);
+    record->WriteHandle(descriptorPool);
+    record->WriteHandles(pDescriptorSets, descriptorSetCount);
+}
+
+void ApiCapture::PostCallRecordUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount,
+                                                    const VkWriteDescriptorSet *pDescriptorWrites, uint32_t descriptorCopyCount,
+                                                    const VkCopyDescriptorSet *pDescriptorCopies) {
+    Record record(*writer_, api_capture::kUpdateDescriptorSets);
+    record->Write(descriptorWriteCount);
+    for (uint32_t i = 0; i < descriptorWriteCount; ++i) {
+        const auto &write = pDescriptorWrites[i];
+        record->Write(write);
+        // Only the array the descriptor type uses is valid.  Inline uniform block and acceleration structure writes keep their
+        // data in the pNext chain, so they are written without it and dropped by the replay.
+        switch (write.descriptorType) {
+            case VK_DESCRIPTOR_TYPE_SAMPLER:
+            case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+            case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+            case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+            case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+                record->WriteArray(write.pImageInfo, write.descriptorCount);
+                break;
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+                record->WriteArray(write.pBufferInfo, write.descriptorCount);
+                break;
+            case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                record->WriteHandles(write.pTexelBufferView, write.descriptorCount);
+                break;
+            default:
+                break;
+        }
+    }
+    record->WriteArray(pDescriptorCopies, descriptorCopyCount);
+}
+
+void ApiCapture::PostCallRecordCreateRenderPass(VkDevice device, const VkRenderPassCreateInfo *pCreateInfo,
+                                                const VkAllocationCallbacks *pAllocator, VkRenderPass *pRenderPass,
+                                                VkResult result) {
+    if (result != VK_SUCCESS) return;
+    Record record(*writer_, api_capture::kCreateRenderPass);
+    record->Write(*pCreateInfo);
+    record->WriteArray(pCreateInfo->pAttachments, pCreateInfo->attachmentCount);
+    for (uint32_t i = 0; i < pCreateInfo->subpassCount; ++i) {
+        const auto &subpass = pCreateInfo->pSubpasses[i];
+        record->Write(subpass);
+        record->WriteArray(subpass.pInputAttachments, subpass.inputAttachmentCount);
+        record->WriteArray(subpass.pColorAttachments, subpass.colorAttachmentCount);
+        record->WriteArray(subpass.pResolveAttachments, subpass.colorAttachmentCount);
+        record->WriteOptional(subpass.pDepthStencilAttachment);
+        record->WriteArray(subpass.pPreserveAttachments, subpass.preserveAttachmentCount);
+    }
+    record->WriteArray(pCreateInfo->pDependencies, pCreateInfo->dependencyCount);
+    record->WriteHandle(*pRenderPass);
+}
+
+void ApiCapture::PostCallRecordDestroyRenderPass(VkDevice device, VkRenderPass renderPass,
+                                                 const VkAllocationCallbacks *pAllocator) {
+    Record record(*writer_, api_capture::kDestroyRenderPass);
+    record->WriteHandle(renderPass);
+}
+
+void ApiCapture::PostCallRecordCreateFramebuffer(VkDevice device, const VkFramebufferCreateInfo *pCreateInfo,
+                                                 const VkAllocationCallbacks *pAllocator, VkFramebuffer *pFramebuffer,
+                                                 VkResult result) {
+    if (result != VK_SUCCESS) return;
+    const bool imageless = (pCreateInfo->flags & VK_FRAMEBUFFER_CREATE_IMAGELESS_BIT) != 0;
+    Record record(*writer_, api_capture::kCreateFramebuffer);
+    record->Write(*pCreateInfo);
+    record->WriteHandles(pCreateInfo->pAttachments, imageless ? 0 : pCreateInfo->attachmentCount);
+    record->WriteHandle(*pFramebuffer);
+}
+
+void ApiCapture::PostCallRecordDestroyFramebuffer(VkDevice device, VkFramebuffer framebuffer,
+                                                  const VkAllocationCallbacks *pAllocator) {
+    Record record(*writer_, api_capture::kDestroyFramebuffer);
+    record->WriteHandle(framebuffer);
+}
+
+void ApiCapture::PostCallRecordCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount,
+                                                       const VkGraphicsPipelineCreateInfo *pCreateInfos,
+                                                       const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
+                                                       VkResult result) {
+    if (result != VK_SUCCESS) return;
+    Record record(*writer_, api_capture::kCreateGraphicsPipelines);
+    record->Write(createInfoCount);
+    for (uint32_t i = 0; i < createInfoCount; ++i) {
+        const auto &create_info = pCreateInfos[i];
+        record->Write(create_info);
+        bool tessellation = false;
+        for (uint32_t stage = 0; stage < create_info.stageCount; ++stage) {
+            WriteShaderStage(create_info.pStages[stage]);
+            tessellation |= (create_info.pStages[stage].stage == VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT);
+        }
+        // The states that are ignored, and so may be invalid pointers, are written as absent
+        const auto *rasterization = create_info.pRasterizationState;
+        const bool rasterizes = rasterization && !rasterization->rasterizerDiscardEnable;
+        const auto *vertex_input = create_info.pVertexInputState;
+        record->WriteOptional(vertex_input);
+        if (vertex_input) {
+            record->WriteArray(vertex_input->pVertexBindingDescriptions, vertex_input->vertexBindingDescriptionCount);
+            record->WriteArray(vertex_input->pVertexAttributeDescriptions, vertex_input->vertexAttributeDescriptionCount);
+        }
+        record->WriteOptional(create_info.pInputAssemblyState);
+        record->WriteOptional(tessellation ? create_info.pTessellationState : nullptr);
+        const auto *viewport = rasterizes ? create_info.pViewportState : nullptr;
+        record->WriteOptional(viewport);
+        if (viewport) {
+            record->WriteArray(viewport->pViewports, viewport->viewportCount);
+            record->WriteArray(viewport->pScissors, viewport->scissorCount);
+        }
+        record->WriteOptional(rasterization);
+        const auto *multisample = rasterizes ? create_info.pMultisampleState : nullptr;
+        record->WriteOptional(multisample);
+        if (multisample) {
+            record->WriteArray(multisample->pSampleMask, (static_cast<uint32_t>(multisample->rasterizationSamples) + 31) / 32);
+        }
+        record->WriteOptional(rasterizes ? create_info.pDepthStencilState : nullptr);
+        const auto *color_blend = rasterizes ? create_info.pColorBlendState : nullptr;
+        record->WriteOptional(color_blend);
+        if (color_blend) record->WriteArray(color_blend->pAttachments, color_blend->attachmentCount);
+        const auto *dynamic = create_info.pDynamicState;
+        record->WriteOptional(dynamic);
+        if (dynamic) record->WriteArray(dynamic->pDynamicStates, dynamic->dynamicStateCount);
+    }
+    record->WriteHandles(pPipelines, createInfoCount);
+}
+
+void ApiCapture::PostCallRecordCreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount,
+                                                      const VkComputePipelineCreateInfo *pCreateInfos,
+                                                      const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
+                                                      VkResult result) {
+    if (result != VK_SUCCESS) return;
+    Record record(*writer_, api_capture::kCreateComputePipelines);
+    record->Write(createInfoCount);
+    for (uint32_t i = 0; i < createInfoCount; ++i) {
+        record->Write(pCreateInfos[i]);
+        WriteShaderStage(pCreateInfos[i].stage);
+    }
+    record->WriteHandles(pPipelines, createInfoCount);
+}
+
+void ApiCapture::PostCallRecordDestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks *pAllocator) {
+    Record record(*writer_, api_capture::kDestroyPipeline);
+    record->WriteHandle(pipeline);
+}
+
+void ApiCapture::PostCallRecordCreateFence(VkDevice device, const VkFenceCreateInfo *pCreateInfo,
+                                           const VkAllocationCallbacks *pAllocator, VkFence *pFence, VkResult result) {
+    if (result != VK_SUCCESS) return;
+    Record record(*writer_, api_capture::kCreateFence);
+    record->Write(*pCreateInfo);
+    record->WriteHandle(*pFence);
+}
+
+void ApiCapture::PostCallRecordDestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks *pAllocator) {
+    Record record(*writer_, api_capture::kDestroyFence);
+    record->WriteHandle(fence);
+}
+
+void ApiCapture::PostCallRecordResetFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences, VkResult result) {
+    if (result != VK_SUCCESS) return;
+    Record record(*writer_, api_capture::kResetFences);
+    record->WriteHandles(pFences, fenceCount);
+}
+
+void ApiCapture::PostCallRecordWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences, VkBool32 waitAll,
+                                             uint64_t timeout, VkResult result) {
+    Record record(*writer_, api_capture::kWaitForFences);
+    record->WriteHandles(pFences, fenceCount);
+    record->Write(waitAll);
+    record->Write(timeout);
+}
+
+void ApiCapture::PostCallRecordCreateCommandPool(VkDevice device, const VkCommandPoolCreateInfo *pCreateInfo,
+                                                 const VkAllocationCallbacks *pAllocator, VkCommandPool *pCommandPool,
+                                                 VkResult result) {
+    if (result != VK_SUCCESS) return;
+    Record record(*writer_, api_capture::kCreateCommandPool);
+    record->Write(*pCreateInfo);
+    record->WriteHandle(*pCommandPool);
+}
+
+void ApiCapture::PostCallRecordDestroyCommandPool(VkDevice device, VkCommandPool commandPool,
+                                                  const VkAllocationCallbacks *pAllocator) {
+    Record record(*writer_, api_capture::kDestroyCommandPool);
+    record->WriteHandle(commandPool);
+}
+
+void ApiCapture::PostCallRecordResetCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags flags,
+                                                VkResult result) {
+    if (result != VK_SUCCESS) return;
+    Record record(*writer_, api_capture::kResetCommandPool);
+    record->WriteHandle(commandPool);
+    record->Write(flags);
+}
+
+void ApiCapture::PostCallRecordAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo *pAllocateInfo,
+                                                      VkCommandBuffer *pCommandBuffers, VkResult result) {
+    if (result != VK_SUCCESS) return;
+    if (pAllocateInfo->level == VK_COMMAND_BUFFER_LEVEL_SECONDARY) {
+        secondary_command_buffers_.insert(pCommandBuffers, pCommandBuffers + pAllocateInfo->commandBufferCount);
+    }
+    Record record(*writer_, api_capture::kAllocateCommandBuffers);
+    record->Write(*pAllocateInfo);
+    record->WriteHandles(pCommandBuffers, pAllocateInfo->commandBufferCount);
+}
+
+void ApiCapture::PostCallRecordFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount,
+                                                  const VkCommandBuffer *pCommandBuffers) {
+    for (uint32_t i = 0; i < commandBufferCount; ++i) secondary_command_buffers_.erase(pCommandBuffers[i]);
+    Record record(*writer_, api_capture::kFreeCommandBuffers);
+    record->WriteHandle(commandPool);
+    record->WriteHandles(pCommandBuffers, commandBufferCount);
+}
+
+void ApiCapture::PostCallRecordBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo *pBeginInfo,
+                                                  VkResult result) {
+    if (result != VK_SUCCESS) return;
+    // The inheritance info of a primary command buffer is ignored, and may be an invalid pointer
+    const bool secondary = secondary_command_buffers_.count(commandBuffer) != 0;
+    Record record(*writer_, api_capture::kBeginCommandBuffer);
+    record->WriteHandle(commandBuffer);
+    record->Write(*pBeginInfo);
+    record->WriteOptional(secondary ? pBeginInfo->pInheritanceInfo : nullptr);
+}
+
+void ApiCapture::PostCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer, VkResult result) {
+    Record record(*writer_, api_capture::kEndCommandBuffer);
+    record->WriteHandle(commandBuffer);
+}
+
+void ApiCapture::PostCallRecordResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags,
+                                                  VkResult result) {
+    if (result != VK_SUCCESS) return;
+    Record record(*writer_, api_capture::kResetCommandBuffer);
+    record->WriteHandle(commandBuffer);
+    record->Write(flags);
+}
+
+void ApiCapture::PostCallRecordCmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
+                                               VkPipeline pipeline) {
+    Record record(*writer_, api_capture::kCmdBindPipeline);
+    record->WriteHandle(commandBuffer);
+    record->Write(pipelineBindPoint);
+    record->WriteHandle(pipeline);
+}
+
+void ApiCapture::PostCallRecordCmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount,
+                                              const VkViewport *pViewports) {
+    Record record(*writer_, api_capture::kCmdSetViewport);
+    record->WriteHandle(commandBuffer);
+    record->Write(firstViewport);
+    record->WriteArray(pViewports, viewportCount);
+}
+
+void ApiCapture::PostCallRecordCmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount,
+                                             const VkRect2D *pScissors) {
+    Record record(*writer_, api_capture::kCmdSetScissor);
+    record->WriteHandle(commandBuffer);
+    record->Write(firstScissor);
+    record->WriteArray(pScissors, scissorCount);
+}
+
+void ApiCapture::PostCallRecordCmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
+                                                     VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount,
+                                                     const VkDescriptorSet *pDescriptorSets, uint32_t dynamicOffsetCount,
+                                                     const uint32_t *pDynamicOffsets) {
+    Record record(*writer_, api_capture::kCmdBindDescriptorSets);
+    record->WriteHandle(commandBuffer);
+    record->Write(pipelineBindPoint);
+    record->WriteHandle(layout);
+    record->Write(firstSet);
+    record->WriteHandles(pDescriptorSets, descriptorSetCount);
+    record->WriteArray(pDynamicOffsets, dynamicOffsetCount);
+}
+
+void ApiCapture::PostCallRecordCmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
+                                                  VkIndexType indexType) {
+    Record record(*writer_, api_capture::kCmdBindIndexBuffer);
+    record->WriteHandle(commandBuffer);
+    record->WriteHandle(buffer);
+    record->Write(offset);
+    record->Write(indexType);
+}
+
+void ApiCapture::PostCallRecordCmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount,
+                                                    const VkBuffer *pBuffers, const VkDeviceSize *pOffsets) {
+    Record record(*writer_, api_capture::kCmdBindVertexBuffers);
+    record->WriteHandle(commandBuffer);
+    record->Write(firstBinding);
+    record->WriteHandles(pBuffers, bindingCount);
+    record->WriteArray(pOffsets, bindingCount);
+}
+
+void ApiCapture::PostCallRecordCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount,
+                                       uint32_t firstVertex, uint32_t firstInstance) {
+    Record record(*writer_, api_capture::kCmdDraw);
+    record->WriteHandle(commandBuffer);
+    record->Write(vertexCount);
+    record->Write(instanceCount);
+    record->Write(firstVertex);
+    record->Write(firstInstance);
+}
+
+void ApiCapture::PostCallRecordCmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount,
+                                              uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) {
+    Record record(*writer_, api_capture::kCmdDrawIndexed);
+    record->WriteHandle(commandBuffer);
+    record->Write(indexCount);
+    record->Write(instanceCount);
+    record->Write(firstIndex);
+    record->Write(vertexOffset);
+    record->Write(firstInstance);
+}
+
+void ApiCapture::PostCallRecordCmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
+                                               uint32_t drawCount, uint32_t stride) {
+    Record record(*writer_, api_capture::kCmdDrawIndirect);
+    record->WriteHandle(commandBuffer);
+    record->WriteHandle(buffer);
+    record->Write(offset);
+    record->Write(drawCount);
+    record->Write(stride);
+}
+
+void ApiCapture::PostCallRecordCmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
+                                                      uint32_t drawCount, uint32_t stride) {
+    Record record(*writer_, api_capture::kCmdDrawIndexedIndirect);
+    record->WriteHandle(commandBuffer);
+    record->WriteHandle(buffer);
+    record->Write(offset);
+    record->Write(drawCount);
+    record->Write(stride);
+}
+
+void ApiCapture::PostCallRecordCmdDispatch(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY,
+                                           uint32_t groupCountZ) {
+    Record record(*writer_, api_capture::kCmdDispatch);
+    record->WriteHandle(commandBuffer);
+    record->Write(groupCountX);
+    record->Write(groupCountY);
+    record->Write(groupCountZ);
+}
+
+void ApiCapture::PostCallRecordCmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset) {
+    Record record(*writer_, api_capture::kCmdDispatchIndirect);
+    record->WriteHandle(commandBuffer);
+    record->WriteHandle(buffer);
+    record->Write(offset);
+}
+
+void ApiCapture::PostCallRecordCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer,
+                                             uint32_t regionCount, const VkBufferCopy *pRegions) {
+    Record record(*writer_, api_capture::kCmdCopyBuffer);
+    record->WriteHandle(commandBuffer);
+    record->WriteHandle(srcBuffer);
+    record->WriteHandle(dstBuffer);
+    record->WriteArray(pRegions, regionCount);
+}
+
+void ApiCapture::PostCallRecordCmdCopyImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout,
+                                            VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
+                                            const VkImageCopy *pRegions) {
+    Record record(*writer_, api_capture::kCmdCopyImage);
+    record->WriteHandle(commandBuffer);
+    record->WriteHandle(srcImage);
+    record->Write(srcImageLayout);
+    record->WriteHandle(dstImage);
+    record->Write(dstImageLayout);
+    record->WriteArray(pRegions, regionCount);
+}
+
+void ApiCapture::PostCallRecordCmdBlitImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout,
+                                            VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
+                                            const VkImageBlit *pRegions, VkFilter filter) {
+    Record record(*writer_, api_capture::kCmdBlitImage);
+    record->WriteHandle(commandBuffer);
+    record->WriteHandle(srcImage);
+    record->Write(srcImageLayout);
+    record->WriteHandle(dstImage);
+    record->Write(dstImageLayout);
+    record->WriteArray(pRegions, regionCount);
+    record->Write(filter);
+}
+
+void ApiCapture::PostCallRecordCmdCopyBufferToImage(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage,
+                                                    VkImageLayout dstImageLayout, uint32_t regionCount,
+                                                    const VkBufferImageCopy *pRegions) {
+    Record record(*writer_, api_capture::kCmdCopyBufferToImage);
+    record->WriteHandle(commandBuffer);
+    record->WriteHandle(srcBuffer);
+    record->WriteHandle(dstImage);
+    record->Write(dstImageLayout);
+    record->WriteArray(pRegions, regionCount);
+}
+
+void ApiCapture::PostCallRecordCmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout,
+                                                    VkBuffer dstBuffer, uint32_t regionCount, const VkBufferImageCopy *pRegions) {
+    Record record(*writer_, api_capture::kCmdCopyImageToBuffer);
+    record->WriteHandle(commandBuffer);
+    record->WriteHandle(srcImage);
+    record->Write(srcImageLayout);
+    record->WriteHandle(dstBuffer);
+    record->WriteArray(pRegions, regionCount);
+}
+
+void ApiCapture::PostCallRecordCmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
+                                               VkDeviceSize dataSize, const void *pData) {
+    Record record(*writer_, api_capture::kCmdUpdateBuffer);
+    record->WriteHandle(commandBuffer);
+    record->WriteHandle(dstBuffer);
+    record->Write(dstOffset);
+    record->WriteArray(static_cast<const uint8_t *>(pData), static_cast<uint32_t>(dataSize));
+}
+
+void ApiCapture::PostCallRecordCmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
+                                             VkDeviceSize size, uint32_t data) {
+    Record record(*writer_, api_capture::kCmdFillBuffer);
+    record->WriteHandle(commandBuffer);
+    record->WriteHandle(dstBuffer);
+    record->Write(dstOffset);
+    record->Write(size);
+    record->Write(data);
+}
+
+void ApiCapture::PostCallRecordCmdClearColorImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout,
+                                                  const VkClearColorValue *pColor, uint32_t rangeCount,
+                                                  const VkImageSubresourceRange *pRanges) {
+    Record record(*writer_, api_capture::kCmdClearColorImage);
+    record->WriteHandle(commandBuffer);
+    record->WriteHandle(image);
+    record->Write(imageLayout);
+    record->Write(*pColor);
+    record->WriteArray(pRanges, rangeCount);
+}
+
+void ApiCapture::PostCallRecordCmdClearAttachments(VkCommandBuffer commandBuffer, uint32_t attachmentCount,
+                                                   const VkClearAttachment *pAttachments, uint32_t rectCount,
+                                                   const VkClearRect *pRects) {
+    Record record(*writer_, api_capture::kCmdClearAttachments);
+    record->WriteHandle(commandBuffer);
+    record->WriteArray(pAttachments, attachmentCount);
+    record->WriteArray(pRects, rectCount);
+}
+
+void ApiCapture::PostCallRecordCmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask,
+                                                  VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags,
+                                                  uint32_t memoryBarrierCount, const VkMemoryBarrier *pMemoryBarriers,
+                                                  uint32_t bufferMemoryBarrierCount,
+                                                  const VkBufferMemoryBarrier *pBufferMemoryBarriers,
+                                                  uint32_t imageMemoryBarrierCount,
+                                                  const VkImageMemoryBarrier *pImageMemoryBarriers) {
+    Record record(*writer_, api_capture::kCmdPipelineBarrier);
+    record->WriteHandle(commandBuffer);
+    record->Write(srcStageMask);
+    record->Write(dstStageMask);
+    record->Write(dependencyFlags);
+    record->WriteArray(pMemoryBarriers, memoryBarrierCount);
+    record->WriteArray(pBufferMemoryBarriers, bufferMemoryBarrierCount);
+    record->WriteArray(pImageMemoryBarriers, imageMemoryBarrierCount);
+}
+
+void ApiCapture::PostCallRecordCmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout,
+                                                VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size,
+                                                const void *pValues) {
+    Record record(*writer_, api_capture::kCmdPushConstants);
+    record->WriteHandle(commandBuffer);
+    record->WriteHandle(layout);
+    record->Write(stageFlags);
+    record->Write(offset);
+    record->WriteArray(static_cast<const uint8_t *>(pValues), size);
+}
+
+void ApiCapture::PostCallRecordCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
+                                                  VkSubpassContents contents) {
+    Record record(*writer_, api_capture::kCmdBeginRenderPass);
+    record->WriteHandle(commandBuffer);
+    record->Write(*pRenderPassBegin);
+    record->WriteArray(pRenderPassBegin->pClearValues, pRenderPassBegin->clearValueCount);
+    record->Write(contents);
+}
+
+void ApiCapture::PostCallRecordCmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents) {
+    Record record(*writer_, api_capture::kCmdNextSubpass);
+    record->WriteHandle(commandBuffer);
+    record->Write(contents);
+}
+
+void ApiCapture::PostCallRecordCmdEndRenderPass(VkCommandBuffer commandBuffer) {
+    Record record(*writer_, api_capture::kCmdEndRenderPass);
+    record->WriteHandle(commandBuffer);
+}
+
+void ApiCapture::PostCallRecordCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount,
+                                                  const VkCommandBuffer *pCommandBuffers) {
+    Record record(*writer_, api_capture::kCmdExecuteCommands);
+    record->WriteHandle(commandBuffer);
+    record->WriteHandles(pCommandBuffers, commandBufferCount);
+}
+
+void ApiCapture::PostCallRecordCreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR *pCreateInfo,
+                                                  const VkAllocationCallbacks *pAllocator, VkSwapchainKHR *pSwapchain,
+                                                  VkResult result) {
+    if (result != VK_SUCCESS) return;
+    Record record(*writer_, api_capture::kCreateSwapchainKHR);
+    record->Write(*pCreateInfo);
+    record->WriteHandle(*pSwapchain);
+}
+
+void ApiCapture::PostCallRecordGetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t *pSwapchainImageCount,
+                                                     VkImage *pSwapchainImages, VkResult result) {
+    if (!pSwapchainImages || ((result != VK_SUCCESS) && (result != VK_INCOMPLETE))) return;
+    Record record(*writer_, api_capture::kGetSwapchainImagesKHR);
+    record->WriteHandle(swapchain);
+    record->WriteHandles(pSwapchainImages, *pSwapchainImageCount);
+}
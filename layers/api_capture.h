@@ -0,0 +1,234 @@
+/* Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "chassis.h"
+#include "api_capture_stream.h"
+
+// Writes the device level calls of an application to a file, for replay through the layer by the benchmarks (see
+// docs/layer_performance.md), so that validation overhead can be profiled without the application or its GPU.
+//
+// Enabled by VALIDATION_CHECK_ENABLE_API_CAPTURE, for the first device the process creates; the file is named by the
+// khronos_validation.capture_file setting.  The calls are recorded in PostCallRecord, after the driver succeeded, in the
+// order the validation object's lock is taken.  The captured calls are those of resource, descriptor, pipeline and render
+// pass creation, command buffer recording and queue submission listed in api_capture::Command, without pNext chains.
+// Semaphores, events and queries aren't captured, and swapchain images are captured as the images the replay creates in
+// their place.
+class ApiCapture : public ValidationObject {
+  public:
+    explicit ApiCapture(const VkDeviceCreateInfo *pCreateInfo);
+    virtual ~ApiCapture() {}
+
+    void InitDeviceValidationObject(bool add_obj, ValidationObject *inst_obj, ValidationObject *dev_obj) override;
+
+    void PostCallRecordGetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue *pQueue) override;
+    void PostCallRecordDeviceWaitIdle(VkDevice device, VkResult result) override;
+    void PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence,
+                                   VkResult result) override;
+    void PostCallRecordQueueWaitIdle(VkQueue queue, VkResult result) override;
+
+    void PostCallRecordAllocateMemory(VkDevice device, const VkMemoryAllocateInfo *pAllocateInfo,
+                                      const VkAllocationCallbacks *pAllocator, VkDeviceMemory *pMemory, VkResult result) override;
+    void PostCallRecordFreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks *pAllocator) override;
+    void PostCallRecordCreateBuffer(VkDevice device, const VkBufferCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator,
+                                    VkBuffer *pBuffer, VkResult result) override;
+    void PostCallRecordDestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks *pAllocator) override;
+    void PostCallRecordBindBufferMemory(VkDevice device, VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset,
+                                        VkResult result) override;
+    void PostCallRecordCreateBufferView(VkDevice device, const VkBufferViewCreateInfo *pCreateInfo,
+                                        const VkAllocationCallbacks *pAllocator, VkBufferView *pView, VkResult result) override;
+    void PostCallRecordDestroyBufferView(VkDevice device, VkBufferView bufferView,
+                                         const VkAllocationCallbacks *pAllocator) override;
+    void PostCallRecordCreateImage(VkDevice device, const VkImageCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator,
+                                   VkImage *pImage, VkResult result) override;
+    void PostCallRecordDestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks *pAllocator) override;
+    void PostCallRecordBindImageMemory(VkDevice device, VkImage image, VkDeviceMemory memory, VkDeviceSize memoryOffset,
+                                       VkResult result) override;
+    void PostCallRecordCreateImageView(VkDevice device, const VkImageViewCreateInfo *pCreateInfo,
+                                       const VkAllocationCallbacks *pAllocator, VkImageView *pView, VkResult result) override;
+    void PostCallRecordDestroyImageView(VkDevice device, VkImageView imageView, const VkAllocationCallbacks *pAllocator) override;
+    void PostCallRecordCreateSampler(VkDevice device, const VkSamplerCreateInfo *pCreateInfo,
+                                     const VkAllocationCallbacks *pAllocator, VkSampler *pSampler, VkResult result) override;
+    void PostCallRecordDestroySampler(VkDevice device, VkSampler sampler, const VkAllocationCallbacks *pAllocator) override;
+    void PostCallRecordCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo *pCreateInfo,
+                                          const VkAllocationCallbacks *pAllocator, VkShaderModule *pShaderModule,
+                                          VkResult result) override;
+    void PostCallRecordDestroyShaderModule(VkDevice device, VkShaderModule shaderModule,
+                                           const VkAllocationCallbacks *pAllocator) override;
+    void PostCallRecordCreateDescriptorSetLayout(VkDevice device, const VkDescriptorSetLayoutCreateInfo *pCreateInfo,
+                                                 const VkAllocationCallbacks *pAllocator, VkDescriptorSetLayout *pSetLayout,
+                                                 VkResult result) override;
+    void PostCallRecordDestroyDescriptorSetLayout(VkDevice device, VkDescriptorSetLayout descriptorSetLayout,
+                                                  const VkAllocationCallbacks *pAllocator) override;
+    void PostCallRecordCreatePipelineLayout(VkDevice device, const VkPipelineLayoutCreateInfo *pCreateInfo,
+                                            const VkAllocationCallbacks *pAllocator, VkPipelineLayout *pPipelineLayout,
+                                            VkResult result) override;
+    void PostCallRecordDestroyPipelineLayout(VkDevice device, VkPipelineLayout pipelineLayout,
+                                             const VkAllocationCallbacks *pAllocator) override;
+    void PostCallRecordCreateDescriptorPool(VkDevice device, const VkDescriptorPoolCreateInfo *pCreateInfo,
+                                            const VkAllocationCallbacks *pAllocator, VkDescriptorPool *pDescriptorPool,
+                                            VkResult result) override;
+    void PostCallRecordDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
+                                             const VkAllocationCallbacks *pAllocator) override;
+    void PostCallRecordResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, VkDescriptorPoolResetFlags flags,
+                                           VkResult result) override;
+    void PostCallRecordAllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo *pAllocateInfo,
+                                              VkDescriptorSet *pDescriptorSets, VkResult result) override;
+    void PostCallRecordFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount,
+                                          const VkDescriptorSet *pDescriptorSets, VkResult result) override;
+    void PostCallRecordUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount,
+                                            const VkWriteDescriptorSet *pDescriptorWrites, uint32_t descriptorCopyCount,
+                                            const VkCopyDescriptorSet *pDescriptorCopies) override;
+    void PostCallRecordCreateRenderPass(VkDevice device, const VkRenderPassCreateInfo *pCreateInfo,
+                                        const VkAllocationCallbacks *pAllocator, VkRenderPass *pRenderPass,
+                                        VkResult result) override;
+    void PostCallRecordDestroyRenderPass(VkDevice device, VkRenderPass renderPass,
+                                         const VkAllocationCallbacks *pAllocator) override;
+    void PostCallRecordCreateFramebuffer(VkDevice device, const VkFramebufferCreateInfo *pCreateInfo,
+                                         const VkAllocationCallbacks *pAllocator, VkFramebuffer *pFramebuffer,
+                                         VkResult result) override;
+    void PostCallRecordDestroyFramebuffer(VkDevice device, VkFramebuffer framebuffer,
+                                          const VkAllocationCallbacks *pAllocator) override;
+    void PostCallRecordCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount,
+                                               const VkGraphicsPipelineCreateInfo *pCreateInfos,
+                                               const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
+                                               VkResult result) override;
+    void PostCallRecordCreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount,
+                                              const VkComputePipelineCreateInfo *pCreateInfos,
+                                              const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
+                                              VkResult result) override;
+    void PostCallRecordDestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks *pAllocator) override;
+    void PostCallRecordCreateFence(VkDevice device, const VkFenceCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator,
+                                   VkFence *pFence, VkResult result) override;
+    void PostCallRecordDestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks *pAllocator) override;
+    void PostCallRecordResetFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences, VkResult result) override;
+    void PostCallRecordWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences, VkBool32 waitAll,
+                                     uint64_t timeout, VkResult result) override;
+    void PostCallRecordCreateCommandPool(VkDevice device, const VkCommandPoolCreateInfo *pCreateInfo,
+                                         const VkAllocationCallbacks *pAllocator, VkCommandPool *pCommandPool,
+                                         VkResult result) override;
+    void PostCallRecordDestroyCommandPool(VkDevice device, VkCommandPool commandPool,
+                                          const VkAllocationCallbacks *pAllocator) override;
+    void PostCallRecordResetCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags flags,
+                                        VkResult result) override;
+    void PostCallRecordAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo *pAllocateInfo,
+                                              VkCommandBuffer *pCommandBuffers, VkResult result) override;
+    void PostCallRecordFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount,
+                                          const VkCommandBuffer *pCommandBuffers) override;
+    void PostCallRecordBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo *pBeginInfo,
+                                          VkResult result) override;
+    void PostCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer, VkResult result) override;
+    void PostCallRecordResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags, VkResult result) override;
+
+    void PostCallRecordCmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
+                                       VkPipeline pipeline) override;
+    void PostCallRecordCmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount,
+                                      const VkViewport *pViewports) override;
+    void PostCallRecordCmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount,
+                                     const VkRect2D *pScissors) override;
+    void PostCallRecordCmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
+                                             VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount,
+                                             const VkDescriptorSet *pDescriptorSets, uint32_t dynamicOffsetCount,
+                                             const uint32_t *pDynamicOffsets) override;
+    void PostCallRecordCmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
+                                          VkIndexType indexType) override;
+    void PostCallRecordCmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount,
+                                            const VkBuffer *pBuffers, const VkDeviceSize *pOffsets) override;
+    void PostCallRecordCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex,
+                               uint32_t firstInstance) override;
+    void PostCallRecordCmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount,
+                                      uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) override;
+    void PostCallRecordCmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount,
+                                       uint32_t stride) override;
+    void PostCallRecordCmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
+                                              uint32_t drawCount, uint32_t stride) override;
+    void PostCallRecordCmdDispatch(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY,
+                                   uint32_t groupCountZ) override;
+    void PostCallRecordCmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset) override;
+    void PostCallRecordCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount,
+                                     const VkBufferCopy *pRegions) override;
+    void PostCallRecordCmdCopyImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout,
+                                    VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
+                                    const VkImageCopy *pRegions) override;
+    void PostCallRecordCmdBlitImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout,
+                                    VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
+                                    const VkImageBlit *pRegions, VkFilter filter) override;
+    void PostCallRecordCmdCopyBufferToImage(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage,
+                                            VkImageLayout dstImageLayout, uint32_t regionCount,
+                                            const VkBufferImageCopy *pRegions) override;
+    void PostCallRecordCmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout,
+                                            VkBuffer dstBuffer, uint32_t regionCount, const VkBufferImageCopy *pRegions) override;
+    void PostCallRecordCmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
+                                       VkDeviceSize dataSize, const void *pData) override;
+    void PostCallRecordCmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize size,
+                                     uint32_t data) override;
+    void PostCallRecordCmdClearColorImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout,
+                                          const VkClearColorValue *pColor, uint32_t rangeCount,
+                                          const VkImageSubresourceRange *pRanges) override;
+    void PostCallRecordCmdClearAttachments(VkCommandBuffer commandBuffer, uint32_t attachmentCount,
+                                           const VkClearAttachment *pAttachments, uint32_t rectCount,
+                                           const VkClearRect *pRects) override;
+    void PostCallRecordCmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask,
+                                          VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags,
+                                          uint32_t memoryBarrierCount, const VkMemoryBarrier *pMemoryBarriers,
+                                          uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier *pBufferMemoryBarriers,
+                                          uint32_t imageMemoryBarrierCount,
+                                          const VkImageMemoryBarrier *pImageMemoryBarriers) override;
+    void PostCallRecordCmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags,
+                                        uint32_t offset, uint32_t size, const void *pValues) override;
+    void PostCallRecordCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
+                                          VkSubpassContents contents) override;
+    void PostCallRecordCmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents) override;
+    void PostCallRecordCmdEndRenderPass(VkCommandBuffer commandBuffer) override;
+    void PostCallRecordCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount,
+                                          const VkCommandBuffer *pCommandBuffers) override;
+
+    void PostCallRecordCreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR *pCreateInfo,
+                                          const VkAllocationCallbacks *pAllocator, VkSwapchainKHR *pSwapchain,
+                                          VkResult result) override;
+    void PostCallRecordGetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t *pSwapchainImageCount,
+                                             VkImage *pSwapchainImages, VkResult result) override;
+
+  private:
+    // The writer appends the record, and ends it when the scope closes
+    class Record {
+      public:
+        Record(api_capture::Writer &writer, api_capture::Command command) : writer_(writer) { writer_.BeginRecord(command); }
+        ~Record() { writer_.EndRecord(); }
+        Record(const Record &) = delete;
+        Record &operator=(const Record &) = delete;
+        api_capture::Writer *operator->() const { return &writer_; }
+
+      private:
+        api_capture::Writer &writer_;
+    };
+
+    void WriteShaderStage(const VkPipelineShaderStageCreateInfo &stage);
+
+    std::vector<std::string> enabled_extensions_;
+    std::unique_ptr<VkPhysicalDeviceFeatures> enabled_features_;
+    VkPhysicalDeviceMemoryProperties memory_properties_ = {};
+    // Only secondary command buffers have an inheritance info to write
+    std::unordered_set<VkCommandBuffer> secondary_command_buffers_;
+    std::unique_ptr<api_capture::Writer> writer_;
+};
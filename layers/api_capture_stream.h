@@ -0,0 +1,427 @@
+/* Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+// Binary stream of captured device level API calls, written by the ApiCapture validation object and read back by the replay
+// benchmark.
+//
+// The stream starts with kCaptureMagic and kCaptureVersion, followed by one record per call: the Command, the size of the
+// payload in bytes and the payload.  Structures are stored as their raw bytes followed by the arrays they point to, each with
+// its length, in member order, so the reader copies each structure and then patches its pointers; pNext chains are not
+// stored.  Handles are stored with their values at capture time and are mapped to the replay's handles as they are read.
+// Values keep the byte order and sizes of the capturing process, so a capture replays only on the same architecture.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "vulkan/vulkan.h"
+#include "cast_utils.h"
+
+namespace api_capture {
+
+const uint32_t kCaptureMagic = 0x5043564c;  // "LVCP"
+const uint32_t kCaptureVersion = 1;
+
+enum Command : uint32_t {
+    kDevice = 0,  // The enabled extensions and features of the captured device
+    kGetDeviceQueue,
+    kDeviceWaitIdle,
+    kQueueSubmit,
+    kQueueWaitIdle,
+    kAllocateMemory,
+    kFreeMemory,
+    kCreateBuffer,
+    kDestroyBuffer,
+    kBindBufferMemory,
+    kCreateBufferView,
+    kDestroyBufferView,
+    kCreateImage,
+    kDestroyImage,
+    kBindImageMemory,
+    kCreateImageView,
+    kDestroyImageView,
+    kCreateSampler,
+    kDestroySampler,
+    kCreateShaderModule,
+    kDestroyShaderModule,
+    kCreateDescriptorSetLayout,
+    kDestroyDescriptorSetLayout,
+    kCreatePipelineLayout,
+    kDestroyPipelineLayout,
+    kCreateDescriptorPool,
+    kDestroyDescriptorPool,
+    kResetDescriptorPool,
+    kAllocateDescriptorSets,
+    kFreeDescriptorSets,
+    kUpdateDescriptorSets,
+    kCreateRenderPass,
+    kDestroyRenderPass,
+    kCreateFramebuffer,
+    kDestroyFramebuffer,
+    kCreateGraphicsPipelines,
+    kCreateComputePipelines,
+    kDestroyPipeline,
+    kCreateFence,
+    kDestroyFence,
+    kResetFences,
+    kWaitForFences,
+    kCreateCommandPool,
+    kDestroyCommandPool,
+    kResetCommandPool,
+    kAllocateCommandBuffers,
+    kFreeCommandBuffers,
+    kBeginCommandBuffer,
+    kEndCommandBuffer,
+    kResetCommandBuffer,
+    kCmdBindPipeline,
+    kCmdSetViewport,
+    kCmdSetScissor,
+    kCmdBindDescriptorSets,
+    kCmdBindIndexBuffer,
+    kCmdBindVertexBuffers,
+    kCmdDraw,
+    kCmdDrawIndexed,
+    kCmdDrawIndirect,
+    kCmdDrawIndexedIndirect,
+    kCmdDispatch,
+    kCmdDispatchIndirect,
+    kCmdCopyBuffer,
+    kCmdCopyImage,
+    kCmdBlitImage,
+    kCmdCopyBufferToImage,
+    kCmdCopyImageToBuffer,
+    kCmdUpdateBuffer,
+    kCmdFillBuffer,
+    kCmdClearColorImage,
+    kCmdClearAttachments,
+    kCmdPipelineBarrier,
+    kCmdPushConstants,
+    kCmdBeginRenderPass,
+    kCmdNextSubpass,
+    kCmdEndRenderPass,
+    kCmdExecuteCommands,
+    kCreateSwapchainKHR,     // Replayed as the creation info of ordinary images
+    kGetSwapchainImagesKHR,  // Replayed as the creation of an image per swapchain image
+    kCommandCount,
+};
+
+// Name of the entry point each Command records, for reports
+static const char *const kCommandNames[kCommandCount] = {
+    "vkCreateDevice",
+    "vkGetDeviceQueue",
+    "vkDeviceWaitIdle",
+    "vkQueueSubmit",
+    "vkQueueWaitIdle",
+    "vkAllocateMemory",
+    "vkFreeMemory",
+    "vkCreateBuffer",
+    "vkDestroyBuffer",
+    "vkBindBufferMemory",
+    "vkCreateBufferView",
+    "vkDestroyBufferView",
+    "vkCreateImage",
+    "vkDestroyImage",
+    "vkBindImageMemory",
+    "vkCreateImageView",
+    "vkDestroyImageView",
+    "vkCreateSampler",
+    "vkDestroySampler",
+    "vkCreateShaderModule",
+    "vkDestroyShaderModule",
+    "vkCreateDescriptorSetLayout",
+    "vkDestroyDescriptorSetLayout",
+    "vkCreatePipelineLayout",
+    "vkDestroyPipelineLayout",
+    "vkCreateDescriptorPool",
+    "vkDestroyDescriptorPool",
+    "vkResetDescriptorPool",
+    "vkAllocateDescriptorSets",
+    "vkFreeDescriptorSets",
+    "vkUpdateDescriptorSets",
+    "vkCreateRenderPass",
+    "vkDestroyRenderPass",
+    "vkCreateFramebuffer",
+    "vkDestroyFramebuffer",
+    "vkCreateGraphicsPipelines",
+    "vkCreateComputePipelines",
+    "vkDestroyPipeline",
+    "vkCreateFence",
+    "vkDestroyFence",
+    "vkResetFences",
+    "vkWaitForFences",
+    "vkCreateCommandPool",
+    "vkDestroyCommandPool",
+    "vkResetCommandPool",
+    "vkAllocateCommandBuffers",
+    "vkFreeCommandBuffers",
+    "vkBeginCommandBuffer",
+    "vkEndCommandBuffer",
+    "vkResetCommandBuffer",
+    "vkCmdBindPipeline",
+    "vkCmdSetViewport",
+    "vkCmdSetScissor",
+    "vkCmdBindDescriptorSets",
+    "vkCmdBindIndexBuffer",
+    "vkCmdBindVertexBuffers",
+    "vkCmdDraw",
+    "vkCmdDrawIndexed",
+    "vkCmdDrawIndirect",
+    "vkCmdDrawIndexedIndirect",
+    "vkCmdDispatch",
+    "vkCmdDispatchIndirect",
+    "vkCmdCopyBuffer",
+    "vkCmdCopyImage",
+    "vkCmdBlitImage",
+    "vkCmdCopyBufferToImage",
+    "vkCmdCopyImageToBuffer",
+    "vkCmdUpdateBuffer",
+    "vkCmdFillBuffer",
+    "vkCmdClearColorImage",
+    "vkCmdClearAttachments",
+    "vkCmdPipelineBarrier",
+    "vkCmdPushConstants",
+    "vkCmdBeginRenderPass",
+    "vkCmdNextSubpass",
+    "vkCmdEndRenderPass",
+    "vkCmdExecuteCommands",
+    "vkCreateSwapchainKHR",
+    "vkGetSwapchainImagesKHR",
+};
+
+class Writer {
+  public:
+    explicit Writer(FILE *file) : file_(file) {
+        Write(kCaptureMagic);
+        Write(kCaptureVersion);
+    }
+    ~Writer() {
+        Flush();
+        fclose(file_);
+    }
+
+    void BeginRecord(Command command) {
+        Write(static_cast<uint32_t>(command));
+        record_start_ = buffer_.size();
+        Write(static_cast<uint32_t>(0));
+    }
+    void EndRecord() {
+        const uint32_t size = static_cast<uint32_t>(buffer_.size() - record_start_ - sizeof(uint32_t));
+        memcpy(&buffer_[record_start_], &size, sizeof(size));
+        if (buffer_.size() >= kFlushSize) Flush();
+    }
+
+    template <typename T>
+    void Write(const T &value) {
+        WriteBytes(&value, sizeof(T));
+    }
+    // The number of values, then the values.  A null array is written as empty.
+    template <typename T>
+    void WriteArray(const T *values, uint32_t count) {
+        if (!values) count = 0;
+        Write(count);
+        WriteBytes(values, sizeof(T) * count);
+    }
+    // Whether value is present, then the value
+    template <typename T>
+    void WriteOptional(const T *value) {
+        Write(static_cast<uint32_t>(value != nullptr));
+        if (value) Write(*value);
+    }
+    template <typename HandleType>
+    void WriteHandle(HandleType handle) {
+        Write(CastToUint64(handle));
+    }
+    template <typename HandleType>
+    void WriteHandles(const HandleType *handles, uint32_t count) {
+        if (!handles) count = 0;
+        Write(count);
+        for (uint32_t i = 0; i < count; ++i) WriteHandle(handles[i]);
+    }
+    void WriteString(const char *string) {
+        const uint32_t length = string ? static_cast<uint32_t>(strlen(string)) : 0;
+        Write(length);
+        WriteBytes(string, length);
+    }
+    void WriteBytes(const void *data, size_t size) {
+        if (!size) return;
+        const auto *bytes = static_cast<const uint8_t *>(data);
+        buffer_.insert(buffer_.end(), bytes, bytes + size);
+    }
+
+  private:
+    static const size_t kFlushSize = 1 << 20;
+
+    void Flush() {
+        if (!buffer_.empty()) fwrite(buffer_.data(), 1, buffer_.size(), file_);
+        buffer_.clear();
+    }
+
+    FILE *file_;
+    std::vector<uint8_t> buffer_;
+    size_t record_start_ = 0;
+};
+
+class Reader {
+  public:
+    // Returns false if the file can't be read or isn't a capture of this version
+    bool Open(const char *filename) {
+        FILE *file = fopen(filename, "rb");
+        if (!file) return false;
+        uint8_t chunk[1 << 16];
+        size_t read;
+        while ((read = fread(chunk, 1, sizeof(chunk), file)) > 0) data_.insert(data_.end(), chunk, chunk + read);
+        fclose(file);
+        record_end_ = data_.size();
+        const bool valid = (Read<uint32_t>() == kCaptureMagic) && (Read<uint32_t>() == kCaptureVersion) && !overrun_;
+        next_record_ = offset_;
+        return valid;
+    }
+
+    // Moves to the next record, returning false at the end of the stream or if it is truncated
+    bool NextRecord(Command *command) {
+        arena_.clear();
+        offset_ = next_record_;
+        record_end_ = data_.size();
+        const uint32_t id = Read<uint32_t>();
+        const uint32_t size = Read<uint32_t>();
+        if (overrun_ || (size > data_.size() - offset_) || (id >= kCommandCount)) return false;
+        record_end_ = next_record_ = offset_ + size;
+        *command = static_cast<Command>(id);
+        return true;
+    }
+    // Whether a read went past the end of the current record
+    bool Overrun() const { return overrun_; }
+    size_t RemainingBytes() const { return record_end_ - offset_; }
+
+    template <typename T>
+    T Read() {
+        T value;
+        ReadBytes(&value, sizeof(T));
+        return value;
+    }
+    // A copy of the next array, or null when it is empty, and its length in count if given
+    template <typename T>
+    T *ReadArray(uint32_t *count = nullptr) {
+        uint32_t length = Read<uint32_t>();
+        T *values = length ? ReadValues<T>(length) : nullptr;
+        if (!values) length = 0;
+        if (count) *count = length;
+        return values;
+    }
+    template <typename T>
+    T *ReadOptional() {
+        return Read<uint32_t>() ? ReadValues<T>(1) : nullptr;
+    }
+    // The replay handle for the next captured handle
+    template <typename HandleType>
+    HandleType ReadHandle() {
+        return CastFromUint64<HandleType>(MapCaptured(Read<uint64_t>()));
+    }
+    template <typename HandleType>
+    HandleType *ReadHandles(uint32_t *count = nullptr) {
+        uint32_t length = Read<uint32_t>();
+        const uint64_t *captured = length ? ReadValues<uint64_t>(length) : nullptr;
+        if (!captured) length = 0;
+        if (count) *count = length;
+        if (!captured) return nullptr;
+        HandleType *handles = Allocate<HandleType>(length);
+        for (uint32_t i = 0; i < length; ++i) handles[i] = CastFromUint64<HandleType>(MapCaptured(captured[i]));
+        return handles;
+    }
+    // The captured value of a handle the replayed call creates, to be passed to AddHandle
+    uint64_t ReadNewHandle() { return Read<uint64_t>(); }
+    const char *ReadString() {
+        uint32_t length = Read<uint32_t>();
+        const char *chars = length ? ReadValues<char>(length) : nullptr;
+        if (!chars) length = 0;
+        char *string = Allocate<char>(length + 1);
+        if (length) memcpy(string, chars, length);
+        string[length] = '\0';
+        return string;
+    }
+
+    // The replay handle for a handle copied as part of a structure
+    template <typename HandleType>
+    HandleType Map(HandleType captured) {
+        return CastFromUint64<HandleType>(MapCaptured(CastToUint64(captured)));
+    }
+    template <typename HandleType>
+    void AddHandle(uint64_t captured, HandleType replayed) {
+        if (captured) handles_[captured] = CastToUint64(replayed);
+    }
+    void RemoveHandle(uint64_t captured) { handles_.erase(captured); }
+    // Captured handles that weren't created by a captured call, and were replayed as VK_NULL_HANDLE
+    uint64_t UnknownHandleCount() const { return unknown_handles_; }
+
+    // Scratch memory that stays valid until the next record
+    template <typename T>
+    T *Allocate(size_t count) {
+        const size_t words = (sizeof(T) * count + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+        arena_.emplace_back(new uint64_t[words ? words : 1]());
+        return reinterpret_cast<T *>(arena_.back().get());
+    }
+
+  private:
+    template <typename T>
+    T *ReadValues(uint32_t count) {
+        // Bound the allocation by what the record can hold, a corrupt length only overruns
+        if (sizeof(T) * count > record_end_ - offset_) {
+            overrun_ = true;
+            offset_ = record_end_;
+            return nullptr;
+        }
+        T *values = Allocate<T>(count);
+        ReadBytes(values, sizeof(T) * count);
+        return values;
+    }
+    void ReadBytes(void *data, size_t size) {
+        if (size > record_end_ - offset_) {
+            overrun_ = true;
+            memset(data, 0, size);
+            offset_ = record_end_;
+            return;
+        }
+        memcpy(data, data_.data() + offset_, size);
+        offset_ += size;
+    }
+    uint64_t MapCaptured(uint64_t captured) {
+        if (!captured) return 0;
+        const auto found = handles_.find(captured);
+        if (found == handles_.end()) {
+            ++unknown_handles_;
+            return 0;
+        }
+        return found->second;
+    }
+
+    std::vector<uint8_t> data_;
+    size_t offset_ = 0;
+    size_t record_end_ = 0;
+    size_t next_record_ = 0;
+    bool overrun_ = false;
+    std::vector<std::unique_ptr<uint64_t[]>> arena_;
+    std::unordered_map<uint64_t, uint64_t> handles_;
+    uint64_t unknown_handles_ = 0;
+};
+
+}  // namespace api_capture
@@ -1035,18 +1035,24 @@ bool CoreChecks::ValidateBarriersToImages(const CMD_BUFFER_STATE *cb_state, uint
                 bool subres_skip = false;
                 LayoutUseCheckAndMessage layout_check(subresource_map);
                 VkImageSubresourceRange normalized_isr = NormalizeSubresourceRange(*image_state, img_barrier.subresourceRange);
-                // IncrementInterval skips over all the subresources that have the same state as we just checked, incrementing to
-                // the next "constant value" range
-                for (auto pos = subresource_map->Find(normalized_isr); !(pos.AtEnd()) && !subres_skip; pos.IncrementInterval()) {
-                    const auto &value = *pos;
-                    if (!layout_check.Check(value.subresource, img_barrier.oldLayout, value.current_layout, value.initial_layout)) {
-                        subres_skip = LogError(
-                            cb_state->commandBuffer, "VUID-VkImageMemoryBarrier-oldLayout-01197",
-                            "%s: For %s you cannot transition the layout of aspect=%d level=%d layer=%d from %s when the "
-                            "%s layout is %s.",
-                            func_name, report_data->FormatHandle(img_barrier.image).c_str(), value.subresource.aspectMask,
-                            value.subresource.mipLevel, value.subresource.arrayLayer, string_VkImageLayout(img_barrier.oldLayout),
-                            layout_check.message, string_VkImageLayout(layout_check.layout));
+                // Images whose subresources all share one layout pair can often be checked without walking the range
+                if (!layout_check.CheckUniform(img_barrier.oldLayout)) {
+                    // IncrementInterval skips over all the subresources that have the same state as we just checked,
+                    // incrementing to the next "constant value" range
+                    for (auto pos = subresource_map->Find(normalized_isr); !(pos.AtEnd()) && !subres_skip;
+                         pos.IncrementInterval()) {
+                        const auto &value = *pos;
+                        if (!layout_check.Check(value.subresource, img_barrier.oldLayout, value.current_layout,
+                                                value.initial_layout)) {
+                            subres_skip = LogError(
+                                cb_state->commandBuffer, "VUID-VkImageMemoryBarrier-oldLayout-01197",
+                                "%s: For %s you cannot transition the layout of aspect=%d level=%d layer=%d from %s when the "
+                                "%s layout is %s.",
+                                func_name, report_data->FormatHandle(img_barrier.image).c_str(), value.subresource.aspectMask,
+                                value.subresource.mipLevel, value.subresource.arrayLayer,
+                                string_VkImageLayout(img_barrier.oldLayout), layout_check.message,
+                                string_VkImageLayout(layout_check.layout));
+                        }
                     }
                 }
                 skip |= subres_skip;
@@ -1387,17 +1393,20 @@ bool CoreChecks::VerifyImageLayout(const CMD_BUFFER_STATE *cb_node, const IMAGE_
     if (subresource_map) {
         bool subres_skip = false;
         LayoutUseCheckAndMessage layout_check(subresource_map, aspect_mask);
-        // IncrementInterval skips over all the subresources that have the same state as we just checked, incrementing to
-        // the next "constant value" range
-        for (auto pos = subresource_map->Find(range); !(pos.AtEnd()) && !subres_skip; pos.IncrementInterval()) {
-            if (!layout_check.Check(pos->subresource, explicit_layout, pos->current_layout, pos->initial_layout)) {
-                *error = true;
-                subres_skip |= LogError(cb_node->commandBuffer, layout_mismatch_msg_code,
-                                        "%s: Cannot use %s (layer=%u mip=%u) with specific layout %s that doesn't match the "
-                                        "%s layout %s.",
-                                        caller, report_data->FormatHandle(image).c_str(), pos->subresource.arrayLayer,
-                                        pos->subresource.mipLevel, string_VkImageLayout(explicit_layout), layout_check.message,
-                                        string_VkImageLayout(layout_check.layout));
+        // Images whose subresources all share one layout pair can often be checked without walking the range
+        if (!layout_check.CheckUniform(explicit_layout)) {
+            // IncrementInterval skips over all the subresources that have the same state as we just checked, incrementing to
+            // the next "constant value" range
+            for (auto pos = subresource_map->Find(range); !(pos.AtEnd()) && !subres_skip; pos.IncrementInterval()) {
+                if (!layout_check.Check(pos->subresource, explicit_layout, pos->current_layout, pos->initial_layout)) {
+                    *error = true;
+                    subres_skip |= LogError(cb_node->commandBuffer, layout_mismatch_msg_code,
+                                            "%s: Cannot use %s (layer=%u mip=%u) with specific layout %s that doesn't match the "
+                                            "%s layout %s.",
+                                            caller, report_data->FormatHandle(image).c_str(), pos->subresource.arrayLayer,
+                                            pos->subresource.mipLevel, string_VkImageLayout(explicit_layout), layout_check.message,
+                                            string_VkImageLayout(layout_check.layout));
+                }
             }
         }
         skip |= subres_skip;
@@ -2016,6 +2025,7 @@ void CoreChecks::PostCallRecordCreateImage(VkDevice device, const VkImageCreateI
     StateTracker::PostCallRecordCreateImage(device, pCreateInfo, pAllocator, pImage, result);
     auto image_state = Get<IMAGE_STATE>(*pImage);
     AddInitialLayoutintoImageLayoutMap(*image_state, imageLayoutMap);
+    UpdateImageLayoutGeneration(*pImage);
 }
 
 bool CoreChecks::PreCallValidateDestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks *pAllocator) const {
@@ -2033,6 +2043,7 @@ void CoreChecks::PreCallRecordDestroyImage(VkDevice device, VkImage image, const
     EraseQFOReleaseBarriers<VkImageMemoryBarrier>(image);
 
     imageLayoutMap.erase(image);
+    imageLayoutGenerationMap.erase(image);
 
     // Clean up generic image state
     StateTracker::PreCallRecordDestroyImage(device, image, pAllocator);
@@ -2104,20 +2115,23 @@ bool CoreChecks::VerifyClearImageLayout(const CMD_BUFFER_STATE *cb_node, const I
         bool subres_skip = false;
         LayoutUseCheckAndMessage layout_check(subresource_map);
         VkImageSubresourceRange normalized_isr = NormalizeSubresourceRange(*image_state, range);
-        // IncrementInterval skips over all the subresources that have the same state as we just checked, incrementing to
-        // the next "constant value" range
-        for (auto pos = subresource_map->Find(normalized_isr); !(pos.AtEnd()) && !subres_skip; pos.IncrementInterval()) {
-            if (!layout_check.Check(pos->subresource, dest_image_layout, pos->current_layout, pos->initial_layout)) {
-                const char *error_code = "VUID-vkCmdClearColorImage-imageLayout-00004";
-                if (strcmp(func_name, "vkCmdClearDepthStencilImage()") == 0) {
-                    error_code = "VUID-vkCmdClearDepthStencilImage-imageLayout-00011";
-                } else {
-                    assert(strcmp(func_name, "vkCmdClearColorImage()") == 0);
+        // Images whose subresources all share one layout pair can often be checked without walking the range
+        if (!layout_check.CheckUniform(dest_image_layout)) {
+            // IncrementInterval skips over all the subresources that have the same state as we just checked, incrementing to
+            // the next "constant value" range
+            for (auto pos = subresource_map->Find(normalized_isr); !(pos.AtEnd()) && !subres_skip; pos.IncrementInterval()) {
+                if (!layout_check.Check(pos->subresource, dest_image_layout, pos->current_layout, pos->initial_layout)) {
+                    const char *error_code = "VUID-vkCmdClearColorImage-imageLayout-00004";
+                    if (strcmp(func_name, "vkCmdClearDepthStencilImage()") == 0) {
+                        error_code = "VUID-vkCmdClearDepthStencilImage-imageLayout-00011";
+                    } else {
+                        assert(strcmp(func_name, "vkCmdClearColorImage()") == 0);
+                    }
+                    subres_skip |= LogError(cb_node->commandBuffer, error_code,
+                                            "%s: Cannot clear an image whose layout is %s and doesn't match the %s layout %s.",
+                                            func_name, string_VkImageLayout(dest_image_layout), layout_check.message,
+                                            string_VkImageLayout(layout_check.layout));
                 }
-                subres_skip |= LogError(cb_node->commandBuffer, error_code,
-                                        "%s: Cannot clear an image whose layout is %s and doesn't match the %s layout %s.",
-                                        func_name, string_VkImageLayout(dest_image_layout), layout_check.message,
-                                        string_VkImageLayout(layout_check.layout));
             }
         }
         skip |= subres_skip;
@@ -2309,49 +2323,112 @@ void CoreChecks::PreCallRecordCmdClearDepthStencilImage(VkCommandBuffer commandB
     }
 }
 
-// Returns true if [x, xoffset] and [y, yoffset] overlap
-static bool RangesIntersect(int32_t start, uint32_t start_offset, int32_t end, uint32_t end_offset) {
-    bool result = false;
-    uint32_t intersection_min = std::max(static_cast<uint32_t>(start), static_cast<uint32_t>(end));
-    uint32_t intersection_max = std::min(static_cast<uint32_t>(start) + start_offset, static_cast<uint32_t>(end) + end_offset);
+// One side (source or destination) of a copy region, as a box in (array layer, z, y, x) order.  Boxes can only overlap if
+// their keys, which name the plane and mip level of an image, are equal.
+struct CopyRegionBox {
+    static const uint32_t kAxisCount = 4;
+    uint64_t key;
+    uint32_t region;
+    bool is_dst;
+    int64_t begin[kAxisCount];
+    int64_t end[kAxisCount];
 
-    if (intersection_max > intersection_min) {
-        result = true;
+    bool Empty() const {
+        for (uint32_t axis = 0; axis < kAxisCount; ++axis) {
+            if (begin[axis] >= end[axis]) return true;
+        }
+        return false;
     }
-    return result;
-}
-
-// Returns true if source area of first vkImageCopy/vkImageCopy2KHR region intersects dest area of second region
-// It is assumed that these are copy regions within a single image (otherwise no possibility of collision)
-template <typename RegionType>
-static bool RegionIntersects(const RegionType *rgn0, const RegionType *rgn1, VkImageType type, bool is_multiplane) {
-    bool result = false;
-
-    // Separate planes within a multiplane image cannot intersect
-    if (is_multiplane && (rgn0->srcSubresource.aspectMask != rgn1->dstSubresource.aspectMask)) {
-        return result;
+    bool Intersects(const CopyRegionBox &other) const {
+        for (uint32_t axis = 0; axis < kAxisCount; ++axis) {
+            if ((begin[axis] >= other.end[axis]) || (other.begin[axis] >= end[axis])) return false;
+        }
+        return true;
     }
+};
 
-    if ((rgn0->srcSubresource.mipLevel == rgn1->dstSubresource.mipLevel) &&
-        (RangesIntersect(rgn0->srcSubresource.baseArrayLayer, rgn0->srcSubresource.layerCount, rgn1->dstSubresource.baseArrayLayer,
-                         rgn1->dstSubresource.layerCount))) {
-        result = true;
-        switch (type) {
-            case VK_IMAGE_TYPE_3D:
-                result &= RangesIntersect(rgn0->srcOffset.z, rgn0->extent.depth, rgn1->dstOffset.z, rgn1->extent.depth);
-                // fall through
-            case VK_IMAGE_TYPE_2D:
-                result &= RangesIntersect(rgn0->srcOffset.y, rgn0->extent.height, rgn1->dstOffset.y, rgn1->extent.height);
-                // fall through
-            case VK_IMAGE_TYPE_1D:
-                result &= RangesIntersect(rgn0->srcOffset.x, rgn0->extent.width, rgn1->dstOffset.x, rgn1->extent.width);
-                break;
-            default:
-                // Unrecognized or new IMAGE_TYPE enums will be caught in parameter_validation
-                assert(false);
+static CopyRegionBox BufferCopyRegionBox(uint32_t region, bool is_dst, VkDeviceSize offset, VkDeviceSize size) {
+    // Ranges past the end of the buffer are reported by other VUIDs, so they only need to be kept from wrapping here
+    const VkDeviceSize kMax = static_cast<VkDeviceSize>(std::numeric_limits<int64_t>::max());
+    const VkDeviceSize begin = std::min(offset, kMax);
+    const VkDeviceSize end = std::min(size, kMax - begin) + begin;
+    return {0, region, is_dst, {0, 0, 0, static_cast<int64_t>(begin)}, {1, 1, 1, static_cast<int64_t>(end)}};
+}
+
+// Axes beyond those of the image type are ignored, as their offsets and extents are validated elsewhere
+static CopyRegionBox ImageCopyRegionBox(uint32_t region, bool is_dst, const VkImageSubresourceLayers &subresource,
+                                        bool is_multiplane, VkImageType type, const VkOffset3D &offset, const VkExtent3D &extent) {
+    // Separate planes within a multiplane image cannot overlap
+    const uint64_t plane = is_multiplane ? subresource.aspectMask : 0;
+    CopyRegionBox box = {(plane << 32) | subresource.mipLevel,
+                         region,
+                         is_dst,
+                         {subresource.baseArrayLayer, offset.z, offset.y, offset.x},
+                         {static_cast<int64_t>(subresource.baseArrayLayer) + subresource.layerCount,
+                          static_cast<int64_t>(offset.z) + extent.depth, static_cast<int64_t>(offset.y) + extent.height,
+                          static_cast<int64_t>(offset.x) + extent.width}};
+    if (type != VK_IMAGE_TYPE_3D) {
+        box.begin[1] = 0;
+        box.end[1] = 1;
+    }
+    if (type == VK_IMAGE_TYPE_1D) {
+        box.begin[2] = 0;
+        box.end[2] = 1;
+    }
+    return box;
+}
+
+// Returns the sorted (source region, destination region) pairs whose boxes overlap.  The boxes are sorted by key and then
+// along the axis on which their begins are most spread out, and swept along that axis, so that only the boxes that
+// already overlap on it are compared.  This is O(n log n) plus the number of those candidates, rather than O(n^2).
+static std::vector<std::pair<uint32_t, uint32_t>> FindCopyRegionOverlaps(std::vector<CopyRegionBox> &boxes) {
+    std::vector<std::pair<uint32_t, uint32_t>> overlaps;
+    boxes.erase(std::remove_if(boxes.begin(), boxes.end(), [](const CopyRegionBox &box) { return box.Empty(); }), boxes.end());
+    if (boxes.size() < 2) return overlaps;
+
+    uint32_t sweep_axis = 0;
+    size_t most_begins = 0;
+    std::vector<int64_t> begins(boxes.size());
+    for (uint32_t axis = 0; axis < CopyRegionBox::kAxisCount; ++axis) {
+        for (size_t i = 0; i < boxes.size(); ++i) begins[i] = boxes[i].begin[axis];
+        std::sort(begins.begin(), begins.end());
+        const size_t distinct_begins = std::unique(begins.begin(), begins.end()) - begins.begin();
+        if (distinct_begins > most_begins) {
+            most_begins = distinct_begins;
+            sweep_axis = axis;
+        }
+    }
+    std::sort(boxes.begin(), boxes.end(), [sweep_axis](const CopyRegionBox &lhs, const CopyRegionBox &rhs) {
+        return (lhs.key < rhs.key) || ((lhs.key == rhs.key) && (lhs.begin[sweep_axis] < rhs.begin[sweep_axis]));
+    });
+
+    // The boxes of each side that the sweep is still inside of, pruned as they're compared
+    std::vector<const CopyRegionBox *> active[2];
+    uint64_t key = boxes[0].key;
+    for (const auto &box : boxes) {
+        if (box.key != key) {
+            key = box.key;
+            active[0].clear();
+            active[1].clear();
+        }
+        auto &opposite = active[box.is_dst ? 0 : 1];
+        for (size_t i = 0; i < opposite.size();) {
+            const CopyRegionBox *other = opposite[i];
+            if (other->end[sweep_axis] <= box.begin[sweep_axis]) {
+                opposite[i] = opposite.back();
+                opposite.pop_back();
+                continue;
+            }
+            if (box.Intersects(*other)) {
+                overlaps.emplace_back(box.is_dst ? std::make_pair(other->region, box.region)
+                                                 : std::make_pair(box.region, other->region));
+            }
+            ++i;
         }
+        active[box.is_dst ? 1 : 0].push_back(&box);
     }
-    return result;
+    std::sort(overlaps.begin(), overlaps.end());
+    return overlaps;
 }
 
 // Returns non-zero if offset and extent exceed image extents
@@ -3030,18 +3107,6 @@ bool CoreChecks::ValidateCmdCopyImage(VkCommandBuffer commandBuffer, VkImage src
                              func_name, i, region.dstOffset.z, dst_copy_extent.depth, subresource_extent.depth);
         }
 
-        // The union of all source regions, and the union of all destination regions, specified by the elements of regions,
-        // must not overlap in memory
-        if (src_image_state->image == dst_image_state->image) {
-            for (uint32_t j = 0; j < regionCount; j++) {
-                if (RegionIntersects(&region, &pRegions[j], src_image_state->createInfo.imageType,
-                                     FormatIsMultiplane(src_format))) {
-                    vuid = is_2khr ? "VUID-VkCopyImageInfo2KHR-pRegions-00124" : "VUID-vkCmdCopyImage-pRegions-00124";
-                    skip |= LogError(command_buffer, vuid, "%s: pRegion[%u] src overlaps with pRegions[%u].", func_name, i, j);
-                }
-            }
-        }
-
         // Check depth for 2D as post Maintaince 1 requires both while prior only required one to be 2D
         if (device_extensions.vk_khr_maintenance1) {
             if (((VK_IMAGE_TYPE_2D == src_image_state->createInfo.imageType) &&
@@ -3111,6 +3176,27 @@ bool CoreChecks::ValidateCmdCopyImage(VkCommandBuffer commandBuffer, VkImage src
         }
     }
 
+    // The union of all source regions, and the union of all destination regions, specified by the elements of regions,
+    // must not overlap in memory
+    if (src_image_state->image == dst_image_state->image) {
+        const VkImageType image_type = src_image_state->createInfo.imageType;
+        const bool is_multiplane = FormatIsMultiplane(src_format);
+        std::vector<CopyRegionBox> boxes;
+        boxes.reserve(2 * regionCount);
+        for (uint32_t i = 0; i < regionCount; i++) {
+            const RegionType &region = pRegions[i];
+            boxes.emplace_back(ImageCopyRegionBox(i, false, region.srcSubresource, is_multiplane, image_type, region.srcOffset,
+                                                  region.extent));
+            boxes.emplace_back(ImageCopyRegionBox(i, true, region.dstSubresource, is_multiplane, image_type, region.dstOffset,
+                                                  region.extent));
+        }
+        vuid = is_2khr ? "VUID-VkCopyImageInfo2KHR-pRegions-00124" : "VUID-vkCmdCopyImage-pRegions-00124";
+        for (const auto &overlap : FindCopyRegionOverlaps(boxes)) {
+            skip |= LogError(command_buffer, vuid, "%s: pRegion[%u] src overlaps with pRegions[%u].", func_name, overlap.first,
+                             overlap.second);
+        }
+    }
+
     // The formats of non-multiplane src_image and dst_image must be compatible. Formats are considered compatible if their texel
     // size in bytes is the same between both formats. For example, VK_FORMAT_R8G8B8A8_UNORM is compatible with VK_FORMAT_R32_UINT
     // because because both texels are 4 bytes in size.
@@ -4202,65 +4288,84 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const CMD_BUFFER_STATE *pCB, const G
         const auto *image_state = GetImageState(image);
         if (!image_state) continue;  // Can't check layouts of a dead image
         const auto &subres_map = layout_map_entry.second;
-        const auto &initial_layout_map = subres_map->GetInitialLayoutMap();
         // Validate the initial_uses for each subresource referenced
-        if (initial_layout_map.empty()) continue;
+        if (!subres_map->HasInitialLayouts()) continue;
+
+        // If no earlier command buffer of this submit changed the image, the global layouts are current, and a match
+        // against the global generation found at a previous submit still holds.
+        const auto overlay_it = overlay_layout_map.find(image);
+        const bool in_overlay = (overlay_it != overlay_layout_map.cend()) && !overlay_it->second->empty();
+        const uint64_t global_generation = in_overlay ? 0 : GetImageLayoutGeneration(image);
+        if ((global_generation != 0) && (subres_map->GetValidatedGeneration() == global_generation)) {
+            // Without transitions the current layouts are the global ones, so the overlay needs no update either
+            if (subres_map->HasLayoutTransitions()) {
+                subres_map->SpliceCurrentLayouts(GetLayoutRangeMap(&overlay_layout_map, *image_state));
+            }
+            continue;
+        }
 
         auto *overlay_map = GetLayoutRangeMap(&overlay_layout_map, *image_state);
         const auto *global_map = GetLayoutRangeMap(globalImageLayoutMap, image);
         if (global_map == nullptr) {
             global_map = &empty_map;
         }
+        // Only exact matches are cached, as relaxed matches leave the global layouts to be changed by the splice below
+        bool exact_match = true;
 
         // Note: don't know if it would matter
         // if (global_map->empty() && overlay_map->empty()) // skip this next loop...;
 
-        auto pos = initial_layout_map.begin();
-        const auto end = initial_layout_map.end();
         sparse_container::parallel_iterator<const ImageSubresourceLayoutMap::LayoutMap> current_layout(*overlay_map, *global_map,
-                                                                                                       pos->first.begin);
-        while (pos != end) {
-            VkImageLayout initial_layout = pos->second;
-            VkImageLayout image_layout = kInvalidLayout;
-            if (current_layout->range.empty()) break;  // When we are past the end of data in overlay and global... stop looking
-            if (current_layout->pos_A->valid) {        // pos_A denotes the overlay map in the parallel iterator
-                image_layout = current_layout->pos_A->lower_bound->second;
-            } else if (current_layout->pos_B->valid) {  // pos_B denotes the global map in the parallel iterator
-                image_layout = current_layout->pos_B->lower_bound->second;
-            }
-            const auto intersected_range = pos->first & current_layout->range;
-            if (initial_layout == VK_IMAGE_LAYOUT_UNDEFINED) {
-                // TODO: Set memory invalid which is in mem_tracker currently
-            } else if (image_layout != initial_layout) {
-                // Need to look up the inital layout *state* to get a bit more information
-                const auto *initial_layout_state = subres_map->GetSubresourceInitialLayoutState(pos->first.begin);
-                assert(initial_layout_state);  // There's no way we should have an initial layout without matching state...
-                bool matches = ImageLayoutMatches(initial_layout_state->aspect_mask, image_layout, initial_layout);
-                if (!matches) {
-                    // We can report all the errors for the intersected range directly
-                    for (auto index : sparse_container::range_view<decltype(intersected_range)>(intersected_range)) {
-                        const auto subresource = image_state->subresource_encoder.Decode(index);
-                        skip |= LogError(
-                            pCB->commandBuffer, kVUID_Core_DrawState_InvalidImageLayout,
-                            "Submitted command buffer expects %s (subresource: aspectMask 0x%X array layer %u, mip level %u) "
-                            "to be in layout %s--instead, current layout is %s.",
-                            report_data->FormatHandle(image).c_str(), subresource.aspectMask, subresource.arrayLayer,
-                            subresource.mipLevel, string_VkImageLayout(initial_layout), string_VkImageLayout(image_layout));
-                    }
+                                                                                                       0);
+        const auto check_range = [&](const image_layout_map::IndexRange &initial_range, VkImageLayout initial_layout) {
+            for (auto range_index = initial_range.begin; initial_range.includes(range_index);) {
+                current_layout.seek(range_index);
+                VkImageLayout image_layout = kInvalidLayout;
+                if (current_layout->range.empty()) {  // When we are past the end of data in overlay and global... stop looking
+                    exact_match = false;
+                    return false;
                 }
-            }
-            if (pos->first.includes(intersected_range.end)) {
-                current_layout.seek(intersected_range.end);
-            } else {
-                ++pos;
-                if (pos != end) {
-                    current_layout.seek(pos->first.begin);
+                if (current_layout->pos_A->valid) {  // pos_A denotes the overlay map in the parallel iterator
+                    image_layout = current_layout->pos_A->lower_bound->second;
+                } else if (current_layout->pos_B->valid) {  // pos_B denotes the global map in the parallel iterator
+                    image_layout = current_layout->pos_B->lower_bound->second;
+                }
+                const auto intersected_range = initial_range & current_layout->range;
+                if (image_layout != initial_layout) {
+                    exact_match = false;
                 }
+                if (initial_layout == VK_IMAGE_LAYOUT_UNDEFINED) {
+                    // TODO: Set memory invalid which is in mem_tracker currently
+                } else if (image_layout != initial_layout) {
+                    // Need to look up the inital layout *state* to get a bit more information
+                    const auto *initial_layout_state = subres_map->GetSubresourceInitialLayoutState(initial_range.begin);
+                    assert(initial_layout_state);  // There's no way we should have an initial layout without matching state...
+                    bool matches = ImageLayoutMatches(initial_layout_state->aspect_mask, image_layout, initial_layout);
+                    if (!matches) {
+                        // We can report all the errors for the intersected range directly
+                        for (auto index : sparse_container::range_view<decltype(intersected_range)>(intersected_range)) {
+                            const auto subresource = image_state->subresource_encoder.Decode(index);
+                            skip |= LogError(
+                                pCB->commandBuffer, kVUID_Core_DrawState_InvalidImageLayout,
+                                "Submitted command buffer expects %s (subresource: aspectMask 0x%X array layer %u, mip level %u) "
+                                "to be in layout %s--instead, current layout is %s.",
+                                report_data->FormatHandle(image).c_str(), subresource.aspectMask, subresource.arrayLayer,
+                                subresource.mipLevel, string_VkImageLayout(initial_layout), string_VkImageLayout(image_layout));
+                        }
+                    }
+                }
+                range_index = intersected_range.end;
             }
+            return true;
+        };
+        subres_map->ForEachInitialLayoutRange(check_range);
+
+        if (exact_match && (global_generation != 0)) {
+            subres_map->SetValidatedGeneration(global_generation);
         }
 
         // Update all layout set operations (which will be a subset of the initial_layouts)
-        sparse_container::splice(overlay_map, subres_map->GetCurrentLayoutMap(), sparse_container::value_precedence::prefer_source);
+        subres_map->SpliceCurrentLayouts(overlay_map);
     }
 
     return skip;
@@ -4272,11 +4377,28 @@ void CoreChecks::UpdateCmdBufImageLayouts(CMD_BUFFER_STATE *pCB) {
         const auto &subres_map = layout_map_entry.second;
         const auto *image_state = GetImageState(image);
         if (!image_state) continue;  // Can't set layouts of a dead image
+        const uint64_t global_generation = GetImageLayoutGeneration(image);
+        if (!subres_map->HasLayoutTransitions() && (global_generation != 0) &&
+            (subres_map->GetValidatedGeneration() == global_generation)) {
+            continue;  // Current layouts exactly match the global ones, the splice would be a no-op
+        }
         auto *global_map = GetLayoutRangeMap(&imageLayoutMap, *image_state);
-        sparse_container::splice(global_map, subres_map->GetCurrentLayoutMap(), sparse_container::value_precedence::prefer_source);
+        if (subres_map->SpliceCurrentLayouts(global_map)) {
+            UpdateImageLayoutGeneration(image);
+        }
+    }
+}
+
+uint64_t CoreChecks::GetImageLayoutGeneration(VkImage image) const {
+    const auto it = imageLayoutGenerationMap.find(image);
+    if (it != imageLayoutGenerationMap.cend()) {
+        return it->second;
     }
+    return 0;
 }
 
+void CoreChecks::UpdateImageLayoutGeneration(VkImage image) { imageLayoutGenerationMap[image] = ++imageLayoutGenerationCounter; }
+
 // ValidateLayoutVsAttachmentDescription is a general function where we can validate various state associated with the
 // VkAttachmentDescription structs that are used by the sub-passes of a renderpass. Initial check is to make sure that READ_ONLY
 // layout attachments don't have CLEAR as their loadOp.
@@ -5297,17 +5419,8 @@ bool CoreChecks::ValidateCmdCopyBufferBounds(const BUFFER_STATE *src_buffer_stat
 
     VkDeviceSize src_buffer_size = src_buffer_state->createInfo.size;
     VkDeviceSize dst_buffer_size = dst_buffer_state->createInfo.size;
-    VkDeviceSize src_min = UINT64_MAX;
-    VkDeviceSize src_max = 0;
-    VkDeviceSize dst_min = UINT64_MAX;
-    VkDeviceSize dst_max = 0;
 
     for (uint32_t i = 0; i < regionCount; i++) {
-        src_min = std::min(src_min, pRegions[i].srcOffset);
-        src_max = std::max(src_max, (pRegions[i].srcOffset + pRegions[i].size));
-        dst_min = std::min(dst_min, pRegions[i].dstOffset);
-        dst_max = std::max(dst_max, (pRegions[i].dstOffset + pRegions[i].size));
-
         // The srcOffset member of each element of pRegions must be less than the size of srcBuffer
         if (pRegions[i].srcOffset >= src_buffer_size) {
             vuid = is_2khr ? "VUID-VkCopyBufferInfo2KHR-srcOffset-00113" : "VUID-vkCmdCopyBuffer-srcOffset-00113";
@@ -5345,10 +5458,18 @@ bool CoreChecks::ValidateCmdCopyBufferBounds(const BUFFER_STATE *src_buffer_stat
 
     // The union of the source regions, and the union of the destination regions, must not overlap in memory
     if (src_buffer_state->buffer == dst_buffer_state->buffer) {
-        if (((src_min > dst_min) && (src_min < dst_max)) || ((src_max > dst_min) && (src_max < dst_max))) {
-            vuid = is_2khr ? "VUID-VkCopyBufferInfo2KHR-pRegions-00117" : "VUID-vkCmdCopyBuffer-pRegions-00117";
-            skip |= LogError(src_buffer_state->buffer, vuid, "%s: Detected overlap between source and dest regions in memory.",
-                             func_name);
+        std::vector<CopyRegionBox> boxes;
+        boxes.reserve(2 * regionCount);
+        for (uint32_t i = 0; i < regionCount; i++) {
+            boxes.emplace_back(BufferCopyRegionBox(i, false, pRegions[i].srcOffset, pRegions[i].size));
+            boxes.emplace_back(BufferCopyRegionBox(i, true, pRegions[i].dstOffset, pRegions[i].size));
+        }
+        vuid = is_2khr ? "VUID-VkCopyBufferInfo2KHR-pRegions-00117" : "VUID-vkCmdCopyBuffer-pRegions-00117";
+        for (const auto &overlap : FindCopyRegionOverlaps(boxes)) {
+            skip |= LogError(src_buffer_state->buffer, vuid,
+                             "%s: Detected overlap between source and dest regions in memory: the source of pRegions[%u] overlaps "
+                             "the destination of pRegions[%u].",
+                             func_name, overlap.first, overlap.second);
         }
     }
 
@@ -5419,7 +5540,7 @@ bool CoreChecks::ValidateIdleBuffer(VkBuffer buffer) const {
     bool skip = false;
     auto buffer_state = GetBufferState(buffer);
     if (buffer_state) {
-        if (buffer_state->in_use.load()) {
+        if (buffer_state->in_use.load() || IsInUseThroughDescriptors(buffer_state)) {
             skip |= LogError(buffer, "VUID-vkDestroyBuffer-buffer-00922", "Cannot free %s that is in use by a command buffer.",
                              report_data->FormatHandle(buffer).c_str());
         }
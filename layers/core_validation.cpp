@@ -53,6 +53,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <string>
+#include <thread>
 #include <valarray>
 
 #include "vk_loader_platform.h"
@@ -645,6 +646,9 @@ bool CoreChecks::ValidateRenderPassCompatibility(const char *type1_string, const
                                                  const char *error_code) const {
     bool skip = false;
 
+    // Render passes with the same compatibility id compare equal below, so only incompatible ones need the full comparison
+    if (rp1_state->compatibility && (rp1_state->compatibility == rp2_state->compatibility)) return skip;
+
     // createInfo flags must be identical for the renderpasses to be compatible.
     if (rp1_state->createInfo.flags != rp2_state->createInfo.flags) {
         LogObjectList objlist(rp1_state->renderPass);
@@ -2575,11 +2579,16 @@ void CoreChecks::PostCallRecordCreateDevice(VkPhysicalDevice gpu, const VkDevice
         [core_checks](CMD_BUFFER_STATE *cb_node, const IMAGE_VIEW_STATE &iv_state, VkImageLayout layout) -> void {
             core_checks->SetImageViewInitialLayout(cb_node, iv_state, layout);
         });
+    if (core_checks->enabled[guard_mapped_memory]) {
+        core_checks->mapped_memory_guard = MappedMemoryGuard::Create(core_checks->enabled[track_mapped_memory_writes]);
+    }
 }
 
 void CoreChecks::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
     if (!device) return;
     imageLayoutMap.clear();
+    imageLayoutGenerationMap.clear();
+    mapped_memory_guard.reset();
 
     StateTracker::PreCallRecordDestroyDevice(device, pAllocator);
 }
@@ -2779,20 +2788,63 @@ bool CoreChecks::ValidateQueueFamilyIndices(const CMD_BUFFER_STATE *pCB, VkQueue
         }
 
         // Ensure that any bound images or buffers created with SHARING_MODE_CONCURRENT have access to the current queue family
+        // An image or buffer may be both bound and used through a descriptor, so each one is checked once
+        std::unordered_set<const BASE_NODE *> checked;
+        auto validate_image = [&](const IMAGE_STATE *image_state) {
+            if (image_state && image_state->createInfo.sharingMode == VK_SHARING_MODE_CONCURRENT &&
+                image_state->create_from_swapchain == VK_NULL_HANDLE && checked.insert(image_state).second) {
+                skip |= ValidImageBufferQueue(pCB, VulkanTypedHandle(image_state->image, kVulkanObjectTypeImage),
+                                              queue_state->queueFamilyIndex, image_state->createInfo.queueFamilyIndexCount,
+                                              image_state->createInfo.pQueueFamilyIndices);
+            }
+        };
+        auto validate_buffer = [&](const BUFFER_STATE *buffer_state) {
+            if (buffer_state && buffer_state->createInfo.sharingMode == VK_SHARING_MODE_CONCURRENT &&
+                checked.insert(buffer_state).second) {
+                skip |= ValidImageBufferQueue(pCB, VulkanTypedHandle(buffer_state->buffer, kVulkanObjectTypeBuffer),
+                                              queue_state->queueFamilyIndex, buffer_state->createInfo.queueFamilyIndexCount,
+                                              buffer_state->createInfo.pQueueFamilyIndices);
+            }
+        };
         for (const auto &object : pCB->object_bindings) {
             if (object.type == kVulkanObjectTypeImage) {
-                auto image_state = object.node ? (IMAGE_STATE *)object.node : GetImageState(object.Cast<VkImage>());
-                if (image_state && image_state->createInfo.sharingMode == VK_SHARING_MODE_CONCURRENT) {
-                    skip |= ValidImageBufferQueue(pCB, object, queue_state->queueFamilyIndex,
-                                                  image_state->createInfo.queueFamilyIndexCount,
-                                                  image_state->createInfo.pQueueFamilyIndices);
-                }
+                validate_image(object.node ? (IMAGE_STATE *)object.node : GetImageState(object.Cast<VkImage>()));
             } else if (object.type == kVulkanObjectTypeBuffer) {
-                auto buffer_state = object.node ? (BUFFER_STATE *)object.node : GetBufferState(object.Cast<VkBuffer>());
-                if (buffer_state && buffer_state->createInfo.sharingMode == VK_SHARING_MODE_CONCURRENT) {
-                    skip |= ValidImageBufferQueue(pCB, object, queue_state->queueFamilyIndex,
-                                                  buffer_state->createInfo.queueFamilyIndexCount,
-                                                  buffer_state->createInfo.pQueueFamilyIndices);
+                validate_buffer(object.node ? (BUFFER_STATE *)object.node : GetBufferState(object.Cast<VkBuffer>()));
+            }
+        }
+        // Descriptor resources aren't linked to the command buffer, so they're found through the bindings its draws used
+        for (const auto &used_bindings : pCB->descriptor_set_bindings) {
+            const auto *descriptor_set = used_bindings.first;
+            for (const auto &binding : used_bindings.second) {
+                const auto range = descriptor_set->GetGlobalIndexRangeFromBinding(binding.first);
+                for (uint32_t i = range.start; i < range.end; ++i) {
+                    const auto *descriptor = descriptor_set->GetDescriptorFromGlobalIndex(i);
+                    switch (descriptor->GetClass()) {
+                        case cvdescriptorset::ImageSampler: {
+                            const auto *iv_state =
+                                static_cast<const cvdescriptorset::ImageSamplerDescriptor *>(descriptor)->GetImageViewState();
+                            if (iv_state) validate_image(iv_state->image_state.get());
+                            break;
+                        }
+                        case cvdescriptorset::Image: {
+                            const auto *iv_state =
+                                static_cast<const cvdescriptorset::ImageDescriptor *>(descriptor)->GetImageViewState();
+                            if (iv_state) validate_image(iv_state->image_state.get());
+                            break;
+                        }
+                        case cvdescriptorset::TexelBuffer: {
+                            const auto *bv_state =
+                                static_cast<const cvdescriptorset::TexelDescriptor *>(descriptor)->GetBufferViewState();
+                            if (bv_state) validate_buffer(bv_state->buffer_state.get());
+                            break;
+                        }
+                        case cvdescriptorset::GeneralBuffer:
+                            validate_buffer(static_cast<const cvdescriptorset::BufferDescriptor *>(descriptor)->GetBufferState());
+                            break;
+                        default:
+                            break;
+                    }
                 }
             }
         }
@@ -2862,6 +2914,16 @@ bool CoreChecks::ValidateFenceForSubmit(const FENCE_STATE *pFence, const char *i
     return skip;
 }
 
+void CoreChecks::PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence) {
+    StateTracker::PreCallRecordQueueSubmit(queue, submitCount, pSubmits, fence);
+
+    if (mapped_memory_guard) {
+        for (const auto mem : mapped_memory_guard->GetAccessedMemory()) {
+            ReportGuardedMemoryAccesses(mem, "vkQueueSubmit()");
+        }
+    }
+}
+
 void CoreChecks::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence,
                                            VkResult result) {
     StateTracker::PostCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, result);
@@ -3048,10 +3110,93 @@ bool CoreChecks::ValidateMaxTimelineSemaphoreValueDifference(VkSemaphore semapho
     return skip;
 }
 
+// Revalidate the descriptors that could only be checked at submit time (e.g. UPDATE_AFTER_BIND bindings)
+bool CoreChecks::ValidateSubmitTimeDescriptorSets(const CMD_BUFFER_STATE *cb_node) const {
+    bool skip = false;
+    for (auto descriptor_set : cb_node->validate_descriptorsets_in_queuesubmit) {
+        const cvdescriptorset::DescriptorSet *set_node = GetSetNode(descriptor_set.first);
+        if (set_node) {
+            for (auto cmd_info : descriptor_set.second) {
+                std::string function = "vkQueueSubmit(), ";
+                function += cmd_info.function;
+                for (auto binding_info : cmd_info.binding_infos) {
+                    std::vector<uint32_t> dynamic_offsets;
+                    // dynamic data isn't allowed in UPDATE_AFTER_BIND, so dynamicOffsets is always empty.
+                    // This submit time not record time...
+                    const bool record_time_validate = false;
+                    skip |= ValidateDescriptorSetBindingData(cb_node, set_node, dynamic_offsets, binding_info, cmd_info.framebuffer,
+                                                             cmd_info.attachments.get(), *cmd_info.subpasses.get(),
+                                                             record_time_validate, function.c_str(),
+                                                             GetDrawDispatchVuid(cmd_info.cmd_type));
+                }
+            }
+        }
+    }
+    return skip;
+}
+
+// The descriptor revalidation only reads device state and is independent between command buffers, so when a submit carries
+// enough of them it is spread across worker threads up front. The order dependent checks (layouts, QFO transfers, queries,
+// events) stay serial in ValidateCommandBuffersForSubmit, which picks up these results and reports their messages in
+// submission order.
+SubmitDescriptorResults CoreChecks::ValidateSubmitTimeDescriptorSets(uint32_t submit_count, const VkSubmitInfo *submits) const {
+    static const size_t kMinParallelCommandBuffers = 8;
+    std::vector<SubmitDescriptorResult *> cb_results;
+    std::vector<const CMD_BUFFER_STATE *> cb_nodes;
+    SubmitDescriptorResults results;
+    for (uint32_t submit_idx = 0; submit_idx < submit_count; submit_idx++) {
+        const VkSubmitInfo &submit = submits[submit_idx];
+        for (uint32_t i = 0; i < submit.commandBufferCount; i++) {
+            const auto *cb_node = GetCBState(submit.pCommandBuffers[i]);
+            if (cb_node && !cb_node->validate_descriptorsets_in_queuesubmit.empty()) {
+                auto inserted = results.emplace(cb_node, SubmitDescriptorResult());
+                if (inserted.second) {
+                    cb_results.push_back(&inserted.first->second);
+                    cb_nodes.push_back(cb_node);
+                }
+            }
+        }
+    }
+
+    const uint32_t count = static_cast<uint32_t>(cb_nodes.size());
+    auto validate = [this, &cb_nodes, &cb_results](uint32_t index) {
+        auto &deferred_messages = DeferredLogMessages();
+        auto *const outer_messages = deferred_messages;
+        deferred_messages = &cb_results[index]->messages;
+        cb_results[index]->skip = ValidateSubmitTimeDescriptorSets(cb_nodes[index]);
+        deferred_messages = outer_messages;
+    };
+    if (count >= kMinParallelCommandBuffers) {
+        std::call_once(submit_validation_pool_once, [this]() {
+            const uint32_t worker_count = std::thread::hardware_concurrency();
+            if (worker_count > 1) submit_validation_pool.reset(new ValidationWorkerPool(worker_count - 1));
+        });
+    }
+    if (submit_validation_pool && (count >= kMinParallelCommandBuffers)) {
+        submit_validation_pool->Run(count, validate);
+    } else {
+        for (uint32_t index = 0; index < count; index++) validate(index);
+    }
+    return results;
+}
+
+// Report messages held back by submit time validation, into the caller's deferred messages when there are some, which (as
+// LogMsgOrDefer does) counts them as found
+bool CoreChecks::LogSubmitTimeMessages(std::vector<DeferredLogMessage> &messages) const {
+    auto *const deferred_messages = DeferredLogMessages();
+    if (deferred_messages) {
+        const bool found = !messages.empty();
+        std::move(messages.begin(), messages.end(), std::back_inserter(*deferred_messages));
+        messages.clear();
+        return found;
+    }
+    return LogDeferredMessages(report_data, messages);
+}
+
 bool CoreChecks::ValidateCommandBuffersForSubmit(VkQueue queue, const VkSubmitInfo *submit,
                                                  GlobalImageLayoutMap *overlayImageLayoutMap_arg,
-                                                 QueryMap *local_query_to_state_map,
-                                                 vector<VkCommandBuffer> *current_cmds_arg) const {
+                                                 QueryMap *local_query_to_state_map, vector<VkCommandBuffer> *current_cmds_arg,
+                                                 SubmitDescriptorResults *descriptor_results) const {
     bool skip = false;
     auto queue_state = GetQueueState(queue);
 
@@ -3075,25 +3220,12 @@ bool CoreChecks::ValidateCommandBuffersForSubmit(VkQueue queue, const VkSubmitIn
                 &qfo_image_scoreboards, &qfo_buffer_scoreboards);
             skip |= ValidateQueueFamilyIndices(cb_node, queue);
 
-            for (auto descriptor_set : cb_node->validate_descriptorsets_in_queuesubmit) {
-                const cvdescriptorset::DescriptorSet *set_node = GetSetNode(descriptor_set.first);
-                if (set_node) {
-                    for (auto cmd_info : descriptor_set.second) {
-                        std::string function = "vkQueueSubmit(), ";
-                        function += cmd_info.function;
-                        for (auto binding_info : cmd_info.binding_infos) {
-                            std::string error;
-                            std::vector<uint32_t> dynamic_offsets;
-                            // dynamic data isn't allowed in UPDATE_AFTER_BIND, so dynamicOffsets is always empty.
-                            // This submit time not record time...
-                            const bool record_time_validate = false;
-                            skip |= ValidateDescriptorSetBindingData(cb_node, set_node, dynamic_offsets, binding_info,
-                                                                     cmd_info.framebuffer, cmd_info.attachments.get(),
-                                                                     *cmd_info.subpasses.get(), record_time_validate,
-                                                                     function.c_str(), GetDrawDispatchVuid(cmd_info.cmd_type));
-                        }
-                    }
-                }
+            auto descriptor_result = descriptor_results->find(cb_node);
+            if (descriptor_result != descriptor_results->end()) {
+                auto &result = descriptor_result->second;
+                // With messages, the result's skip only records that they were found, while reporting them gives the skip
+                skip |= result.messages.empty() ? result.skip : LogSubmitTimeMessages(result.messages);
+                descriptor_results->erase(descriptor_result);
             }
 
             // Potential early exit here as bad object state may crash in delayed function calls
@@ -3132,13 +3264,15 @@ bool CoreChecks::PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount,
     vector<VkCommandBuffer> current_cmds;
     GlobalImageLayoutMap overlay_image_layout_map;
     QueryMap local_query_to_state_map;
+    auto descriptor_results = ValidateSubmitTimeDescriptorSets(submitCount, pSubmits);
 
     // Now verify each individual submit
     for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
         const VkSubmitInfo *submit = &pSubmits[submit_idx];
         skip |= ValidateSemaphoresForSubmit(queue, submit, submit_idx, &unsignaled_semaphores, &signaled_semaphores,
                                             &internal_semaphores);
-        skip |= ValidateCommandBuffersForSubmit(queue, submit, &overlay_image_layout_map, &local_query_to_state_map, &current_cmds);
+        skip |= ValidateCommandBuffersForSubmit(queue, submit, &overlay_image_layout_map, &local_query_to_state_map, &current_cmds,
+                                                &descriptor_results);
 
         auto chained_device_group_struct = LvlFindInChain<VkDeviceGroupSubmitInfo>(submit->pNext);
         if (chained_device_group_struct && chained_device_group_struct->commandBufferCount > 0) {
@@ -3186,6 +3320,12 @@ bool CoreChecks::PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount,
         }
     }
 
+    // Command buffers after one that stopped the validation of its submit early go unreported, as they did before the
+    // descriptor revalidation was done up front
+    for (auto &descriptor_result : descriptor_results) {
+        DiscardDeferredMessages(descriptor_result.second.messages);
+    }
+
     if (skip) return skip;
 
     // Now verify maxTimelineSemaphoreValueDifference
@@ -3840,7 +3980,7 @@ bool CoreChecks::ValidateObjectNotInUse(const BASE_NODE *obj_node, const VulkanT
                                         const char *error_code) const {
     if (disabled[object_in_use]) return false;
     bool skip = false;
-    if (obj_node->in_use.load()) {
+    if (obj_node->in_use.load() || IsInUseThroughDescriptors(obj_node)) {
         skip |= LogError(device, error_code, "Cannot call %s on %s that is currently in use by a command buffer.", caller_name,
                          report_data->FormatHandle(obj_struct).c_str());
     }
@@ -11480,6 +11620,54 @@ bool CoreChecks::PreCallValidateUnmapMemory(VkDevice device, VkDeviceMemory mem)
     return skip;
 }
 
+void CoreChecks::PostCallRecordMapMemory(VkDevice device, VkDeviceMemory mem, VkDeviceSize offset, VkDeviceSize size,
+                                         VkFlags flags, void **ppData, VkResult result) {
+    StateTracker::PostCallRecordMapMemory(device, mem, offset, size, flags, ppData, result);
+    if (!mapped_memory_guard || (VK_SUCCESS != result)) return;
+
+    const auto mem_info = GetDevMemState(mem);
+    if (mem_info) {
+        const VkDeviceSize mapped_size = (size == VK_WHOLE_SIZE) ? (mem_info->alloc_info.allocationSize - offset) : size;
+        const bool coherent = (phys_dev_mem_props.memoryTypes[mem_info->alloc_info.memoryTypeIndex].propertyFlags &
+                               VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0;
+        mapped_memory_guard->Map(mem, *ppData, mapped_size, coherent);
+    }
+}
+
+void CoreChecks::PreCallRecordUnmapMemory(VkDevice device, VkDeviceMemory mem) {
+    if (mapped_memory_guard) {
+        ReportGuardedMemoryAccesses(mem, "vkUnmapMemory()");
+        mapped_memory_guard->Unmap(mem);
+    }
+    StateTracker::PreCallRecordUnmapMemory(device, mem);
+}
+
+void CoreChecks::PreCallRecordFreeMemory(VkDevice device, VkDeviceMemory mem, const VkAllocationCallbacks *pAllocator) {
+    if (mapped_memory_guard) {
+        ReportGuardedMemoryAccesses(mem, "vkFreeMemory()");
+        mapped_memory_guard->Unmap(mem);
+    }
+    StateTracker::PreCallRecordFreeMemory(device, mem, pAllocator);
+}
+
+// Report the accesses through the mapped pointer of mem that the mapped memory guard has seen since the last report
+void CoreChecks::ReportGuardedMemoryAccesses(VkDeviceMemory mem, const char *func_name) {
+    int64_t out_of_bounds_offset = 0;
+    if (mapped_memory_guard->TakeOutOfBoundsAccess(mem, &out_of_bounds_offset)) {
+        LogError(mem, kVUID_Core_MemTrack_MappedOutOfBounds,
+                 "%s: The host accessed mapped memory (%s) at offset %" PRId64
+                 " from the pointer returned by vkMapMemory, which is outside of the mapped range.",
+                 func_name, report_data->FormatHandle(mem).c_str(), out_of_bounds_offset);
+    }
+    VkDeviceSize unflushed_offset = 0;
+    if (mapped_memory_guard->TakeUnflushedWrite(mem, &unflushed_offset)) {
+        LogWarning(mem, kVUID_Core_MemTrack_UnflushedWrite,
+                   "%s: The host wrote to non-coherent mapped memory (%s) at or after offset 0x%" PRIxLEAST64
+                   " from the pointer returned by vkMapMemory, without a following vkFlushMappedMemoryRanges call.",
+                   func_name, report_data->FormatHandle(mem).c_str(), unflushed_offset);
+    }
+}
+
 bool CoreChecks::ValidateMemoryIsMapped(const char *funcName, uint32_t memRangeCount, const VkMappedMemoryRange *pMemRanges) const {
     bool skip = false;
     for (uint32_t i = 0; i < memRangeCount; ++i) {
@@ -11560,6 +11748,18 @@ bool CoreChecks::PreCallValidateFlushMappedMemoryRanges(VkDevice device, uint32_
     return skip;
 }
 
+void CoreChecks::PostCallRecordFlushMappedMemoryRanges(VkDevice device, uint32_t memRangeCount,
+                                                       const VkMappedMemoryRange *pMemRanges, VkResult result) {
+    if (!mapped_memory_guard || (VK_SUCCESS != result)) return;
+    for (uint32_t i = 0; i < memRangeCount; ++i) {
+        const auto mem_info = GetDevMemState(pMemRanges[i].memory);
+        if (mem_info && (pMemRanges[i].offset >= mem_info->mapped_range.offset)) {
+            mapped_memory_guard->Flush(pMemRanges[i].memory, pMemRanges[i].offset - mem_info->mapped_range.offset,
+                                       pMemRanges[i].size);
+        }
+    }
+}
+
 bool CoreChecks::PreCallValidateInvalidateMappedMemoryRanges(VkDevice device, uint32_t memRangeCount,
                                                              const VkMappedMemoryRange *pMemRanges) const {
     bool skip = false;
@@ -12762,6 +12962,7 @@ void CoreChecks::PreCallRecordDestroySwapchainKHR(VkDevice device, VkSwapchainKH
         if (swapchain_data) {
             for (const auto &swapchain_image : swapchain_data->images) {
                 imageLayoutMap.erase(swapchain_image.image);
+                imageLayoutGenerationMap.erase(swapchain_image.image);
                 EraseQFOImageRelaseBarriers(swapchain_image.image);
             }
         }
@@ -12812,6 +13013,7 @@ void CoreChecks::PostCallRecordGetSwapchainImagesKHR(VkDevice device, VkSwapchai
         for (; new_swapchain_image_index < *pSwapchainImageCount; ++new_swapchain_image_index) {
             auto image_state = Get<IMAGE_STATE>(pSwapchainImages[new_swapchain_image_index]);
             AddInitialLayoutintoImageLayoutMap(*image_state, imageLayoutMap);
+            UpdateImageLayoutGeneration(image_state->image);
         }
     }
 }
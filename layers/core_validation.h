@@ -31,6 +31,7 @@
 #include "image_layout_map.h"
 #include "gpu_validation.h"
 #include "shader_validation.h"
+#include "mapped_memory_guard.h"
 
 // Set of VUID that need to go between core_validation.cpp and drawdispatch.cpp
 struct DrawDispatchVuid {
@@ -100,6 +101,13 @@ class CoreChecks : public ValidationStateTracker {
     GlobalQFOTransferBarrierMap<VkImageMemoryBarrier> qfo_release_image_barrier_map;
     GlobalQFOTransferBarrierMap<VkBufferMemoryBarrier> qfo_release_buffer_barrier_map;
     GlobalImageLayoutMap imageLayoutMap;
+    GlobalImageLayoutGenerationMap imageLayoutGenerationMap;
+    uint64_t imageLayoutGenerationCounter = 0;
+    // Checks host accesses through mapped pointers with VALIDATION_CHECK_ENABLE_MAPPED_MEMORY_GUARD, see mapped_memory_guard.h
+    std::unique_ptr<MappedMemoryGuard> mapped_memory_guard;
+    // Workers for the submit time descriptor revalidation, created by the first vkQueueSubmit with enough command buffers
+    mutable std::unique_ptr<ValidationWorkerPool> submit_validation_pool;
+    mutable std::once_flag submit_validation_pool_once;
 
     CoreChecks() { container_type = LayerObjectTypeCoreValidation; }
 
@@ -133,7 +141,11 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidateMaxTimelineSemaphoreValueDifference(VkSemaphore semaphore, uint64_t value, const char* func_name,
                                                      const char* vuid) const;
     bool ValidateCommandBuffersForSubmit(VkQueue queue, const VkSubmitInfo* submit, GlobalImageLayoutMap* localImageLayoutMap_arg,
-                                         QueryMap* local_query_to_state_map, std::vector<VkCommandBuffer>* current_cmds_arg) const;
+                                         QueryMap* local_query_to_state_map, std::vector<VkCommandBuffer>* current_cmds_arg,
+                                         SubmitDescriptorResults* descriptor_results) const;
+    bool ValidateSubmitTimeDescriptorSets(const CMD_BUFFER_STATE* cb_node) const;
+    SubmitDescriptorResults ValidateSubmitTimeDescriptorSets(uint32_t submit_count, const VkSubmitInfo* submits) const;
+    bool LogSubmitTimeMessages(std::vector<DeferredLogMessage>& messages) const;
     bool ValidateStatus(const CMD_BUFFER_STATE* pNode, CBStatusFlags status_mask, const char* fail_msg, const char* msg_code) const;
     bool ValidateDrawStateFlags(const CMD_BUFFER_STATE* pCB, const PIPELINE_STATE* pPipe, bool indexed, const char* msg_code) const;
     bool LogInvalidAttachmentMessage(const char* type1_string, const RENDER_PASS_STATE* rp1_state, const char* type2_string,
@@ -415,9 +427,11 @@ class CoreChecks : public ValidationStateTracker {
                                   const char* func_name, std::string* error_code, std::string* error_msg) const;
     // Validate contents of a WriteUpdate
     bool ValidateWriteUpdate(const DescriptorSet* descriptor_set, const VkWriteDescriptorSet* update, const char* func_name,
-                             std::string* error_code, std::string* error_msg) const;
+                             std::string* error_code, std::string* error_msg,
+                             cvdescriptorset::WriteUpdateResourceCache* resource_cache) const;
     bool VerifyWriteUpdateContents(const DescriptorSet* dest_set, const VkWriteDescriptorSet* update, const uint32_t index,
-                                   const char* func_name, std::string* error_code, std::string* error_msg) const;
+                                   const char* func_name, std::string* error_code, std::string* error_msg,
+                                   cvdescriptorset::WriteUpdateResourceCache* resource_cache) const;
     // Shared helper functions - These are useful because the shared sampler image descriptor type
     //  performs common functions with both sampler and image descriptors so they can share their common functions
     bool ValidateImageUpdate(VkImageView, VkImageLayout, VkDescriptorType, const char* func_name, std::string*, std::string*) const;
@@ -427,7 +441,8 @@ class CoreChecks : public ValidationStateTracker {
     // Descriptor Set Validation Functions
     bool ValidateSampler(VkSampler) const;
     bool ValidateBufferUpdate(VkDescriptorBufferInfo const* buffer_info, VkDescriptorType type, const char* func_name,
-                              std::string* error_code, std::string* error_msg) const;
+                              std::string* error_code, std::string* error_msg,
+                              cvdescriptorset::WriteUpdateResourceCache* resource_cache) const;
     template <typename T>
     bool ValidateAccelerationStructureUpdate(T acc, const char* func_name, std::string* error_code, std::string* error_msg) const;
     bool ValidateUpdateDescriptorSetsWithTemplateKHR(VkDescriptorSet descriptorSet, const TEMPLATE_STATE* template_state,
@@ -471,8 +486,7 @@ class CoreChecks : public ValidationStateTracker {
                                             PIPELINE_STATE const* pipeline, uint32_t subpass_index) const;
     bool ValidatePushConstantUsage(const PIPELINE_STATE& pipeline, SHADER_MODULE_STATE const* src,
                                    VkPipelineShaderStageCreateInfo const* pStage) const;
-    bool ValidateBuiltinLimits(SHADER_MODULE_STATE const* src, const std::unordered_set<uint32_t>& accessible_ids,
-                               VkShaderStageFlagBits stage) const;
+    bool ValidateBuiltinLimits(SHADER_MODULE_STATE const* src, const SpirvIdSet& accessible_ids, VkShaderStageFlagBits stage) const;
     PushConstantByteState ValidatePushConstantSetUpdate(const std::vector<uint8_t>& push_constant_data_update,
                                                         const shader_struct_member& push_constant_used_in_shader,
                                                         uint32_t& out_issue_index) const;
@@ -694,6 +708,8 @@ class CoreChecks : public ValidationStateTracker {
                                     GlobalImageLayoutMap* overlayLayoutMap_arg) const;
 
     void UpdateCmdBufImageLayouts(CMD_BUFFER_STATE* pCB);
+    uint64_t GetImageLayoutGeneration(VkImage image) const;
+    void UpdateImageLayoutGeneration(VkImage image);
 
     template <typename T1>
     bool VerifyBoundMemoryIsValid(const DEVICE_MEMORY_STATE* mem_state, const T1 object, const VulkanTypedHandle& typed_handle,
@@ -939,11 +955,13 @@ class CoreChecks : public ValidationStateTracker {
     void PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator) override;
     bool PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits,
                                     VkFence fence) const override;
+    void PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence) override;
     void PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence,
                                    VkResult result) override;
     bool PreCallValidateAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo,
                                        const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory) const override;
     bool PreCallValidateFreeMemory(VkDevice device, VkDeviceMemory mem, const VkAllocationCallbacks* pAllocator) const override;
+    void PreCallRecordFreeMemory(VkDevice device, VkDeviceMemory mem, const VkAllocationCallbacks* pAllocator) override;
     bool PreCallValidateWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences, VkBool32 waitAll,
                                       uint64_t timeout) const override;
     bool PreCallValidateQueueWaitIdle(VkQueue queue) const override;
@@ -1222,9 +1240,15 @@ class CoreChecks : public ValidationStateTracker {
                                            const VkCommandBuffer* pCommandBuffers) const override;
     bool PreCallValidateMapMemory(VkDevice device, VkDeviceMemory mem, VkDeviceSize offset, VkDeviceSize size, VkFlags flags,
                                   void** ppData) const override;
+    void PostCallRecordMapMemory(VkDevice device, VkDeviceMemory mem, VkDeviceSize offset, VkDeviceSize size, VkFlags flags,
+                                 void** ppData, VkResult result) override;
     bool PreCallValidateUnmapMemory(VkDevice device, VkDeviceMemory mem) const override;
+    void PreCallRecordUnmapMemory(VkDevice device, VkDeviceMemory mem) override;
+    void ReportGuardedMemoryAccesses(VkDeviceMemory mem, const char* func_name);
     bool PreCallValidateFlushMappedMemoryRanges(VkDevice device, uint32_t memRangeCount,
                                                 const VkMappedMemoryRange* pMemRanges) const override;
+    void PostCallRecordFlushMappedMemoryRanges(VkDevice device, uint32_t memRangeCount, const VkMappedMemoryRange* pMemRanges,
+                                               VkResult result) override;
     bool PreCallValidateInvalidateMappedMemoryRanges(VkDevice device, uint32_t memRangeCount,
                                                      const VkMappedMemoryRange* pMemRanges) const override;
     bool PreCallValidateBindImageMemory(VkDevice device, VkImage image, VkDeviceMemory mem,
@@ -1508,4 +1532,12 @@ struct LayoutUseCheckAndMessage {
         }
         return layout == kInvalidLayout;
     }
+    // True if every subresource is known to pass Check, which can only be shown without walking the range when all of them
+    // share one layout pair, and the relaxed initial use rules (which depend on the initial layout state) aren't needed.
+    bool CheckUniform(VkImageLayout check) const {
+        ImageSubresourceLayoutMap::Layouts layouts;
+        if (!layout_map->GetUniformLayouts(&layouts)) return false;
+        if (layouts.current_layout != kInvalidLayout) return ImageLayoutMatches(aspect_mask, check, layouts.current_layout);
+        return (layouts.initial_layout == kInvalidLayout) || ImageLayoutMatches(aspect_mask, check, layouts.initial_layout);
+    }
 };
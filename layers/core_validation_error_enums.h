@@ -39,6 +39,8 @@ static const char DECORATE_UNUSED *kVUID_Core_Bound_Resource_FreedMemoryAccess =
 // static const char DECORATE_UNUSED *kVUID_Core_MemTrack_FenceState = "UNASSIGNED-CoreValidation-MemTrack-FenceState";
 static const char DECORATE_UNUSED *kVUID_Core_MemTrack_InvalidMap = "UNASSIGNED-CoreValidation-MemTrack-InvalidMap";
 static const char DECORATE_UNUSED *kVUID_Core_MemTrack_InvalidState = "UNASSIGNED-CoreValidation-MemTrack-InvalidState";
+static const char DECORATE_UNUSED *kVUID_Core_MemTrack_MappedOutOfBounds = "UNASSIGNED-CoreValidation-MemTrack-MappedOutOfBounds";
+static const char DECORATE_UNUSED *kVUID_Core_MemTrack_UnflushedWrite = "UNASSIGNED-CoreValidation-MemTrack-UnflushedWrite";
 // static const char DECORATE_UNUSED *kVUID_Core_MemTrack_InvalidUsageFlag = "UNASSIGNED-CoreValidation-MemTrack-InvalidUsageFlag";
 static const char DECORATE_UNUSED *kVUID_Core_MemTrack_RebindObject = "UNASSIGNED-CoreValidation-MemTrack-RebindObject";
 // Previously defined but unused - uncomment as needed
@@ -33,6 +33,7 @@
 #include "vk_safe_struct.h"
 #include "vulkan/vulkan.h"
 #include "vk_layer_logging.h"
+#include "vk_layer_utils.h"
 #include "vk_object_types.h"
 #include "vk_extension_helper.h"
 #include "vk_typemap_helper.h"
@@ -43,6 +44,7 @@
 #include <array>
 #include <atomic>
 #include <functional>
+#include <limits>
 #include <list>
 #include <map>
 #include <memory>
@@ -203,9 +205,13 @@ struct DESCRIPTOR_POOL_STATE : BASE_NODE {
     uint32_t availableSets;  // Available descriptor sets in this pool
 
     safe_VkDescriptorPoolCreateInfo createInfo;
-    std::unordered_set<cvdescriptorset::DescriptorSet *> sets;  // Collection of all sets in this pool
-    std::map<uint32_t, uint32_t> maxDescriptorTypeCount;        // Max # of descriptors of each type in this pool
-    std::map<uint32_t, uint32_t> availableDescriptorTypeCount;  // Available # of descriptors of each type in this pool
+    std::vector<cvdescriptorset::DescriptorSet *> sets;  // Collection of all sets in this pool, see DescriptorSet::GetPoolSlot
+    DescriptorTypeCounts maxDescriptorTypeCount;        // Max # of descriptors of each type in this pool, by DescriptorTypeToIndex
+    DescriptorTypeCounts availableDescriptorTypeCount;  // Available # of descriptors of each type in this pool
+    // A pool created without VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT is only ever emptied as a whole, so the
+    // state of its sets and their descriptors is placed in this arena and reclaimed in one step by vkResetDescriptorPool.
+    // Null for pools that free sets individually.
+    std::unique_ptr<LinearArena> arena;
 
     DESCRIPTOR_POOL_STATE(const VkDescriptorPool pool, const VkDescriptorPoolCreateInfo *pCreateInfo)
         : pool(pool),
@@ -216,11 +222,11 @@ struct DESCRIPTOR_POOL_STATE : BASE_NODE {
           availableDescriptorTypeCount() {
         // Collect maximums per descriptor type.
         for (uint32_t i = 0; i < createInfo.poolSizeCount; ++i) {
-            uint32_t typeIndex = static_cast<uint32_t>(createInfo.pPoolSizes[i].type);
+            uint32_t typeIndex = DescriptorTypeToIndex(createInfo.pPoolSizes[i].type);
             // Same descriptor types can appear several times
             maxDescriptorTypeCount[typeIndex] += createInfo.pPoolSizes[i].descriptorCount;
-            availableDescriptorTypeCount[typeIndex] = maxDescriptorTypeCount[typeIndex];
         }
+        availableDescriptorTypeCount = maxDescriptorTypeCount;
     }
 };
 
@@ -229,6 +235,48 @@ struct MemRange {
     VkDeviceSize size = 0;
 };
 
+// Index of the resources bound to a memory object by the range of the memory they are bound to, so that the resources over
+// part of the memory can be found without walking every binding.  Bindings may overlap, so the range_map holds disjoint
+// segments, split at the begin and end of each binding, each listing the bindings that cover it.
+class BoundMemoryRangeMap {
+  public:
+    using RangeKey = sparse_container::range<VkDeviceSize>;
+    struct Binding {
+        VulkanTypedHandle handle;
+        RangeKey range;
+        bool operator==(const Binding &rhs) const { return (handle == rhs.handle) && (range == rhs.range); }
+    };
+
+    void Insert(const VulkanTypedHandle &handle, const RangeKey &range);
+    // Remove all of the ranges bound for handle
+    void Erase(const VulkanTypedHandle &handle);
+    bool empty() const { return ranges_by_handle_.empty(); }
+
+    // Call f(binding) once for each binding that overlaps range
+    template <typename Fn>
+    void ForEachBinding(const RangeKey &range, Fn &&f) const {
+        bool first_segment = true;
+        for (auto pos = segments_.lower_bound(range); (pos != segments_.end()) && (pos->first.begin < range.end); ++pos) {
+            for (const auto &binding : pos->second) {
+                // Every binding begins a segment, so report each in the first segment of it that is in range
+                if (first_segment || (binding.range.begin == pos->first.begin)) f(binding);
+            }
+            first_segment = false;
+        }
+    }
+    template <typename Fn>
+    void ForEachBinding(Fn &&f) const {
+        ForEachBinding(RangeKey(0, std::numeric_limits<VkDeviceSize>::max()), std::forward<Fn>(f));
+    }
+
+  private:
+    using Segment = small_vector<Binding, 1, uint32_t>;
+    void MergeSegmentsAt(VkDeviceSize offset);
+
+    sparse_container::range_map<VkDeviceSize, Segment> segments_;
+    std::unordered_map<VulkanTypedHandle, small_vector<RangeKey, 1, uint32_t>> ranges_by_handle_;
+};
+
 // Data struct for tracking memory object
 struct DEVICE_MEMORY_STATE : public BASE_NODE {
     void *object;  // Dispatchable object used to create this memory (device of swapchain)
@@ -245,16 +293,10 @@ struct DEVICE_MEMORY_STATE : public BASE_NODE {
     VkExternalMemoryHandleTypeFlags export_handle_type_flags;
     VkExternalMemoryHandleTypeFlags import_handle_type_flags;
     std::unordered_set<VulkanTypedHandle> obj_bindings;  // objects bound to this memory
-    // Convenience vectors of handles to speed up iterating over objects independently
-    std::unordered_set<VkImage> bound_images;
-    std::unordered_set<VkBuffer> bound_buffers;
-    std::unordered_set<VkAccelerationStructureNV> bound_acceleration_structures;
+    // Non-sparse bindings of images, buffers and acceleration structures, by memory range
+    BoundMemoryRangeMap bound_ranges;
 
     MemRange mapped_range;
-    void *shadow_copy_base;          // Base of layer's allocation for guard band, data, and alignment space
-    void *shadow_copy;               // Pointer to start of guard-band data before mapped region
-    uint64_t shadow_pad_size;        // Size of the guard-band data before and after actual data. It MUST be a
-                                     // multiple of limits.minMemoryMapAlignment
     void *p_driver_data;             // Pointer to application's actual memory
     VkDeviceSize fake_base_address;  // To allow a unified view of allocations, useful to Synchronization Validation
 
@@ -274,9 +316,6 @@ struct DEVICE_MEMORY_STATE : public BASE_NODE {
           export_handle_type_flags(0),
           import_handle_type_flags(0),
           mapped_range{},
-          shadow_copy_base(0),
-          shadow_copy(0),
-          shadow_pad_size(0),
           p_driver_data(0),
           fake_base_address(fake_address){};
 };
@@ -637,7 +676,10 @@ struct SubpassDependencyGraphNode {
     std::unique_ptr<VkSubpassDependency2> implicit_barrier_to_external;
 };
 
-struct RENDER_PASS_STATE : public BASE_NODE {
+// The subpass dependency graph and attachment use tables of a render pass.  They depend only on the values in the key, so
+// render passes created with the same values share one (immutable) analysis.  The analysis keeps its own copy of the create
+// info, as the dependency graph points into it.
+struct RenderPassAnalysis {
     struct AttachmentTransition {
         uint32_t prev_pass;
         uint32_t attachment;
@@ -647,7 +689,7 @@ struct RENDER_PASS_STATE : public BASE_NODE {
             : prev_pass(prev_pass_), attachment(attachment_), old_layout(old_layout_), new_layout(new_layout_) {}
     };
 
-    VkRenderPass renderPass;
+    std::vector<uint32_t> key;  // Empty when the analysis can't be shared
     safe_VkRenderPassCreateInfo2 createInfo;
     std::vector<std::vector<uint32_t>> self_dependencies;
     std::vector<DAGNode> subpassToNode;
@@ -658,10 +700,47 @@ struct RENDER_PASS_STATE : public BASE_NODE {
     std::vector<SubpassDependencyGraphNode> subpass_dependencies;
     std::vector<std::vector<AttachmentTransition>> subpass_transitions;
 
-    RENDER_PASS_STATE(VkRenderPassCreateInfo2 const *pCreateInfo) : createInfo(pCreateInfo) {}
-    RENDER_PASS_STATE(VkRenderPassCreateInfo const *pCreateInfo) {
-        ConvertVkRenderPassCreateInfoToV2KHR(*pCreateInfo, &createInfo);
-    }
+    RenderPassAnalysis(std::vector<uint32_t> &&key_, VkRenderPassCreateInfo2 const *pCreateInfo)
+        : key(std::move(key_)), createInfo(pCreateInfo) {}
+};
+
+// The values of a render pass that its compatibility with other render passes depends on, with unused attachment references
+// trimmed from the end of each list.  Render passes with the same RenderPassCompatibilityId are compatible.
+using RenderPassCompatibilityDef = std::vector<uint32_t>;
+using RenderPassCompatibilityDict =
+    hash_util::Dictionary<RenderPassCompatibilityDef, hash_util::IsOrderedContainer<RenderPassCompatibilityDef>>;
+using RenderPassCompatibilityId = RenderPassCompatibilityDict::Id;
+
+struct RENDER_PASS_STATE : public BASE_NODE {
+    using AttachmentTransition = RenderPassAnalysis::AttachmentTransition;
+
+    VkRenderPass renderPass;
+    safe_VkRenderPassCreateInfo2 createInfo;
+    RenderPassCompatibilityId compatibility;
+    std::shared_ptr<const RenderPassAnalysis> analysis;
+    // The tables of the analysis
+    const std::vector<std::vector<uint32_t>> &self_dependencies;
+    const std::vector<DAGNode> &subpassToNode;
+    const std::unordered_map<uint32_t, bool> &attachment_first_read;
+    const std::vector<uint32_t> &attachment_first_subpass;
+    const std::vector<uint32_t> &attachment_last_subpass;
+    const std::vector<bool> &attachment_first_is_transition;
+    const std::vector<SubpassDependencyGraphNode> &subpass_dependencies;
+    const std::vector<std::vector<AttachmentTransition>> &subpass_transitions;
+
+    RENDER_PASS_STATE(VkRenderPassCreateInfo2 const *pCreateInfo, RenderPassCompatibilityId &&compatibility_,
+                      std::shared_ptr<const RenderPassAnalysis> &&analysis_)
+        : createInfo(pCreateInfo),
+          compatibility(std::move(compatibility_)),
+          analysis(std::move(analysis_)),
+          self_dependencies(analysis->self_dependencies),
+          subpassToNode(analysis->subpassToNode),
+          attachment_first_read(analysis->attachment_first_read),
+          attachment_first_subpass(analysis->attachment_first_subpass),
+          attachment_last_subpass(analysis->attachment_last_subpass),
+          attachment_first_is_transition(analysis->attachment_first_is_transition),
+          subpass_dependencies(analysis->subpass_dependencies),
+          subpass_transitions(analysis->subpass_transitions) {}
 };
 
 // Autogenerated as part of the vk_validation_error_message.h codegen
@@ -887,6 +966,59 @@ struct interface_var {
           is_sampler_bias_offset(false) {}
 };
 
+// A set of SPIR-V ids, stored as a bitset over the module's id bound. Iteration is in ascending id order.
+class SpirvIdSet {
+  public:
+    class const_iterator {
+      public:
+        const_iterator(const std::vector<bool> *bits, uint32_t id) : bits_(bits), id_(id) { SkipUnset(); }
+        uint32_t operator*() const { return id_; }
+        const_iterator &operator++() {
+            ++id_;
+            SkipUnset();
+            return *this;
+        }
+        bool operator==(const const_iterator &rhs) const { return id_ == rhs.id_; }
+        bool operator!=(const const_iterator &rhs) const { return id_ != rhs.id_; }
+
+      private:
+        void SkipUnset() {
+            while ((id_ < bits_->size()) && !(*bits_)[id_]) ++id_;
+        }
+        const std::vector<bool> *bits_;
+        uint32_t id_;
+    };
+
+    explicit SpirvIdSet(uint32_t id_bound = 0) : bits_(id_bound, false), size_(0) {}
+
+    // Returns true if the id was not already present
+    bool insert(uint32_t id) {
+        if (id >= bits_.size()) bits_.resize(id + 1, false);
+        if (bits_[id]) return false;
+        bits_[id] = true;
+        ++size_;
+        return true;
+    }
+    size_t count(uint32_t id) const { return ((id < bits_.size()) && bits_[id]) ? 1 : 0; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    const_iterator begin() const { return const_iterator(&bits_, 0); }
+    const_iterator end() const { return const_iterator(&bits_, static_cast<uint32_t>(bits_.size())); }
+
+  private:
+    std::vector<bool> bits_;
+    size_t size_;
+};
+
+// The parts of a pipeline stage's state that depend only on the shader module and entry point. These are computed once per
+// entry point and shared (immutably) by every pipeline stage using it.
+struct ShaderEntryPointAnalysis {
+    SpirvIdSet accessible_ids;
+    std::vector<std::pair<descriptor_slot_t, interface_var>> descriptor_uses;
+    bool has_writable_descriptor = false;
+    bool has_atomic_descriptor = false;
+};
+
 // Safe struct that spans NV and KHR VkRayTracingPipelineCreateInfo structures.
 // It is a safe_VkRayTracingPipelineCreateInfoKHR and supports construction from
 // a VkRayTracingPipelineCreateInfoNV.
@@ -945,10 +1077,8 @@ struct SHADER_MODULE_STATE;
 class PIPELINE_STATE : public BASE_NODE {
   public:
     struct StageState {
-        std::unordered_set<uint32_t> accessible_ids;
-        std::vector<std::pair<descriptor_slot_t, interface_var>> descriptor_uses;
-        bool has_writable_descriptor;
-        bool has_atomic_descriptor;
+        // Never null once recorded, empty if the module or entry point is invalid
+        std::shared_ptr<const ShaderEntryPointAnalysis> entry_point_analysis;
         VkShaderStageFlagBits stage_flag;
         std::string entry_point_name;
         std::shared_ptr<const SHADER_MODULE_STATE> shader_state;
@@ -1240,8 +1370,17 @@ struct QFOTransferCBScoreboards {
 
 typedef std::map<QueryObject, QueryState> QueryMap;
 typedef std::unordered_map<VkEvent, VkPipelineStageFlags> EventToStageMap;
+// Result of the submit time descriptor revalidation of one command buffer, with its messages held back until the serial
+// submit validation reaches the command buffer
+struct SubmitDescriptorResult {
+    bool skip = false;
+    std::vector<DeferredLogMessage> messages;
+};
+typedef std::unordered_map<const CMD_BUFFER_STATE *, SubmitDescriptorResult> SubmitDescriptorResults;
 typedef ImageSubresourceLayoutMap::LayoutMap GlobalImageLayoutRangeMap;
 typedef std::unordered_map<VkImage, std::unique_ptr<GlobalImageLayoutRangeMap>> GlobalImageLayoutMap;
+// Device unique generation of each image's global layouts, changed whenever the layouts are (0 is never a valid generation)
+typedef std::unordered_map<VkImage, uint64_t> GlobalImageLayoutGenerationMap;
 typedef std::unordered_map<VkImage, std::unique_ptr<ImageSubresourceLayoutMap>> CommandBufferImageLayoutMap;
 
 enum LvlBindPoint {
@@ -1334,6 +1473,11 @@ struct CMD_BUFFER_STATE : public BASE_NODE {
     //  dependencies that have been broken : either destroyed objects, or updated descriptor sets
     std::vector<VulkanTypedHandle> object_bindings;
     std::vector<VulkanTypedHandle> broken_bindings;
+    // While recording, the cb_bindings links back from bound objects are journaled here (keyed by the object's cb_bindings,
+    // with the object_bindings index as value) and published together at vkEndCommandBuffer, so that recording from
+    // several threads doesn't write to objects shared between command buffers.
+    std::unordered_map<small_unordered_map<CMD_BUFFER_STATE *, int, 8> *, int> pending_cb_bindings;
+    bool journal_cb_bindings = false;
 
     QFOTransferBarrierSets<VkBufferMemoryBarrier> qfo_transfer_buffer_barriers;
     QFOTransferBarrierSets<VkImageMemoryBarrier> qfo_transfer_image_barriers;
@@ -1363,6 +1507,11 @@ struct CMD_BUFFER_STATE : public BASE_NODE {
                                    uint32_t perfQueryPass, QueryMap *localQueryToStateMap)>>
         queryUpdates;
     std::unordered_set<cvdescriptorset::DescriptorSet *> validated_descriptor_sets;
+    // The bindings of each descriptor set used by draws and dispatches, with the set's change count when the image layouts of
+    // their descriptors were last recorded.  The resources of the descriptors aren't linked to the command buffer, see
+    // ValidationStateTracker::descriptor_references.  Entries are added by ValidationStateTracker::GetDescriptorSetBindings,
+    // which indexes the command buffer under the set.
+    std::unordered_map<cvdescriptorset::DescriptorSet *, std::map<uint32_t, uint64_t>> descriptor_set_bindings;
     // Contents valid only after an index buffer is bound (CBSTATUS_INDEX_BUFFER_BOUND set)
     IndexBufferBinding index_buffer_binding;
     bool performance_lock_acquired = false;
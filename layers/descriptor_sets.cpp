@@ -57,6 +57,8 @@ using DescriptorSetLayoutId = cvdescriptorset::DescriptorSetLayoutId;
 
 // Canonical dictionary of DescriptorSetLayoutDef (without any handle/device specific information)
 cvdescriptorset::DescriptorSetLayoutDict descriptor_set_layout_dict;
+INTERCEPT_STATS_COUNTER_SOURCE("DescriptorSetLayoutDictHits", [] { return descriptor_set_layout_dict.GetStats().hits; });
+INTERCEPT_STATS_COUNTER_SOURCE("DescriptorSetLayoutDictMisses", [] { return descriptor_set_layout_dict.GetStats().misses; });
 
 DescriptorSetLayoutId GetCanonicalId(const VkDescriptorSetLayoutCreateInfo *p_create_info) {
     return descriptor_set_layout_dict.look_up(DescriptorSetLayoutDef(p_create_info));
@@ -589,26 +591,49 @@ cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, DESCRIP
     : some_update_(false),
       set_(set),
       pool_state_(pool_state),
+      pool_slot_(0),
       layout_(layout),
+      descriptors_(nullptr),
+      descriptor_count_(0),
       state_data_(state_data),
       variable_count_(variable_count),
       change_count_(0) {
+    // The block holds each binding's descriptors in an array of their class, followed by descriptors_
+    size_t store_size = 0;
+    for (uint32_t i = 0; i < layout_->GetBindingCount(); ++i) {
+        store_size += layout_->GetDescriptorCountFromIndex(i) * DescriptorSize(layout_->GetTypeFromIndex(i));
+    }
+    const size_t block_size = store_size + layout_->GetTotalDescriptorCount() * sizeof(Descriptor *);
+    void *block = nullptr;
+    if (pool_state_ && pool_state_->arena) {
+        block = pool_state_->arena->Allocate(block_size, alignof(AnyDescriptor));
+    } else {
+        owned_descriptor_block_.reset(new uint8_t[block_size]);
+        block = owned_descriptor_block_.get();
+    }
+    auto free_descriptor = static_cast<uint8_t *>(block);
+    descriptors_ = reinterpret_cast<Descriptor **>(free_descriptor + store_size);
+    auto next_descriptor = descriptors_;
+    size_t descriptor_size = 0;
+    auto next_store = [&free_descriptor, &descriptor_size]() {
+        void *store = free_descriptor;
+        free_descriptor += descriptor_size;
+        return store;
+    };
+
     // Foreach binding, create default descriptors of given type
-    descriptors_.reserve(layout_->GetTotalDescriptorCount());
-    descriptor_store_.resize(layout_->GetTotalDescriptorCount());
-    auto free_descriptor = descriptor_store_.data();
     for (uint32_t i = 0; i < layout_->GetBindingCount(); ++i) {
         auto type = layout_->GetTypeFromIndex(i);
+        descriptor_size = DescriptorSize(type);
         switch (type) {
             case VK_DESCRIPTOR_TYPE_SAMPLER: {
                 auto immut_sampler = layout_->GetImmutableSamplerPtrFromIndex(i);
                 for (uint32_t di = 0; di < layout_->GetDescriptorCountFromIndex(i); ++di) {
                     if (immut_sampler) {
-                        descriptors_.emplace_back(new ((free_descriptor++)->Sampler())
-                                                      SamplerDescriptor(state_data, immut_sampler + di));
+                        *(next_descriptor++) = new (next_store()) SamplerDescriptor(state_data, immut_sampler + di);
                         some_update_ = true;  // Immutable samplers are updated at creation
                     } else {
-                        descriptors_.emplace_back(new ((free_descriptor++)->Sampler()) SamplerDescriptor(state_data, nullptr));
+                        *(next_descriptor++) = new (next_store()) SamplerDescriptor(state_data, nullptr);
                     }
                 }
                 break;
@@ -617,12 +642,10 @@ cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, DESCRIP
                 auto immut = layout_->GetImmutableSamplerPtrFromIndex(i);
                 for (uint32_t di = 0; di < layout_->GetDescriptorCountFromIndex(i); ++di) {
                     if (immut) {
-                        descriptors_.emplace_back(new ((free_descriptor++)->ImageSampler())
-                                                      ImageSamplerDescriptor(state_data, immut + di));
+                        *(next_descriptor++) = new (next_store()) ImageSamplerDescriptor(state_data, immut + di);
                         some_update_ = true;  // Immutable samplers are updated at creation
                     } else {
-                        descriptors_.emplace_back(new ((free_descriptor++)->ImageSampler())
-                                                      ImageSamplerDescriptor(state_data, nullptr));
+                        *(next_descriptor++) = new (next_store()) ImageSamplerDescriptor(state_data, nullptr);
                     }
                 }
                 break;
@@ -632,13 +655,13 @@ cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, DESCRIP
             case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
             case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
                 for (uint32_t di = 0; di < layout_->GetDescriptorCountFromIndex(i); ++di) {
-                    descriptors_.emplace_back(new ((free_descriptor++)->Image()) ImageDescriptor(type));
+                    *(next_descriptor++) = new (next_store()) ImageDescriptor(type);
                 }
                 break;
             case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
             case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
                 for (uint32_t di = 0; di < layout_->GetDescriptorCountFromIndex(i); ++di) {
-                    descriptors_.emplace_back(new ((free_descriptor++)->Texel()) TexelDescriptor(type));
+                    *(next_descriptor++) = new (next_store()) TexelDescriptor(type);
                 }
                 break;
             case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
@@ -646,19 +669,18 @@ cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, DESCRIP
             case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
             case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
                 for (uint32_t di = 0; di < layout_->GetDescriptorCountFromIndex(i); ++di) {
-                    descriptors_.emplace_back(new ((free_descriptor++)->Buffer()) BufferDescriptor(type));
+                    *(next_descriptor++) = new (next_store()) BufferDescriptor(type);
                 }
                 break;
             case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT:
                 for (uint32_t di = 0; di < layout_->GetDescriptorCountFromIndex(i); ++di) {
-                    descriptors_.emplace_back(new ((free_descriptor++)->InlineUniform()) InlineUniformDescriptor(type));
+                    *(next_descriptor++) = new (next_store()) InlineUniformDescriptor(type);
                 }
                 break;
             case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
             case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
                 for (uint32_t di = 0; di < layout_->GetDescriptorCountFromIndex(i); ++di) {
-                    descriptors_.emplace_back(new ((free_descriptor++)->AccelerationStructure())
-                                                  AccelerationStructureDescriptor(type));
+                    *(next_descriptor++) = new (next_store()) AccelerationStructureDescriptor(type);
                 }
                 break;
             default:
@@ -666,9 +688,53 @@ cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, DESCRIP
                 break;
         }
     }
+    descriptor_count_ = static_cast<uint32_t>(next_descriptor - descriptors_);
+}
+
+size_t cvdescriptorset::DescriptorSize(VkDescriptorType type) {
+    size_t size = sizeof(AnyDescriptor);
+    switch (type) {
+        case VK_DESCRIPTOR_TYPE_SAMPLER:
+            size = sizeof(SamplerDescriptor);
+            break;
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+            size = sizeof(ImageSamplerDescriptor);
+            break;
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+            size = sizeof(ImageDescriptor);
+            break;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+            size = sizeof(TexelDescriptor);
+            break;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+            size = sizeof(BufferDescriptor);
+            break;
+        case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT:
+            size = sizeof(InlineUniformDescriptor);
+            break;
+        case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
+        case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
+            size = sizeof(AccelerationStructureDescriptor);
+            break;
+        default:
+            break;
+    }
+    // Keep the arrays of all classes at the strictest alignment, as they follow one another in a set's block
+    const size_t alignment = alignof(AnyDescriptor);
+    return (size + alignment - 1) / alignment * alignment;
 }
 
-cvdescriptorset::DescriptorSet::~DescriptorSet() {}
+cvdescriptorset::DescriptorSet::~DescriptorSet() {
+    for (uint32_t i = 0; i < descriptor_count_; ++i) {
+        descriptors_[i]->~Descriptor();
+    }
+}
 
 static std::string StringDescriptorReqViewType(descriptor_req req) {
     std::string result("");
@@ -807,7 +873,7 @@ bool CoreChecks::ValidateDescriptorSetBindingData(const CMD_BUFFER_STATE *cb_nod
                                 }
                             }
                         }
-                        if (descriptor->IsDynamic()) {
+                        if (static_cast<const BufferDescriptor *>(descriptor)->IsDynamic()) {
                             // Validate that dynamic offsets are within the buffer
                             auto buffer_size = buffer_node->createInfo.size;
                             auto range = static_cast<const BufferDescriptor *>(descriptor)->GetRange();
@@ -1441,9 +1507,11 @@ void cvdescriptorset::DescriptorSet::InvalidateBoundCmdBuffers(ValidationStateTr
 void cvdescriptorset::DescriptorSet::PerformPushDescriptorsUpdate(ValidationStateTracker *dev_data, uint32_t write_count,
                                                                   const VkWriteDescriptorSet *p_wds) {
     assert(IsPushDescriptor());
+    bool invalidate = false;
     for (uint32_t i = 0; i < write_count; i++) {
-        PerformWriteUpdate(dev_data, &p_wds[i]);
+        invalidate |= ApplyWriteUpdate(dev_data, &p_wds[i]);
     }
+    if (invalidate) InvalidateBoundCmdBuffers(dev_data);
 
     push_descriptor_set_writes.clear();
     push_descriptor_set_writes.reserve(static_cast<std::size_t>(write_count));
@@ -1454,6 +1522,16 @@ void cvdescriptorset::DescriptorSet::PerformPushDescriptorsUpdate(ValidationStat
 
 // Perform write update in given update struct
 void cvdescriptorset::DescriptorSet::PerformWriteUpdate(ValidationStateTracker *dev_data, const VkWriteDescriptorSet *update) {
+    if (ApplyWriteUpdate(dev_data, update)) InvalidateBoundCmdBuffers(dev_data);
+}
+
+// Write the descriptors of the given update, returning true if command buffers the set is bound to are invalidated by it
+bool cvdescriptorset::DescriptorSet::ApplyWriteUpdate(ValidationStateTracker *dev_data, const VkWriteDescriptorSet *update) {
+    // The updated descriptors are consecutive, even when the update rolls over to the next bindings
+    const uint32_t update_start = layout_->GetGlobalIndexRangeFromBinding(update->dstBinding).start + update->dstArrayElement;
+    const uint32_t update_end = std::min(update_start + update->descriptorCount, descriptor_count_);
+    UpdateResourceReferences(dev_data, update->dstBinding, update_start, update_end, false);
+
     // Perform update on a per-binding basis as consecutive updates roll over to next binding
     auto descriptors_remaining = update->descriptorCount;
     auto offset = update->dstArrayElement;
@@ -1492,11 +1570,10 @@ void cvdescriptorset::DescriptorSet::PerformWriteUpdate(ValidationStateTracker *
         some_update_ = true;
         change_count_++;
     }
+    UpdateResourceReferences(dev_data, update->dstBinding, update_start, update_end, true);
 
-    if (!(layout_->GetDescriptorBindingFlagsFromBinding(update->dstBinding) &
-          (VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT))) {
-        InvalidateBoundCmdBuffers(dev_data);
-    }
+    return !(layout_->GetDescriptorBindingFlagsFromBinding(update->dstBinding) &
+             (VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT));
 }
 // Validate Copy update
 bool CoreChecks::ValidateCopyUpdate(const VkCopyDescriptorSet *update, const DescriptorSet *dst_set, const DescriptorSet *src_set,
@@ -1708,10 +1785,12 @@ void cvdescriptorset::DescriptorSet::PerformCopyUpdate(ValidationStateTracker *d
                                                        const DescriptorSet *src_set) {
     auto src_start_idx = src_set->GetGlobalIndexRangeFromBinding(update->srcBinding).start + update->srcArrayElement;
     auto dst_start_idx = layout_->GetGlobalIndexRangeFromBinding(update->dstBinding).start + update->dstArrayElement;
+    const uint32_t dst_end_idx = std::min(dst_start_idx + update->descriptorCount, descriptor_count_);
+    UpdateResourceReferences(dev_data, update->dstBinding, dst_start_idx, dst_end_idx, false);
     // Update parameters all look good so perform update
     for (uint32_t di = 0; di < update->descriptorCount; ++di) {
-        auto src = src_set->descriptors_[src_start_idx + di].get();
-        auto dst = descriptors_[dst_start_idx + di].get();
+        auto src = src_set->descriptors_[src_start_idx + di];
+        auto dst = descriptors_[dst_start_idx + di];
         if (src->updated) {
             dst->CopyUpdate(state_data_, src);
             some_update_ = true;
@@ -1720,6 +1799,7 @@ void cvdescriptorset::DescriptorSet::PerformCopyUpdate(ValidationStateTracker *d
             dst->updated = false;
         }
     }
+    UpdateResourceReferences(dev_data, update->dstBinding, dst_start_idx, dst_end_idx, true);
 
     if (!(layout_->GetDescriptorBindingFlagsFromBinding(update->dstBinding) &
           (VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT))) {
@@ -1727,6 +1807,146 @@ void cvdescriptorset::DescriptorSet::PerformCopyUpdate(ValidationStateTracker *d
     }
 }
 
+// The descriptors of a binding all have the same class, so the per binding walks below choose the class once and call the
+// (final) descriptor class directly for each descriptor
+
+// Record the layouts that the image or combined image sampler descriptors of a binding use their image views in
+template <typename ImageDescriptorClass>
+static void SetImageViewInitialLayouts(ValidationStateTracker *device_data, CMD_BUFFER_STATE *cb_node,
+                                       cvdescriptorset::Descriptor *const *descriptors, uint32_t count) {
+    for (uint32_t i = 0; i < count; ++i) {
+        const auto *descriptor = static_cast<const ImageDescriptorClass *>(descriptors[i]);
+        const auto *iv_state = descriptor->GetImageViewState();
+        if (iv_state) device_data->CallSetImageViewInitialLayoutCallback(cb_node, *iv_state, descriptor->GetImageLayout());
+    }
+}
+
+template <typename ConcreteDescriptor>
+static void LinkDescriptorResources(ValidationStateTracker *device_data, CMD_BUFFER_STATE *cb_node,
+                                    cvdescriptorset::Descriptor *const *descriptors, uint32_t count) {
+    for (uint32_t i = 0; i < count; ++i) {
+        static_cast<ConcreteDescriptor *>(descriptors[i])->UpdateDrawState(device_data, cb_node);
+    }
+}
+
+// Link the resources of the count descriptors of a binding to cb_node
+static void LinkBindingDescriptorResources(ValidationStateTracker *device_data, CMD_BUFFER_STATE *cb_node,
+                                           cvdescriptorset::Descriptor *const *descriptors, uint32_t count) {
+    if (!count) return;
+    switch (descriptors[0]->GetClass()) {
+        case cvdescriptorset::PlainSampler:
+            LinkDescriptorResources<cvdescriptorset::SamplerDescriptor>(device_data, cb_node, descriptors, count);
+            break;
+        case cvdescriptorset::ImageSampler:
+            LinkDescriptorResources<cvdescriptorset::ImageSamplerDescriptor>(device_data, cb_node, descriptors, count);
+            break;
+        case cvdescriptorset::Image:
+            LinkDescriptorResources<cvdescriptorset::ImageDescriptor>(device_data, cb_node, descriptors, count);
+            break;
+        case cvdescriptorset::TexelBuffer:
+            LinkDescriptorResources<cvdescriptorset::TexelDescriptor>(device_data, cb_node, descriptors, count);
+            break;
+        case cvdescriptorset::GeneralBuffer:
+            LinkDescriptorResources<cvdescriptorset::BufferDescriptor>(device_data, cb_node, descriptors, count);
+            break;
+        case cvdescriptorset::AccelerationStructure:
+            LinkDescriptorResources<cvdescriptorset::AccelerationStructureDescriptor>(device_data, cb_node, descriptors, count);
+            break;
+        default:
+            break;
+    }
+}
+
+// Call fn with each state object that a command buffer using descriptor would be linked to by the descriptor's UpdateDrawState:
+// the sampler, image view, buffer view or acceleration structure, the image or buffer it's of and the memory bound to that
+template <typename Fn>
+static void ForEachDescriptorResource(const cvdescriptorset::Descriptor &descriptor, Fn &&fn) {
+    auto bindable = [&fn](const BINDABLE *bindable_state) {
+        fn(bindable_state);
+        for (const auto *mem_state : bindable_state->GetBoundMemory()) {
+            fn(mem_state);
+        }
+    };
+    auto image_view = [&fn, &bindable](const IMAGE_VIEW_STATE *iv_state) {
+        if (!iv_state) return;
+        fn(iv_state);
+        // Images created through WSI aren't linked, see AddCommandBufferBindingImage
+        const auto *image_state = iv_state->image_state.get();
+        if (image_state && image_state->create_from_swapchain == VK_NULL_HANDLE) bindable(image_state);
+    };
+    switch (descriptor.GetClass()) {
+        case cvdescriptorset::PlainSampler: {
+            const auto *sampler_state = static_cast<const cvdescriptorset::SamplerDescriptor &>(descriptor).GetSamplerState();
+            if (sampler_state) fn(sampler_state);
+            break;
+        }
+        case cvdescriptorset::ImageSampler: {
+            const auto &image_sampler = static_cast<const cvdescriptorset::ImageSamplerDescriptor &>(descriptor);
+            if (image_sampler.GetSamplerState()) fn(image_sampler.GetSamplerState());
+            image_view(image_sampler.GetImageViewState());
+            break;
+        }
+        case cvdescriptorset::Image:
+            image_view(static_cast<const cvdescriptorset::ImageDescriptor &>(descriptor).GetImageViewState());
+            break;
+        case cvdescriptorset::TexelBuffer: {
+            const auto *bv_state = static_cast<const cvdescriptorset::TexelDescriptor &>(descriptor).GetBufferViewState();
+            if (bv_state) {
+                fn(bv_state);
+                if (bv_state->buffer_state) bindable(bv_state->buffer_state.get());
+            }
+            break;
+        }
+        case cvdescriptorset::GeneralBuffer: {
+            const auto *buffer_state = static_cast<const cvdescriptorset::BufferDescriptor &>(descriptor).GetBufferState();
+            if (buffer_state) bindable(buffer_state);
+            break;
+        }
+        case cvdescriptorset::AccelerationStructure: {
+            const auto &acceleration_structure = static_cast<const cvdescriptorset::AccelerationStructureDescriptor &>(descriptor);
+            if (acceleration_structure.GetAccelerationStructureStateKHR()) {
+                bindable(acceleration_structure.GetAccelerationStructureStateKHR());
+            }
+            if (acceleration_structure.GetAccelerationStructureStateNV()) {
+                bindable(acceleration_structure.GetAccelerationStructureStateNV());
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+void cvdescriptorset::DescriptorSet::UpdateResourceReferences(ValidationStateTracker *dev_data, bool add) {
+    if (!layout_->GetBindingCount()) return;
+    UpdateResourceReferences(dev_data, layout_->GetBindings()[0].binding, 0, descriptor_count_, add);
+}
+
+void cvdescriptorset::DescriptorSet::UpdateResourceReferences(ValidationStateTracker *dev_data, uint32_t binding, uint32_t start,
+                                                              uint32_t end, bool add) {
+    // Push descriptor sets belong to a command buffer and have their resources linked to it at each draw
+    if (dev_data->disabled[command_buffer_state] || IsPushDescriptor()) return;
+    for (DescriptorSetLayout::ConstBindingIterator it(layout_.get(), binding); !it.AtEnd() && (start < end); ++it) {
+        const auto &range = it.GetGlobalIndexRange();
+        const uint32_t binding_end = std::min(end, range.end);
+        // The uses of these bindings aren't recorded by draws, see UpdateDrawState
+        if (!(it.GetDescriptorBindingFlags() &
+              (VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT))) {
+            const uint32_t it_binding = it.Binding();
+            for (uint32_t i = std::max(start, range.start); i < binding_end; ++i) {
+                ForEachDescriptorResource(*descriptors_[i], [this, dev_data, it_binding, add](const BASE_NODE *node) {
+                    if (add) {
+                        dev_data->AddDescriptorReference(node, this, it_binding);
+                    } else {
+                        dev_data->RemoveDescriptorReference(node, this, it_binding);
+                    }
+                });
+            }
+        }
+        start = std::max(start, binding_end);
+    }
+}
+
 // Update the drawing state for the affected descriptors.
 // Set cb_node to this set and this set to cb_node.
 // Add the bindings of the descriptor
@@ -1755,7 +1975,13 @@ void cvdescriptorset::DescriptorSet::UpdateDrawState(ValidationStateTracker *dev
     }
 
     // For the active slots, use set# to look up descriptorSet from boundDescriptorSets, and bind all of that descriptor set's
-    // resources
+    // resources.  Except for push descriptor sets, which are small and belong to the command buffer, the resources aren't
+    // linked to cb_node: only the use of the binding is recorded, with the set's change count, and the resources reach the
+    // command buffers that used them through the references the set keeps (see ValidationStateTracker::descriptor_references).
+    // The descriptors of a binding are walked for their image layouts once for each change count of the set.
+    const bool link_now = !device_data->disabled[command_buffer_state] && IsPushDescriptor();
+    auto *used_bindings = IsPushDescriptor() ? nullptr : &device_data->GetDescriptorSetBindings(cb_node, this);
+    const bool track_layouts = !device_data->disabled[image_layout_validation];
     CMD_BUFFER_STATE::CmdDrawDispatchInfo cmd_info = {};
     for (auto binding_req_pair : binding_req_map) {
         auto index = layout_->GetIndexFromBinding(binding_req_pair.first);
@@ -1768,9 +1994,25 @@ void cvdescriptorset::DescriptorSet::UpdateDrawState(ValidationStateTracker *dev
             }
             continue;
         }
+        if (used_bindings) {
+            auto used = used_bindings->emplace(binding_req_pair.first, change_count_);
+            if (!used.second) {
+                if (used.first->second == change_count_) continue;
+                used.first->second = change_count_;
+            }
+        }
         auto range = layout_->GetGlobalIndexRangeFromIndex(index);
-        for (uint32_t i = range.start; i < range.end; ++i) {
-            descriptors_[i]->UpdateDrawState(device_data, cb_node);
+        if (range.start == range.end) continue;
+        Descriptor *const *descriptors = &descriptors_[range.start];
+        const uint32_t count = range.end - range.start;
+        if (link_now) LinkBindingDescriptorResources(device_data, cb_node, descriptors, count);
+        if (track_layouts) {
+            const auto descriptor_class = descriptors[0]->GetClass();
+            if (descriptor_class == ImageSampler) {
+                SetImageViewInitialLayouts<ImageSamplerDescriptor>(device_data, cb_node, descriptors, count);
+            } else if (descriptor_class == Image) {
+                SetImageViewInitialLayouts<ImageDescriptor>(device_data, cb_node, descriptors, count);
+            }
         }
     }
 
@@ -2200,7 +2442,6 @@ void cvdescriptorset::ImageSamplerDescriptor::UpdateDrawState(ValidationStateTra
     auto iv_state = GetImageViewState();
     if (iv_state) {
         dev_data->AddCommandBufferBindingImageView(cb_node, iv_state);
-        dev_data->CallSetImageViewInitialLayoutCallback(cb_node, *iv_state, image_layout_);
     }
 }
 
@@ -2230,7 +2471,6 @@ void cvdescriptorset::ImageDescriptor::UpdateDrawState(ValidationStateTracker *d
     auto iv_state = GetImageViewState();
     if (iv_state) {
         dev_data->AddCommandBufferBindingImageView(cb_node, iv_state);
-        dev_data->CallSetImageViewInitialLayoutCallback(cb_node, *iv_state, image_layout_);
     }
 }
 
@@ -2346,10 +2586,13 @@ void cvdescriptorset::AccelerationStructureDescriptor::UpdateDrawState(Validatio
 bool CoreChecks::ValidateUpdateDescriptorSets(uint32_t write_count, const VkWriteDescriptorSet *p_wds, uint32_t copy_count,
                                               const VkCopyDescriptorSet *p_cds, const char *func_name) const {
     bool skip = false;
+    cvdescriptorset::WriteUpdateResourceCache resource_cache;
+    const DescriptorSet *set_node = nullptr;
     // Validate Write updates
     for (uint32_t i = 0; i < write_count; i++) {
         auto dest_set = p_wds[i].dstSet;
-        auto set_node = GetSetNode(dest_set);
+        // Writes to one set usually come together, so look the set up once for each run of them
+        if (i == 0 || dest_set != p_wds[i - 1].dstSet) set_node = GetSetNode(dest_set);
         if (!set_node) {
             skip |=
                 LogError(dest_set, kVUID_Core_DrawState_InvalidDescriptorSet, "Cannot call %s on %s that has not been allocated.",
@@ -2357,7 +2600,7 @@ bool CoreChecks::ValidateUpdateDescriptorSets(uint32_t write_count, const VkWrit
         } else {
             std::string error_code;
             std::string error_str;
-            if (!ValidateWriteUpdate(set_node, &p_wds[i], func_name, &error_code, &error_str)) {
+            if (!ValidateWriteUpdate(set_node, &p_wds[i], func_name, &error_code, &error_str, &resource_cache)) {
                 skip |= LogError(dest_set, error_code, "%s failed write update validation for %s with error: %s.", func_name,
                                  report_data->FormatHandle(dest_set).c_str(), error_str.c_str());
             }
@@ -2425,15 +2668,22 @@ bool CoreChecks::ValidateUpdateDescriptorSets(uint32_t write_count, const VkWrit
 void cvdescriptorset::PerformUpdateDescriptorSets(ValidationStateTracker *dev_data, uint32_t write_count,
                                                   const VkWriteDescriptorSet *p_wds, uint32_t copy_count,
                                                   const VkCopyDescriptorSet *p_cds) {
-    // Write updates first
+    // Write updates first.  Writes to one set usually come together, so the set is looked up, and the command buffers it is
+    // bound to are invalidated, once for each run of them rather than for each write.
     uint32_t i = 0;
+    DescriptorSet *set_node = nullptr;
+    bool invalidate = false;
     for (i = 0; i < write_count; ++i) {
-        auto dest_set = p_wds[i].dstSet;
-        auto set_node = dev_data->GetSetNode(dest_set);
+        if (i == 0 || p_wds[i].dstSet != p_wds[i - 1].dstSet) {
+            if (invalidate) set_node->InvalidateBoundCmdBuffers(dev_data);
+            invalidate = false;
+            set_node = dev_data->GetSetNode(p_wds[i].dstSet);
+        }
         if (set_node) {
-            set_node->PerformWriteUpdate(dev_data, &p_wds[i]);
+            invalidate |= set_node->ApplyWriteUpdate(dev_data, &p_wds[i]);
         }
     }
+    if (invalidate) set_node->InvalidateBoundCmdBuffers(dev_data);
     // Now copy updates
     for (i = 0; i < copy_count; ++i) {
         auto dst_set = p_cds[i].dstSet;
@@ -2459,6 +2709,32 @@ cvdescriptorset::DecodedTemplateUpdate::DecodedTemplateUpdate(const ValidationSt
                                               : push_layout;
     auto layout_obj = device_data->GetDescriptorSetLayoutShared(effective_dsl);
 
+    if (!template_state->decoded_writes.empty() && layout_obj &&
+        (layout_obj->GetLayoutDef() == template_state->decoded_layout_def.get())) {
+        desc_writes = template_state->decoded_writes;
+        for (size_t i = 0; i < desc_writes.size(); i++) {
+            auto &write_entry = desc_writes[i];
+            const char *update_entry = static_cast<const char *>(pData) + template_state->decoded_write_offsets[i];
+            write_entry.dstSet = descriptorSet;
+            switch (write_entry.descriptorType) {
+                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+                    write_entry.pBufferInfo = reinterpret_cast<const VkDescriptorBufferInfo *>(update_entry);
+                    break;
+                case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+                case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                    write_entry.pTexelBufferView = reinterpret_cast<const VkBufferView *>(update_entry);
+                    break;
+                default:
+                    write_entry.pImageInfo = reinterpret_cast<const VkDescriptorImageInfo *>(update_entry);
+                    break;
+            }
+        }
+        return;
+    }
+
     // Create a WriteDescriptorSet struct for each template update entry
     for (uint32_t i = 0; i < create_info.descriptorUpdateEntryCount; i++) {
         auto binding_count = layout_obj->GetDescriptorCountFromBinding(create_info.pDescriptorUpdateEntries[i].dstBinding);
@@ -2545,6 +2821,85 @@ cvdescriptorset::DecodedTemplateUpdate::DecodedTemplateUpdate(const ValidationSt
         }
     }
 }
+void cvdescriptorset::DecodedTemplateUpdate::DecodeAhead(const ValidationStateTracker *device_data,
+                                                         TEMPLATE_STATE *template_state) {
+    auto const &create_info = template_state->create_info;
+    std::shared_ptr<DescriptorSetLayout const> layout_obj;
+    if (create_info.templateType == VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET) {
+        layout_obj = device_data->GetDescriptorSetLayoutShared(create_info.descriptorSetLayout);
+    } else {
+        layout_obj = GetDslFromPipelineLayout(device_data->GetPipelineLayout(create_info.pipelineLayout), create_info.set);
+    }
+    if (!layout_obj) return;
+
+    // Inline uniform blocks and acceleration structures need extension structs for each update, so decode those afresh
+    for (uint32_t i = 0; i < create_info.descriptorUpdateEntryCount; i++) {
+        switch (create_info.pDescriptorUpdateEntries[i].descriptorType) {
+            case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT:
+            case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
+            case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
+                return;
+            default:
+                break;
+        }
+    }
+
+    std::vector<VkWriteDescriptorSet> decoded_writes;
+    std::vector<size_t> decoded_write_offsets;
+    // Walk the entries as the DecodedTemplateUpdate constructor does, merging the descriptors of an entry that land in
+    // consecutive elements of one binding, and are tightly packed in pData, into a single write
+    for (uint32_t i = 0; i < create_info.descriptorUpdateEntryCount; i++) {
+        const auto &update_entry = create_info.pDescriptorUpdateEntries[i];
+        auto binding_count = layout_obj->GetDescriptorCountFromBinding(update_entry.dstBinding);
+        auto binding_being_updated = update_entry.dstBinding;
+        auto dst_array_element = update_entry.dstArrayElement;
+
+        size_t element_size = sizeof(VkDescriptorImageInfo);
+        switch (update_entry.descriptorType) {
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+                element_size = sizeof(VkDescriptorBufferInfo);
+                break;
+            case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                element_size = sizeof(VkBufferView);
+                break;
+            default:
+                break;
+        }
+        const bool packed = (update_entry.stride == element_size);
+
+        for (uint32_t j = 0; j < update_entry.descriptorCount; j++) {
+            bool new_write = (j == 0) || !packed;
+            if (dst_array_element >= binding_count) {
+                dst_array_element = 0;
+                binding_being_updated = layout_obj->GetNextValidBinding(binding_being_updated);
+                new_write = true;
+            }
+
+            if (new_write) {
+                VkWriteDescriptorSet write_entry = {};
+                write_entry.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+                write_entry.dstBinding = binding_being_updated;
+                write_entry.dstArrayElement = dst_array_element;
+                write_entry.descriptorCount = 1;
+                write_entry.descriptorType = update_entry.descriptorType;
+                decoded_writes.emplace_back(write_entry);
+                decoded_write_offsets.emplace_back(update_entry.offset + j * update_entry.stride);
+            } else {
+                decoded_writes.back().descriptorCount++;
+            }
+            dst_array_element++;
+        }
+    }
+
+    template_state->decoded_layout_def = layout_obj->GetLayoutId();
+    template_state->decoded_writes = std::move(decoded_writes);
+    template_state->decoded_write_offsets = std::move(decoded_write_offsets);
+}
+
 // These helper functions carry out the validate and record descriptor updates peformed via update templates. They decode
 // the templatized data and leverage the non-template UpdateDescriptor helper functions.
 bool CoreChecks::ValidateUpdateDescriptorSetsWithTemplateKHR(VkDescriptorSet descriptorSet, const TEMPLATE_STATE *template_state,
@@ -2576,10 +2931,11 @@ bool CoreChecks::ValidatePushDescriptorsUpdate(const DescriptorSet *push_set, ui
                                                const VkWriteDescriptorSet *p_wds, const char *func_name) const {
     assert(push_set->IsPushDescriptor());
     bool skip = false;
+    cvdescriptorset::WriteUpdateResourceCache resource_cache;
     for (uint32_t i = 0; i < write_count; i++) {
         std::string error_code;
         std::string error_str;
-        if (!ValidateWriteUpdate(push_set, &p_wds[i], func_name, &error_code, &error_str)) {
+        if (!ValidateWriteUpdate(push_set, &p_wds[i], func_name, &error_code, &error_str, &resource_cache)) {
             skip |= LogError(push_set->GetDescriptorSetLayout(), error_code, "%s failed update validation: %s.", func_name,
                              error_str.c_str());
         }
@@ -2642,20 +2998,31 @@ bool cvdescriptorset::ValidateBufferUsage(debug_report_data *report_data, BUFFER
 //  5. range and offset are within the device's limits
 // If there's an error, update the error_msg string with details and return false, else return true
 bool CoreChecks::ValidateBufferUpdate(VkDescriptorBufferInfo const *buffer_info, VkDescriptorType type, const char *func_name,
-                                      std::string *error_code, std::string *error_msg) const {
-    // First make sure that buffer is valid
-    auto buffer_node = GetBufferState(buffer_info->buffer);
-    // Any invalid buffer should already be caught by object_tracker
-    assert(buffer_node);
-    if (ValidateMemoryIsBoundToBuffer(buffer_node, func_name, "VUID-VkWriteDescriptorSet-descriptorType-00329")) {
-        *error_code = "VUID-VkWriteDescriptorSet-descriptorType-00329";
-        *error_msg = "No memory bound to buffer.";
-        return false;
-    }
-    // Verify usage bits
-    if (!cvdescriptorset::ValidateBufferUsage(report_data, buffer_node, type, error_code, error_msg)) {
-        // error_msg will have been updated by ValidateBufferUsage()
-        return false;
+                                      std::string *error_code, std::string *error_msg,
+                                      cvdescriptorset::WriteUpdateResourceCache *resource_cache) const {
+    // Checks 1 and 2 depend only on the buffer and type, so are made once per call
+    const cvdescriptorset::WriteUpdateResourceCache::Key key = {HandleToUint64(buffer_info->buffer), VK_IMAGE_LAYOUT_UNDEFINED,
+                                                                type};
+    const BUFFER_STATE *buffer_node = nullptr;
+    auto cached = resource_cache->valid_buffers.find(key);
+    if (cached != resource_cache->valid_buffers.end()) {
+        buffer_node = cached->second;
+    } else {
+        // First make sure that buffer is valid
+        buffer_node = GetBufferState(buffer_info->buffer);
+        // Any invalid buffer should already be caught by object_tracker
+        assert(buffer_node);
+        if (ValidateMemoryIsBoundToBuffer(buffer_node, func_name, "VUID-VkWriteDescriptorSet-descriptorType-00329")) {
+            *error_code = "VUID-VkWriteDescriptorSet-descriptorType-00329";
+            *error_msg = "No memory bound to buffer.";
+            return false;
+        }
+        // Verify usage bits
+        if (!cvdescriptorset::ValidateBufferUsage(report_data, buffer_node, type, error_code, error_msg)) {
+            // error_msg will have been updated by ValidateBufferUsage()
+            return false;
+        }
+        resource_cache->valid_buffers.emplace(key, buffer_node);
     }
     // offset must be less than buffer size
     if (buffer_info->offset >= buffer_node->createInfo.size) {
@@ -2935,16 +3302,15 @@ bool CoreChecks::ValidateAllocateDescriptorSets(const VkDescriptorSetAllocateInf
                              pool_state->availableSets);
         }
         // Determine whether descriptor counts are satisfiable
-        for (auto it = ds_data->required_descriptors_by_type.begin(); it != ds_data->required_descriptors_by_type.end(); ++it) {
-            auto count_iter = pool_state->availableDescriptorTypeCount.find(it->first);
-            uint32_t available_count = (count_iter != pool_state->availableDescriptorTypeCount.end()) ? count_iter->second : 0;
+        for (uint32_t type_index = 0; type_index < kDescriptorTypeIndexCount; ++type_index) {
+            const uint32_t required_count = ds_data->required_descriptors_by_type[type_index];
+            const uint32_t available_count = pool_state->availableDescriptorTypeCount[type_index];
 
-            if (ds_data->required_descriptors_by_type.at(it->first) > available_count) {
+            if (required_count > available_count) {
                 skip |= LogError(pool_state->pool, "VUID-VkDescriptorSetAllocateInfo-descriptorPool-00307",
                                  "Unable to allocate %u descriptors of type %s from %s"
                                  ". This pool only has %d descriptors of this type remaining.",
-                                 ds_data->required_descriptors_by_type.at(it->first),
-                                 string_VkDescriptorType(VkDescriptorType(it->first)),
+                                 required_count, string_VkDescriptorType(DescriptorTypeFromIndex(type_index)),
                                  report_data->FormatHandle(pool_state->pool).c_str(), available_count);
             }
         }
@@ -3049,7 +3415,8 @@ bool cvdescriptorset::VerifyUpdateConsistency(debug_report_data *report_data,
 // Validate the state for a given write update but don't actually perform the update
 //  If an error would occur for this update, return false and fill in details in error_msg string
 bool CoreChecks::ValidateWriteUpdate(const DescriptorSet *dest_set, const VkWriteDescriptorSet *update, const char *func_name,
-                                     std::string *error_code, std::string *error_msg) const {
+                                     std::string *error_code, std::string *error_msg,
+                                     cvdescriptorset::WriteUpdateResourceCache *resource_cache) const {
     const auto dest_layout = dest_set->GetLayout().get();
 
     // Verify dst layout still valid
@@ -3156,7 +3523,7 @@ bool CoreChecks::ValidateWriteUpdate(const DescriptorSet *dest_set, const VkWrit
     // Verify all bindings update share identical properties across all items
     if (update->descriptorCount > 0) {
         // Save first binding information and error if something different is found
-        DescriptorSetLayout::ConstBindingIterator current_binding(dest_layout, update->dstBinding);
+        DescriptorSetLayout::ConstBindingIterator current_binding = dest;
         VkShaderStageFlags stage_flags = current_binding.GetStageFlags();
         VkDescriptorType descriptor_type = current_binding.GetType();
         bool immutable_samplers = (current_binding.GetImmutableSamplerPtr() == nullptr);
@@ -3198,9 +3565,8 @@ bool CoreChecks::ValidateWriteUpdate(const DescriptorSet *dest_set, const VkWrit
     }
 
     // Verify consecutive bindings match (if needed)
-    if (!VerifyUpdateConsistency(report_data, DescriptorSetLayout::ConstBindingIterator(dest_layout, update->dstBinding),
-                                 update->dstArrayElement, update->descriptorCount, "write update to", dest_set->GetSet(),
-                                 error_msg)) {
+    if (!VerifyUpdateConsistency(report_data, dest, update->dstArrayElement, update->descriptorCount, "write update to",
+                                 dest_set->GetSet(), error_msg)) {
         // TODO : Should break out "consecutive binding updates" language into valid usage statements
         *error_code = "VUID-VkWriteDescriptorSet-dstArrayElement-00321";
         return false;
@@ -3218,7 +3584,7 @@ bool CoreChecks::ValidateWriteUpdate(const DescriptorSet *dest_set, const VkWrit
         }
     }
     // Update is within bounds and consistent so last step is to validate update contents
-    if (!VerifyWriteUpdateContents(dest_set, update, start_idx, func_name, error_code, error_msg)) {
+    if (!VerifyWriteUpdateContents(dest_set, update, start_idx, func_name, error_code, error_msg, resource_cache)) {
         std::stringstream error_str;
         error_str << "Write update to " << dest_set->StringifySetAndLayout() << " binding #" << update->dstBinding
                   << " failed with error message: " << error_msg->c_str();
@@ -3231,9 +3597,30 @@ bool CoreChecks::ValidateWriteUpdate(const DescriptorSet *dest_set, const VkWrit
 
 // Verify that the contents of the update are ok, but don't perform actual update
 bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet *dest_set, const VkWriteDescriptorSet *update, const uint32_t index,
-                                           const char *func_name, std::string *error_code, std::string *error_msg) const {
+                                           const char *func_name, std::string *error_code, std::string *error_msg,
+                                           cvdescriptorset::WriteUpdateResourceCache *resource_cache) const {
     using ImageSamplerDescriptor = cvdescriptorset::ImageSamplerDescriptor;
     using Descriptor = cvdescriptorset::Descriptor;
+    using ResourceKey = cvdescriptorset::WriteUpdateResourceCache::Key;
+
+    // Resource lookups and checks shared with the other writes of this call
+    auto get_image_view_state = [this, resource_cache](VkImageView image_view) {
+        auto result = resource_cache->image_views.emplace(image_view, nullptr);
+        if (result.second) result.first->second = GetImageViewState(image_view);
+        return result.first->second;
+    };
+    auto get_sampler_state = [this, resource_cache](VkSampler sampler) {
+        auto result = resource_cache->samplers.emplace(sampler, nullptr);
+        if (result.second) result.first->second = GetSamplerState(sampler);
+        return result.first->second;
+    };
+    auto validate_image_update = [&](VkImageView image_view, VkImageLayout image_layout) {
+        const ResourceKey key = {HandleToUint64(image_view), image_layout, update->descriptorType};
+        if (resource_cache->valid_image_updates.count(key)) return true;
+        if (!ValidateImageUpdate(image_view, image_layout, update->descriptorType, func_name, error_code, error_msg)) return false;
+        resource_cache->valid_image_updates.insert(key);
+        return true;
+    };
 
     switch (update->descriptorType) {
         case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER: {
@@ -3242,12 +3629,12 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet *dest_set, const
                 auto image_view = update->pImageInfo[di].imageView;
                 auto image_layout = update->pImageInfo[di].imageLayout;
                 auto sampler = update->pImageInfo[di].sampler;
-                auto iv_state = GetImageViewState(image_view);
+                auto iv_state = get_image_view_state(image_view);
                 const ImageSamplerDescriptor *desc =
                     (const ImageSamplerDescriptor *)dest_set->GetDescriptorFromGlobalIndex(index + di);
                 if (image_view) {
                     auto image_state = iv_state->image_state.get();
-                    if (!ValidateImageUpdate(image_view, image_layout, update->descriptorType, func_name, error_code, error_msg)) {
+                    if (!validate_image_update(image_view, image_layout)) {
                         std::stringstream error_str;
                         error_str << "Attempted write update to combined image sampler descriptor failed due to: "
                                   << error_msg->c_str();
@@ -3256,7 +3643,7 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet *dest_set, const
                     }
                     if (device_extensions.vk_khr_sampler_ycbcr_conversion) {
                         if (desc->IsImmutableSampler()) {
-                            auto sampler_state = GetSamplerState(desc->GetSampler());
+                            auto sampler_state = get_sampler_state(desc->GetSampler());
                             if (iv_state && sampler_state) {
                                 if (iv_state->samplerConversion != sampler_state->samplerConversion) {
                                     *error_code = "VUID-VkWriteDescriptorSet-descriptorType-01948";
@@ -3312,7 +3699,7 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet *dest_set, const
                     }
 
                     // Verify portability
-                    auto sampler_state = GetSamplerState(sampler);
+                    auto sampler_state = get_sampler_state(sampler);
                     if (sampler_state) {
                         if (ExtEnabled::kNotEnabled != device_extensions.vk_khr_portability_subset) {
                             if ((VK_FALSE == enabled_features.portability_subset_features.mutableComparisonSamplers) &&
@@ -3330,7 +3717,7 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet *dest_set, const
             for (uint32_t di = 0; di < update->descriptorCount; ++di) {
                 const auto *desc = static_cast<const Descriptor *>(dest_set->GetDescriptorFromGlobalIndex(index + di));
                 if (!desc->IsImmutableSampler()) {
-                    if (!ValidateSampler(update->pImageInfo[di].sampler)) {
+                    if (!get_sampler_state(update->pImageInfo[di].sampler)) {
                         *error_code = "VUID-VkWriteDescriptorSet-descriptorType-00325";
                         std::stringstream error_str;
                         error_str << "Attempted write update to sampler descriptor with invalid sampler: "
@@ -3355,7 +3742,7 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet *dest_set, const
                 auto image_view = update->pImageInfo[di].imageView;
                 auto image_layout = update->pImageInfo[di].imageLayout;
                 if (image_view) {
-                    if (!ValidateImageUpdate(image_view, image_layout, update->descriptorType, func_name, error_code, error_msg)) {
+                    if (!validate_image_update(image_view, image_layout)) {
                         std::stringstream error_str;
                         error_str << "Attempted write update to image descriptor failed due to: " << error_msg->c_str();
                         *error_msg = error_str.str();
@@ -3369,7 +3756,8 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet *dest_set, const
         case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER: {
             for (uint32_t di = 0; di < update->descriptorCount; ++di) {
                 auto buffer_view = update->pTexelBufferView[di];
-                if (buffer_view) {
+                const ResourceKey key = {HandleToUint64(buffer_view), VK_IMAGE_LAYOUT_UNDEFINED, update->descriptorType};
+                if (buffer_view && !resource_cache->valid_buffer_views.count(key)) {
                     auto bv_state = GetBufferViewState(buffer_view);
                     if (!bv_state) {
                         *error_code = "VUID-VkWriteDescriptorSet-descriptorType-02994";
@@ -3396,6 +3784,7 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet *dest_set, const
                         *error_msg = error_str.str();
                         return false;
                     }
+                    resource_cache->valid_buffer_views.insert(key);
                 }
             }
             break;
@@ -3406,7 +3795,8 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet *dest_set, const
         case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC: {
             for (uint32_t di = 0; di < update->descriptorCount; ++di) {
                 if (update->pBufferInfo[di].buffer) {
-                    if (!ValidateBufferUpdate(update->pBufferInfo + di, update->descriptorType, func_name, error_code, error_msg)) {
+                    if (!ValidateBufferUpdate(update->pBufferInfo + di, update->descriptorType, func_name, error_code, error_msg,
+                                              resource_cache)) {
                         std::stringstream error_str;
                         error_str << "Attempted write update to buffer descriptor failed due to: " << error_msg->c_str();
                         *error_msg = error_str.str();
@@ -350,7 +350,15 @@ class DescriptorSetLayout : public BASE_NODE {
  */
 
 // Slightly broader than type, each c++ "class" will has a corresponding "DescriptorClass"
-enum DescriptorClass { PlainSampler, ImageSampler, Image, TexelBuffer, GeneralBuffer, InlineUniform, AccelerationStructure };
+enum DescriptorClass : uint8_t {
+    PlainSampler,
+    ImageSampler,
+    Image,
+    TexelBuffer,
+    GeneralBuffer,
+    InlineUniform,
+    AccelerationStructure
+};
 
 class Descriptor {
   public:
@@ -359,15 +367,17 @@ class Descriptor {
     virtual void CopyUpdate(const ValidationStateTracker *dev_data, const Descriptor *) = 0;
     // Create binding between resources of this descriptor and given cb_node
     virtual void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *) = 0;
-    virtual DescriptorClass GetClass() const { return descriptor_class; };
+    DescriptorClass GetClass() const { return descriptor_class; };
     // Special fast-path check for SamplerDescriptors that are immutable
     virtual bool IsImmutableSampler() const { return false; };
     // Check for dynamic descriptor type
     virtual bool IsDynamic() const { return false; };
     // Check for storage descriptor type
     virtual bool IsStorage() const { return false; };
-    bool updated;  // Has descriptor been updated?
+    // Kept small and together after the vtable pointer, so that the flags of each descriptor class can be packed in beside
+    // them by compilers that reuse a base class's tail padding
     DescriptorClass descriptor_class;
+    bool updated;  // Has descriptor been updated?
 };
 
 // Return true if this layout is compatible with passed in layout from a pipelineLayout,
@@ -382,7 +392,7 @@ bool ValidateDescriptorSetLayoutCreateInfo(const ValidationObject *val_obj, cons
                                            const VkPhysicalDeviceInlineUniformBlockPropertiesEXT *inline_uniform_block_props,
                                            const DeviceExtensions *device_extensions);
 
-class SamplerDescriptor : public Descriptor {
+class SamplerDescriptor final : public Descriptor {
   public:
     SamplerDescriptor(const ValidationStateTracker *dev_data, const VkSampler *);
     void WriteUpdate(const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t) override;
@@ -399,7 +409,7 @@ class SamplerDescriptor : public Descriptor {
     std::shared_ptr<SAMPLER_STATE> sampler_state_;
 };
 
-class ImageSamplerDescriptor : public Descriptor {
+class ImageSamplerDescriptor final : public Descriptor {
   public:
     ImageSamplerDescriptor(const ValidationStateTracker *dev_data, const VkSampler *);
     void WriteUpdate(const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t) override;
@@ -417,13 +427,13 @@ class ImageSamplerDescriptor : public Descriptor {
     std::shared_ptr<SAMPLER_STATE> GetSharedSamplerState() const { return sampler_state_; }
 
   private:
-    std::shared_ptr<SAMPLER_STATE> sampler_state_;
     bool immutable_;
-    std::shared_ptr<IMAGE_VIEW_STATE> image_view_state_;
     VkImageLayout image_layout_;
+    std::shared_ptr<SAMPLER_STATE> sampler_state_;
+    std::shared_ptr<IMAGE_VIEW_STATE> image_view_state_;
 };
 
-class ImageDescriptor : public Descriptor {
+class ImageDescriptor final : public Descriptor {
   public:
     ImageDescriptor(const VkDescriptorType);
     void WriteUpdate(const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t) override;
@@ -438,11 +448,11 @@ class ImageDescriptor : public Descriptor {
 
   private:
     bool storage_;
-    std::shared_ptr<IMAGE_VIEW_STATE> image_view_state_;
     VkImageLayout image_layout_;
+    std::shared_ptr<IMAGE_VIEW_STATE> image_view_state_;
 };
 
-class TexelDescriptor : public Descriptor {
+class TexelDescriptor final : public Descriptor {
   public:
     TexelDescriptor(const VkDescriptorType);
     void WriteUpdate(const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t) override;
@@ -459,7 +469,7 @@ class TexelDescriptor : public Descriptor {
     std::shared_ptr<BUFFER_VIEW_STATE> buffer_view_state_;
 };
 
-class BufferDescriptor : public Descriptor {
+class BufferDescriptor final : public Descriptor {
   public:
     BufferDescriptor(const VkDescriptorType);
     void WriteUpdate(const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t) override;
@@ -482,7 +492,7 @@ class BufferDescriptor : public Descriptor {
     std::shared_ptr<BUFFER_STATE> buffer_state_;
 };
 
-class InlineUniformDescriptor : public Descriptor {
+class InlineUniformDescriptor final : public Descriptor {
   public:
     InlineUniformDescriptor(const VkDescriptorType) {
         updated = false;
@@ -495,7 +505,7 @@ class InlineUniformDescriptor : public Descriptor {
     void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *) override {}
 };
 
-class AccelerationStructureDescriptor : public Descriptor {
+class AccelerationStructureDescriptor final : public Descriptor {
   public:
     AccelerationStructureDescriptor(const VkDescriptorType);
     void WriteUpdate(const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t) override;
@@ -528,26 +538,16 @@ union AnyDescriptor {
     ~AnyDescriptor() = delete;
 };
 
-struct alignas(alignof(AnyDescriptor)) DescriptorBackingStore {
-    uint8_t data[sizeof(AnyDescriptor)];
-
-    SamplerDescriptor *Sampler() { return &(reinterpret_cast<AnyDescriptor *>(this)->sampler); }
-    ImageSamplerDescriptor *ImageSampler() { return &(reinterpret_cast<AnyDescriptor *>(this)->image_sampler); }
-    ImageDescriptor *Image() { return &(reinterpret_cast<AnyDescriptor *>(this)->image); }
-    TexelDescriptor *Texel() { return &(reinterpret_cast<AnyDescriptor *>(this)->texel); }
-    BufferDescriptor *Buffer() { return &(reinterpret_cast<AnyDescriptor *>(this)->buffer); }
-    InlineUniformDescriptor *InlineUniform() { return &(reinterpret_cast<AnyDescriptor *>(this)->inline_uniform); }
-    AccelerationStructureDescriptor *AccelerationStructure() {
-        return &(reinterpret_cast<AnyDescriptor *>(this)->accelerator_structure);
-    }
-};
+// Storage taken by a descriptor of the given type within a set.  Each binding's descriptors are stored in an array of their
+// own class, so a sampler binding doesn't take the space of the largest descriptor class.
+size_t DescriptorSize(VkDescriptorType type);
 
 // Structs to contain common elements that need to be shared between Validate* and Perform* calls below
 struct AllocateDescriptorSetsData {
-    std::map<uint32_t, uint32_t> required_descriptors_by_type;
+    DescriptorTypeCounts required_descriptors_by_type;  // By DescriptorTypeToIndex
     std::vector<std::shared_ptr<DescriptorSetLayout const>> layout_nodes;
     void Init(uint32_t);
-    AllocateDescriptorSetsData(){};
+    AllocateDescriptorSetsData() : required_descriptors_by_type(){};
 };
 // Helper functions for descriptor set functions that cross multiple sets
 // "Validate" will make sure an update is ok without actually performing it
@@ -578,6 +578,30 @@ struct DecodedTemplateUpdate {
     DecodedTemplateUpdate(const ValidationStateTracker *device_data, VkDescriptorSet descriptorSet,
                           const TEMPLATE_STATE *template_state, const void *pData,
                           VkDescriptorSetLayout push_layout = VK_NULL_HANDLE);
+
+    // Decode the update entries against the template's layout at template creation, so that each update only has to point
+    // the decoded writes at its pData
+    static void DecodeAhead(const ValidationStateTracker *device_data, TEMPLATE_STATE *template_state);
+};
+
+// The resources written by one vkUpdateDescriptorSets or push descriptor call, each looked up once.  A batch of writes often
+// names the same image view, sampler or buffer many times, so the checks that depend only on the resource (and on the layout
+// and descriptor type it is written with) are remembered once they pass and not repeated for the rest of the call.
+struct WriteUpdateResourceCache {
+    struct Key {
+        uint64_t handle;
+        VkImageLayout layout;
+        VkDescriptorType type;
+        bool operator==(const Key &rhs) const { return handle == rhs.handle && layout == rhs.layout && type == rhs.type; }
+        size_t hash() const { return hash_util::HashCombiner().Combine(handle).Combine(layout).Combine(type).Value(); }
+    };
+    using KeySet = std::unordered_set<Key, hash_util::HasHashMember<Key>>;
+
+    std::unordered_map<VkImageView, const IMAGE_VIEW_STATE *> image_views;
+    std::unordered_map<VkSampler, const SAMPLER_STATE *> samplers;
+    KeySet valid_image_updates;   // Passed ValidateImageUpdate, by image view, layout and type
+    KeySet valid_buffer_views;    // Passed the texel buffer checks, by buffer view and type
+    std::unordered_map<Key, const BUFFER_STATE *, hash_util::HasHashMember<Key>> valid_buffers;  // Bound and usable as type
 };
 
 /*
@@ -625,6 +649,10 @@ class DescriptorSet : public BASE_NODE {
     void PerformPushDescriptorsUpdate(ValidationStateTracker *dev_data, uint32_t write_count, const VkWriteDescriptorSet *p_wds);
     // Perform a WriteUpdate whose contents were just validated using ValidateWriteUpdate
     void PerformWriteUpdate(ValidationStateTracker *dev_data, const VkWriteDescriptorSet *);
+    // As PerformWriteUpdate, but returns whether bound command buffers are to be invalidated, so a batch can do it once
+    bool ApplyWriteUpdate(ValidationStateTracker *dev_data, const VkWriteDescriptorSet *);
+    // Set all bound cmd buffers to INVALID state
+    void InvalidateBoundCmdBuffers(ValidationStateTracker *state_data);
     // Perform a CopyUpdate whose contents were just validated using ValidateCopyUpdate
     void PerformCopyUpdate(ValidationStateTracker *dev_data, const VkCopyDescriptorSet *, const DescriptorSet *);
 
@@ -635,6 +663,8 @@ class DescriptorSet : public BASE_NODE {
     // update CB image layout map with image/imagesampler descriptor image layouts
     void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *, CMD_TYPE cmd_type, const PIPELINE_STATE *,
                          const BindingReqMap &, const char *function);
+    // Add or remove the references of all the descriptors to their resources, as the set is allocated or freed
+    void UpdateResourceReferences(ValidationStateTracker *, bool add);
 
     // Track work that has been bound or validated to avoid duplicate work, important when large descriptor arrays
     // are present
@@ -671,34 +701,36 @@ class DescriptorSet : public BASE_NODE {
     }
     uint32_t GetVariableDescriptorCount() const { return variable_count_; }
     DESCRIPTOR_POOL_STATE *GetPoolState() const { return pool_state_; }
-    const Descriptor *GetDescriptorFromGlobalIndex(const uint32_t index) const { return descriptors_[index].get(); }
+    // Index of this set in its pool's DESCRIPTOR_POOL_STATE::sets
+    uint32_t GetPoolSlot() const { return pool_slot_; }
+    void SetPoolSlot(uint32_t slot) { pool_slot_ = slot; }
+    const Descriptor *GetDescriptorFromGlobalIndex(const uint32_t index) const { return descriptors_[index]; }
     const Descriptor *GetDescriptorFromBinding(const uint32_t binding, const uint32_t index = 0) const {
         const auto range = GetGlobalIndexRangeFromBinding(binding);
         if ((range.start + index) >= range.end) {
             return nullptr;
         }
-        return descriptors_[range.start + index].get();
+        return descriptors_[range.start + index];
     }
     uint64_t GetChangeCount() const { return change_count_; }
 
     const std::vector<safe_VkWriteDescriptorSet> &GetWrites() const { return push_descriptor_set_writes; }
 
-    // Given that we are providing placement new allocation for descriptors, the deleter needs to *only* call the destructor
-    struct DescriptorDeleter {
-        void operator()(Descriptor *desc) { desc->~Descriptor(); }
-    };
-
   private:
-    // Private helper to set all bound cmd buffers to INVALID state
-    void InvalidateBoundCmdBuffers(ValidationStateTracker *state_data);
+    // Add or remove the references of the descriptors from global index start up to end, the first of which is in binding
+    void UpdateResourceReferences(ValidationStateTracker *, uint32_t binding, uint32_t start, uint32_t end, bool add);
+
     bool some_update_;  // has any part of the set ever been updated?
     VkDescriptorSet set_;
     DESCRIPTOR_POOL_STATE *pool_state_;
+    uint32_t pool_slot_;
     const std::shared_ptr<DescriptorSetLayout const> layout_;
-    // NOTE: the the backing store for the descriptors must be declared *before* it so it will be destructed *after* it
-    // "Destructors for nonstatic member objects are called in the reverse order in which they appear in the class declaration."
-    std::vector<DescriptorBackingStore> descriptor_store_;
-    std::vector<std::unique_ptr<Descriptor, DescriptorDeleter>> descriptors_;
+    // The descriptors are constructed with placement new in a block holding their backing store followed by descriptors_,
+    // and only their destructors are called, by ~DescriptorSet.  The block is owned by the set, or for a pool with an arena
+    // it is taken from the arena.
+    std::unique_ptr<uint8_t[]> owned_descriptor_block_;
+    Descriptor **descriptors_;
+    uint32_t descriptor_count_;
     const StateTracker *state_data_;
     uint32_t variable_count_;
     uint64_t change_count_;
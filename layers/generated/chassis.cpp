@@ -44,6 +44,7 @@ bool wrap_handles = true;
 #define OBJECT_LAYER_DESCRIPTION "khronos_validation"
 
 // Include layer validation object definitions
+#include "api_capture.h"
 #include "best_practices_validation.h"
 #include "core_validation.h"
 #include "corechecks_optick_instrumentation.h"
@@ -277,8 +278,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     // Set up enable and disable features flags
     CHECK_ENABLED local_enables {};
     CHECK_DISABLED local_disables {};
+    ValidationSampler::Settings local_sampling_settings {};
     ConfigAndEnvSettings config_and_env_settings_data {OBJECT_LAYER_DESCRIPTION, pCreateInfo->pNext, local_enables, local_disables,
-        report_data->filter_message_ids, &report_data->duplicate_message_limit};
+        report_data->filter_message_ids, &report_data->duplicate_message_limit, &local_sampling_settings};
     ProcessConfigAndEnvSettings(&config_and_env_settings_data);
     layer_debug_messenger_actions(report_data, pAllocator, OBJECT_LAYER_DESCRIPTION);
 
@@ -318,11 +320,13 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     // Init dispatch array and call registration functions
     bool skip = false;
     for (auto intercept : local_object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateInstance");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateInstance(pCreateInfo, pAllocator, pInstance);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : local_object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateInstance");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateInstance(pCreateInfo, pAllocator, pInstance);
     }
@@ -336,6 +340,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     framework->container_type = LayerObjectTypeInstance;
     framework->disabled = local_disables;
     framework->enabled = local_enables;
+    framework->validation_sampler_settings = local_sampling_settings;
 
     framework->instance = *pInstance;
     layer_init_instance_dispatch_table(*pInstance, &framework->instance_dispatch_table, fpGetInstanceProcAddr);
@@ -357,6 +362,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     sync_validation_obj->FinalizeInstanceValidationObject(framework);
 
     for (auto intercept : framework->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateInstance");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateInstance(pCreateInfo, pAllocator, pInstance, result);
     }
@@ -365,7 +371,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     std::vector<ValidationObject*> local_objs = {
         thread_checker_obj, object_tracker_obj, parameter_validation_obj,
         core_checks_obj, best_practices_obj, gpu_assisted_obj, debug_printf_obj,
-        sync_validation_obj,
+        sync_validation_obj, api_capture_obj,
     };
     for (auto obj : local_objs) {
         if (std::find(local_object_dispatch.begin(), local_object_dispatch.end(), obj) == local_object_dispatch.end()) {
@@ -385,11 +391,13 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
 
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroyInstance");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyInstance(instance, pAllocator);
         //if (skip) return; // WORKAROUD: does not currently work properly
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroyInstance");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyInstance(instance, pAllocator);
     }
@@ -397,6 +405,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
     layer_data->instance_dispatch_table.DestroyInstance(instance, pAllocator);
 
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroyInstance");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyInstance(instance, pAllocator);
     }
@@ -443,11 +452,13 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
 
     bool skip = false;
     for (auto intercept : instance_interceptor->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateDevice");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDevice(gpu, pCreateInfo, pAllocator, pDevice);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : instance_interceptor->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateDevice");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, &modified_create_info);
     }
@@ -501,6 +512,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
     auto sync_validation_obj = new SyncValidator;
     sync_validation_obj->InitDeviceValidationObject(enables[sync_validation], instance_interceptor, device_interceptor);
 
+    auto api_capture_obj = new ApiCapture(pCreateInfo);
+    api_capture_obj->InitDeviceValidationObject(enables[api_capture], instance_interceptor, device_interceptor);
+
     // Delete unused validation objects to avoid memory leak.
     std::vector<ValidationObject *> local_objs = {
         thread_safety_obj, stateless_validation_obj, object_tracker_obj,
@@ -515,12 +529,28 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
     }
 
     for (auto intercept : instance_interceptor->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateDevice");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, result);
     }
 
     device_interceptor->InitObjectDispatchVectors();
 
+    if (enables[parallel_validate] && (device_interceptor->object_dispatch.size() > 1)) {
+        // The calling thread validates too, so one worker fewer than objects suffices
+        const uint32_t hardware_threads = std::max(std::thread::hardware_concurrency(), 1U);
+        const uint32_t worker_count =
+            std::min(static_cast<uint32_t>(device_interceptor->object_dispatch.size()) - 1, hardware_threads - 1);
+        if (worker_count) {
+            device_interceptor->parallel_validation_pool.reset(new ValidationWorkerPool(worker_count));
+        }
+    }
+
+    device_interceptor->validation_sampler = ValidationSampler::Create(instance_interceptor->validation_sampler_settings);
+    if (device_interceptor->validation_sampler) {
+        device_interceptor->InitUnselectedInterceptVectors();
+    }
+
     DeviceExtensionWhitelist(device_interceptor, pCreateInfo, *pDevice);
 
     return result;
@@ -531,11 +561,13 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
     auto layer_data = GetLayerDataPtr(key, layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroyDevice");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDevice(device, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroyDevice");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyDevice(device, pAllocator);
     }
@@ -543,9 +575,11 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
     layer_data->device_dispatch_table.DestroyDevice(device, pAllocator);
 
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroyDevice");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyDevice(device, pAllocator);
     }
+    INTERCEPT_STATS_DUMP();
 
     for (auto item = layer_data->object_dispatch.begin(); item != layer_data->object_dispatch.end(); item++) {
         delete *item;
@@ -568,13 +602,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(
 
     create_graphics_pipeline_api_state cgpl_state[LayerObjectTypeMaxEnum]{};
 
-    for (auto intercept : layer_data->object_dispatch) {
-        cgpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
-        auto lock = intercept->read_lock();
-        skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(cgpl_state[intercept->container_type]));
+    if (layer_data->parallel_validation_pool) {
+        skip = layer_data->ParallelPreCallValidate(layer_data->object_dispatch, [&](const ValidationObject *intercept) {
+            cgpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
+            INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateGraphicsPipelines");
+            return intercept->PreCallValidateCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(cgpl_state[intercept->container_type]));
+        });
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
+    } else {
+        for (auto intercept : layer_data->object_dispatch) {
+            cgpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
+            INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateGraphicsPipelines");
+            auto lock = intercept->read_lock();
+            skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(cgpl_state[intercept->container_type]));
+            if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
+        }
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateGraphicsPipelines");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(cgpl_state[intercept->container_type]));
     }
@@ -585,6 +630,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(
     VkResult result = DispatchCreateGraphicsPipelines(device, pipelineCache, createInfoCount, usepCreateInfos, pAllocator, pPipelines);
 
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateGraphicsPipelines");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, result, &(cgpl_state[intercept->container_type]));
     }
@@ -604,13 +650,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(
 
     create_compute_pipeline_api_state ccpl_state[LayerObjectTypeMaxEnum]{};
 
-    for (auto intercept : layer_data->object_dispatch) {
-        ccpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
-        auto lock = intercept->read_lock();
-        skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(ccpl_state[intercept->container_type]));
+    if (layer_data->parallel_validation_pool) {
+        skip = layer_data->ParallelPreCallValidate(layer_data->object_dispatch, [&](const ValidationObject *intercept) {
+            ccpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
+            INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateComputePipelines");
+            return intercept->PreCallValidateCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(ccpl_state[intercept->container_type]));
+        });
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
+    } else {
+        for (auto intercept : layer_data->object_dispatch) {
+            ccpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
+            INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateComputePipelines");
+            auto lock = intercept->read_lock();
+            skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(ccpl_state[intercept->container_type]));
+            if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
+        }
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateComputePipelines");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(ccpl_state[intercept->container_type]));
     }
@@ -621,6 +678,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(
     VkResult result = DispatchCreateComputePipelines(device, pipelineCache, createInfoCount, usepCreateInfos, pAllocator, pPipelines);
 
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateComputePipelines");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, result, &(ccpl_state[intercept->container_type]));
     }
@@ -641,12 +699,14 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(
 
     for (auto intercept : layer_data->object_dispatch) {
         crtpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateRayTracingPipelinesNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos,
                                                                       pAllocator, pPipelines, &(crtpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateRayTracingPipelinesNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                             pPipelines, &(crtpl_state[intercept->container_type]));
@@ -655,6 +715,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(
     VkResult result = DispatchCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
 
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateRayTracingPipelinesNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                              pPipelines, result, &(crtpl_state[intercept->container_type]));
@@ -677,12 +738,14 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesKHR(
 
     for (auto intercept : layer_data->object_dispatch) {
         crtpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateRayTracingPipelinesKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos,
                                                                       pAllocator, pPipelines, &(crtpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateRayTracingPipelinesKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                             pPipelines, &(crtpl_state[intercept->container_type]));
@@ -691,6 +754,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesKHR(
     VkResult result = DispatchCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
 
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateRayTracingPipelinesKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                              pPipelines, result, &(crtpl_state[intercept->container_type]));
@@ -711,16 +775,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(
     cpl_state.modified_create_info = *pCreateInfo;
 
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreatePipelineLayout");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreatePipelineLayout");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, &cpl_state);
     }
     VkResult result = DispatchCreatePipelineLayout(device, &cpl_state.modified_create_info, pAllocator, pPipelineLayout);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreatePipelineLayout");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, result);
     }
@@ -740,16 +807,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(
     csm_state.instrumented_create_info = *pCreateInfo;
 
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateShaderModule");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, &csm_state);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateShaderModule");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, &csm_state);
     }
     VkResult result = DispatchCreateShaderModule(device, &csm_state.instrumented_create_info, pAllocator, pShaderModule);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateShaderModule");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, result, &csm_state);
     }
@@ -767,17 +837,20 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(
 
     for (auto intercept : layer_data->object_dispatch) {
         ads_state[intercept->container_type].Init(pAllocateInfo->descriptorSetCount);
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkAllocateDescriptorSets");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAllocateDescriptorSets(device,
             pAllocateInfo, pDescriptorSets, &(ads_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkAllocateDescriptorSets");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
     }
     VkResult result = DispatchAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkAllocateDescriptorSets");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets,
             result, &(ads_state[intercept->container_type]));
@@ -798,16 +871,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(
     cb_state.modified_create_info = *pCreateInfo;
 
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateBuffer");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateBuffer(device, pCreateInfo, pAllocator, pBuffer);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateBuffer");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, &cb_state);
     }
     VkResult result = DispatchCreateBuffer(device, &cb_state.modified_create_info, pAllocator, pBuffer);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateBuffer");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, result);
     }
@@ -844,12 +920,14 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceToolPropertiesEXT(
     }
 
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceToolPropertiesEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
 
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceToolPropertiesEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties);
     }
@@ -862,6 +940,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceToolPropertiesEXT(
     (*pToolCount)++;
 
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceToolPropertiesEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties, result);
     }
@@ -941,16 +1020,19 @@ VKAPI_ATTR VkResult VKAPI_CALL EnumeratePhysicalDevices(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkEnumeratePhysicalDevices");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateEnumeratePhysicalDevices(instance, pPhysicalDeviceCount, pPhysicalDevices);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkEnumeratePhysicalDevices");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordEnumeratePhysicalDevices(instance, pPhysicalDeviceCount, pPhysicalDevices);
     }
     VkResult result = DispatchEnumeratePhysicalDevices(instance, pPhysicalDeviceCount, pPhysicalDevices);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkEnumeratePhysicalDevices");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordEnumeratePhysicalDevices(instance, pPhysicalDeviceCount, pPhysicalDevices, result);
     }
@@ -963,16 +1045,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFeatures(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceFeatures");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceFeatures(physicalDevice, pFeatures);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceFeatures");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceFeatures(physicalDevice, pFeatures);
     }
     DispatchGetPhysicalDeviceFeatures(physicalDevice, pFeatures);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceFeatures");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceFeatures(physicalDevice, pFeatures);
     }
@@ -985,16 +1070,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFormatProperties(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceFormatProperties");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceFormatProperties(physicalDevice, format, pFormatProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceFormatProperties");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceFormatProperties(physicalDevice, format, pFormatProperties);
     }
     DispatchGetPhysicalDeviceFormatProperties(physicalDevice, format, pFormatProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceFormatProperties");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceFormatProperties(physicalDevice, format, pFormatProperties);
     }
@@ -1011,16 +1099,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceImageFormatProperties(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceImageFormatProperties");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceImageFormatProperties(physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceImageFormatProperties");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceImageFormatProperties(physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceImageFormatProperties(physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceImageFormatProperties");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceImageFormatProperties(physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties, result);
     }
@@ -1033,16 +1124,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceProperties(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceProperties");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceProperties(physicalDevice, pProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceProperties");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceProperties(physicalDevice, pProperties);
     }
     DispatchGetPhysicalDeviceProperties(physicalDevice, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceProperties");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceProperties(physicalDevice, pProperties);
     }
@@ -1055,16 +1149,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceQueueFamilyProperties(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceQueueFamilyProperties");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceQueueFamilyProperties(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceQueueFamilyProperties");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceQueueFamilyProperties(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
     }
     DispatchGetPhysicalDeviceQueueFamilyProperties(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceQueueFamilyProperties");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceQueueFamilyProperties(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
     }
@@ -1076,16 +1173,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceMemoryProperties(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceMemoryProperties");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceMemoryProperties(physicalDevice, pMemoryProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceMemoryProperties");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceMemoryProperties(physicalDevice, pMemoryProperties);
     }
     DispatchGetPhysicalDeviceMemoryProperties(physicalDevice, pMemoryProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceMemoryProperties");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceMemoryProperties(physicalDevice, pMemoryProperties);
     }
@@ -1099,16 +1199,19 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceQueue(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceQueue]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetDeviceQueue");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceQueue]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetDeviceQueue");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
     }
     DispatchGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceQueue]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetDeviceQueue");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
     }
@@ -1121,17 +1224,29 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit(
     VkFence                                     fence) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueSubmit]) {
-        auto lock = intercept->read_lock();
-        skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueSubmit(queue, submitCount, pSubmits, fence);
+    if (layer_data->parallel_validation_pool) {
+        skip = layer_data->ParallelPreCallValidate(
+            layer_data->intercept_vectors[InterceptIdPreCallValidateQueueSubmit], [&](const ValidationObject *intercept) {
+                INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkQueueSubmit");
+                return intercept->PreCallValidateQueueSubmit(queue, submitCount, pSubmits, fence);
+            });
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
+    } else {
+        for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueSubmit]) {
+            INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkQueueSubmit");
+            auto lock = intercept->read_lock();
+            skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueSubmit(queue, submitCount, pSubmits, fence);
+            if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
+        }
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueSubmit]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkQueueSubmit");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordQueueSubmit(queue, submitCount, pSubmits, fence);
     }
     VkResult result = DispatchQueueSubmit(queue, submitCount, pSubmits, fence);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueSubmit]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkQueueSubmit");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, result);
     }
@@ -1143,16 +1258,19 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueWaitIdle(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueWaitIdle]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkQueueWaitIdle");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueWaitIdle(queue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueWaitIdle]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkQueueWaitIdle");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordQueueWaitIdle(queue);
     }
     VkResult result = DispatchQueueWaitIdle(queue);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueWaitIdle]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkQueueWaitIdle");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordQueueWaitIdle(queue, result);
     }
@@ -1164,16 +1282,19 @@ VKAPI_ATTR VkResult VKAPI_CALL DeviceWaitIdle(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDeviceWaitIdle]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDeviceWaitIdle");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDeviceWaitIdle(device);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDeviceWaitIdle]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDeviceWaitIdle");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDeviceWaitIdle(device);
     }
     VkResult result = DispatchDeviceWaitIdle(device);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDeviceWaitIdle]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDeviceWaitIdle");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDeviceWaitIdle(device, result);
     }
@@ -1188,16 +1309,19 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateMemory(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAllocateMemory]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkAllocateMemory");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAllocateMemory]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkAllocateMemory");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordAllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
     }
     VkResult result = DispatchAllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAllocateMemory]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkAllocateMemory");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordAllocateMemory(device, pAllocateInfo, pAllocator, pMemory, result);
     }
@@ -1211,16 +1335,19 @@ VKAPI_ATTR void VKAPI_CALL FreeMemory(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateFreeMemory]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkFreeMemory");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateFreeMemory(device, memory, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordFreeMemory]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkFreeMemory");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordFreeMemory(device, memory, pAllocator);
     }
     DispatchFreeMemory(device, memory, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordFreeMemory]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkFreeMemory");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordFreeMemory(device, memory, pAllocator);
     }
@@ -1236,16 +1363,19 @@ VKAPI_ATTR VkResult VKAPI_CALL MapMemory(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateMapMemory]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkMapMemory");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateMapMemory(device, memory, offset, size, flags, ppData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordMapMemory]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkMapMemory");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordMapMemory(device, memory, offset, size, flags, ppData);
     }
     VkResult result = DispatchMapMemory(device, memory, offset, size, flags, ppData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordMapMemory]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkMapMemory");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordMapMemory(device, memory, offset, size, flags, ppData, result);
     }
@@ -1258,16 +1388,19 @@ VKAPI_ATTR void VKAPI_CALL UnmapMemory(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUnmapMemory]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkUnmapMemory");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUnmapMemory(device, memory);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordUnmapMemory]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkUnmapMemory");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordUnmapMemory(device, memory);
     }
     DispatchUnmapMemory(device, memory);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordUnmapMemory]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkUnmapMemory");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordUnmapMemory(device, memory);
     }
@@ -1280,16 +1413,19 @@ VKAPI_ATTR VkResult VKAPI_CALL FlushMappedMemoryRanges(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateFlushMappedMemoryRanges]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkFlushMappedMemoryRanges");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordFlushMappedMemoryRanges]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkFlushMappedMemoryRanges");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
     }
     VkResult result = DispatchFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordFlushMappedMemoryRanges]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkFlushMappedMemoryRanges");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges, result);
     }
@@ -1303,16 +1439,19 @@ VKAPI_ATTR VkResult VKAPI_CALL InvalidateMappedMemoryRanges(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateInvalidateMappedMemoryRanges]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkInvalidateMappedMemoryRanges");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordInvalidateMappedMemoryRanges]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkInvalidateMappedMemoryRanges");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
     }
     VkResult result = DispatchInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordInvalidateMappedMemoryRanges]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkInvalidateMappedMemoryRanges");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges, result);
     }
@@ -1326,16 +1465,19 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceMemoryCommitment(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceMemoryCommitment]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetDeviceMemoryCommitment");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceMemoryCommitment]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetDeviceMemoryCommitment");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
     }
     DispatchGetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceMemoryCommitment]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetDeviceMemoryCommitment");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
     }
@@ -1349,16 +1491,19 @@ VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindBufferMemory]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkBindBufferMemory");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindBufferMemory(device, buffer, memory, memoryOffset);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindBufferMemory]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkBindBufferMemory");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordBindBufferMemory(device, buffer, memory, memoryOffset);
     }
     VkResult result = DispatchBindBufferMemory(device, buffer, memory, memoryOffset);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindBufferMemory]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkBindBufferMemory");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordBindBufferMemory(device, buffer, memory, memoryOffset, result);
     }
@@ -1373,16 +1518,19 @@ VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindImageMemory]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkBindImageMemory");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindImageMemory(device, image, memory, memoryOffset);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindImageMemory]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkBindImageMemory");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordBindImageMemory(device, image, memory, memoryOffset);
     }
     VkResult result = DispatchBindImageMemory(device, image, memory, memoryOffset);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindImageMemory]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkBindImageMemory");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordBindImageMemory(device, image, memory, memoryOffset, result);
     }
@@ -1396,16 +1544,19 @@ VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferMemoryRequirements]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetBufferMemoryRequirements");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferMemoryRequirements]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetBufferMemoryRequirements");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
     }
     DispatchGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferMemoryRequirements]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetBufferMemoryRequirements");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
     }
@@ -1418,16 +1569,19 @@ VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageMemoryRequirements]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetImageMemoryRequirements");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageMemoryRequirements(device, image, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageMemoryRequirements]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetImageMemoryRequirements");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetImageMemoryRequirements(device, image, pMemoryRequirements);
     }
     DispatchGetImageMemoryRequirements(device, image, pMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageMemoryRequirements]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetImageMemoryRequirements");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetImageMemoryRequirements(device, image, pMemoryRequirements);
     }
@@ -1441,16 +1595,19 @@ VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageSparseMemoryRequirements]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetImageSparseMemoryRequirements");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageSparseMemoryRequirements]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetImageSparseMemoryRequirements");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
     DispatchGetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageSparseMemoryRequirements]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetImageSparseMemoryRequirements");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
@@ -1468,16 +1625,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceSparseImageFormatProperties(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceSparseImageFormatProperties");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSparseImageFormatProperties(physicalDevice, format, type, samples, usage, tiling, pPropertyCount, pProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceSparseImageFormatProperties");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceSparseImageFormatProperties(physicalDevice, format, type, samples, usage, tiling, pPropertyCount, pProperties);
     }
     DispatchGetPhysicalDeviceSparseImageFormatProperties(physicalDevice, format, type, samples, usage, tiling, pPropertyCount, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceSparseImageFormatProperties");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceSparseImageFormatProperties(physicalDevice, format, type, samples, usage, tiling, pPropertyCount, pProperties);
     }
@@ -1491,16 +1651,19 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueBindSparse(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueBindSparse]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkQueueBindSparse");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueBindSparse]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkQueueBindSparse");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordQueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
     }
     VkResult result = DispatchQueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueBindSparse]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkQueueBindSparse");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordQueueBindSparse(queue, bindInfoCount, pBindInfo, fence, result);
     }
@@ -1515,16 +1678,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateFence(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateFence]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateFence");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateFence(device, pCreateInfo, pAllocator, pFence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateFence]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateFence");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateFence(device, pCreateInfo, pAllocator, pFence);
     }
     VkResult result = DispatchCreateFence(device, pCreateInfo, pAllocator, pFence);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateFence]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateFence");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateFence(device, pCreateInfo, pAllocator, pFence, result);
     }
@@ -1538,16 +1704,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyFence(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyFence]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroyFence");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyFence(device, fence, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyFence]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroyFence");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyFence(device, fence, pAllocator);
     }
     DispatchDestroyFence(device, fence, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyFence]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroyFence");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyFence(device, fence, pAllocator);
     }
@@ -1560,16 +1729,19 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetFences(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetFences]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkResetFences");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetFences(device, fenceCount, pFences);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetFences]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkResetFences");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordResetFences(device, fenceCount, pFences);
     }
     VkResult result = DispatchResetFences(device, fenceCount, pFences);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetFences]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkResetFences");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordResetFences(device, fenceCount, pFences, result);
     }
@@ -1582,16 +1754,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetFenceStatus(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetFenceStatus]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetFenceStatus");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetFenceStatus(device, fence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetFenceStatus]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetFenceStatus");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetFenceStatus(device, fence);
     }
     VkResult result = DispatchGetFenceStatus(device, fence);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetFenceStatus]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetFenceStatus");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetFenceStatus(device, fence, result);
     }
@@ -1607,16 +1782,19 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitForFences(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateWaitForFences]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkWaitForFences");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateWaitForFences(device, fenceCount, pFences, waitAll, timeout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordWaitForFences]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkWaitForFences");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordWaitForFences(device, fenceCount, pFences, waitAll, timeout);
     }
     VkResult result = DispatchWaitForFences(device, fenceCount, pFences, waitAll, timeout);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordWaitForFences]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkWaitForFences");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordWaitForFences(device, fenceCount, pFences, waitAll, timeout, result);
     }
@@ -1631,16 +1809,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSemaphore(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSemaphore]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateSemaphore");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateSemaphore]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateSemaphore");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
     }
     VkResult result = DispatchCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateSemaphore]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateSemaphore");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore, result);
     }
@@ -1654,16 +1835,19 @@ VKAPI_ATTR void VKAPI_CALL DestroySemaphore(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroySemaphore]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroySemaphore");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySemaphore(device, semaphore, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroySemaphore]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroySemaphore");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroySemaphore(device, semaphore, pAllocator);
     }
     DispatchDestroySemaphore(device, semaphore, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroySemaphore]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroySemaphore");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroySemaphore(device, semaphore, pAllocator);
     }
@@ -1677,16 +1861,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateEvent(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateEvent]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateEvent");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateEvent(device, pCreateInfo, pAllocator, pEvent);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateEvent]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateEvent");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateEvent(device, pCreateInfo, pAllocator, pEvent);
     }
     VkResult result = DispatchCreateEvent(device, pCreateInfo, pAllocator, pEvent);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateEvent]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateEvent");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateEvent(device, pCreateInfo, pAllocator, pEvent, result);
     }
@@ -1700,16 +1887,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyEvent(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyEvent]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroyEvent");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyEvent(device, event, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyEvent]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroyEvent");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyEvent(device, event, pAllocator);
     }
     DispatchDestroyEvent(device, event, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyEvent]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroyEvent");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyEvent(device, event, pAllocator);
     }
@@ -1721,16 +1911,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetEventStatus(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetEventStatus]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetEventStatus");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetEventStatus(device, event);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetEventStatus]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetEventStatus");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetEventStatus(device, event);
     }
     VkResult result = DispatchGetEventStatus(device, event);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetEventStatus]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetEventStatus");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetEventStatus(device, event, result);
     }
@@ -1743,16 +1936,19 @@ VKAPI_ATTR VkResult VKAPI_CALL SetEvent(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetEvent]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkSetEvent");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetEvent(device, event);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetEvent]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkSetEvent");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordSetEvent(device, event);
     }
     VkResult result = DispatchSetEvent(device, event);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetEvent]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkSetEvent");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordSetEvent(device, event, result);
     }
@@ -1765,16 +1961,19 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetEvent(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetEvent]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkResetEvent");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetEvent(device, event);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetEvent]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkResetEvent");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordResetEvent(device, event);
     }
     VkResult result = DispatchResetEvent(device, event);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetEvent]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkResetEvent");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordResetEvent(device, event, result);
     }
@@ -1789,16 +1988,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateQueryPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateQueryPool]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateQueryPool");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateQueryPool]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateQueryPool");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
     }
     VkResult result = DispatchCreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateQueryPool]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateQueryPool");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool, result);
     }
@@ -1812,16 +2014,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyQueryPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyQueryPool]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroyQueryPool");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyQueryPool(device, queryPool, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyQueryPool]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroyQueryPool");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyQueryPool(device, queryPool, pAllocator);
     }
     DispatchDestroyQueryPool(device, queryPool, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyQueryPool]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroyQueryPool");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyQueryPool(device, queryPool, pAllocator);
     }
@@ -1839,16 +2044,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetQueryPoolResults(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetQueryPoolResults]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetQueryPoolResults");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetQueryPoolResults]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetQueryPoolResults");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
     }
     VkResult result = DispatchGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetQueryPoolResults]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetQueryPoolResults");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags, result);
     }
@@ -1862,16 +2070,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyBuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyBuffer]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroyBuffer");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyBuffer(device, buffer, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyBuffer]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroyBuffer");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyBuffer(device, buffer, pAllocator);
     }
     DispatchDestroyBuffer(device, buffer, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyBuffer]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroyBuffer");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyBuffer(device, buffer, pAllocator);
     }
@@ -1885,16 +2096,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBufferView(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateBufferView]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateBufferView");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateBufferView(device, pCreateInfo, pAllocator, pView);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateBufferView]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateBufferView");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateBufferView(device, pCreateInfo, pAllocator, pView);
     }
     VkResult result = DispatchCreateBufferView(device, pCreateInfo, pAllocator, pView);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateBufferView]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateBufferView");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateBufferView(device, pCreateInfo, pAllocator, pView, result);
     }
@@ -1908,16 +2122,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyBufferView(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyBufferView]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroyBufferView");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyBufferView(device, bufferView, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyBufferView]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroyBufferView");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyBufferView(device, bufferView, pAllocator);
     }
     DispatchDestroyBufferView(device, bufferView, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyBufferView]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroyBufferView");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyBufferView(device, bufferView, pAllocator);
     }
@@ -1931,16 +2148,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateImage(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateImage]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateImage");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateImage(device, pCreateInfo, pAllocator, pImage);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateImage]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateImage");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateImage(device, pCreateInfo, pAllocator, pImage);
     }
     VkResult result = DispatchCreateImage(device, pCreateInfo, pAllocator, pImage);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateImage]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateImage");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateImage(device, pCreateInfo, pAllocator, pImage, result);
     }
@@ -1954,16 +2174,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyImage(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyImage]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroyImage");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyImage(device, image, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyImage]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroyImage");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyImage(device, image, pAllocator);
     }
     DispatchDestroyImage(device, image, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyImage]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroyImage");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyImage(device, image, pAllocator);
     }
@@ -1977,16 +2200,19 @@ VKAPI_ATTR void VKAPI_CALL GetImageSubresourceLayout(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageSubresourceLayout]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetImageSubresourceLayout");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageSubresourceLayout(device, image, pSubresource, pLayout);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageSubresourceLayout]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetImageSubresourceLayout");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetImageSubresourceLayout(device, image, pSubresource, pLayout);
     }
     DispatchGetImageSubresourceLayout(device, image, pSubresource, pLayout);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageSubresourceLayout]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetImageSubresourceLayout");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetImageSubresourceLayout(device, image, pSubresource, pLayout);
     }
@@ -2000,16 +2226,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateImageView(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateImageView]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateImageView");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateImageView(device, pCreateInfo, pAllocator, pView);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateImageView]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateImageView");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateImageView(device, pCreateInfo, pAllocator, pView);
     }
     VkResult result = DispatchCreateImageView(device, pCreateInfo, pAllocator, pView);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateImageView]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateImageView");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateImageView(device, pCreateInfo, pAllocator, pView, result);
     }
@@ -2023,16 +2252,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyImageView(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyImageView]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroyImageView");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyImageView(device, imageView, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyImageView]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroyImageView");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyImageView(device, imageView, pAllocator);
     }
     DispatchDestroyImageView(device, imageView, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyImageView]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroyImageView");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyImageView(device, imageView, pAllocator);
     }
@@ -2045,16 +2277,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyShaderModule(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyShaderModule]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroyShaderModule");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyShaderModule(device, shaderModule, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyShaderModule]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroyShaderModule");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyShaderModule(device, shaderModule, pAllocator);
     }
     DispatchDestroyShaderModule(device, shaderModule, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyShaderModule]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroyShaderModule");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyShaderModule(device, shaderModule, pAllocator);
     }
@@ -2068,16 +2303,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineCache(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreatePipelineCache]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreatePipelineCache");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreatePipelineCache]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreatePipelineCache");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
     }
     VkResult result = DispatchCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreatePipelineCache]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreatePipelineCache");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache, result);
     }
@@ -2091,16 +2329,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipelineCache(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyPipelineCache]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroyPipelineCache");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyPipelineCache(device, pipelineCache, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyPipelineCache]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroyPipelineCache");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyPipelineCache(device, pipelineCache, pAllocator);
     }
     DispatchDestroyPipelineCache(device, pipelineCache, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyPipelineCache]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroyPipelineCache");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyPipelineCache(device, pipelineCache, pAllocator);
     }
@@ -2114,16 +2355,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineCacheData(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPipelineCacheData]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPipelineCacheData");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPipelineCacheData(device, pipelineCache, pDataSize, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPipelineCacheData]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPipelineCacheData");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPipelineCacheData(device, pipelineCache, pDataSize, pData);
     }
     VkResult result = DispatchGetPipelineCacheData(device, pipelineCache, pDataSize, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPipelineCacheData]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPipelineCacheData");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPipelineCacheData(device, pipelineCache, pDataSize, pData, result);
     }
@@ -2138,16 +2382,19 @@ VKAPI_ATTR VkResult VKAPI_CALL MergePipelineCaches(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateMergePipelineCaches]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkMergePipelineCaches");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordMergePipelineCaches]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkMergePipelineCaches");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
     }
     VkResult result = DispatchMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordMergePipelineCaches]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkMergePipelineCaches");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches, result);
     }
@@ -2161,16 +2408,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipeline(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyPipeline]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroyPipeline");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyPipeline(device, pipeline, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyPipeline]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroyPipeline");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyPipeline(device, pipeline, pAllocator);
     }
     DispatchDestroyPipeline(device, pipeline, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyPipeline]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroyPipeline");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyPipeline(device, pipeline, pAllocator);
     }
@@ -2183,16 +2433,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipelineLayout(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyPipelineLayout]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroyPipelineLayout");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyPipelineLayout(device, pipelineLayout, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyPipelineLayout]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroyPipelineLayout");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyPipelineLayout(device, pipelineLayout, pAllocator);
     }
     DispatchDestroyPipelineLayout(device, pipelineLayout, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyPipelineLayout]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroyPipelineLayout");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyPipelineLayout(device, pipelineLayout, pAllocator);
     }
@@ -2206,16 +2459,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSampler(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSampler]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateSampler");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSampler(device, pCreateInfo, pAllocator, pSampler);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateSampler]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateSampler");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateSampler(device, pCreateInfo, pAllocator, pSampler);
     }
     VkResult result = DispatchCreateSampler(device, pCreateInfo, pAllocator, pSampler);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateSampler]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateSampler");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateSampler(device, pCreateInfo, pAllocator, pSampler, result);
     }
@@ -2229,16 +2485,19 @@ VKAPI_ATTR void VKAPI_CALL DestroySampler(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroySampler]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroySampler");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySampler(device, sampler, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroySampler]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroySampler");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroySampler(device, sampler, pAllocator);
     }
     DispatchDestroySampler(device, sampler, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroySampler]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroySampler");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroySampler(device, sampler, pAllocator);
     }
@@ -2252,16 +2511,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorSetLayout(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDescriptorSetLayout]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateDescriptorSetLayout");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateDescriptorSetLayout]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateDescriptorSetLayout");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
     }
     VkResult result = DispatchCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateDescriptorSetLayout]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateDescriptorSetLayout");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout, result);
     }
@@ -2275,16 +2537,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorSetLayout(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyDescriptorSetLayout]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroyDescriptorSetLayout");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyDescriptorSetLayout]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroyDescriptorSetLayout");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
     }
     DispatchDestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyDescriptorSetLayout]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroyDescriptorSetLayout");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
     }
@@ -2298,16 +2563,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDescriptorPool]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateDescriptorPool");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateDescriptorPool]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateDescriptorPool");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
     }
     VkResult result = DispatchCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateDescriptorPool]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateDescriptorPool");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool, result);
     }
@@ -2321,16 +2589,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyDescriptorPool]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroyDescriptorPool");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDescriptorPool(device, descriptorPool, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyDescriptorPool]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroyDescriptorPool");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyDescriptorPool(device, descriptorPool, pAllocator);
     }
     DispatchDestroyDescriptorPool(device, descriptorPool, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyDescriptorPool]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroyDescriptorPool");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyDescriptorPool(device, descriptorPool, pAllocator);
     }
@@ -2343,16 +2614,19 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetDescriptorPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetDescriptorPool]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkResetDescriptorPool");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetDescriptorPool(device, descriptorPool, flags);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetDescriptorPool]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkResetDescriptorPool");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordResetDescriptorPool(device, descriptorPool, flags);
     }
     VkResult result = DispatchResetDescriptorPool(device, descriptorPool, flags);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetDescriptorPool]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkResetDescriptorPool");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordResetDescriptorPool(device, descriptorPool, flags, result);
     }
@@ -2367,16 +2641,19 @@ VKAPI_ATTR VkResult VKAPI_CALL FreeDescriptorSets(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateFreeDescriptorSets]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkFreeDescriptorSets");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordFreeDescriptorSets]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkFreeDescriptorSets");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
     }
     VkResult result = DispatchFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordFreeDescriptorSets]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkFreeDescriptorSets");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets, result);
     }
@@ -2391,17 +2668,29 @@ VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSets(
     const VkCopyDescriptorSet*                  pDescriptorCopies) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUpdateDescriptorSets]) {
-        auto lock = intercept->read_lock();
-        skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
+    if (layer_data->parallel_validation_pool) {
+        skip = layer_data->ParallelPreCallValidate(
+            layer_data->intercept_vectors[InterceptIdPreCallValidateUpdateDescriptorSets], [&](const ValidationObject *intercept) {
+                INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkUpdateDescriptorSets");
+                return intercept->PreCallValidateUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
+            });
         if (skip) return;
+    } else {
+        for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUpdateDescriptorSets]) {
+            INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkUpdateDescriptorSets");
+            auto lock = intercept->read_lock();
+            skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
+            if (skip) return;
+        }
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordUpdateDescriptorSets]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkUpdateDescriptorSets");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
     }
     DispatchUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordUpdateDescriptorSets]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkUpdateDescriptorSets");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
     }
@@ -2415,16 +2704,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateFramebuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateFramebuffer]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateFramebuffer");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateFramebuffer]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateFramebuffer");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
     }
     VkResult result = DispatchCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateFramebuffer]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateFramebuffer");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer, result);
     }
@@ -2438,16 +2730,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyFramebuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyFramebuffer]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroyFramebuffer");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyFramebuffer(device, framebuffer, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyFramebuffer]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroyFramebuffer");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyFramebuffer(device, framebuffer, pAllocator);
     }
     DispatchDestroyFramebuffer(device, framebuffer, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyFramebuffer]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroyFramebuffer");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyFramebuffer(device, framebuffer, pAllocator);
     }
@@ -2461,16 +2756,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateRenderPass]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateRenderPass");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateRenderPass]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateRenderPass");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
     }
     VkResult result = DispatchCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateRenderPass]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateRenderPass");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass, result);
     }
@@ -2484,16 +2782,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyRenderPass(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyRenderPass]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroyRenderPass");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyRenderPass(device, renderPass, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyRenderPass]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroyRenderPass");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyRenderPass(device, renderPass, pAllocator);
     }
     DispatchDestroyRenderPass(device, renderPass, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyRenderPass]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroyRenderPass");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyRenderPass(device, renderPass, pAllocator);
     }
@@ -2506,16 +2807,19 @@ VKAPI_ATTR void VKAPI_CALL GetRenderAreaGranularity(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetRenderAreaGranularity]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetRenderAreaGranularity");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRenderAreaGranularity(device, renderPass, pGranularity);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetRenderAreaGranularity]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetRenderAreaGranularity");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetRenderAreaGranularity(device, renderPass, pGranularity);
     }
     DispatchGetRenderAreaGranularity(device, renderPass, pGranularity);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetRenderAreaGranularity]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetRenderAreaGranularity");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetRenderAreaGranularity(device, renderPass, pGranularity);
     }
@@ -2529,16 +2833,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateCommandPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateCommandPool]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateCommandPool");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateCommandPool]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateCommandPool");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
     }
     VkResult result = DispatchCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateCommandPool]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateCommandPool");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool, result);
     }
@@ -2552,16 +2859,20 @@ VKAPI_ATTR void VKAPI_CALL DestroyCommandPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyCommandPool]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroyCommandPool");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyCommandPool(device, commandPool, pAllocator);
         if (skip) return;
     }
+    if (layer_data->validation_sampler) layer_data->validation_sampler->DestroyCommandPool(commandPool);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyCommandPool]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroyCommandPool");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyCommandPool(device, commandPool, pAllocator);
     }
     DispatchDestroyCommandPool(device, commandPool, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyCommandPool]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroyCommandPool");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyCommandPool(device, commandPool, pAllocator);
     }
@@ -2574,16 +2885,19 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetCommandPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetCommandPool]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkResetCommandPool");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetCommandPool(device, commandPool, flags);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetCommandPool]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkResetCommandPool");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordResetCommandPool(device, commandPool, flags);
     }
     VkResult result = DispatchResetCommandPool(device, commandPool, flags);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetCommandPool]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkResetCommandPool");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordResetCommandPool(device, commandPool, flags, result);
     }
@@ -2597,16 +2911,20 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateCommandBuffers(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAllocateCommandBuffers]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkAllocateCommandBuffers");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAllocateCommandBuffers]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkAllocateCommandBuffers");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
     }
     VkResult result = DispatchAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
+    if (layer_data->validation_sampler && (result == VK_SUCCESS)) layer_data->validation_sampler->AllocateCommandBuffers(pAllocateInfo, pCommandBuffers);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAllocateCommandBuffers]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkAllocateCommandBuffers");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers, result);
     }
@@ -2621,16 +2939,20 @@ VKAPI_ATTR void VKAPI_CALL FreeCommandBuffers(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateFreeCommandBuffers]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkFreeCommandBuffers");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
         if (skip) return;
     }
+    if (layer_data->validation_sampler) layer_data->validation_sampler->FreeCommandBuffers(commandBufferCount, pCommandBuffers);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordFreeCommandBuffers]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkFreeCommandBuffers");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
     }
     DispatchFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordFreeCommandBuffers]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkFreeCommandBuffers");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
     }
@@ -2642,16 +2964,20 @@ VKAPI_ATTR VkResult VKAPI_CALL BeginCommandBuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBeginCommandBuffer]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkBeginCommandBuffer");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBeginCommandBuffer(commandBuffer, pBeginInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
+    if (layer_data->validation_sampler) layer_data->validation_sampler->BeginCommandBuffer(commandBuffer);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBeginCommandBuffer]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkBeginCommandBuffer");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordBeginCommandBuffer(commandBuffer, pBeginInfo);
     }
     VkResult result = DispatchBeginCommandBuffer(commandBuffer, pBeginInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBeginCommandBuffer]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkBeginCommandBuffer");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordBeginCommandBuffer(commandBuffer, pBeginInfo, result);
     }
@@ -2663,16 +2989,19 @@ VKAPI_ATTR VkResult VKAPI_CALL EndCommandBuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateEndCommandBuffer]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkEndCommandBuffer");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateEndCommandBuffer(commandBuffer);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordEndCommandBuffer]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkEndCommandBuffer");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordEndCommandBuffer(commandBuffer);
     }
     VkResult result = DispatchEndCommandBuffer(commandBuffer);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordEndCommandBuffer]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkEndCommandBuffer");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordEndCommandBuffer(commandBuffer, result);
     }
@@ -2685,16 +3014,19 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetCommandBuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetCommandBuffer]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkResetCommandBuffer");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetCommandBuffer(commandBuffer, flags);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetCommandBuffer]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkResetCommandBuffer");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordResetCommandBuffer(commandBuffer, flags);
     }
     VkResult result = DispatchResetCommandBuffer(commandBuffer, flags);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetCommandBuffer]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkResetCommandBuffer");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordResetCommandBuffer(commandBuffer, flags, result);
     }
@@ -2707,17 +3039,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBindPipeline(
     VkPipeline                                  pipeline) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindPipeline]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdBindPipeline, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdBindPipeline");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindPipeline]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdBindPipeline, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdBindPipeline");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
     }
     DispatchCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindPipeline]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdBindPipeline, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdBindPipeline");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
     }
@@ -2730,17 +3065,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewport(
     const VkViewport*                           pViewports) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewport]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetViewport, commandBuffer, true)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetViewport");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetViewport]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetViewport, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetViewport");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
     }
     DispatchCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetViewport]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetViewport, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetViewport");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
     }
@@ -2753,17 +3091,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissor(
     const VkRect2D*                             pScissors) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetScissor]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetScissor, commandBuffer, true)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetScissor");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetScissor]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetScissor, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetScissor");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
     }
     DispatchCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetScissor]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetScissor, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetScissor");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
     }
@@ -2774,17 +3115,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineWidth(
     float                                       lineWidth) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetLineWidth]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetLineWidth, commandBuffer, true)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetLineWidth");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetLineWidth(commandBuffer, lineWidth);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetLineWidth]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetLineWidth, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetLineWidth");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetLineWidth(commandBuffer, lineWidth);
     }
     DispatchCmdSetLineWidth(commandBuffer, lineWidth);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetLineWidth]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetLineWidth, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetLineWidth");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetLineWidth(commandBuffer, lineWidth);
     }
@@ -2797,17 +3141,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBias(
     float                                       depthBiasSlopeFactor) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBias]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetDepthBias, commandBuffer, true)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetDepthBias");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthBias]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetDepthBias, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetDepthBias");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
     }
     DispatchCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthBias]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetDepthBias, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetDepthBias");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
     }
@@ -2818,17 +3165,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetBlendConstants(
     const float                                 blendConstants[4]) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetBlendConstants]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetBlendConstants, commandBuffer, true)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetBlendConstants");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetBlendConstants(commandBuffer, blendConstants);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetBlendConstants]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetBlendConstants, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetBlendConstants");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetBlendConstants(commandBuffer, blendConstants);
     }
     DispatchCmdSetBlendConstants(commandBuffer, blendConstants);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetBlendConstants]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetBlendConstants, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetBlendConstants");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetBlendConstants(commandBuffer, blendConstants);
     }
@@ -2840,17 +3190,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBounds(
     float                                       maxDepthBounds) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBounds]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetDepthBounds, commandBuffer, true)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetDepthBounds");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthBounds]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetDepthBounds, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetDepthBounds");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
     }
     DispatchCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthBounds]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetDepthBounds, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetDepthBounds");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
     }
@@ -2862,17 +3215,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilCompareMask(
     uint32_t                                    compareMask) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilCompareMask]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetStencilCompareMask, commandBuffer, true)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetStencilCompareMask");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilCompareMask]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetStencilCompareMask, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetStencilCompareMask");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
     }
     DispatchCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilCompareMask]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetStencilCompareMask, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetStencilCompareMask");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
     }
@@ -2884,17 +3240,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilWriteMask(
     uint32_t                                    writeMask) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilWriteMask]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetStencilWriteMask, commandBuffer, true)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetStencilWriteMask");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilWriteMask]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetStencilWriteMask, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetStencilWriteMask");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
     }
     DispatchCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilWriteMask]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetStencilWriteMask, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetStencilWriteMask");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
     }
@@ -2906,17 +3265,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilReference(
     uint32_t                                    reference) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilReference]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetStencilReference, commandBuffer, true)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetStencilReference");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilReference(commandBuffer, faceMask, reference);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilReference]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetStencilReference, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetStencilReference");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetStencilReference(commandBuffer, faceMask, reference);
     }
     DispatchCmdSetStencilReference(commandBuffer, faceMask, reference);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilReference]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetStencilReference, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetStencilReference");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetStencilReference(commandBuffer, faceMask, reference);
     }
@@ -2933,17 +3295,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets(
     const uint32_t*                             pDynamicOffsets) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindDescriptorSets]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdBindDescriptorSets, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdBindDescriptorSets");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindDescriptorSets]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdBindDescriptorSets, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdBindDescriptorSets");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
     }
     DispatchCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindDescriptorSets]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdBindDescriptorSets, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdBindDescriptorSets");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
     }
@@ -2956,17 +3321,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer(
     VkIndexType                                 indexType) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindIndexBuffer]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdBindIndexBuffer, commandBuffer, true)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdBindIndexBuffer");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindIndexBuffer]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdBindIndexBuffer, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdBindIndexBuffer");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
     }
     DispatchCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindIndexBuffer]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdBindIndexBuffer, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdBindIndexBuffer");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
     }
@@ -2980,17 +3348,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers(
     const VkDeviceSize*                         pOffsets) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindVertexBuffers]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdBindVertexBuffers, commandBuffer, true)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdBindVertexBuffers");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindVertexBuffers]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdBindVertexBuffers, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdBindVertexBuffers");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
     }
     DispatchCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindVertexBuffers]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdBindVertexBuffers, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdBindVertexBuffers");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
     }
@@ -3004,17 +3375,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDraw(
     uint32_t                                    firstInstance) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDraw]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdDraw, commandBuffer, true)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdDraw");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDraw]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdDraw, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdDraw");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
     }
     DispatchCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDraw]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdDraw, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdDraw");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
     }
@@ -3029,17 +3403,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexed(
     uint32_t                                    firstInstance) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexed]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdDrawIndexed, commandBuffer, true)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdDrawIndexed");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndexed]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdDrawIndexed, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdDrawIndexed");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
     }
     DispatchCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndexed]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdDrawIndexed, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdDrawIndexed");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
     }
@@ -3053,17 +3430,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirect(
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirect]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdDrawIndirect, commandBuffer, true)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdDrawIndirect");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndirect]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdDrawIndirect, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdDrawIndirect");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
     }
     DispatchCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndirect]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdDrawIndirect, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdDrawIndirect");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
     }
@@ -3077,17 +3457,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirect(
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexedIndirect]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdDrawIndexedIndirect, commandBuffer, true)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdDrawIndexedIndirect");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndexedIndirect]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdDrawIndexedIndirect, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdDrawIndexedIndirect");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
     }
     DispatchCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndexedIndirect]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdDrawIndexedIndirect, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdDrawIndexedIndirect");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
     }
@@ -3100,17 +3483,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatch(
     uint32_t                                    groupCountZ) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatch]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdDispatch, commandBuffer, true)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdDispatch");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDispatch]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdDispatch, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdDispatch");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
     }
     DispatchCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDispatch]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdDispatch, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdDispatch");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
     }
@@ -3122,17 +3508,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchIndirect(
     VkDeviceSize                                offset) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatchIndirect]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdDispatchIndirect, commandBuffer, true)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdDispatchIndirect");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDispatchIndirect(commandBuffer, buffer, offset);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDispatchIndirect]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdDispatchIndirect, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdDispatchIndirect");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdDispatchIndirect(commandBuffer, buffer, offset);
     }
     DispatchCmdDispatchIndirect(commandBuffer, buffer, offset);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDispatchIndirect]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdDispatchIndirect, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdDispatchIndirect");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdDispatchIndirect(commandBuffer, buffer, offset);
     }
@@ -3146,17 +3535,20 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer(
     const VkBufferCopy*                         pRegions) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBuffer]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdCopyBuffer, commandBuffer, true)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdCopyBuffer");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyBuffer]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdCopyBuffer, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdCopyBuffer");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
     }
     DispatchCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyBuffer]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdCopyBuffer, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdCopyBuffer");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
     }
@@ -3172,17 +3564,20 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage(
     const VkImageCopy*                          pRegions) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImage]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdCopyImage, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdCopyImage");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyImage]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdCopyImage, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdCopyImage");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     }
     DispatchCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyImage]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdCopyImage, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdCopyImage");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     }
@@ -3199,17 +3594,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage(
     VkFilter                                    filter) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBlitImage]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdBlitImage, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdBlitImage");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBlitImage]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdBlitImage, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdBlitImage");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
     }
     DispatchCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBlitImage]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdBlitImage, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdBlitImage");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
     }
@@ -3224,17 +3622,20 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage(
     const VkBufferImageCopy*                    pRegions) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBufferToImage]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdCopyBufferToImage, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdCopyBufferToImage");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyBufferToImage]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdCopyBufferToImage, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdCopyBufferToImage");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
     }
     DispatchCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyBufferToImage]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdCopyBufferToImage, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdCopyBufferToImage");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
     }
@@ -3249,17 +3650,20 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer(
     const VkBufferImageCopy*                    pRegions) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImageToBuffer]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdCopyImageToBuffer, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdCopyImageToBuffer");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyImageToBuffer]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdCopyImageToBuffer, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdCopyImageToBuffer");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
     }
     DispatchCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyImageToBuffer]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdCopyImageToBuffer, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdCopyImageToBuffer");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
     }
@@ -3273,17 +3677,20 @@ VKAPI_ATTR void VKAPI_CALL CmdUpdateBuffer(
     const void*                                 pData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdUpdateBuffer]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdUpdateBuffer, commandBuffer, true)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdUpdateBuffer");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdUpdateBuffer]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdUpdateBuffer, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdUpdateBuffer");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
     }
     DispatchCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdUpdateBuffer]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdUpdateBuffer, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdUpdateBuffer");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
     }
@@ -3297,17 +3704,20 @@ VKAPI_ATTR void VKAPI_CALL CmdFillBuffer(
     uint32_t                                    data) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdFillBuffer]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdFillBuffer, commandBuffer, true)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdFillBuffer");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdFillBuffer]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdFillBuffer, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdFillBuffer");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
     }
     DispatchCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdFillBuffer]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdFillBuffer, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdFillBuffer");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
     }
@@ -3322,17 +3732,20 @@ VKAPI_ATTR void VKAPI_CALL CmdClearColorImage(
     const VkImageSubresourceRange*              pRanges) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdClearColorImage]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdClearColorImage, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdClearColorImage");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdClearColorImage]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdClearColorImage, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdClearColorImage");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
     }
     DispatchCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdClearColorImage]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdClearColorImage, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdClearColorImage");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
     }
@@ -3347,17 +3760,20 @@ VKAPI_ATTR void VKAPI_CALL CmdClearDepthStencilImage(
     const VkImageSubresourceRange*              pRanges) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdClearDepthStencilImage]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdClearDepthStencilImage, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdClearDepthStencilImage");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdClearDepthStencilImage]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdClearDepthStencilImage, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdClearDepthStencilImage");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
     }
     DispatchCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdClearDepthStencilImage]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdClearDepthStencilImage, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdClearDepthStencilImage");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
     }
@@ -3371,17 +3787,20 @@ VKAPI_ATTR void VKAPI_CALL CmdClearAttachments(
     const VkClearRect*                          pRects) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdClearAttachments]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdClearAttachments, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdClearAttachments");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdClearAttachments]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdClearAttachments, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdClearAttachments");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
     }
     DispatchCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdClearAttachments]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdClearAttachments, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdClearAttachments");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
     }
@@ -3397,17 +3816,20 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage(
     const VkImageResolve*                       pRegions) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResolveImage]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdResolveImage, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdResolveImage");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdResolveImage]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdResolveImage, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdResolveImage");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     }
     DispatchCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdResolveImage]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdResolveImage, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdResolveImage");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     }
@@ -3419,17 +3841,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetEvent(
     VkPipelineStageFlags                        stageMask) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetEvent]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetEvent, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetEvent");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetEvent(commandBuffer, event, stageMask);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetEvent]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetEvent, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetEvent");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetEvent(commandBuffer, event, stageMask);
     }
     DispatchCmdSetEvent(commandBuffer, event, stageMask);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetEvent]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetEvent, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetEvent");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetEvent(commandBuffer, event, stageMask);
     }
@@ -3441,17 +3866,20 @@ VKAPI_ATTR void VKAPI_CALL CmdResetEvent(
     VkPipelineStageFlags                        stageMask) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResetEvent]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdResetEvent, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdResetEvent");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdResetEvent(commandBuffer, event, stageMask);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdResetEvent]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdResetEvent, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdResetEvent");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdResetEvent(commandBuffer, event, stageMask);
     }
     DispatchCmdResetEvent(commandBuffer, event, stageMask);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdResetEvent]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdResetEvent, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdResetEvent");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdResetEvent(commandBuffer, event, stageMask);
     }
@@ -3471,17 +3899,20 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents(
     const VkImageMemoryBarrier*                 pImageMemoryBarriers) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWaitEvents]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdWaitEvents, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdWaitEvents");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWaitEvents]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdWaitEvents, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdWaitEvents");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     }
     DispatchCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWaitEvents]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdWaitEvents, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdWaitEvents");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     }
@@ -3500,17 +3931,20 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier(
     const VkImageMemoryBarrier*                 pImageMemoryBarriers) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPipelineBarrier]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdPipelineBarrier, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdPipelineBarrier");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPipelineBarrier]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdPipelineBarrier, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdPipelineBarrier");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     }
     DispatchCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPipelineBarrier]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdPipelineBarrier, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdPipelineBarrier");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     }
@@ -3523,17 +3957,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginQuery(
     VkQueryControlFlags                         flags) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginQuery]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdBeginQuery, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdBeginQuery");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginQuery(commandBuffer, queryPool, query, flags);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginQuery]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdBeginQuery, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdBeginQuery");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdBeginQuery(commandBuffer, queryPool, query, flags);
     }
     DispatchCmdBeginQuery(commandBuffer, queryPool, query, flags);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginQuery]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdBeginQuery, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdBeginQuery");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdBeginQuery(commandBuffer, queryPool, query, flags);
     }
@@ -3545,17 +3982,20 @@ VKAPI_ATTR void VKAPI_CALL CmdEndQuery(
     uint32_t                                    query) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndQuery]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdEndQuery, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdEndQuery");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndQuery(commandBuffer, queryPool, query);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndQuery]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdEndQuery, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdEndQuery");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdEndQuery(commandBuffer, queryPool, query);
     }
     DispatchCmdEndQuery(commandBuffer, queryPool, query);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndQuery]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdEndQuery, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdEndQuery");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdEndQuery(commandBuffer, queryPool, query);
     }
@@ -3568,17 +4008,20 @@ VKAPI_ATTR void VKAPI_CALL CmdResetQueryPool(
     uint32_t                                    queryCount) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResetQueryPool]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdResetQueryPool, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdResetQueryPool");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdResetQueryPool]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdResetQueryPool, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdResetQueryPool");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
     }
     DispatchCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdResetQueryPool]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdResetQueryPool, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdResetQueryPool");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
     }
@@ -3591,17 +4034,20 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp(
     uint32_t                                    query) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteTimestamp]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdWriteTimestamp, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdWriteTimestamp");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteTimestamp]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdWriteTimestamp, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdWriteTimestamp");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
     }
     DispatchCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteTimestamp]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdWriteTimestamp, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdWriteTimestamp");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
     }
@@ -3618,17 +4064,20 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyQueryPoolResults(
     VkQueryResultFlags                          flags) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyQueryPoolResults]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdCopyQueryPoolResults, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdCopyQueryPoolResults");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyQueryPoolResults]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdCopyQueryPoolResults, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdCopyQueryPoolResults");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
     }
     DispatchCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyQueryPoolResults]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdCopyQueryPoolResults, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdCopyQueryPoolResults");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
     }
@@ -3643,17 +4092,20 @@ VKAPI_ATTR void VKAPI_CALL CmdPushConstants(
     const void*                                 pValues) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPushConstants]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdPushConstants, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdPushConstants");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPushConstants]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdPushConstants, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdPushConstants");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
     }
     DispatchCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPushConstants]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdPushConstants, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdPushConstants");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
     }
@@ -3665,17 +4117,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass(
     VkSubpassContents                           contents) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRenderPass]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdBeginRenderPass, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdBeginRenderPass");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginRenderPass]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdBeginRenderPass, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdBeginRenderPass");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
     }
     DispatchCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginRenderPass]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdBeginRenderPass, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdBeginRenderPass");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
     }
@@ -3686,17 +4141,20 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass(
     VkSubpassContents                           contents) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdNextSubpass]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdNextSubpass, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdNextSubpass");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdNextSubpass(commandBuffer, contents);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdNextSubpass]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdNextSubpass, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdNextSubpass");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdNextSubpass(commandBuffer, contents);
     }
     DispatchCmdNextSubpass(commandBuffer, contents);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdNextSubpass]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdNextSubpass, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdNextSubpass");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdNextSubpass(commandBuffer, contents);
     }
@@ -3706,17 +4164,20 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass(
     VkCommandBuffer                             commandBuffer) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRenderPass]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdEndRenderPass, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdEndRenderPass");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndRenderPass(commandBuffer);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndRenderPass]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdEndRenderPass, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdEndRenderPass");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdEndRenderPass(commandBuffer);
     }
     DispatchCmdEndRenderPass(commandBuffer);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndRenderPass]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdEndRenderPass, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdEndRenderPass");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdEndRenderPass(commandBuffer);
     }
@@ -3728,17 +4189,20 @@ VKAPI_ATTR void VKAPI_CALL CmdExecuteCommands(
     const VkCommandBuffer*                      pCommandBuffers) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdExecuteCommands]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdExecuteCommands, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdExecuteCommands");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdExecuteCommands]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdExecuteCommands, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdExecuteCommands");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
     }
     DispatchCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdExecuteCommands]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdExecuteCommands, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdExecuteCommands");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
     }
@@ -3752,16 +4216,19 @@ VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindBufferMemory2]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkBindBufferMemory2");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindBufferMemory2(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindBufferMemory2]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkBindBufferMemory2");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordBindBufferMemory2(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindBufferMemory2(device, bindInfoCount, pBindInfos);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindBufferMemory2]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkBindBufferMemory2");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordBindBufferMemory2(device, bindInfoCount, pBindInfos, result);
     }
@@ -3775,16 +4242,19 @@ VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindImageMemory2]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkBindImageMemory2");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindImageMemory2(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindImageMemory2]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkBindImageMemory2");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordBindImageMemory2(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindImageMemory2(device, bindInfoCount, pBindInfos);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindImageMemory2]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkBindImageMemory2");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordBindImageMemory2(device, bindInfoCount, pBindInfos, result);
     }
@@ -3800,16 +4270,19 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceGroupPeerMemoryFeatures(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceGroupPeerMemoryFeatures]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetDeviceGroupPeerMemoryFeatures");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceGroupPeerMemoryFeatures]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetDeviceGroupPeerMemoryFeatures");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     }
     DispatchGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceGroupPeerMemoryFeatures]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetDeviceGroupPeerMemoryFeatures");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     }
@@ -3820,17 +4293,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDeviceMask(
     uint32_t                                    deviceMask) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDeviceMask]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetDeviceMask, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetDeviceMask");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDeviceMask(commandBuffer, deviceMask);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDeviceMask]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetDeviceMask, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetDeviceMask");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetDeviceMask(commandBuffer, deviceMask);
     }
     DispatchCmdSetDeviceMask(commandBuffer, deviceMask);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDeviceMask]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetDeviceMask, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetDeviceMask");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetDeviceMask(commandBuffer, deviceMask);
     }
@@ -3846,17 +4322,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchBase(
     uint32_t                                    groupCountZ) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatchBase]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdDispatchBase, commandBuffer, true)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdDispatchBase");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDispatchBase]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdDispatchBase, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdDispatchBase");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     }
     DispatchCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDispatchBase]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdDispatchBase, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdDispatchBase");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     }
@@ -3869,16 +4348,19 @@ VKAPI_ATTR VkResult VKAPI_CALL EnumeratePhysicalDeviceGroups(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkEnumeratePhysicalDeviceGroups");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateEnumeratePhysicalDeviceGroups(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkEnumeratePhysicalDeviceGroups");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordEnumeratePhysicalDeviceGroups(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
     }
     VkResult result = DispatchEnumeratePhysicalDeviceGroups(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkEnumeratePhysicalDeviceGroups");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordEnumeratePhysicalDeviceGroups(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties, result);
     }
@@ -3892,16 +4374,19 @@ VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageMemoryRequirements2]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetImageMemoryRequirements2");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageMemoryRequirements2]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetImageMemoryRequirements2");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
     }
     DispatchGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageMemoryRequirements2]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetImageMemoryRequirements2");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
     }
@@ -3914,16 +4399,19 @@ VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferMemoryRequirements2]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetBufferMemoryRequirements2");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferMemoryRequirements2]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetBufferMemoryRequirements2");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
     }
     DispatchGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferMemoryRequirements2]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetBufferMemoryRequirements2");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
     }
@@ -3937,16 +4425,19 @@ VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageSparseMemoryRequirements2]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetImageSparseMemoryRequirements2");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageSparseMemoryRequirements2]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetImageSparseMemoryRequirements2");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
     DispatchGetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageSparseMemoryRequirements2]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetImageSparseMemoryRequirements2");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
@@ -3958,16 +4449,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFeatures2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceFeatures2");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceFeatures2(physicalDevice, pFeatures);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceFeatures2");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceFeatures2(physicalDevice, pFeatures);
     }
     DispatchGetPhysicalDeviceFeatures2(physicalDevice, pFeatures);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceFeatures2");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceFeatures2(physicalDevice, pFeatures);
     }
@@ -3979,16 +4473,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceProperties2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceProperties2");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceProperties2(physicalDevice, pProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceProperties2");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceProperties2(physicalDevice, pProperties);
     }
     DispatchGetPhysicalDeviceProperties2(physicalDevice, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceProperties2");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceProperties2(physicalDevice, pProperties);
     }
@@ -4001,16 +4498,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFormatProperties2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceFormatProperties2");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceFormatProperties2(physicalDevice, format, pFormatProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceFormatProperties2");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceFormatProperties2(physicalDevice, format, pFormatProperties);
     }
     DispatchGetPhysicalDeviceFormatProperties2(physicalDevice, format, pFormatProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceFormatProperties2");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceFormatProperties2(physicalDevice, format, pFormatProperties);
     }
@@ -4023,16 +4523,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceImageFormatProperties2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceImageFormatProperties2");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceImageFormatProperties2(physicalDevice, pImageFormatInfo, pImageFormatProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceImageFormatProperties2");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceImageFormatProperties2(physicalDevice, pImageFormatInfo, pImageFormatProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceImageFormatProperties2(physicalDevice, pImageFormatInfo, pImageFormatProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceImageFormatProperties2");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceImageFormatProperties2(physicalDevice, pImageFormatInfo, pImageFormatProperties, result);
     }
@@ -4046,16 +4549,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceQueueFamilyProperties2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceQueueFamilyProperties2");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceQueueFamilyProperties2(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceQueueFamilyProperties2");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceQueueFamilyProperties2(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
     }
     DispatchGetPhysicalDeviceQueueFamilyProperties2(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceQueueFamilyProperties2");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceQueueFamilyProperties2(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
     }
@@ -4067,16 +4573,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceMemoryProperties2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceMemoryProperties2");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceMemoryProperties2(physicalDevice, pMemoryProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceMemoryProperties2");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceMemoryProperties2(physicalDevice, pMemoryProperties);
     }
     DispatchGetPhysicalDeviceMemoryProperties2(physicalDevice, pMemoryProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceMemoryProperties2");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceMemoryProperties2(physicalDevice, pMemoryProperties);
     }
@@ -4090,16 +4599,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceSparseImageFormatProperties2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceSparseImageFormatProperties2");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSparseImageFormatProperties2(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceSparseImageFormatProperties2");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceSparseImageFormatProperties2(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
     }
     DispatchGetPhysicalDeviceSparseImageFormatProperties2(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceSparseImageFormatProperties2");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceSparseImageFormatProperties2(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
     }
@@ -4112,16 +4624,19 @@ VKAPI_ATTR void VKAPI_CALL TrimCommandPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateTrimCommandPool]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkTrimCommandPool");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateTrimCommandPool(device, commandPool, flags);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordTrimCommandPool]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkTrimCommandPool");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordTrimCommandPool(device, commandPool, flags);
     }
     DispatchTrimCommandPool(device, commandPool, flags);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordTrimCommandPool]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkTrimCommandPool");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordTrimCommandPool(device, commandPool, flags);
     }
@@ -4134,16 +4649,19 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceQueue2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceQueue2]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetDeviceQueue2");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceQueue2(device, pQueueInfo, pQueue);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceQueue2]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetDeviceQueue2");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDeviceQueue2(device, pQueueInfo, pQueue);
     }
     DispatchGetDeviceQueue2(device, pQueueInfo, pQueue);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceQueue2]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetDeviceQueue2");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDeviceQueue2(device, pQueueInfo, pQueue);
     }
@@ -4157,16 +4675,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSamplerYcbcrConversion(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSamplerYcbcrConversion]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateSamplerYcbcrConversion");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateSamplerYcbcrConversion]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateSamplerYcbcrConversion");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion);
     }
     VkResult result = DispatchCreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateSamplerYcbcrConversion]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateSamplerYcbcrConversion");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion, result);
     }
@@ -4180,16 +4701,19 @@ VKAPI_ATTR void VKAPI_CALL DestroySamplerYcbcrConversion(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroySamplerYcbcrConversion]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroySamplerYcbcrConversion");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroySamplerYcbcrConversion]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroySamplerYcbcrConversion");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
     }
     DispatchDestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroySamplerYcbcrConversion]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroySamplerYcbcrConversion");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
     }
@@ -4203,16 +4727,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorUpdateTemplate(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDescriptorUpdateTemplate]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateDescriptorUpdateTemplate");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateDescriptorUpdateTemplate]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateDescriptorUpdateTemplate");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
     }
     VkResult result = DispatchCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateDescriptorUpdateTemplate]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateDescriptorUpdateTemplate");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate, result);
     }
@@ -4226,16 +4753,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorUpdateTemplate(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyDescriptorUpdateTemplate]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroyDescriptorUpdateTemplate");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyDescriptorUpdateTemplate]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroyDescriptorUpdateTemplate");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
     }
     DispatchDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyDescriptorUpdateTemplate]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroyDescriptorUpdateTemplate");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
     }
@@ -4249,16 +4779,19 @@ VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSetWithTemplate(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUpdateDescriptorSetWithTemplate]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkUpdateDescriptorSetWithTemplate");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordUpdateDescriptorSetWithTemplate]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkUpdateDescriptorSetWithTemplate");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
     }
     DispatchUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordUpdateDescriptorSetWithTemplate]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkUpdateDescriptorSetWithTemplate");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
     }
@@ -4271,16 +4804,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalBufferProperties(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceExternalBufferProperties");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceExternalBufferProperties(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceExternalBufferProperties");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceExternalBufferProperties(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
     }
     DispatchGetPhysicalDeviceExternalBufferProperties(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceExternalBufferProperties");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceExternalBufferProperties(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
     }
@@ -4293,16 +4829,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalFenceProperties(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceExternalFenceProperties");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceExternalFenceProperties(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceExternalFenceProperties");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceExternalFenceProperties(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
     }
     DispatchGetPhysicalDeviceExternalFenceProperties(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceExternalFenceProperties");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceExternalFenceProperties(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
     }
@@ -4315,16 +4854,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalSemaphoreProperties(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceExternalSemaphoreProperties");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceExternalSemaphoreProperties(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceExternalSemaphoreProperties");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceExternalSemaphoreProperties(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
     }
     DispatchGetPhysicalDeviceExternalSemaphoreProperties(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceExternalSemaphoreProperties");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceExternalSemaphoreProperties(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
     }
@@ -4337,16 +4879,19 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutSupport(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDescriptorSetLayoutSupport]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetDescriptorSetLayoutSupport");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDescriptorSetLayoutSupport]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetDescriptorSetLayoutSupport");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
     }
     DispatchGetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDescriptorSetLayoutSupport]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetDescriptorSetLayoutSupport");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
     }
@@ -4363,17 +4908,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCount(
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirectCount]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdDrawIndirectCount, commandBuffer, true)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdDrawIndirectCount");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndirectCount]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdDrawIndirectCount, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdDrawIndirectCount");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndirectCount]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdDrawIndirectCount, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdDrawIndirectCount");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
@@ -4389,17 +4937,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCount(
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexedIndirectCount]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdDrawIndexedIndirectCount, commandBuffer, true)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdDrawIndexedIndirectCount");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndexedIndirectCount]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdDrawIndexedIndirectCount, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdDrawIndexedIndirectCount");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndexedIndirectCount]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdDrawIndexedIndirectCount, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdDrawIndexedIndirectCount");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
@@ -4413,16 +4964,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateRenderPass2]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateRenderPass2");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateRenderPass2]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateRenderPass2");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass);
     }
     VkResult result = DispatchCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateRenderPass2]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateRenderPass2");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass, result);
     }
@@ -4435,17 +4989,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2(
     const VkSubpassBeginInfo*                   pSubpassBeginInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRenderPass2]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdBeginRenderPass2, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdBeginRenderPass2");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginRenderPass2]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdBeginRenderPass2, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdBeginRenderPass2");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     }
     DispatchCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginRenderPass2]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdBeginRenderPass2, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdBeginRenderPass2");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     }
@@ -4457,17 +5014,20 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass2(
     const VkSubpassEndInfo*                     pSubpassEndInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdNextSubpass2]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdNextSubpass2, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdNextSubpass2");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdNextSubpass2]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdNextSubpass2, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdNextSubpass2");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     }
     DispatchCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdNextSubpass2]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdNextSubpass2, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdNextSubpass2");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     }
@@ -4478,17 +5038,20 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass2(
     const VkSubpassEndInfo*                     pSubpassEndInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRenderPass2]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdEndRenderPass2, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdEndRenderPass2");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndRenderPass2]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdEndRenderPass2, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdEndRenderPass2");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
     }
     DispatchCmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndRenderPass2]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdEndRenderPass2, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdEndRenderPass2");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
     }
@@ -4502,16 +5065,19 @@ VKAPI_ATTR void VKAPI_CALL ResetQueryPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetQueryPool]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkResetQueryPool");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetQueryPool(device, queryPool, firstQuery, queryCount);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetQueryPool]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkResetQueryPool");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordResetQueryPool(device, queryPool, firstQuery, queryCount);
     }
     DispatchResetQueryPool(device, queryPool, firstQuery, queryCount);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetQueryPool]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkResetQueryPool");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordResetQueryPool(device, queryPool, firstQuery, queryCount);
     }
@@ -4524,16 +5090,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreCounterValue(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSemaphoreCounterValue]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetSemaphoreCounterValue");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSemaphoreCounterValue(device, semaphore, pValue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSemaphoreCounterValue]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetSemaphoreCounterValue");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetSemaphoreCounterValue(device, semaphore, pValue);
     }
     VkResult result = DispatchGetSemaphoreCounterValue(device, semaphore, pValue);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSemaphoreCounterValue]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetSemaphoreCounterValue");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetSemaphoreCounterValue(device, semaphore, pValue, result);
     }
@@ -4547,16 +5116,19 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitSemaphores(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateWaitSemaphores]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkWaitSemaphores");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateWaitSemaphores(device, pWaitInfo, timeout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordWaitSemaphores]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkWaitSemaphores");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordWaitSemaphores(device, pWaitInfo, timeout);
     }
     VkResult result = DispatchWaitSemaphores(device, pWaitInfo, timeout);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordWaitSemaphores]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkWaitSemaphores");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordWaitSemaphores(device, pWaitInfo, timeout, result);
     }
@@ -4569,16 +5141,19 @@ VKAPI_ATTR VkResult VKAPI_CALL SignalSemaphore(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSignalSemaphore]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkSignalSemaphore");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSignalSemaphore(device, pSignalInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSignalSemaphore]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkSignalSemaphore");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordSignalSemaphore(device, pSignalInfo);
     }
     VkResult result = DispatchSignalSemaphore(device, pSignalInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSignalSemaphore]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkSignalSemaphore");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordSignalSemaphore(device, pSignalInfo, result);
     }
@@ -4591,16 +5166,19 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddress(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferDeviceAddress]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetBufferDeviceAddress");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferDeviceAddress(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferDeviceAddress]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetBufferDeviceAddress");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetBufferDeviceAddress(device, pInfo);
     }
     VkDeviceAddress result = DispatchGetBufferDeviceAddress(device, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferDeviceAddress]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetBufferDeviceAddress");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetBufferDeviceAddress(device, pInfo, result);
     }
@@ -4613,16 +5191,19 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetBufferOpaqueCaptureAddress(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferOpaqueCaptureAddress]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetBufferOpaqueCaptureAddress");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferOpaqueCaptureAddress(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferOpaqueCaptureAddress]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetBufferOpaqueCaptureAddress");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetBufferOpaqueCaptureAddress(device, pInfo);
     }
     uint64_t result = DispatchGetBufferOpaqueCaptureAddress(device, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferOpaqueCaptureAddress]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetBufferOpaqueCaptureAddress");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetBufferOpaqueCaptureAddress(device, pInfo);
     }
@@ -4635,16 +5216,19 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetDeviceMemoryOpaqueCaptureAddress(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceMemoryOpaqueCaptureAddress]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetDeviceMemoryOpaqueCaptureAddress");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceMemoryOpaqueCaptureAddress(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceMemoryOpaqueCaptureAddress]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetDeviceMemoryOpaqueCaptureAddress");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDeviceMemoryOpaqueCaptureAddress(device, pInfo);
     }
     uint64_t result = DispatchGetDeviceMemoryOpaqueCaptureAddress(device, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceMemoryOpaqueCaptureAddress]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetDeviceMemoryOpaqueCaptureAddress");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDeviceMemoryOpaqueCaptureAddress(device, pInfo);
     }
@@ -4659,16 +5243,19 @@ VKAPI_ATTR void VKAPI_CALL DestroySurfaceKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroySurfaceKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySurfaceKHR(instance, surface, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroySurfaceKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroySurfaceKHR(instance, surface, pAllocator);
     }
     DispatchDestroySurfaceKHR(instance, surface, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroySurfaceKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroySurfaceKHR(instance, surface, pAllocator);
     }
@@ -4682,16 +5269,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceSupportKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceSurfaceSupportKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSurfaceSupportKHR(physicalDevice, queueFamilyIndex, surface, pSupported);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceSurfaceSupportKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceSurfaceSupportKHR(physicalDevice, queueFamilyIndex, surface, pSupported);
     }
     VkResult result = DispatchGetPhysicalDeviceSurfaceSupportKHR(physicalDevice, queueFamilyIndex, surface, pSupported);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceSurfaceSupportKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceSurfaceSupportKHR(physicalDevice, queueFamilyIndex, surface, pSupported, result);
     }
@@ -4705,16 +5295,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceCapabilitiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceSurfaceCapabilitiesKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSurfaceCapabilitiesKHR(physicalDevice, surface, pSurfaceCapabilities);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceSurfaceCapabilitiesKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceSurfaceCapabilitiesKHR(physicalDevice, surface, pSurfaceCapabilities);
     }
     VkResult result = DispatchGetPhysicalDeviceSurfaceCapabilitiesKHR(physicalDevice, surface, pSurfaceCapabilities);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceSurfaceCapabilitiesKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceSurfaceCapabilitiesKHR(physicalDevice, surface, pSurfaceCapabilities, result);
     }
@@ -4729,16 +5322,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceFormatsKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceSurfaceFormatsKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceSurfaceFormatsKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats);
     }
     VkResult result = DispatchGetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceSurfaceFormatsKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats, result);
     }
@@ -4753,16 +5349,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfacePresentModesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceSurfacePresentModesKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSurfacePresentModesKHR(physicalDevice, surface, pPresentModeCount, pPresentModes);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceSurfacePresentModesKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceSurfacePresentModesKHR(physicalDevice, surface, pPresentModeCount, pPresentModes);
     }
     VkResult result = DispatchGetPhysicalDeviceSurfacePresentModesKHR(physicalDevice, surface, pPresentModeCount, pPresentModes);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceSurfacePresentModesKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceSurfacePresentModesKHR(physicalDevice, surface, pPresentModeCount, pPresentModes, result);
     }
@@ -4778,16 +5377,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSwapchainKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSwapchainKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateSwapchainKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateSwapchainKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateSwapchainKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
     }
     VkResult result = DispatchCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateSwapchainKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateSwapchainKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain, result);
     }
@@ -4801,16 +5403,19 @@ VKAPI_ATTR void VKAPI_CALL DestroySwapchainKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroySwapchainKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroySwapchainKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySwapchainKHR(device, swapchain, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroySwapchainKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroySwapchainKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroySwapchainKHR(device, swapchain, pAllocator);
     }
     DispatchDestroySwapchainKHR(device, swapchain, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroySwapchainKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroySwapchainKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroySwapchainKHR(device, swapchain, pAllocator);
     }
@@ -4824,16 +5429,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainImagesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSwapchainImagesKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetSwapchainImagesKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSwapchainImagesKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetSwapchainImagesKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
     }
     VkResult result = DispatchGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSwapchainImagesKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetSwapchainImagesKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages, result);
     }
@@ -4850,16 +5458,19 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireNextImageKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAcquireNextImageKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkAcquireNextImageKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAcquireNextImageKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkAcquireNextImageKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
     }
     VkResult result = DispatchAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAcquireNextImageKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkAcquireNextImageKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex, result);
     }
@@ -4872,16 +5483,20 @@ VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueuePresentKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkQueuePresentKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueuePresentKHR(queue, pPresentInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
+    if (layer_data->validation_sampler) layer_data->validation_sampler->QueuePresent();
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueuePresentKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkQueuePresentKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordQueuePresentKHR(queue, pPresentInfo);
     }
     VkResult result = DispatchQueuePresentKHR(queue, pPresentInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueuePresentKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkQueuePresentKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordQueuePresentKHR(queue, pPresentInfo, result);
     }
@@ -4894,16 +5509,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeviceGroupPresentCapabilitiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceGroupPresentCapabilitiesKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetDeviceGroupPresentCapabilitiesKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceGroupPresentCapabilitiesKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetDeviceGroupPresentCapabilitiesKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities);
     }
     VkResult result = DispatchGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceGroupPresentCapabilitiesKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetDeviceGroupPresentCapabilitiesKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities, result);
     }
@@ -4917,16 +5535,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeviceGroupSurfacePresentModesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceGroupSurfacePresentModesKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetDeviceGroupSurfacePresentModesKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceGroupSurfacePresentModesKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetDeviceGroupSurfacePresentModesKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes);
     }
     VkResult result = DispatchGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceGroupSurfacePresentModesKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetDeviceGroupSurfacePresentModesKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes, result);
     }
@@ -4941,16 +5562,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDevicePresentRectanglesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDevicePresentRectanglesKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDevicePresentRectanglesKHR(physicalDevice, surface, pRectCount, pRects);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDevicePresentRectanglesKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDevicePresentRectanglesKHR(physicalDevice, surface, pRectCount, pRects);
     }
     VkResult result = DispatchGetPhysicalDevicePresentRectanglesKHR(physicalDevice, surface, pRectCount, pRects);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDevicePresentRectanglesKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDevicePresentRectanglesKHR(physicalDevice, surface, pRectCount, pRects, result);
     }
@@ -4964,16 +5588,19 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireNextImage2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAcquireNextImage2KHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkAcquireNextImage2KHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAcquireNextImage2KHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkAcquireNextImage2KHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex);
     }
     VkResult result = DispatchAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAcquireNextImage2KHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkAcquireNextImage2KHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex, result);
     }
@@ -4988,16 +5615,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceDisplayPropertiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceDisplayPropertiesKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceDisplayPropertiesKHR(physicalDevice, pPropertyCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceDisplayPropertiesKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceDisplayPropertiesKHR(physicalDevice, pPropertyCount, pProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceDisplayPropertiesKHR(physicalDevice, pPropertyCount, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceDisplayPropertiesKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceDisplayPropertiesKHR(physicalDevice, pPropertyCount, pProperties, result);
     }
@@ -5011,16 +5641,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceDisplayPlanePropertiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceDisplayPlanePropertiesKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceDisplayPlanePropertiesKHR(physicalDevice, pPropertyCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceDisplayPlanePropertiesKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceDisplayPlanePropertiesKHR(physicalDevice, pPropertyCount, pProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceDisplayPlanePropertiesKHR(physicalDevice, pPropertyCount, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceDisplayPlanePropertiesKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceDisplayPlanePropertiesKHR(physicalDevice, pPropertyCount, pProperties, result);
     }
@@ -5035,16 +5668,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDisplayPlaneSupportedDisplaysKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetDisplayPlaneSupportedDisplaysKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDisplayPlaneSupportedDisplaysKHR(physicalDevice, planeIndex, pDisplayCount, pDisplays);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetDisplayPlaneSupportedDisplaysKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDisplayPlaneSupportedDisplaysKHR(physicalDevice, planeIndex, pDisplayCount, pDisplays);
     }
     VkResult result = DispatchGetDisplayPlaneSupportedDisplaysKHR(physicalDevice, planeIndex, pDisplayCount, pDisplays);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetDisplayPlaneSupportedDisplaysKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDisplayPlaneSupportedDisplaysKHR(physicalDevice, planeIndex, pDisplayCount, pDisplays, result);
     }
@@ -5059,16 +5695,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDisplayModePropertiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetDisplayModePropertiesKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDisplayModePropertiesKHR(physicalDevice, display, pPropertyCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetDisplayModePropertiesKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDisplayModePropertiesKHR(physicalDevice, display, pPropertyCount, pProperties);
     }
     VkResult result = DispatchGetDisplayModePropertiesKHR(physicalDevice, display, pPropertyCount, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetDisplayModePropertiesKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDisplayModePropertiesKHR(physicalDevice, display, pPropertyCount, pProperties, result);
     }
@@ -5084,16 +5723,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDisplayModeKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateDisplayModeKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDisplayModeKHR(physicalDevice, display, pCreateInfo, pAllocator, pMode);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateDisplayModeKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateDisplayModeKHR(physicalDevice, display, pCreateInfo, pAllocator, pMode);
     }
     VkResult result = DispatchCreateDisplayModeKHR(physicalDevice, display, pCreateInfo, pAllocator, pMode);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateDisplayModeKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateDisplayModeKHR(physicalDevice, display, pCreateInfo, pAllocator, pMode, result);
     }
@@ -5108,16 +5750,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDisplayPlaneCapabilitiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetDisplayPlaneCapabilitiesKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDisplayPlaneCapabilitiesKHR(physicalDevice, mode, planeIndex, pCapabilities);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetDisplayPlaneCapabilitiesKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDisplayPlaneCapabilitiesKHR(physicalDevice, mode, planeIndex, pCapabilities);
     }
     VkResult result = DispatchGetDisplayPlaneCapabilitiesKHR(physicalDevice, mode, planeIndex, pCapabilities);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetDisplayPlaneCapabilitiesKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDisplayPlaneCapabilitiesKHR(physicalDevice, mode, planeIndex, pCapabilities, result);
     }
@@ -5132,16 +5777,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDisplayPlaneSurfaceKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateDisplayPlaneSurfaceKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDisplayPlaneSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateDisplayPlaneSurfaceKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateDisplayPlaneSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateDisplayPlaneSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateDisplayPlaneSurfaceKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateDisplayPlaneSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface, result);
     }
@@ -5158,16 +5806,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSharedSwapchainsKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSharedSwapchainsKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateSharedSwapchainsKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateSharedSwapchainsKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateSharedSwapchainsKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
     }
     VkResult result = DispatchCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateSharedSwapchainsKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateSharedSwapchainsKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains, result);
     }
@@ -5184,16 +5835,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateXlibSurfaceKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateXlibSurfaceKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateXlibSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateXlibSurfaceKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateXlibSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateXlibSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateXlibSurfaceKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateXlibSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface, result);
     }
@@ -5208,16 +5862,19 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceXlibPresentationSupportKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceXlibPresentationSupportKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceXlibPresentationSupportKHR(physicalDevice, queueFamilyIndex, dpy, visualID);
         if (skip) return VK_FALSE;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceXlibPresentationSupportKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceXlibPresentationSupportKHR(physicalDevice, queueFamilyIndex, dpy, visualID);
     }
     VkBool32 result = DispatchGetPhysicalDeviceXlibPresentationSupportKHR(physicalDevice, queueFamilyIndex, dpy, visualID);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceXlibPresentationSupportKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceXlibPresentationSupportKHR(physicalDevice, queueFamilyIndex, dpy, visualID);
     }
@@ -5235,16 +5892,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateXcbSurfaceKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateXcbSurfaceKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateXcbSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateXcbSurfaceKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateXcbSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateXcbSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateXcbSurfaceKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateXcbSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface, result);
     }
@@ -5259,16 +5919,19 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceXcbPresentationSupportKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceXcbPresentationSupportKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceXcbPresentationSupportKHR(physicalDevice, queueFamilyIndex, connection, visual_id);
         if (skip) return VK_FALSE;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceXcbPresentationSupportKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceXcbPresentationSupportKHR(physicalDevice, queueFamilyIndex, connection, visual_id);
     }
     VkBool32 result = DispatchGetPhysicalDeviceXcbPresentationSupportKHR(physicalDevice, queueFamilyIndex, connection, visual_id);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceXcbPresentationSupportKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceXcbPresentationSupportKHR(physicalDevice, queueFamilyIndex, connection, visual_id);
     }
@@ -5286,16 +5949,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateWaylandSurfaceKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateWaylandSurfaceKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateWaylandSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateWaylandSurfaceKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateWaylandSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateWaylandSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateWaylandSurfaceKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateWaylandSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface, result);
     }
@@ -5309,16 +5975,19 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceWaylandPresentationSupportKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceWaylandPresentationSupportKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceWaylandPresentationSupportKHR(physicalDevice, queueFamilyIndex, display);
         if (skip) return VK_FALSE;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceWaylandPresentationSupportKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceWaylandPresentationSupportKHR(physicalDevice, queueFamilyIndex, display);
     }
     VkBool32 result = DispatchGetPhysicalDeviceWaylandPresentationSupportKHR(physicalDevice, queueFamilyIndex, display);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceWaylandPresentationSupportKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceWaylandPresentationSupportKHR(physicalDevice, queueFamilyIndex, display);
     }
@@ -5336,16 +6005,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateAndroidSurfaceKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateAndroidSurfaceKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateAndroidSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateAndroidSurfaceKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateAndroidSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateAndroidSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateAndroidSurfaceKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateAndroidSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface, result);
     }
@@ -5363,16 +6035,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateWin32SurfaceKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateWin32SurfaceKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateWin32SurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateWin32SurfaceKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateWin32SurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateWin32SurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateWin32SurfaceKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateWin32SurfaceKHR(instance, pCreateInfo, pAllocator, pSurface, result);
     }
@@ -5385,16 +6060,19 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceWin32PresentationSupportKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceWin32PresentationSupportKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceWin32PresentationSupportKHR(physicalDevice, queueFamilyIndex);
         if (skip) return VK_FALSE;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceWin32PresentationSupportKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceWin32PresentationSupportKHR(physicalDevice, queueFamilyIndex);
     }
     VkBool32 result = DispatchGetPhysicalDeviceWin32PresentationSupportKHR(physicalDevice, queueFamilyIndex);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceWin32PresentationSupportKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceWin32PresentationSupportKHR(physicalDevice, queueFamilyIndex);
     }
@@ -5411,16 +6089,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFeatures2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceFeatures2KHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceFeatures2KHR(physicalDevice, pFeatures);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceFeatures2KHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceFeatures2KHR(physicalDevice, pFeatures);
     }
     DispatchGetPhysicalDeviceFeatures2KHR(physicalDevice, pFeatures);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceFeatures2KHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceFeatures2KHR(physicalDevice, pFeatures);
     }
@@ -5432,16 +6113,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceProperties2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceProperties2KHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceProperties2KHR(physicalDevice, pProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceProperties2KHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceProperties2KHR(physicalDevice, pProperties);
     }
     DispatchGetPhysicalDeviceProperties2KHR(physicalDevice, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceProperties2KHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceProperties2KHR(physicalDevice, pProperties);
     }
@@ -5454,16 +6138,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFormatProperties2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceFormatProperties2KHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceFormatProperties2KHR(physicalDevice, format, pFormatProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceFormatProperties2KHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceFormatProperties2KHR(physicalDevice, format, pFormatProperties);
     }
     DispatchGetPhysicalDeviceFormatProperties2KHR(physicalDevice, format, pFormatProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceFormatProperties2KHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceFormatProperties2KHR(physicalDevice, format, pFormatProperties);
     }
@@ -5476,16 +6163,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceImageFormatProperties2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceImageFormatProperties2KHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceImageFormatProperties2KHR(physicalDevice, pImageFormatInfo, pImageFormatProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceImageFormatProperties2KHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceImageFormatProperties2KHR(physicalDevice, pImageFormatInfo, pImageFormatProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceImageFormatProperties2KHR(physicalDevice, pImageFormatInfo, pImageFormatProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceImageFormatProperties2KHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceImageFormatProperties2KHR(physicalDevice, pImageFormatInfo, pImageFormatProperties, result);
     }
@@ -5499,16 +6189,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceQueueFamilyProperties2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceQueueFamilyProperties2KHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceQueueFamilyProperties2KHR(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceQueueFamilyProperties2KHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceQueueFamilyProperties2KHR(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
     }
     DispatchGetPhysicalDeviceQueueFamilyProperties2KHR(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceQueueFamilyProperties2KHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceQueueFamilyProperties2KHR(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
     }
@@ -5520,16 +6213,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceMemoryProperties2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceMemoryProperties2KHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceMemoryProperties2KHR(physicalDevice, pMemoryProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceMemoryProperties2KHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceMemoryProperties2KHR(physicalDevice, pMemoryProperties);
     }
     DispatchGetPhysicalDeviceMemoryProperties2KHR(physicalDevice, pMemoryProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceMemoryProperties2KHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceMemoryProperties2KHR(physicalDevice, pMemoryProperties);
     }
@@ -5543,16 +6239,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceSparseImageFormatProperties2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceSparseImageFormatProperties2KHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSparseImageFormatProperties2KHR(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceSparseImageFormatProperties2KHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceSparseImageFormatProperties2KHR(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
     }
     DispatchGetPhysicalDeviceSparseImageFormatProperties2KHR(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceSparseImageFormatProperties2KHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceSparseImageFormatProperties2KHR(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
     }
@@ -5568,16 +6267,19 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceGroupPeerMemoryFeaturesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceGroupPeerMemoryFeaturesKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetDeviceGroupPeerMemoryFeaturesKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceGroupPeerMemoryFeaturesKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetDeviceGroupPeerMemoryFeaturesKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     }
     DispatchGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceGroupPeerMemoryFeaturesKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetDeviceGroupPeerMemoryFeaturesKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     }
@@ -5588,17 +6290,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDeviceMaskKHR(
     uint32_t                                    deviceMask) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDeviceMaskKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetDeviceMaskKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetDeviceMaskKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDeviceMaskKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetDeviceMaskKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetDeviceMaskKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
     }
     DispatchCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDeviceMaskKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetDeviceMaskKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetDeviceMaskKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
     }
@@ -5614,17 +6319,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchBaseKHR(
     uint32_t                                    groupCountZ) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatchBaseKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdDispatchBaseKHR, commandBuffer, true)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdDispatchBaseKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDispatchBaseKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdDispatchBaseKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdDispatchBaseKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     }
     DispatchCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDispatchBaseKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdDispatchBaseKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdDispatchBaseKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     }
@@ -5639,16 +6347,19 @@ VKAPI_ATTR void VKAPI_CALL TrimCommandPoolKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateTrimCommandPoolKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkTrimCommandPoolKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateTrimCommandPoolKHR(device, commandPool, flags);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordTrimCommandPoolKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkTrimCommandPoolKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordTrimCommandPoolKHR(device, commandPool, flags);
     }
     DispatchTrimCommandPoolKHR(device, commandPool, flags);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordTrimCommandPoolKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkTrimCommandPoolKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordTrimCommandPoolKHR(device, commandPool, flags);
     }
@@ -5662,16 +6373,19 @@ VKAPI_ATTR VkResult VKAPI_CALL EnumeratePhysicalDeviceGroupsKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkEnumeratePhysicalDeviceGroupsKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateEnumeratePhysicalDeviceGroupsKHR(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkEnumeratePhysicalDeviceGroupsKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordEnumeratePhysicalDeviceGroupsKHR(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
     }
     VkResult result = DispatchEnumeratePhysicalDeviceGroupsKHR(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkEnumeratePhysicalDeviceGroupsKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordEnumeratePhysicalDeviceGroupsKHR(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties, result);
     }
@@ -5686,16 +6400,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalBufferPropertiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceExternalBufferPropertiesKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceExternalBufferPropertiesKHR(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceExternalBufferPropertiesKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceExternalBufferPropertiesKHR(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
     }
     DispatchGetPhysicalDeviceExternalBufferPropertiesKHR(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceExternalBufferPropertiesKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceExternalBufferPropertiesKHR(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
     }
@@ -5711,16 +6428,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryWin32HandleKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryWin32HandleKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetMemoryWin32HandleKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryWin32HandleKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetMemoryWin32HandleKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     }
     VkResult result = DispatchGetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryWin32HandleKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetMemoryWin32HandleKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle, result);
     }
@@ -5735,16 +6455,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryWin32HandlePropertiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryWin32HandlePropertiesKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetMemoryWin32HandlePropertiesKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryWin32HandlePropertiesKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetMemoryWin32HandlePropertiesKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties);
     }
     VkResult result = DispatchGetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryWin32HandlePropertiesKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetMemoryWin32HandlePropertiesKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties, result);
     }
@@ -5760,16 +6483,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryFdKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryFdKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetMemoryFdKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryFdKHR(device, pGetFdInfo, pFd);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryFdKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetMemoryFdKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetMemoryFdKHR(device, pGetFdInfo, pFd);
     }
     VkResult result = DispatchGetMemoryFdKHR(device, pGetFdInfo, pFd);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryFdKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetMemoryFdKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetMemoryFdKHR(device, pGetFdInfo, pFd, result);
     }
@@ -5784,16 +6510,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryFdPropertiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryFdPropertiesKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetMemoryFdPropertiesKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryFdPropertiesKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetMemoryFdPropertiesKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties);
     }
     VkResult result = DispatchGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryFdPropertiesKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetMemoryFdPropertiesKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties, result);
     }
@@ -5811,16 +6540,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalSemaphorePropertiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceExternalSemaphorePropertiesKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceExternalSemaphorePropertiesKHR(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceExternalSemaphorePropertiesKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceExternalSemaphorePropertiesKHR(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
     }
     DispatchGetPhysicalDeviceExternalSemaphorePropertiesKHR(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceExternalSemaphorePropertiesKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceExternalSemaphorePropertiesKHR(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
     }
@@ -5835,16 +6567,19 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportSemaphoreWin32HandleKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateImportSemaphoreWin32HandleKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkImportSemaphoreWin32HandleKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordImportSemaphoreWin32HandleKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkImportSemaphoreWin32HandleKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo);
     }
     VkResult result = DispatchImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordImportSemaphoreWin32HandleKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkImportSemaphoreWin32HandleKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo, result);
     }
@@ -5858,16 +6593,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreWin32HandleKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSemaphoreWin32HandleKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetSemaphoreWin32HandleKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSemaphoreWin32HandleKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetSemaphoreWin32HandleKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     }
     VkResult result = DispatchGetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSemaphoreWin32HandleKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetSemaphoreWin32HandleKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle, result);
     }
@@ -5882,16 +6620,19 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportSemaphoreFdKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateImportSemaphoreFdKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkImportSemaphoreFdKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordImportSemaphoreFdKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkImportSemaphoreFdKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo);
     }
     VkResult result = DispatchImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordImportSemaphoreFdKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkImportSemaphoreFdKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo, result);
     }
@@ -5905,16 +6646,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreFdKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSemaphoreFdKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetSemaphoreFdKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSemaphoreFdKHR(device, pGetFdInfo, pFd);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSemaphoreFdKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetSemaphoreFdKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetSemaphoreFdKHR(device, pGetFdInfo, pFd);
     }
     VkResult result = DispatchGetSemaphoreFdKHR(device, pGetFdInfo, pFd);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSemaphoreFdKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetSemaphoreFdKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetSemaphoreFdKHR(device, pGetFdInfo, pFd, result);
     }
@@ -5931,17 +6675,20 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetKHR(
     const VkWriteDescriptorSet*                 pDescriptorWrites) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPushDescriptorSetKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdPushDescriptorSetKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdPushDescriptorSetKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPushDescriptorSetKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdPushDescriptorSetKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdPushDescriptorSetKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
     }
     DispatchCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPushDescriptorSetKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdPushDescriptorSetKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdPushDescriptorSetKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
     }
@@ -5955,17 +6702,20 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetWithTemplateKHR(
     const void*                                 pData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPushDescriptorSetWithTemplateKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdPushDescriptorSetWithTemplateKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdPushDescriptorSetWithTemplateKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPushDescriptorSetWithTemplateKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdPushDescriptorSetWithTemplateKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdPushDescriptorSetWithTemplateKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
     }
     DispatchCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPushDescriptorSetWithTemplateKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdPushDescriptorSetWithTemplateKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdPushDescriptorSetWithTemplateKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
     }
@@ -5983,16 +6733,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorUpdateTemplateKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDescriptorUpdateTemplateKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateDescriptorUpdateTemplateKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateDescriptorUpdateTemplateKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateDescriptorUpdateTemplateKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
     }
     VkResult result = DispatchCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateDescriptorUpdateTemplateKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateDescriptorUpdateTemplateKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate, result);
     }
@@ -6006,16 +6759,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorUpdateTemplateKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyDescriptorUpdateTemplateKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroyDescriptorUpdateTemplateKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyDescriptorUpdateTemplateKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroyDescriptorUpdateTemplateKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
     }
     DispatchDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyDescriptorUpdateTemplateKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroyDescriptorUpdateTemplateKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
     }
@@ -6029,16 +6785,19 @@ VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSetWithTemplateKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUpdateDescriptorSetWithTemplateKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkUpdateDescriptorSetWithTemplateKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordUpdateDescriptorSetWithTemplateKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkUpdateDescriptorSetWithTemplateKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData);
     }
     DispatchUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordUpdateDescriptorSetWithTemplateKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkUpdateDescriptorSetWithTemplateKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData);
     }
@@ -6054,16 +6813,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateRenderPass2KHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateRenderPass2KHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateRenderPass2KHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateRenderPass2KHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass);
     }
     VkResult result = DispatchCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateRenderPass2KHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateRenderPass2KHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass, result);
     }
@@ -6076,17 +6838,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2KHR(
     const VkSubpassBeginInfo*                   pSubpassBeginInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRenderPass2KHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdBeginRenderPass2KHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdBeginRenderPass2KHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginRenderPass2KHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdBeginRenderPass2KHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdBeginRenderPass2KHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     }
     DispatchCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginRenderPass2KHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdBeginRenderPass2KHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdBeginRenderPass2KHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     }
@@ -6098,17 +6863,20 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass2KHR(
     const VkSubpassEndInfo*                     pSubpassEndInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdNextSubpass2KHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdNextSubpass2KHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdNextSubpass2KHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdNextSubpass2KHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdNextSubpass2KHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdNextSubpass2KHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     }
     DispatchCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdNextSubpass2KHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdNextSubpass2KHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdNextSubpass2KHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     }
@@ -6119,17 +6887,20 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass2KHR(
     const VkSubpassEndInfo*                     pSubpassEndInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRenderPass2KHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdEndRenderPass2KHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdEndRenderPass2KHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndRenderPass2KHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdEndRenderPass2KHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdEndRenderPass2KHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
     }
     DispatchCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndRenderPass2KHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdEndRenderPass2KHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdEndRenderPass2KHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
     }
@@ -6142,16 +6913,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainStatusKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSwapchainStatusKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetSwapchainStatusKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSwapchainStatusKHR(device, swapchain);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSwapchainStatusKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetSwapchainStatusKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetSwapchainStatusKHR(device, swapchain);
     }
     VkResult result = DispatchGetSwapchainStatusKHR(device, swapchain);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSwapchainStatusKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetSwapchainStatusKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetSwapchainStatusKHR(device, swapchain, result);
     }
@@ -6166,16 +6940,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalFencePropertiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceExternalFencePropertiesKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceExternalFencePropertiesKHR(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceExternalFencePropertiesKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceExternalFencePropertiesKHR(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
     }
     DispatchGetPhysicalDeviceExternalFencePropertiesKHR(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceExternalFencePropertiesKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceExternalFencePropertiesKHR(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
     }
@@ -6190,16 +6967,19 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportFenceWin32HandleKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateImportFenceWin32HandleKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkImportFenceWin32HandleKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordImportFenceWin32HandleKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkImportFenceWin32HandleKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo);
     }
     VkResult result = DispatchImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordImportFenceWin32HandleKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkImportFenceWin32HandleKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo, result);
     }
@@ -6213,16 +6993,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetFenceWin32HandleKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetFenceWin32HandleKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetFenceWin32HandleKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetFenceWin32HandleKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetFenceWin32HandleKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     }
     VkResult result = DispatchGetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetFenceWin32HandleKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetFenceWin32HandleKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle, result);
     }
@@ -6237,16 +7020,19 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportFenceFdKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateImportFenceFdKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkImportFenceFdKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateImportFenceFdKHR(device, pImportFenceFdInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordImportFenceFdKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkImportFenceFdKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordImportFenceFdKHR(device, pImportFenceFdInfo);
     }
     VkResult result = DispatchImportFenceFdKHR(device, pImportFenceFdInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordImportFenceFdKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkImportFenceFdKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordImportFenceFdKHR(device, pImportFenceFdInfo, result);
     }
@@ -6260,16 +7046,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetFenceFdKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetFenceFdKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetFenceFdKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetFenceFdKHR(device, pGetFdInfo, pFd);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetFenceFdKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetFenceFdKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetFenceFdKHR(device, pGetFdInfo, pFd);
     }
     VkResult result = DispatchGetFenceFdKHR(device, pGetFdInfo, pFd);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetFenceFdKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetFenceFdKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetFenceFdKHR(device, pGetFdInfo, pFd, result);
     }
@@ -6286,16 +7075,19 @@ VKAPI_ATTR VkResult VKAPI_CALL EnumeratePhysicalDeviceQueueFamilyPerformanceQuer
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(physicalDevice, queueFamilyIndex, pCounterCount, pCounters, pCounterDescriptions);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(physicalDevice, queueFamilyIndex, pCounterCount, pCounters, pCounterDescriptions);
     }
     VkResult result = DispatchEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(physicalDevice, queueFamilyIndex, pCounterCount, pCounters, pCounterDescriptions);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(physicalDevice, queueFamilyIndex, pCounterCount, pCounters, pCounterDescriptions, result);
     }
@@ -6309,16 +7101,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(physicalDevice, pPerformanceQueryCreateInfo, pNumPasses);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(physicalDevice, pPerformanceQueryCreateInfo, pNumPasses);
     }
     DispatchGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(physicalDevice, pPerformanceQueryCreateInfo, pNumPasses);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(physicalDevice, pPerformanceQueryCreateInfo, pNumPasses);
     }
@@ -6330,16 +7125,19 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireProfilingLockKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAcquireProfilingLockKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkAcquireProfilingLockKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireProfilingLockKHR(device, pInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAcquireProfilingLockKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkAcquireProfilingLockKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordAcquireProfilingLockKHR(device, pInfo);
     }
     VkResult result = DispatchAcquireProfilingLockKHR(device, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAcquireProfilingLockKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkAcquireProfilingLockKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordAcquireProfilingLockKHR(device, pInfo, result);
     }
@@ -6351,16 +7149,19 @@ VKAPI_ATTR void VKAPI_CALL ReleaseProfilingLockKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateReleaseProfilingLockKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkReleaseProfilingLockKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateReleaseProfilingLockKHR(device);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordReleaseProfilingLockKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkReleaseProfilingLockKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordReleaseProfilingLockKHR(device);
     }
     DispatchReleaseProfilingLockKHR(device);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordReleaseProfilingLockKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkReleaseProfilingLockKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordReleaseProfilingLockKHR(device);
     }
@@ -6375,16 +7176,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceCapabilities2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceSurfaceCapabilities2KHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSurfaceCapabilities2KHR(physicalDevice, pSurfaceInfo, pSurfaceCapabilities);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceSurfaceCapabilities2KHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceSurfaceCapabilities2KHR(physicalDevice, pSurfaceInfo, pSurfaceCapabilities);
     }
     VkResult result = DispatchGetPhysicalDeviceSurfaceCapabilities2KHR(physicalDevice, pSurfaceInfo, pSurfaceCapabilities);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceSurfaceCapabilities2KHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceSurfaceCapabilities2KHR(physicalDevice, pSurfaceInfo, pSurfaceCapabilities, result);
     }
@@ -6399,16 +7203,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceFormats2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceSurfaceFormats2KHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSurfaceFormats2KHR(physicalDevice, pSurfaceInfo, pSurfaceFormatCount, pSurfaceFormats);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceSurfaceFormats2KHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceSurfaceFormats2KHR(physicalDevice, pSurfaceInfo, pSurfaceFormatCount, pSurfaceFormats);
     }
     VkResult result = DispatchGetPhysicalDeviceSurfaceFormats2KHR(physicalDevice, pSurfaceInfo, pSurfaceFormatCount, pSurfaceFormats);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceSurfaceFormats2KHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceSurfaceFormats2KHR(physicalDevice, pSurfaceInfo, pSurfaceFormatCount, pSurfaceFormats, result);
     }
@@ -6424,16 +7231,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceDisplayProperties2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceDisplayProperties2KHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceDisplayProperties2KHR(physicalDevice, pPropertyCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceDisplayProperties2KHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceDisplayProperties2KHR(physicalDevice, pPropertyCount, pProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceDisplayProperties2KHR(physicalDevice, pPropertyCount, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceDisplayProperties2KHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceDisplayProperties2KHR(physicalDevice, pPropertyCount, pProperties, result);
     }
@@ -6447,16 +7257,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceDisplayPlaneProperties2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceDisplayPlaneProperties2KHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceDisplayPlaneProperties2KHR(physicalDevice, pPropertyCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceDisplayPlaneProperties2KHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceDisplayPlaneProperties2KHR(physicalDevice, pPropertyCount, pProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceDisplayPlaneProperties2KHR(physicalDevice, pPropertyCount, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceDisplayPlaneProperties2KHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceDisplayPlaneProperties2KHR(physicalDevice, pPropertyCount, pProperties, result);
     }
@@ -6471,16 +7284,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDisplayModeProperties2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetDisplayModeProperties2KHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDisplayModeProperties2KHR(physicalDevice, display, pPropertyCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetDisplayModeProperties2KHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDisplayModeProperties2KHR(physicalDevice, display, pPropertyCount, pProperties);
     }
     VkResult result = DispatchGetDisplayModeProperties2KHR(physicalDevice, display, pPropertyCount, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetDisplayModeProperties2KHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDisplayModeProperties2KHR(physicalDevice, display, pPropertyCount, pProperties, result);
     }
@@ -6494,16 +7310,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDisplayPlaneCapabilities2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetDisplayPlaneCapabilities2KHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDisplayPlaneCapabilities2KHR(physicalDevice, pDisplayPlaneInfo, pCapabilities);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetDisplayPlaneCapabilities2KHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDisplayPlaneCapabilities2KHR(physicalDevice, pDisplayPlaneInfo, pCapabilities);
     }
     VkResult result = DispatchGetDisplayPlaneCapabilities2KHR(physicalDevice, pDisplayPlaneInfo, pCapabilities);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetDisplayPlaneCapabilities2KHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDisplayPlaneCapabilities2KHR(physicalDevice, pDisplayPlaneInfo, pCapabilities, result);
     }
@@ -6521,16 +7340,19 @@ VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageMemoryRequirements2KHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetImageMemoryRequirements2KHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageMemoryRequirements2KHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetImageMemoryRequirements2KHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     }
     DispatchGetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageMemoryRequirements2KHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetImageMemoryRequirements2KHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     }
@@ -6543,16 +7365,19 @@ VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferMemoryRequirements2KHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetBufferMemoryRequirements2KHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferMemoryRequirements2KHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetBufferMemoryRequirements2KHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     }
     DispatchGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferMemoryRequirements2KHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetBufferMemoryRequirements2KHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     }
@@ -6566,16 +7391,19 @@ VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageSparseMemoryRequirements2KHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetImageSparseMemoryRequirements2KHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageSparseMemoryRequirements2KHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetImageSparseMemoryRequirements2KHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
     DispatchGetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageSparseMemoryRequirements2KHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetImageSparseMemoryRequirements2KHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
@@ -6591,16 +7419,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSamplerYcbcrConversionKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSamplerYcbcrConversionKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateSamplerYcbcrConversionKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateSamplerYcbcrConversionKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateSamplerYcbcrConversionKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion);
     }
     VkResult result = DispatchCreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateSamplerYcbcrConversionKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateSamplerYcbcrConversionKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion, result);
     }
@@ -6614,16 +7445,19 @@ VKAPI_ATTR void VKAPI_CALL DestroySamplerYcbcrConversionKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroySamplerYcbcrConversionKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroySamplerYcbcrConversionKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroySamplerYcbcrConversionKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroySamplerYcbcrConversionKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
     }
     DispatchDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroySamplerYcbcrConversionKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroySamplerYcbcrConversionKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
     }
@@ -6637,16 +7471,19 @@ VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindBufferMemory2KHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkBindBufferMemory2KHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindBufferMemory2KHR(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindBufferMemory2KHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkBindBufferMemory2KHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordBindBufferMemory2KHR(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindBufferMemory2KHR(device, bindInfoCount, pBindInfos);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindBufferMemory2KHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkBindBufferMemory2KHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordBindBufferMemory2KHR(device, bindInfoCount, pBindInfos, result);
     }
@@ -6660,16 +7497,19 @@ VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindImageMemory2KHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkBindImageMemory2KHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindImageMemory2KHR(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindImageMemory2KHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkBindImageMemory2KHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordBindImageMemory2KHR(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindImageMemory2KHR(device, bindInfoCount, pBindInfos);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindImageMemory2KHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkBindImageMemory2KHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordBindImageMemory2KHR(device, bindInfoCount, pBindInfos, result);
     }
@@ -6687,16 +7527,19 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutSupportKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDescriptorSetLayoutSupportKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetDescriptorSetLayoutSupportKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDescriptorSetLayoutSupportKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetDescriptorSetLayoutSupportKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
     }
     DispatchGetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDescriptorSetLayoutSupportKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetDescriptorSetLayoutSupportKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
     }
@@ -6713,17 +7556,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCountKHR(
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirectCountKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdDrawIndirectCountKHR, commandBuffer, true)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdDrawIndirectCountKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndirectCountKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdDrawIndirectCountKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdDrawIndirectCountKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndirectCountKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdDrawIndirectCountKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdDrawIndirectCountKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
@@ -6739,17 +7585,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCountKHR(
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexedIndirectCountKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdDrawIndexedIndirectCountKHR, commandBuffer, true)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdDrawIndexedIndirectCountKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndexedIndirectCountKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdDrawIndexedIndirectCountKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdDrawIndexedIndirectCountKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndexedIndirectCountKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdDrawIndexedIndirectCountKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdDrawIndexedIndirectCountKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
@@ -6771,16 +7620,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreCounterValueKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSemaphoreCounterValueKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetSemaphoreCounterValueKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSemaphoreCounterValueKHR(device, semaphore, pValue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSemaphoreCounterValueKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetSemaphoreCounterValueKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetSemaphoreCounterValueKHR(device, semaphore, pValue);
     }
     VkResult result = DispatchGetSemaphoreCounterValueKHR(device, semaphore, pValue);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSemaphoreCounterValueKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetSemaphoreCounterValueKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetSemaphoreCounterValueKHR(device, semaphore, pValue, result);
     }
@@ -6794,16 +7646,19 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitSemaphoresKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateWaitSemaphoresKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkWaitSemaphoresKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateWaitSemaphoresKHR(device, pWaitInfo, timeout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordWaitSemaphoresKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkWaitSemaphoresKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordWaitSemaphoresKHR(device, pWaitInfo, timeout);
     }
     VkResult result = DispatchWaitSemaphoresKHR(device, pWaitInfo, timeout);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordWaitSemaphoresKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkWaitSemaphoresKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordWaitSemaphoresKHR(device, pWaitInfo, timeout, result);
     }
@@ -6816,16 +7671,19 @@ VKAPI_ATTR VkResult VKAPI_CALL SignalSemaphoreKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSignalSemaphoreKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkSignalSemaphoreKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSignalSemaphoreKHR(device, pSignalInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSignalSemaphoreKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkSignalSemaphoreKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordSignalSemaphoreKHR(device, pSignalInfo);
     }
     VkResult result = DispatchSignalSemaphoreKHR(device, pSignalInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSignalSemaphoreKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkSignalSemaphoreKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordSignalSemaphoreKHR(device, pSignalInfo, result);
     }
@@ -6842,16 +7700,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceFragmentShadingRatesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceFragmentShadingRatesKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceFragmentShadingRatesKHR(physicalDevice, pFragmentShadingRateCount, pFragmentShadingRates);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceFragmentShadingRatesKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceFragmentShadingRatesKHR(physicalDevice, pFragmentShadingRateCount, pFragmentShadingRates);
     }
     VkResult result = DispatchGetPhysicalDeviceFragmentShadingRatesKHR(physicalDevice, pFragmentShadingRateCount, pFragmentShadingRates);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceFragmentShadingRatesKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceFragmentShadingRatesKHR(physicalDevice, pFragmentShadingRateCount, pFragmentShadingRates, result);
     }
@@ -6864,17 +7725,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFragmentShadingRateKHR(
     const VkFragmentShadingRateCombinerOpKHR    combinerOps[2]) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetFragmentShadingRateKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetFragmentShadingRateKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetFragmentShadingRateKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetFragmentShadingRateKHR(commandBuffer, pFragmentSize, combinerOps);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetFragmentShadingRateKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetFragmentShadingRateKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetFragmentShadingRateKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetFragmentShadingRateKHR(commandBuffer, pFragmentSize, combinerOps);
     }
     DispatchCmdSetFragmentShadingRateKHR(commandBuffer, pFragmentSize, combinerOps);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetFragmentShadingRateKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetFragmentShadingRateKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetFragmentShadingRateKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetFragmentShadingRateKHR(commandBuffer, pFragmentSize, combinerOps);
     }
@@ -6891,16 +7755,19 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddressKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferDeviceAddressKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetBufferDeviceAddressKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferDeviceAddressKHR(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferDeviceAddressKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetBufferDeviceAddressKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetBufferDeviceAddressKHR(device, pInfo);
     }
     VkDeviceAddress result = DispatchGetBufferDeviceAddressKHR(device, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferDeviceAddressKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetBufferDeviceAddressKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetBufferDeviceAddressKHR(device, pInfo, result);
     }
@@ -6913,16 +7780,19 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetBufferOpaqueCaptureAddressKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferOpaqueCaptureAddressKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetBufferOpaqueCaptureAddressKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferOpaqueCaptureAddressKHR(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferOpaqueCaptureAddressKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetBufferOpaqueCaptureAddressKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetBufferOpaqueCaptureAddressKHR(device, pInfo);
     }
     uint64_t result = DispatchGetBufferOpaqueCaptureAddressKHR(device, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferOpaqueCaptureAddressKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetBufferOpaqueCaptureAddressKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetBufferOpaqueCaptureAddressKHR(device, pInfo);
     }
@@ -6935,16 +7805,19 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetDeviceMemoryOpaqueCaptureAddressKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceMemoryOpaqueCaptureAddressKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetDeviceMemoryOpaqueCaptureAddressKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceMemoryOpaqueCaptureAddressKHR(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetDeviceMemoryOpaqueCaptureAddressKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR(device, pInfo);
     }
     uint64_t result = DispatchGetDeviceMemoryOpaqueCaptureAddressKHR(device, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetDeviceMemoryOpaqueCaptureAddressKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR(device, pInfo);
     }
@@ -6959,16 +7832,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDeferredOperationKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDeferredOperationKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateDeferredOperationKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDeferredOperationKHR(device, pAllocator, pDeferredOperation);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateDeferredOperationKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateDeferredOperationKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateDeferredOperationKHR(device, pAllocator, pDeferredOperation);
     }
     VkResult result = DispatchCreateDeferredOperationKHR(device, pAllocator, pDeferredOperation);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateDeferredOperationKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateDeferredOperationKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateDeferredOperationKHR(device, pAllocator, pDeferredOperation, result);
     }
@@ -6982,16 +7858,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyDeferredOperationKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyDeferredOperationKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroyDeferredOperationKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDeferredOperationKHR(device, operation, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyDeferredOperationKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroyDeferredOperationKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyDeferredOperationKHR(device, operation, pAllocator);
     }
     DispatchDestroyDeferredOperationKHR(device, operation, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyDeferredOperationKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroyDeferredOperationKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyDeferredOperationKHR(device, operation, pAllocator);
     }
@@ -7003,16 +7882,19 @@ VKAPI_ATTR uint32_t VKAPI_CALL GetDeferredOperationMaxConcurrencyKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeferredOperationMaxConcurrencyKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetDeferredOperationMaxConcurrencyKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeferredOperationMaxConcurrencyKHR(device, operation);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeferredOperationMaxConcurrencyKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetDeferredOperationMaxConcurrencyKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDeferredOperationMaxConcurrencyKHR(device, operation);
     }
     uint32_t result = DispatchGetDeferredOperationMaxConcurrencyKHR(device, operation);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeferredOperationMaxConcurrencyKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetDeferredOperationMaxConcurrencyKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDeferredOperationMaxConcurrencyKHR(device, operation);
     }
@@ -7025,16 +7907,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeferredOperationResultKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeferredOperationResultKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetDeferredOperationResultKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeferredOperationResultKHR(device, operation);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeferredOperationResultKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetDeferredOperationResultKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDeferredOperationResultKHR(device, operation);
     }
     VkResult result = DispatchGetDeferredOperationResultKHR(device, operation);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeferredOperationResultKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetDeferredOperationResultKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDeferredOperationResultKHR(device, operation, result);
     }
@@ -7047,16 +7932,19 @@ VKAPI_ATTR VkResult VKAPI_CALL DeferredOperationJoinKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDeferredOperationJoinKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDeferredOperationJoinKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDeferredOperationJoinKHR(device, operation);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDeferredOperationJoinKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDeferredOperationJoinKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDeferredOperationJoinKHR(device, operation);
     }
     VkResult result = DispatchDeferredOperationJoinKHR(device, operation);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDeferredOperationJoinKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDeferredOperationJoinKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDeferredOperationJoinKHR(device, operation, result);
     }
@@ -7072,16 +7960,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineExecutablePropertiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPipelineExecutablePropertiesKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPipelineExecutablePropertiesKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPipelineExecutablePropertiesKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPipelineExecutablePropertiesKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties);
     }
     VkResult result = DispatchGetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPipelineExecutablePropertiesKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPipelineExecutablePropertiesKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties, result);
     }
@@ -7096,16 +7987,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineExecutableStatisticsKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPipelineExecutableStatisticsKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPipelineExecutableStatisticsKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPipelineExecutableStatisticsKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPipelineExecutableStatisticsKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics);
     }
     VkResult result = DispatchGetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPipelineExecutableStatisticsKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPipelineExecutableStatisticsKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics, result);
     }
@@ -7120,16 +8014,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineExecutableInternalRepresentationsKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPipelineExecutableInternalRepresentationsKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPipelineExecutableInternalRepresentationsKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPipelineExecutableInternalRepresentationsKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPipelineExecutableInternalRepresentationsKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations);
     }
     VkResult result = DispatchGetPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPipelineExecutableInternalRepresentationsKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPipelineExecutableInternalRepresentationsKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations, result);
     }
@@ -7146,17 +8043,20 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer2KHR(
     const VkCopyBufferInfo2KHR*                 pCopyBufferInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBuffer2KHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdCopyBuffer2KHR, commandBuffer, true)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdCopyBuffer2KHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyBuffer2KHR(commandBuffer, pCopyBufferInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyBuffer2KHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdCopyBuffer2KHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdCopyBuffer2KHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdCopyBuffer2KHR(commandBuffer, pCopyBufferInfo);
     }
     DispatchCmdCopyBuffer2KHR(commandBuffer, pCopyBufferInfo);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyBuffer2KHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdCopyBuffer2KHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdCopyBuffer2KHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdCopyBuffer2KHR(commandBuffer, pCopyBufferInfo);
     }
@@ -7167,17 +8067,20 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage2KHR(
     const VkCopyImageInfo2KHR*                  pCopyImageInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImage2KHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdCopyImage2KHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdCopyImage2KHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyImage2KHR(commandBuffer, pCopyImageInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyImage2KHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdCopyImage2KHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdCopyImage2KHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdCopyImage2KHR(commandBuffer, pCopyImageInfo);
     }
     DispatchCmdCopyImage2KHR(commandBuffer, pCopyImageInfo);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyImage2KHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdCopyImage2KHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdCopyImage2KHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdCopyImage2KHR(commandBuffer, pCopyImageInfo);
     }
@@ -7188,17 +8091,20 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage2KHR(
     const VkCopyBufferToImageInfo2KHR*          pCopyBufferToImageInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBufferToImage2KHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdCopyBufferToImage2KHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdCopyBufferToImage2KHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyBufferToImage2KHR(commandBuffer, pCopyBufferToImageInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyBufferToImage2KHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdCopyBufferToImage2KHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdCopyBufferToImage2KHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdCopyBufferToImage2KHR(commandBuffer, pCopyBufferToImageInfo);
     }
     DispatchCmdCopyBufferToImage2KHR(commandBuffer, pCopyBufferToImageInfo);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyBufferToImage2KHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdCopyBufferToImage2KHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdCopyBufferToImage2KHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdCopyBufferToImage2KHR(commandBuffer, pCopyBufferToImageInfo);
     }
@@ -7209,17 +8115,20 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer2KHR(
     const VkCopyImageToBufferInfo2KHR*          pCopyImageToBufferInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImageToBuffer2KHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdCopyImageToBuffer2KHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdCopyImageToBuffer2KHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyImageToBuffer2KHR(commandBuffer, pCopyImageToBufferInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyImageToBuffer2KHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdCopyImageToBuffer2KHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdCopyImageToBuffer2KHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdCopyImageToBuffer2KHR(commandBuffer, pCopyImageToBufferInfo);
     }
     DispatchCmdCopyImageToBuffer2KHR(commandBuffer, pCopyImageToBufferInfo);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyImageToBuffer2KHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdCopyImageToBuffer2KHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdCopyImageToBuffer2KHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdCopyImageToBuffer2KHR(commandBuffer, pCopyImageToBufferInfo);
     }
@@ -7230,17 +8139,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage2KHR(
     const VkBlitImageInfo2KHR*                  pBlitImageInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBlitImage2KHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdBlitImage2KHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdBlitImage2KHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBlitImage2KHR(commandBuffer, pBlitImageInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBlitImage2KHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdBlitImage2KHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdBlitImage2KHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdBlitImage2KHR(commandBuffer, pBlitImageInfo);
     }
     DispatchCmdBlitImage2KHR(commandBuffer, pBlitImageInfo);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBlitImage2KHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdBlitImage2KHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdBlitImage2KHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdBlitImage2KHR(commandBuffer, pBlitImageInfo);
     }
@@ -7251,17 +8163,20 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage2KHR(
     const VkResolveImageInfo2KHR*               pResolveImageInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResolveImage2KHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdResolveImage2KHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdResolveImage2KHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdResolveImage2KHR(commandBuffer, pResolveImageInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdResolveImage2KHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdResolveImage2KHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdResolveImage2KHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdResolveImage2KHR(commandBuffer, pResolveImageInfo);
     }
     DispatchCmdResolveImage2KHR(commandBuffer, pResolveImageInfo);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdResolveImage2KHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdResolveImage2KHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdResolveImage2KHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdResolveImage2KHR(commandBuffer, pResolveImageInfo);
     }
@@ -7276,17 +8191,20 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDebugReportCallbackEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateDebugReportCallbackEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDebugReportCallbackEXT(instance, pCreateInfo, pAllocator, pCallback);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateDebugReportCallbackEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateDebugReportCallbackEXT(instance, pCreateInfo, pAllocator, pCallback);
     }
     VkResult result = DispatchCreateDebugReportCallbackEXT(instance, pCreateInfo, pAllocator, pCallback);
     layer_create_report_callback(layer_data->report_data, false, pCreateInfo, pAllocator, pCallback);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateDebugReportCallbackEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateDebugReportCallbackEXT(instance, pCreateInfo, pAllocator, pCallback, result);
     }
@@ -7300,17 +8218,20 @@ VKAPI_ATTR void VKAPI_CALL DestroyDebugReportCallbackEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroyDebugReportCallbackEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDebugReportCallbackEXT(instance, callback, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroyDebugReportCallbackEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyDebugReportCallbackEXT(instance, callback, pAllocator);
     }
     DispatchDestroyDebugReportCallbackEXT(instance, callback, pAllocator);
     layer_destroy_callback(layer_data->report_data, callback, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroyDebugReportCallbackEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyDebugReportCallbackEXT(instance, callback, pAllocator);
     }
@@ -7328,16 +8249,19 @@ VKAPI_ATTR void VKAPI_CALL DebugReportMessageEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDebugReportMessageEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDebugReportMessageEXT(instance, flags, objectType, object, location, messageCode, pLayerPrefix, pMessage);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDebugReportMessageEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDebugReportMessageEXT(instance, flags, objectType, object, location, messageCode, pLayerPrefix, pMessage);
     }
     DispatchDebugReportMessageEXT(instance, flags, objectType, object, location, messageCode, pLayerPrefix, pMessage);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDebugReportMessageEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDebugReportMessageEXT(instance, flags, objectType, object, location, messageCode, pLayerPrefix, pMessage);
     }
@@ -7356,16 +8280,19 @@ VKAPI_ATTR VkResult VKAPI_CALL DebugMarkerSetObjectTagEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDebugMarkerSetObjectTagEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDebugMarkerSetObjectTagEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDebugMarkerSetObjectTagEXT(device, pTagInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDebugMarkerSetObjectTagEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDebugMarkerSetObjectTagEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDebugMarkerSetObjectTagEXT(device, pTagInfo);
     }
     VkResult result = DispatchDebugMarkerSetObjectTagEXT(device, pTagInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDebugMarkerSetObjectTagEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDebugMarkerSetObjectTagEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDebugMarkerSetObjectTagEXT(device, pTagInfo, result);
     }
@@ -7378,17 +8305,20 @@ VKAPI_ATTR VkResult VKAPI_CALL DebugMarkerSetObjectNameEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDebugMarkerSetObjectNameEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDebugMarkerSetObjectNameEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDebugMarkerSetObjectNameEXT(device, pNameInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDebugMarkerSetObjectNameEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDebugMarkerSetObjectNameEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDebugMarkerSetObjectNameEXT(device, pNameInfo);
     }
     layer_data->report_data->DebugReportSetMarkerObjectName(pNameInfo);
     VkResult result = DispatchDebugMarkerSetObjectNameEXT(device, pNameInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDebugMarkerSetObjectNameEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDebugMarkerSetObjectNameEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDebugMarkerSetObjectNameEXT(device, pNameInfo, result);
     }
@@ -7400,17 +8330,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerBeginEXT(
     const VkDebugMarkerMarkerInfoEXT*           pMarkerInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDebugMarkerBeginEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdDebugMarkerBeginEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdDebugMarkerBeginEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDebugMarkerBeginEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdDebugMarkerBeginEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdDebugMarkerBeginEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
     }
     DispatchCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDebugMarkerBeginEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdDebugMarkerBeginEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdDebugMarkerBeginEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
     }
@@ -7420,17 +8353,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerEndEXT(
     VkCommandBuffer                             commandBuffer) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDebugMarkerEndEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdDebugMarkerEndEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdDebugMarkerEndEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDebugMarkerEndEXT(commandBuffer);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDebugMarkerEndEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdDebugMarkerEndEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdDebugMarkerEndEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdDebugMarkerEndEXT(commandBuffer);
     }
     DispatchCmdDebugMarkerEndEXT(commandBuffer);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDebugMarkerEndEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdDebugMarkerEndEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdDebugMarkerEndEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdDebugMarkerEndEXT(commandBuffer);
     }
@@ -7441,17 +8377,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerInsertEXT(
     const VkDebugMarkerMarkerInfoEXT*           pMarkerInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDebugMarkerInsertEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdDebugMarkerInsertEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdDebugMarkerInsertEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDebugMarkerInsertEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdDebugMarkerInsertEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdDebugMarkerInsertEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
     }
     DispatchCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDebugMarkerInsertEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdDebugMarkerInsertEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdDebugMarkerInsertEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
     }
@@ -7469,17 +8408,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBindTransformFeedbackBuffersEXT(
     const VkDeviceSize*                         pSizes) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindTransformFeedbackBuffersEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdBindTransformFeedbackBuffersEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdBindTransformFeedbackBuffersEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindTransformFeedbackBuffersEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdBindTransformFeedbackBuffersEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdBindTransformFeedbackBuffersEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
     }
     DispatchCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindTransformFeedbackBuffersEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdBindTransformFeedbackBuffersEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdBindTransformFeedbackBuffersEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
     }
@@ -7493,17 +8435,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginTransformFeedbackEXT(
     const VkDeviceSize*                         pCounterBufferOffsets) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginTransformFeedbackEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdBeginTransformFeedbackEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdBeginTransformFeedbackEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginTransformFeedbackEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdBeginTransformFeedbackEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdBeginTransformFeedbackEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     }
     DispatchCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginTransformFeedbackEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdBeginTransformFeedbackEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdBeginTransformFeedbackEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     }
@@ -7517,17 +8462,20 @@ VKAPI_ATTR void VKAPI_CALL CmdEndTransformFeedbackEXT(
     const VkDeviceSize*                         pCounterBufferOffsets) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndTransformFeedbackEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdEndTransformFeedbackEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdEndTransformFeedbackEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndTransformFeedbackEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdEndTransformFeedbackEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdEndTransformFeedbackEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     }
     DispatchCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndTransformFeedbackEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdEndTransformFeedbackEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdEndTransformFeedbackEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     }
@@ -7541,17 +8489,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginQueryIndexedEXT(
     uint32_t                                    index) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginQueryIndexedEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdBeginQueryIndexedEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdBeginQueryIndexedEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginQueryIndexedEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdBeginQueryIndexedEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdBeginQueryIndexedEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
     }
     DispatchCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginQueryIndexedEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdBeginQueryIndexedEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdBeginQueryIndexedEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
     }
@@ -7564,17 +8515,20 @@ VKAPI_ATTR void VKAPI_CALL CmdEndQueryIndexedEXT(
     uint32_t                                    index) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndQueryIndexedEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdEndQueryIndexedEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdEndQueryIndexedEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndQueryIndexedEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdEndQueryIndexedEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdEndQueryIndexedEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
     }
     DispatchCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndQueryIndexedEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdEndQueryIndexedEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdEndQueryIndexedEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
     }
@@ -7590,17 +8544,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectByteCountEXT(
     uint32_t                                    vertexStride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirectByteCountEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdDrawIndirectByteCountEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdDrawIndirectByteCountEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndirectByteCountEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdDrawIndirectByteCountEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdDrawIndirectByteCountEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
     }
     DispatchCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndirectByteCountEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdDrawIndirectByteCountEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdDrawIndirectByteCountEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
     }
@@ -7613,16 +8570,19 @@ VKAPI_ATTR uint32_t VKAPI_CALL GetImageViewHandleNVX(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageViewHandleNVX]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetImageViewHandleNVX");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageViewHandleNVX(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageViewHandleNVX]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetImageViewHandleNVX");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetImageViewHandleNVX(device, pInfo);
     }
     uint32_t result = DispatchGetImageViewHandleNVX(device, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageViewHandleNVX]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetImageViewHandleNVX");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetImageViewHandleNVX(device, pInfo);
     }
@@ -7636,16 +8596,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetImageViewAddressNVX(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageViewAddressNVX]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetImageViewAddressNVX");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageViewAddressNVX(device, imageView, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageViewAddressNVX]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetImageViewAddressNVX");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetImageViewAddressNVX(device, imageView, pProperties);
     }
     VkResult result = DispatchGetImageViewAddressNVX(device, imageView, pProperties);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageViewAddressNVX]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetImageViewAddressNVX");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetImageViewAddressNVX(device, imageView, pProperties, result);
     }
@@ -7663,17 +8626,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCountAMD(
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirectCountAMD]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdDrawIndirectCountAMD, commandBuffer, true)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdDrawIndirectCountAMD");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndirectCountAMD]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdDrawIndirectCountAMD, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdDrawIndirectCountAMD");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndirectCountAMD]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdDrawIndirectCountAMD, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdDrawIndirectCountAMD");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
@@ -7689,17 +8655,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCountAMD(
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexedIndirectCountAMD]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdDrawIndexedIndirectCountAMD, commandBuffer, true)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdDrawIndexedIndirectCountAMD");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndexedIndirectCountAMD]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdDrawIndexedIndirectCountAMD, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdDrawIndexedIndirectCountAMD");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndexedIndirectCountAMD]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdDrawIndexedIndirectCountAMD, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdDrawIndexedIndirectCountAMD");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
@@ -7720,16 +8689,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetShaderInfoAMD(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetShaderInfoAMD]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetShaderInfoAMD");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetShaderInfoAMD]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetShaderInfoAMD");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
     }
     VkResult result = DispatchGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetShaderInfoAMD]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetShaderInfoAMD");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo, result);
     }
@@ -7747,16 +8719,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateStreamDescriptorSurfaceGGP(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateStreamDescriptorSurfaceGGP");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateStreamDescriptorSurfaceGGP(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateStreamDescriptorSurfaceGGP");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateStreamDescriptorSurfaceGGP(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateStreamDescriptorSurfaceGGP(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateStreamDescriptorSurfaceGGP");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateStreamDescriptorSurfaceGGP(instance, pCreateInfo, pAllocator, pSurface, result);
     }
@@ -7779,16 +8754,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceExternalImageFormatPropertiesNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceExternalImageFormatPropertiesNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceExternalImageFormatPropertiesNV(physicalDevice, format, type, tiling, usage, flags, externalHandleType, pExternalImageFormatProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceExternalImageFormatPropertiesNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceExternalImageFormatPropertiesNV(physicalDevice, format, type, tiling, usage, flags, externalHandleType, pExternalImageFormatProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceExternalImageFormatPropertiesNV(physicalDevice, format, type, tiling, usage, flags, externalHandleType, pExternalImageFormatProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceExternalImageFormatPropertiesNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceExternalImageFormatPropertiesNV(physicalDevice, format, type, tiling, usage, flags, externalHandleType, pExternalImageFormatProperties, result);
     }
@@ -7806,16 +8784,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryWin32HandleNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryWin32HandleNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetMemoryWin32HandleNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryWin32HandleNV(device, memory, handleType, pHandle);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryWin32HandleNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetMemoryWin32HandleNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetMemoryWin32HandleNV(device, memory, handleType, pHandle);
     }
     VkResult result = DispatchGetMemoryWin32HandleNV(device, memory, handleType, pHandle);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryWin32HandleNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetMemoryWin32HandleNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetMemoryWin32HandleNV(device, memory, handleType, pHandle, result);
     }
@@ -7837,16 +8818,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateViSurfaceNN(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateViSurfaceNN");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateViSurfaceNN(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateViSurfaceNN");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateViSurfaceNN(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateViSurfaceNN(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateViSurfaceNN");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateViSurfaceNN(instance, pCreateInfo, pAllocator, pSurface, result);
     }
@@ -7864,17 +8848,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginConditionalRenderingEXT(
     const VkConditionalRenderingBeginInfoEXT*   pConditionalRenderingBegin) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginConditionalRenderingEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdBeginConditionalRenderingEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdBeginConditionalRenderingEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginConditionalRenderingEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdBeginConditionalRenderingEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdBeginConditionalRenderingEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
     }
     DispatchCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginConditionalRenderingEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdBeginConditionalRenderingEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdBeginConditionalRenderingEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
     }
@@ -7884,17 +8871,20 @@ VKAPI_ATTR void VKAPI_CALL CmdEndConditionalRenderingEXT(
     VkCommandBuffer                             commandBuffer) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndConditionalRenderingEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdEndConditionalRenderingEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdEndConditionalRenderingEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndConditionalRenderingEXT(commandBuffer);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndConditionalRenderingEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdEndConditionalRenderingEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdEndConditionalRenderingEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdEndConditionalRenderingEXT(commandBuffer);
     }
     DispatchCmdEndConditionalRenderingEXT(commandBuffer);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndConditionalRenderingEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdEndConditionalRenderingEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdEndConditionalRenderingEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdEndConditionalRenderingEXT(commandBuffer);
     }
@@ -7908,17 +8898,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWScalingNV(
     const VkViewportWScalingNV*                 pViewportWScalings) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewportWScalingNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetViewportWScalingNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetViewportWScalingNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetViewportWScalingNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetViewportWScalingNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetViewportWScalingNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
     }
     DispatchCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetViewportWScalingNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetViewportWScalingNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetViewportWScalingNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
     }
@@ -7931,16 +8924,19 @@ VKAPI_ATTR VkResult VKAPI_CALL ReleaseDisplayEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkReleaseDisplayEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateReleaseDisplayEXT(physicalDevice, display);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkReleaseDisplayEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordReleaseDisplayEXT(physicalDevice, display);
     }
     VkResult result = DispatchReleaseDisplayEXT(physicalDevice, display);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkReleaseDisplayEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordReleaseDisplayEXT(physicalDevice, display, result);
     }
@@ -7956,16 +8952,19 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireXlibDisplayEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkAcquireXlibDisplayEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireXlibDisplayEXT(physicalDevice, dpy, display);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkAcquireXlibDisplayEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordAcquireXlibDisplayEXT(physicalDevice, dpy, display);
     }
     VkResult result = DispatchAcquireXlibDisplayEXT(physicalDevice, dpy, display);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkAcquireXlibDisplayEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordAcquireXlibDisplayEXT(physicalDevice, dpy, display, result);
     }
@@ -7980,16 +8979,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRandROutputDisplayEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetRandROutputDisplayEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRandROutputDisplayEXT(physicalDevice, dpy, rrOutput, pDisplay);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetRandROutputDisplayEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetRandROutputDisplayEXT(physicalDevice, dpy, rrOutput, pDisplay);
     }
     VkResult result = DispatchGetRandROutputDisplayEXT(physicalDevice, dpy, rrOutput, pDisplay);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetRandROutputDisplayEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetRandROutputDisplayEXT(physicalDevice, dpy, rrOutput, pDisplay, result);
     }
@@ -8005,16 +9007,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceCapabilities2EXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceSurfaceCapabilities2EXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSurfaceCapabilities2EXT(physicalDevice, surface, pSurfaceCapabilities);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceSurfaceCapabilities2EXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceSurfaceCapabilities2EXT(physicalDevice, surface, pSurfaceCapabilities);
     }
     VkResult result = DispatchGetPhysicalDeviceSurfaceCapabilities2EXT(physicalDevice, surface, pSurfaceCapabilities);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceSurfaceCapabilities2EXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceSurfaceCapabilities2EXT(physicalDevice, surface, pSurfaceCapabilities, result);
     }
@@ -8029,16 +9034,19 @@ VKAPI_ATTR VkResult VKAPI_CALL DisplayPowerControlEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDisplayPowerControlEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDisplayPowerControlEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDisplayPowerControlEXT(device, display, pDisplayPowerInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDisplayPowerControlEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDisplayPowerControlEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDisplayPowerControlEXT(device, display, pDisplayPowerInfo);
     }
     VkResult result = DispatchDisplayPowerControlEXT(device, display, pDisplayPowerInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDisplayPowerControlEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDisplayPowerControlEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDisplayPowerControlEXT(device, display, pDisplayPowerInfo, result);
     }
@@ -8053,16 +9061,19 @@ VKAPI_ATTR VkResult VKAPI_CALL RegisterDeviceEventEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateRegisterDeviceEventEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkRegisterDeviceEventEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateRegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordRegisterDeviceEventEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkRegisterDeviceEventEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordRegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence);
     }
     VkResult result = DispatchRegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordRegisterDeviceEventEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkRegisterDeviceEventEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordRegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence, result);
     }
@@ -8078,16 +9089,19 @@ VKAPI_ATTR VkResult VKAPI_CALL RegisterDisplayEventEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateRegisterDisplayEventEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkRegisterDisplayEventEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateRegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordRegisterDisplayEventEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkRegisterDisplayEventEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordRegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence);
     }
     VkResult result = DispatchRegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordRegisterDisplayEventEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkRegisterDisplayEventEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordRegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence, result);
     }
@@ -8102,16 +9116,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainCounterEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSwapchainCounterEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetSwapchainCounterEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSwapchainCounterEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetSwapchainCounterEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue);
     }
     VkResult result = DispatchGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSwapchainCounterEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetSwapchainCounterEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue, result);
     }
@@ -8126,16 +9143,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRefreshCycleDurationGOOGLE(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetRefreshCycleDurationGOOGLE]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetRefreshCycleDurationGOOGLE");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetRefreshCycleDurationGOOGLE]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetRefreshCycleDurationGOOGLE");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties);
     }
     VkResult result = DispatchGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetRefreshCycleDurationGOOGLE]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetRefreshCycleDurationGOOGLE");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties, result);
     }
@@ -8150,16 +9170,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPastPresentationTimingGOOGLE(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPastPresentationTimingGOOGLE]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPastPresentationTimingGOOGLE");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPastPresentationTimingGOOGLE]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPastPresentationTimingGOOGLE");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings);
     }
     VkResult result = DispatchGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPastPresentationTimingGOOGLE]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPastPresentationTimingGOOGLE");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings, result);
     }
@@ -8179,17 +9202,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDiscardRectangleEXT(
     const VkRect2D*                             pDiscardRectangles) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDiscardRectangleEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetDiscardRectangleEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetDiscardRectangleEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDiscardRectangleEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetDiscardRectangleEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetDiscardRectangleEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
     }
     DispatchCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDiscardRectangleEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetDiscardRectangleEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetDiscardRectangleEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
     }
@@ -8207,16 +9233,19 @@ VKAPI_ATTR void VKAPI_CALL SetHdrMetadataEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetHdrMetadataEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkSetHdrMetadataEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetHdrMetadataEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkSetHdrMetadataEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordSetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
     }
     DispatchSetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetHdrMetadataEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkSetHdrMetadataEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordSetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
     }
@@ -8232,16 +9261,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateIOSSurfaceMVK(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateIOSSurfaceMVK");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateIOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateIOSSurfaceMVK");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateIOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateIOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateIOSSurfaceMVK");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateIOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface, result);
     }
@@ -8259,16 +9291,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateMacOSSurfaceMVK(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateMacOSSurfaceMVK");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateMacOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateMacOSSurfaceMVK");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateMacOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateMacOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateMacOSSurfaceMVK");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateMacOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface, result);
     }
@@ -8285,17 +9320,20 @@ VKAPI_ATTR VkResult VKAPI_CALL SetDebugUtilsObjectNameEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetDebugUtilsObjectNameEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkSetDebugUtilsObjectNameEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetDebugUtilsObjectNameEXT(device, pNameInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetDebugUtilsObjectNameEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkSetDebugUtilsObjectNameEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordSetDebugUtilsObjectNameEXT(device, pNameInfo);
     }
     layer_data->report_data->DebugReportSetUtilsObjectName(pNameInfo);
     VkResult result = DispatchSetDebugUtilsObjectNameEXT(device, pNameInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetDebugUtilsObjectNameEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkSetDebugUtilsObjectNameEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordSetDebugUtilsObjectNameEXT(device, pNameInfo, result);
     }
@@ -8308,16 +9346,19 @@ VKAPI_ATTR VkResult VKAPI_CALL SetDebugUtilsObjectTagEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetDebugUtilsObjectTagEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkSetDebugUtilsObjectTagEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetDebugUtilsObjectTagEXT(device, pTagInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetDebugUtilsObjectTagEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkSetDebugUtilsObjectTagEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordSetDebugUtilsObjectTagEXT(device, pTagInfo);
     }
     VkResult result = DispatchSetDebugUtilsObjectTagEXT(device, pTagInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetDebugUtilsObjectTagEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkSetDebugUtilsObjectTagEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordSetDebugUtilsObjectTagEXT(device, pTagInfo, result);
     }
@@ -8330,17 +9371,20 @@ VKAPI_ATTR void VKAPI_CALL QueueBeginDebugUtilsLabelEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueBeginDebugUtilsLabelEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkQueueBeginDebugUtilsLabelEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueBeginDebugUtilsLabelEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkQueueBeginDebugUtilsLabelEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordQueueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
     }
     BeginQueueDebugUtilsLabel(layer_data->report_data, queue, pLabelInfo);
     DispatchQueueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueBeginDebugUtilsLabelEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkQueueBeginDebugUtilsLabelEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordQueueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
     }
@@ -8351,17 +9395,20 @@ VKAPI_ATTR void VKAPI_CALL QueueEndDebugUtilsLabelEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueEndDebugUtilsLabelEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkQueueEndDebugUtilsLabelEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueEndDebugUtilsLabelEXT(queue);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueEndDebugUtilsLabelEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkQueueEndDebugUtilsLabelEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordQueueEndDebugUtilsLabelEXT(queue);
     }
     DispatchQueueEndDebugUtilsLabelEXT(queue);
     EndQueueDebugUtilsLabel(layer_data->report_data, queue);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueEndDebugUtilsLabelEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkQueueEndDebugUtilsLabelEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordQueueEndDebugUtilsLabelEXT(queue);
     }
@@ -8373,17 +9420,20 @@ VKAPI_ATTR void VKAPI_CALL QueueInsertDebugUtilsLabelEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueInsertDebugUtilsLabelEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkQueueInsertDebugUtilsLabelEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueInsertDebugUtilsLabelEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkQueueInsertDebugUtilsLabelEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordQueueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
     }
     InsertQueueDebugUtilsLabel(layer_data->report_data, queue, pLabelInfo);
     DispatchQueueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueInsertDebugUtilsLabelEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkQueueInsertDebugUtilsLabelEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordQueueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
     }
@@ -8394,17 +9444,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginDebugUtilsLabelEXT(
     const VkDebugUtilsLabelEXT*                 pLabelInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginDebugUtilsLabelEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdBeginDebugUtilsLabelEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdBeginDebugUtilsLabelEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginDebugUtilsLabelEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdBeginDebugUtilsLabelEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdBeginDebugUtilsLabelEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     }
     DispatchCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginDebugUtilsLabelEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdBeginDebugUtilsLabelEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdBeginDebugUtilsLabelEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     }
@@ -8414,17 +9467,20 @@ VKAPI_ATTR void VKAPI_CALL CmdEndDebugUtilsLabelEXT(
     VkCommandBuffer                             commandBuffer) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndDebugUtilsLabelEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdEndDebugUtilsLabelEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdEndDebugUtilsLabelEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndDebugUtilsLabelEXT(commandBuffer);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndDebugUtilsLabelEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdEndDebugUtilsLabelEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdEndDebugUtilsLabelEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdEndDebugUtilsLabelEXT(commandBuffer);
     }
     DispatchCmdEndDebugUtilsLabelEXT(commandBuffer);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndDebugUtilsLabelEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdEndDebugUtilsLabelEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdEndDebugUtilsLabelEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdEndDebugUtilsLabelEXT(commandBuffer);
     }
@@ -8435,17 +9491,20 @@ VKAPI_ATTR void VKAPI_CALL CmdInsertDebugUtilsLabelEXT(
     const VkDebugUtilsLabelEXT*                 pLabelInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdInsertDebugUtilsLabelEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdInsertDebugUtilsLabelEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdInsertDebugUtilsLabelEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdInsertDebugUtilsLabelEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdInsertDebugUtilsLabelEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdInsertDebugUtilsLabelEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     }
     DispatchCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdInsertDebugUtilsLabelEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdInsertDebugUtilsLabelEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdInsertDebugUtilsLabelEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     }
@@ -8459,17 +9518,20 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDebugUtilsMessengerEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateDebugUtilsMessengerEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDebugUtilsMessengerEXT(instance, pCreateInfo, pAllocator, pMessenger);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateDebugUtilsMessengerEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateDebugUtilsMessengerEXT(instance, pCreateInfo, pAllocator, pMessenger);
     }
     VkResult result = DispatchCreateDebugUtilsMessengerEXT(instance, pCreateInfo, pAllocator, pMessenger);
     layer_create_messenger_callback(layer_data->report_data, false, pCreateInfo, pAllocator, pMessenger);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateDebugUtilsMessengerEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateDebugUtilsMessengerEXT(instance, pCreateInfo, pAllocator, pMessenger, result);
     }
@@ -8483,17 +9545,20 @@ VKAPI_ATTR void VKAPI_CALL DestroyDebugUtilsMessengerEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroyDebugUtilsMessengerEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDebugUtilsMessengerEXT(instance, messenger, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroyDebugUtilsMessengerEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyDebugUtilsMessengerEXT(instance, messenger, pAllocator);
     }
     DispatchDestroyDebugUtilsMessengerEXT(instance, messenger, pAllocator);
     layer_destroy_callback(layer_data->report_data, messenger, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroyDebugUtilsMessengerEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyDebugUtilsMessengerEXT(instance, messenger, pAllocator);
     }
@@ -8507,16 +9572,19 @@ VKAPI_ATTR void VKAPI_CALL SubmitDebugUtilsMessageEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkSubmitDebugUtilsMessageEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSubmitDebugUtilsMessageEXT(instance, messageSeverity, messageTypes, pCallbackData);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkSubmitDebugUtilsMessageEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordSubmitDebugUtilsMessageEXT(instance, messageSeverity, messageTypes, pCallbackData);
     }
     DispatchSubmitDebugUtilsMessageEXT(instance, messageSeverity, messageTypes, pCallbackData);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkSubmitDebugUtilsMessageEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordSubmitDebugUtilsMessageEXT(instance, messageSeverity, messageTypes, pCallbackData);
     }
@@ -8531,16 +9599,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetAndroidHardwareBufferPropertiesANDROID(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetAndroidHardwareBufferPropertiesANDROID]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetAndroidHardwareBufferPropertiesANDROID");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetAndroidHardwareBufferPropertiesANDROID]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetAndroidHardwareBufferPropertiesANDROID");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties);
     }
     VkResult result = DispatchGetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetAndroidHardwareBufferPropertiesANDROID]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetAndroidHardwareBufferPropertiesANDROID");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties, result);
     }
@@ -8554,16 +9625,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryAndroidHardwareBufferANDROID(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryAndroidHardwareBufferANDROID]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetMemoryAndroidHardwareBufferANDROID");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryAndroidHardwareBufferANDROID]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetMemoryAndroidHardwareBufferANDROID");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer);
     }
     VkResult result = DispatchGetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryAndroidHardwareBufferANDROID]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetMemoryAndroidHardwareBufferANDROID");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer, result);
     }
@@ -8583,17 +9657,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetSampleLocationsEXT(
     const VkSampleLocationsInfoEXT*             pSampleLocationsInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetSampleLocationsEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetSampleLocationsEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetSampleLocationsEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetSampleLocationsEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetSampleLocationsEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetSampleLocationsEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
     }
     DispatchCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetSampleLocationsEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetSampleLocationsEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetSampleLocationsEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
     }
@@ -8606,16 +9683,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceMultisamplePropertiesEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceMultisamplePropertiesEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceMultisamplePropertiesEXT(physicalDevice, samples, pMultisampleProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceMultisamplePropertiesEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceMultisamplePropertiesEXT(physicalDevice, samples, pMultisampleProperties);
     }
     DispatchGetPhysicalDeviceMultisamplePropertiesEXT(physicalDevice, samples, pMultisampleProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceMultisamplePropertiesEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceMultisamplePropertiesEXT(physicalDevice, samples, pMultisampleProperties);
     }
@@ -8635,16 +9715,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetImageDrmFormatModifierPropertiesEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageDrmFormatModifierPropertiesEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetImageDrmFormatModifierPropertiesEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageDrmFormatModifierPropertiesEXT(device, image, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageDrmFormatModifierPropertiesEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetImageDrmFormatModifierPropertiesEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetImageDrmFormatModifierPropertiesEXT(device, image, pProperties);
     }
     VkResult result = DispatchGetImageDrmFormatModifierPropertiesEXT(device, image, pProperties);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageDrmFormatModifierPropertiesEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetImageDrmFormatModifierPropertiesEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetImageDrmFormatModifierPropertiesEXT(device, image, pProperties, result);
     }
@@ -8661,17 +9744,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBindShadingRateImageNV(
     VkImageLayout                               imageLayout) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindShadingRateImageNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdBindShadingRateImageNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdBindShadingRateImageNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindShadingRateImageNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdBindShadingRateImageNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdBindShadingRateImageNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
     }
     DispatchCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindShadingRateImageNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdBindShadingRateImageNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdBindShadingRateImageNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
     }
@@ -8684,17 +9770,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportShadingRatePaletteNV(
     const VkShadingRatePaletteNV*               pShadingRatePalettes) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewportShadingRatePaletteNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetViewportShadingRatePaletteNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetViewportShadingRatePaletteNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetViewportShadingRatePaletteNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetViewportShadingRatePaletteNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetViewportShadingRatePaletteNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
     }
     DispatchCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetViewportShadingRatePaletteNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetViewportShadingRatePaletteNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetViewportShadingRatePaletteNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
     }
@@ -8707,17 +9796,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoarseSampleOrderNV(
     const VkCoarseSampleOrderCustomNV*          pCustomSampleOrders) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCoarseSampleOrderNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetCoarseSampleOrderNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetCoarseSampleOrderNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetCoarseSampleOrderNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetCoarseSampleOrderNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetCoarseSampleOrderNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
     }
     DispatchCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetCoarseSampleOrderNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetCoarseSampleOrderNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetCoarseSampleOrderNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
     }
@@ -8732,16 +9824,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateAccelerationStructureNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateAccelerationStructureNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateAccelerationStructureNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateAccelerationStructureNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateAccelerationStructureNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure);
     }
     VkResult result = DispatchCreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateAccelerationStructureNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateAccelerationStructureNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure, result);
     }
@@ -8755,16 +9850,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyAccelerationStructureNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyAccelerationStructureNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroyAccelerationStructureNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyAccelerationStructureNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroyAccelerationStructureNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
     }
     DispatchDestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyAccelerationStructureNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroyAccelerationStructureNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
     }
@@ -8777,16 +9875,19 @@ VKAPI_ATTR void VKAPI_CALL GetAccelerationStructureMemoryRequirementsNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetAccelerationStructureMemoryRequirementsNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetAccelerationStructureMemoryRequirementsNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetAccelerationStructureMemoryRequirementsNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetAccelerationStructureMemoryRequirementsNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
     }
     DispatchGetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetAccelerationStructureMemoryRequirementsNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetAccelerationStructureMemoryRequirementsNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
     }
@@ -8799,16 +9900,19 @@ VKAPI_ATTR VkResult VKAPI_CALL BindAccelerationStructureMemoryNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindAccelerationStructureMemoryNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkBindAccelerationStructureMemoryNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindAccelerationStructureMemoryNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkBindAccelerationStructureMemoryNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordBindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindAccelerationStructureMemoryNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkBindAccelerationStructureMemoryNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordBindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos, result);
     }
@@ -8827,17 +9931,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructureNV(
     VkDeviceSize                                scratchOffset) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBuildAccelerationStructureNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdBuildAccelerationStructureNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdBuildAccelerationStructureNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBuildAccelerationStructureNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdBuildAccelerationStructureNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdBuildAccelerationStructureNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
     }
     DispatchCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBuildAccelerationStructureNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdBuildAccelerationStructureNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdBuildAccelerationStructureNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
     }
@@ -8850,17 +9957,20 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureNV(
     VkCopyAccelerationStructureModeKHR          mode) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyAccelerationStructureNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdCopyAccelerationStructureNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdCopyAccelerationStructureNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyAccelerationStructureNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdCopyAccelerationStructureNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdCopyAccelerationStructureNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
     }
     DispatchCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyAccelerationStructureNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdCopyAccelerationStructureNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdCopyAccelerationStructureNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
     }
@@ -8884,17 +9994,20 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysNV(
     uint32_t                                    depth) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdTraceRaysNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdTraceRaysNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdTraceRaysNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdTraceRaysNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdTraceRaysNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdTraceRaysNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
     }
     DispatchCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdTraceRaysNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdTraceRaysNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdTraceRaysNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
     }
@@ -8910,16 +10023,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRayTracingShaderGroupHandlesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetRayTracingShaderGroupHandlesKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetRayTracingShaderGroupHandlesKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRayTracingShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetRayTracingShaderGroupHandlesKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetRayTracingShaderGroupHandlesKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetRayTracingShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
     }
     VkResult result = DispatchGetRayTracingShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetRayTracingShaderGroupHandlesKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetRayTracingShaderGroupHandlesKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetRayTracingShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData, result);
     }
@@ -8936,16 +10052,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRayTracingShaderGroupHandlesNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetRayTracingShaderGroupHandlesNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetRayTracingShaderGroupHandlesNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetRayTracingShaderGroupHandlesNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetRayTracingShaderGroupHandlesNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData);
     }
     VkResult result = DispatchGetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetRayTracingShaderGroupHandlesNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetRayTracingShaderGroupHandlesNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData, result);
     }
@@ -8960,16 +10079,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetAccelerationStructureHandleNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetAccelerationStructureHandleNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetAccelerationStructureHandleNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetAccelerationStructureHandleNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetAccelerationStructureHandleNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData);
     }
     VkResult result = DispatchGetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetAccelerationStructureHandleNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetAccelerationStructureHandleNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData, result);
     }
@@ -8985,17 +10107,20 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteAccelerationStructuresPropertiesNV(
     uint32_t                                    firstQuery) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteAccelerationStructuresPropertiesNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdWriteAccelerationStructuresPropertiesNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdWriteAccelerationStructuresPropertiesNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteAccelerationStructuresPropertiesNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdWriteAccelerationStructuresPropertiesNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdWriteAccelerationStructuresPropertiesNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
     }
     DispatchCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteAccelerationStructuresPropertiesNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdWriteAccelerationStructuresPropertiesNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdWriteAccelerationStructuresPropertiesNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
     }
@@ -9008,16 +10133,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CompileDeferredNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCompileDeferredNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCompileDeferredNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCompileDeferredNV(device, pipeline, shader);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCompileDeferredNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCompileDeferredNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCompileDeferredNV(device, pipeline, shader);
     }
     VkResult result = DispatchCompileDeferredNV(device, pipeline, shader);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCompileDeferredNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCompileDeferredNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCompileDeferredNV(device, pipeline, shader, result);
     }
@@ -9037,16 +10165,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryHostPointerPropertiesEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryHostPointerPropertiesEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetMemoryHostPointerPropertiesEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryHostPointerPropertiesEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetMemoryHostPointerPropertiesEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties);
     }
     VkResult result = DispatchGetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryHostPointerPropertiesEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetMemoryHostPointerPropertiesEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties, result);
     }
@@ -9062,17 +10193,20 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteBufferMarkerAMD(
     uint32_t                                    marker) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteBufferMarkerAMD]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdWriteBufferMarkerAMD, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdWriteBufferMarkerAMD");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteBufferMarkerAMD]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdWriteBufferMarkerAMD, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdWriteBufferMarkerAMD");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
     }
     DispatchCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteBufferMarkerAMD]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdWriteBufferMarkerAMD, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdWriteBufferMarkerAMD");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
     }
@@ -9087,16 +10221,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceCalibrateableTimeDomainsEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceCalibrateableTimeDomainsEXT(physicalDevice, pTimeDomainCount, pTimeDomains);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceCalibrateableTimeDomainsEXT(physicalDevice, pTimeDomainCount, pTimeDomains);
     }
     VkResult result = DispatchGetPhysicalDeviceCalibrateableTimeDomainsEXT(physicalDevice, pTimeDomainCount, pTimeDomains);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceCalibrateableTimeDomainsEXT(physicalDevice, pTimeDomainCount, pTimeDomains, result);
     }
@@ -9112,16 +10249,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetCalibratedTimestampsEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetCalibratedTimestampsEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetCalibratedTimestampsEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetCalibratedTimestampsEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetCalibratedTimestampsEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
     }
     VkResult result = DispatchGetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetCalibratedTimestampsEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetCalibratedTimestampsEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation, result);
     }
@@ -9144,17 +10284,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksNV(
     uint32_t                                    firstTask) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMeshTasksNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdDrawMeshTasksNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdDrawMeshTasksNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawMeshTasksNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdDrawMeshTasksNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdDrawMeshTasksNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
     }
     DispatchCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawMeshTasksNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdDrawMeshTasksNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdDrawMeshTasksNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
     }
@@ -9168,17 +10311,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectNV(
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMeshTasksIndirectNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdDrawMeshTasksIndirectNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdDrawMeshTasksIndirectNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawMeshTasksIndirectNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdDrawMeshTasksIndirectNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdDrawMeshTasksIndirectNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
     }
     DispatchCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawMeshTasksIndirectNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdDrawMeshTasksIndirectNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdDrawMeshTasksIndirectNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
     }
@@ -9194,17 +10340,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectCountNV(
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMeshTasksIndirectCountNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdDrawMeshTasksIndirectCountNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdDrawMeshTasksIndirectCountNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawMeshTasksIndirectCountNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdDrawMeshTasksIndirectCountNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdDrawMeshTasksIndirectCountNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawMeshTasksIndirectCountNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdDrawMeshTasksIndirectCountNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdDrawMeshTasksIndirectCountNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
@@ -9220,17 +10369,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetExclusiveScissorNV(
     const VkRect2D*                             pExclusiveScissors) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetExclusiveScissorNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetExclusiveScissorNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetExclusiveScissorNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetExclusiveScissorNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetExclusiveScissorNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetExclusiveScissorNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
     }
     DispatchCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetExclusiveScissorNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetExclusiveScissorNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetExclusiveScissorNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
     }
@@ -9242,17 +10394,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCheckpointNV(
     const void*                                 pCheckpointMarker) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCheckpointNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetCheckpointNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetCheckpointNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetCheckpointNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetCheckpointNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetCheckpointNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
     }
     DispatchCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetCheckpointNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetCheckpointNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetCheckpointNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
     }
@@ -9265,16 +10420,19 @@ VKAPI_ATTR void VKAPI_CALL GetQueueCheckpointDataNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetQueueCheckpointDataNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetQueueCheckpointDataNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetQueueCheckpointDataNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetQueueCheckpointDataNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
     }
     DispatchGetQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetQueueCheckpointDataNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetQueueCheckpointDataNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
     }
@@ -9288,16 +10446,19 @@ VKAPI_ATTR VkResult VKAPI_CALL InitializePerformanceApiINTEL(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateInitializePerformanceApiINTEL]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkInitializePerformanceApiINTEL");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateInitializePerformanceApiINTEL(device, pInitializeInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordInitializePerformanceApiINTEL]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkInitializePerformanceApiINTEL");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordInitializePerformanceApiINTEL(device, pInitializeInfo);
     }
     VkResult result = DispatchInitializePerformanceApiINTEL(device, pInitializeInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordInitializePerformanceApiINTEL]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkInitializePerformanceApiINTEL");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordInitializePerformanceApiINTEL(device, pInitializeInfo, result);
     }
@@ -9309,16 +10470,19 @@ VKAPI_ATTR void VKAPI_CALL UninitializePerformanceApiINTEL(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUninitializePerformanceApiINTEL]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkUninitializePerformanceApiINTEL");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUninitializePerformanceApiINTEL(device);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordUninitializePerformanceApiINTEL]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkUninitializePerformanceApiINTEL");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordUninitializePerformanceApiINTEL(device);
     }
     DispatchUninitializePerformanceApiINTEL(device);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordUninitializePerformanceApiINTEL]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkUninitializePerformanceApiINTEL");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordUninitializePerformanceApiINTEL(device);
     }
@@ -9329,17 +10493,20 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceMarkerINTEL(
     const VkPerformanceMarkerInfoINTEL*         pMarkerInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPerformanceMarkerINTEL]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetPerformanceMarkerINTEL, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetPerformanceMarkerINTEL");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPerformanceMarkerINTEL]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetPerformanceMarkerINTEL, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetPerformanceMarkerINTEL");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo);
     }
     VkResult result = DispatchCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPerformanceMarkerINTEL]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetPerformanceMarkerINTEL, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetPerformanceMarkerINTEL");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo, result);
     }
@@ -9351,17 +10518,20 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceStreamMarkerINTEL(
     const VkPerformanceStreamMarkerInfoINTEL*   pMarkerInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPerformanceStreamMarkerINTEL]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetPerformanceStreamMarkerINTEL, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetPerformanceStreamMarkerINTEL");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPerformanceStreamMarkerINTEL]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetPerformanceStreamMarkerINTEL, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetPerformanceStreamMarkerINTEL");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo);
     }
     VkResult result = DispatchCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPerformanceStreamMarkerINTEL]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetPerformanceStreamMarkerINTEL, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetPerformanceStreamMarkerINTEL");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo, result);
     }
@@ -9373,17 +10543,20 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceOverrideINTEL(
     const VkPerformanceOverrideInfoINTEL*       pOverrideInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPerformanceOverrideINTEL]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetPerformanceOverrideINTEL, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetPerformanceOverrideINTEL");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPerformanceOverrideINTEL]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetPerformanceOverrideINTEL, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetPerformanceOverrideINTEL");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo);
     }
     VkResult result = DispatchCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPerformanceOverrideINTEL]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetPerformanceOverrideINTEL, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetPerformanceOverrideINTEL");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo, result);
     }
@@ -9397,16 +10570,19 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquirePerformanceConfigurationINTEL(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAcquirePerformanceConfigurationINTEL]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkAcquirePerformanceConfigurationINTEL");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAcquirePerformanceConfigurationINTEL]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkAcquirePerformanceConfigurationINTEL");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordAcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration);
     }
     VkResult result = DispatchAcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAcquirePerformanceConfigurationINTEL]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkAcquirePerformanceConfigurationINTEL");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordAcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration, result);
     }
@@ -9419,16 +10595,19 @@ VKAPI_ATTR VkResult VKAPI_CALL ReleasePerformanceConfigurationINTEL(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateReleasePerformanceConfigurationINTEL]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkReleasePerformanceConfigurationINTEL");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateReleasePerformanceConfigurationINTEL(device, configuration);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordReleasePerformanceConfigurationINTEL]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkReleasePerformanceConfigurationINTEL");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordReleasePerformanceConfigurationINTEL(device, configuration);
     }
     VkResult result = DispatchReleasePerformanceConfigurationINTEL(device, configuration);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordReleasePerformanceConfigurationINTEL]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkReleasePerformanceConfigurationINTEL");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordReleasePerformanceConfigurationINTEL(device, configuration, result);
     }
@@ -9441,16 +10620,19 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueSetPerformanceConfigurationINTEL(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueSetPerformanceConfigurationINTEL]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkQueueSetPerformanceConfigurationINTEL");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueSetPerformanceConfigurationINTEL(queue, configuration);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueSetPerformanceConfigurationINTEL]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkQueueSetPerformanceConfigurationINTEL");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordQueueSetPerformanceConfigurationINTEL(queue, configuration);
     }
     VkResult result = DispatchQueueSetPerformanceConfigurationINTEL(queue, configuration);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueSetPerformanceConfigurationINTEL]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkQueueSetPerformanceConfigurationINTEL");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordQueueSetPerformanceConfigurationINTEL(queue, configuration, result);
     }
@@ -9464,16 +10646,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPerformanceParameterINTEL(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPerformanceParameterINTEL]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPerformanceParameterINTEL");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPerformanceParameterINTEL(device, parameter, pValue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPerformanceParameterINTEL]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPerformanceParameterINTEL");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPerformanceParameterINTEL(device, parameter, pValue);
     }
     VkResult result = DispatchGetPerformanceParameterINTEL(device, parameter, pValue);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPerformanceParameterINTEL]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPerformanceParameterINTEL");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPerformanceParameterINTEL(device, parameter, pValue, result);
     }
@@ -9489,16 +10674,19 @@ VKAPI_ATTR void VKAPI_CALL SetLocalDimmingAMD(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetLocalDimmingAMD]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkSetLocalDimmingAMD");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetLocalDimmingAMD]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkSetLocalDimmingAMD");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
     }
     DispatchSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetLocalDimmingAMD]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkSetLocalDimmingAMD");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
     }
@@ -9514,16 +10702,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateImagePipeSurfaceFUCHSIA(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateImagePipeSurfaceFUCHSIA");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateImagePipeSurfaceFUCHSIA(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateImagePipeSurfaceFUCHSIA");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateImagePipeSurfaceFUCHSIA(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateImagePipeSurfaceFUCHSIA(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateImagePipeSurfaceFUCHSIA");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateImagePipeSurfaceFUCHSIA(instance, pCreateInfo, pAllocator, pSurface, result);
     }
@@ -9541,16 +10732,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateMetalSurfaceEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateMetalSurfaceEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateMetalSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateMetalSurfaceEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateMetalSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateMetalSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateMetalSurfaceEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateMetalSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface, result);
     }
@@ -9576,16 +10770,19 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddressEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferDeviceAddressEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetBufferDeviceAddressEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferDeviceAddressEXT(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferDeviceAddressEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetBufferDeviceAddressEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetBufferDeviceAddressEXT(device, pInfo);
     }
     VkDeviceAddress result = DispatchGetBufferDeviceAddressEXT(device, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferDeviceAddressEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetBufferDeviceAddressEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetBufferDeviceAddressEXT(device, pInfo, result);
     }
@@ -9603,16 +10800,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceCooperativeMatrixPropertiesNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceCooperativeMatrixPropertiesNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceCooperativeMatrixPropertiesNV(physicalDevice, pPropertyCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceCooperativeMatrixPropertiesNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceCooperativeMatrixPropertiesNV(physicalDevice, pPropertyCount, pProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceCooperativeMatrixPropertiesNV(physicalDevice, pPropertyCount, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceCooperativeMatrixPropertiesNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceCooperativeMatrixPropertiesNV(physicalDevice, pPropertyCount, pProperties, result);
     }
@@ -9627,16 +10827,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSupportedFramebufferMixedSamples
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(physicalDevice, pCombinationCount, pCombinations);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(physicalDevice, pCombinationCount, pCombinations);
     }
     VkResult result = DispatchGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(physicalDevice, pCombinationCount, pCombinations);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(physicalDevice, pCombinationCount, pCombinations, result);
     }
@@ -9655,16 +10858,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfacePresentModes2EXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceSurfacePresentModes2EXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSurfacePresentModes2EXT(physicalDevice, pSurfaceInfo, pPresentModeCount, pPresentModes);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceSurfacePresentModes2EXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceSurfacePresentModes2EXT(physicalDevice, pSurfaceInfo, pPresentModeCount, pPresentModes);
     }
     VkResult result = DispatchGetPhysicalDeviceSurfacePresentModes2EXT(physicalDevice, pSurfaceInfo, pPresentModeCount, pPresentModes);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceSurfacePresentModes2EXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceSurfacePresentModes2EXT(physicalDevice, pSurfaceInfo, pPresentModeCount, pPresentModes, result);
     }
@@ -9677,16 +10883,19 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireFullScreenExclusiveModeEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAcquireFullScreenExclusiveModeEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkAcquireFullScreenExclusiveModeEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireFullScreenExclusiveModeEXT(device, swapchain);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAcquireFullScreenExclusiveModeEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkAcquireFullScreenExclusiveModeEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordAcquireFullScreenExclusiveModeEXT(device, swapchain);
     }
     VkResult result = DispatchAcquireFullScreenExclusiveModeEXT(device, swapchain);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAcquireFullScreenExclusiveModeEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkAcquireFullScreenExclusiveModeEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordAcquireFullScreenExclusiveModeEXT(device, swapchain, result);
     }
@@ -9699,16 +10908,19 @@ VKAPI_ATTR VkResult VKAPI_CALL ReleaseFullScreenExclusiveModeEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateReleaseFullScreenExclusiveModeEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkReleaseFullScreenExclusiveModeEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateReleaseFullScreenExclusiveModeEXT(device, swapchain);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordReleaseFullScreenExclusiveModeEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkReleaseFullScreenExclusiveModeEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordReleaseFullScreenExclusiveModeEXT(device, swapchain);
     }
     VkResult result = DispatchReleaseFullScreenExclusiveModeEXT(device, swapchain);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordReleaseFullScreenExclusiveModeEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkReleaseFullScreenExclusiveModeEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordReleaseFullScreenExclusiveModeEXT(device, swapchain, result);
     }
@@ -9722,16 +10934,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeviceGroupSurfacePresentModes2EXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceGroupSurfacePresentModes2EXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetDeviceGroupSurfacePresentModes2EXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceGroupSurfacePresentModes2EXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetDeviceGroupSurfacePresentModes2EXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes);
     }
     VkResult result = DispatchGetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceGroupSurfacePresentModes2EXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetDeviceGroupSurfacePresentModes2EXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes, result);
     }
@@ -9748,16 +10963,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateHeadlessSurfaceEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateHeadlessSurfaceEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateHeadlessSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateHeadlessSurfaceEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateHeadlessSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateHeadlessSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateHeadlessSurfaceEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateHeadlessSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface, result);
     }
@@ -9771,17 +10989,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineStippleEXT(
     uint16_t                                    lineStipplePattern) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetLineStippleEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetLineStippleEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetLineStippleEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetLineStippleEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetLineStippleEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetLineStippleEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
     }
     DispatchCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetLineStippleEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetLineStippleEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetLineStippleEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
     }
@@ -9797,16 +11018,19 @@ VKAPI_ATTR void VKAPI_CALL ResetQueryPoolEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetQueryPoolEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkResetQueryPoolEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetQueryPoolEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkResetQueryPoolEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
     }
     DispatchResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetQueryPoolEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkResetQueryPoolEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
     }
@@ -9819,17 +11043,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCullModeEXT(
     VkCullModeFlags                             cullMode) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCullModeEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetCullModeEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetCullModeEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetCullModeEXT(commandBuffer, cullMode);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetCullModeEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetCullModeEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetCullModeEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetCullModeEXT(commandBuffer, cullMode);
     }
     DispatchCmdSetCullModeEXT(commandBuffer, cullMode);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetCullModeEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetCullModeEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetCullModeEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetCullModeEXT(commandBuffer, cullMode);
     }
@@ -9840,17 +11067,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFrontFaceEXT(
     VkFrontFace                                 frontFace) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetFrontFaceEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetFrontFaceEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetFrontFaceEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetFrontFaceEXT(commandBuffer, frontFace);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetFrontFaceEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetFrontFaceEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetFrontFaceEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetFrontFaceEXT(commandBuffer, frontFace);
     }
     DispatchCmdSetFrontFaceEXT(commandBuffer, frontFace);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetFrontFaceEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetFrontFaceEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetFrontFaceEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetFrontFaceEXT(commandBuffer, frontFace);
     }
@@ -9861,17 +11091,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveTopologyEXT(
     VkPrimitiveTopology                         primitiveTopology) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPrimitiveTopologyEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetPrimitiveTopologyEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetPrimitiveTopologyEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPrimitiveTopologyEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetPrimitiveTopologyEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetPrimitiveTopologyEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology);
     }
     DispatchCmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPrimitiveTopologyEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetPrimitiveTopologyEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetPrimitiveTopologyEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology);
     }
@@ -9883,17 +11116,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWithCountEXT(
     const VkViewport*                           pViewports) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewportWithCountEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetViewportWithCountEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetViewportWithCountEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetViewportWithCountEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetViewportWithCountEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetViewportWithCountEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports);
     }
     DispatchCmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetViewportWithCountEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetViewportWithCountEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetViewportWithCountEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports);
     }
@@ -9905,17 +11141,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissorWithCountEXT(
     const VkRect2D*                             pScissors) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetScissorWithCountEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetScissorWithCountEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetScissorWithCountEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetScissorWithCountEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetScissorWithCountEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetScissorWithCountEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors);
     }
     DispatchCmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetScissorWithCountEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetScissorWithCountEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetScissorWithCountEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors);
     }
@@ -9931,17 +11170,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers2EXT(
     const VkDeviceSize*                         pStrides) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindVertexBuffers2EXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdBindVertexBuffers2EXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdBindVertexBuffers2EXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindVertexBuffers2EXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdBindVertexBuffers2EXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdBindVertexBuffers2EXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
     }
     DispatchCmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindVertexBuffers2EXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdBindVertexBuffers2EXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdBindVertexBuffers2EXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
     }
@@ -9952,17 +11194,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthTestEnableEXT(
     VkBool32                                    depthTestEnable) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthTestEnableEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetDepthTestEnableEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetDepthTestEnableEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthTestEnableEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetDepthTestEnableEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetDepthTestEnableEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable);
     }
     DispatchCmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthTestEnableEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetDepthTestEnableEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetDepthTestEnableEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable);
     }
@@ -9973,17 +11218,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthWriteEnableEXT(
     VkBool32                                    depthWriteEnable) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthWriteEnableEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetDepthWriteEnableEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetDepthWriteEnableEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthWriteEnableEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetDepthWriteEnableEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetDepthWriteEnableEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable);
     }
     DispatchCmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthWriteEnableEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetDepthWriteEnableEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetDepthWriteEnableEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable);
     }
@@ -9994,17 +11242,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthCompareOpEXT(
     VkCompareOp                                 depthCompareOp) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthCompareOpEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetDepthCompareOpEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetDepthCompareOpEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthCompareOpEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetDepthCompareOpEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetDepthCompareOpEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp);
     }
     DispatchCmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthCompareOpEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetDepthCompareOpEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetDepthCompareOpEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp);
     }
@@ -10015,17 +11266,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBoundsTestEnableEXT(
     VkBool32                                    depthBoundsTestEnable) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBoundsTestEnableEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetDepthBoundsTestEnableEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetDepthBoundsTestEnableEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthBoundsTestEnableEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetDepthBoundsTestEnableEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetDepthBoundsTestEnableEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable);
     }
     DispatchCmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthBoundsTestEnableEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetDepthBoundsTestEnableEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetDepthBoundsTestEnableEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable);
     }
@@ -10036,17 +11290,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilTestEnableEXT(
     VkBool32                                    stencilTestEnable) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilTestEnableEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetStencilTestEnableEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetStencilTestEnableEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilTestEnableEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetStencilTestEnableEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetStencilTestEnableEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable);
     }
     DispatchCmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilTestEnableEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetStencilTestEnableEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetStencilTestEnableEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable);
     }
@@ -10061,17 +11318,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilOpEXT(
     VkCompareOp                                 compareOp) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilOpEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetStencilOpEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetStencilOpEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilOpEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetStencilOpEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetStencilOpEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
     }
     DispatchCmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilOpEXT]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetStencilOpEXT, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetStencilOpEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
     }
@@ -10086,16 +11346,19 @@ VKAPI_ATTR void VKAPI_CALL GetGeneratedCommandsMemoryRequirementsNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetGeneratedCommandsMemoryRequirementsNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetGeneratedCommandsMemoryRequirementsNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetGeneratedCommandsMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetGeneratedCommandsMemoryRequirementsNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetGeneratedCommandsMemoryRequirementsNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetGeneratedCommandsMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
     }
     DispatchGetGeneratedCommandsMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetGeneratedCommandsMemoryRequirementsNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetGeneratedCommandsMemoryRequirementsNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetGeneratedCommandsMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
     }
@@ -10106,17 +11369,20 @@ VKAPI_ATTR void VKAPI_CALL CmdPreprocessGeneratedCommandsNV(
     const VkGeneratedCommandsInfoNV*            pGeneratedCommandsInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPreprocessGeneratedCommandsNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdPreprocessGeneratedCommandsNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdPreprocessGeneratedCommandsNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPreprocessGeneratedCommandsNV(commandBuffer, pGeneratedCommandsInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPreprocessGeneratedCommandsNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdPreprocessGeneratedCommandsNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdPreprocessGeneratedCommandsNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdPreprocessGeneratedCommandsNV(commandBuffer, pGeneratedCommandsInfo);
     }
     DispatchCmdPreprocessGeneratedCommandsNV(commandBuffer, pGeneratedCommandsInfo);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPreprocessGeneratedCommandsNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdPreprocessGeneratedCommandsNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdPreprocessGeneratedCommandsNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdPreprocessGeneratedCommandsNV(commandBuffer, pGeneratedCommandsInfo);
     }
@@ -10128,17 +11394,20 @@ VKAPI_ATTR void VKAPI_CALL CmdExecuteGeneratedCommandsNV(
     const VkGeneratedCommandsInfoNV*            pGeneratedCommandsInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdExecuteGeneratedCommandsNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdExecuteGeneratedCommandsNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdExecuteGeneratedCommandsNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdExecuteGeneratedCommandsNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdExecuteGeneratedCommandsNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdExecuteGeneratedCommandsNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
     }
     DispatchCmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdExecuteGeneratedCommandsNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdExecuteGeneratedCommandsNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdExecuteGeneratedCommandsNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
     }
@@ -10151,17 +11420,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBindPipelineShaderGroupNV(
     uint32_t                                    groupIndex) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindPipelineShaderGroupNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdBindPipelineShaderGroupNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdBindPipelineShaderGroupNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindPipelineShaderGroupNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdBindPipelineShaderGroupNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdBindPipelineShaderGroupNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex);
     }
     DispatchCmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindPipelineShaderGroupNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdBindPipelineShaderGroupNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdBindPipelineShaderGroupNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex);
     }
@@ -10175,16 +11447,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateIndirectCommandsLayoutNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateIndirectCommandsLayoutNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateIndirectCommandsLayoutNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateIndirectCommandsLayoutNV(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateIndirectCommandsLayoutNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateIndirectCommandsLayoutNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateIndirectCommandsLayoutNV(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
     }
     VkResult result = DispatchCreateIndirectCommandsLayoutNV(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateIndirectCommandsLayoutNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateIndirectCommandsLayoutNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateIndirectCommandsLayoutNV(device, pCreateInfo, pAllocator, pIndirectCommandsLayout, result);
     }
@@ -10198,16 +11473,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyIndirectCommandsLayoutNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyIndirectCommandsLayoutNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroyIndirectCommandsLayoutNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyIndirectCommandsLayoutNV(device, indirectCommandsLayout, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyIndirectCommandsLayoutNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroyIndirectCommandsLayoutNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyIndirectCommandsLayoutNV(device, indirectCommandsLayout, pAllocator);
     }
     DispatchDestroyIndirectCommandsLayoutNV(device, indirectCommandsLayout, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyIndirectCommandsLayoutNV]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroyIndirectCommandsLayoutNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyIndirectCommandsLayoutNV(device, indirectCommandsLayout, pAllocator);
     }
@@ -10228,16 +11506,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePrivateDataSlotEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreatePrivateDataSlotEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreatePrivateDataSlotEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreatePrivateDataSlotEXT(device, pCreateInfo, pAllocator, pPrivateDataSlot);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreatePrivateDataSlotEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreatePrivateDataSlotEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreatePrivateDataSlotEXT(device, pCreateInfo, pAllocator, pPrivateDataSlot);
     }
     VkResult result = DispatchCreatePrivateDataSlotEXT(device, pCreateInfo, pAllocator, pPrivateDataSlot);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreatePrivateDataSlotEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreatePrivateDataSlotEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreatePrivateDataSlotEXT(device, pCreateInfo, pAllocator, pPrivateDataSlot, result);
     }
@@ -10251,16 +11532,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyPrivateDataSlotEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyPrivateDataSlotEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroyPrivateDataSlotEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyPrivateDataSlotEXT(device, privateDataSlot, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyPrivateDataSlotEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroyPrivateDataSlotEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyPrivateDataSlotEXT(device, privateDataSlot, pAllocator);
     }
     DispatchDestroyPrivateDataSlotEXT(device, privateDataSlot, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyPrivateDataSlotEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroyPrivateDataSlotEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyPrivateDataSlotEXT(device, privateDataSlot, pAllocator);
     }
@@ -10275,16 +11559,19 @@ VKAPI_ATTR VkResult VKAPI_CALL SetPrivateDataEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetPrivateDataEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkSetPrivateDataEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, data);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetPrivateDataEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkSetPrivateDataEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordSetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, data);
     }
     VkResult result = DispatchSetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, data);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetPrivateDataEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkSetPrivateDataEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordSetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, data, result);
     }
@@ -10300,16 +11587,19 @@ VKAPI_ATTR void VKAPI_CALL GetPrivateDataEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPrivateDataEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPrivateDataEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, pData);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPrivateDataEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPrivateDataEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, pData);
     }
     DispatchGetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPrivateDataEXT]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPrivateDataEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, pData);
     }
@@ -10325,17 +11615,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFragmentShadingRateEnumNV(
     const VkFragmentShadingRateCombinerOpKHR    combinerOps[2]) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetFragmentShadingRateEnumNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetFragmentShadingRateEnumNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetFragmentShadingRateEnumNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetFragmentShadingRateEnumNV(commandBuffer, shadingRate, combinerOps);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetFragmentShadingRateEnumNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetFragmentShadingRateEnumNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetFragmentShadingRateEnumNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetFragmentShadingRateEnumNV(commandBuffer, shadingRate, combinerOps);
     }
     DispatchCmdSetFragmentShadingRateEnumNV(commandBuffer, shadingRate, combinerOps);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetFragmentShadingRateEnumNV]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetFragmentShadingRateEnumNV, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetFragmentShadingRateEnumNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetFragmentShadingRateEnumNV(commandBuffer, shadingRate, combinerOps);
     }
@@ -10353,16 +11646,19 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireWinrtDisplayNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkAcquireWinrtDisplayNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireWinrtDisplayNV(physicalDevice, display);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkAcquireWinrtDisplayNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordAcquireWinrtDisplayNV(physicalDevice, display);
     }
     VkResult result = DispatchAcquireWinrtDisplayNV(physicalDevice, display);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkAcquireWinrtDisplayNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordAcquireWinrtDisplayNV(physicalDevice, display, result);
     }
@@ -10376,16 +11672,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetWinrtDisplayNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetWinrtDisplayNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetWinrtDisplayNV(physicalDevice, deviceRelativeId, pDisplay);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetWinrtDisplayNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetWinrtDisplayNV(physicalDevice, deviceRelativeId, pDisplay);
     }
     VkResult result = DispatchGetWinrtDisplayNV(physicalDevice, deviceRelativeId, pDisplay);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetWinrtDisplayNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetWinrtDisplayNV(physicalDevice, deviceRelativeId, pDisplay, result);
     }
@@ -10403,16 +11702,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDirectFBSurfaceEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateDirectFBSurfaceEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDirectFBSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateDirectFBSurfaceEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateDirectFBSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateDirectFBSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateDirectFBSurfaceEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateDirectFBSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface, result);
     }
@@ -10426,16 +11728,19 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceDirectFBPresentationSupportEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceDirectFBPresentationSupportEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceDirectFBPresentationSupportEXT(physicalDevice, queueFamilyIndex, dfb);
         if (skip) return VK_FALSE;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceDirectFBPresentationSupportEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceDirectFBPresentationSupportEXT(physicalDevice, queueFamilyIndex, dfb);
     }
     VkBool32 result = DispatchGetPhysicalDeviceDirectFBPresentationSupportEXT(physicalDevice, queueFamilyIndex, dfb);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceDirectFBPresentationSupportEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceDirectFBPresentationSupportEXT(physicalDevice, queueFamilyIndex, dfb);
     }
@@ -10453,16 +11758,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateAccelerationStructureKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateAccelerationStructureKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateAccelerationStructureKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateAccelerationStructureKHR(device, pCreateInfo, pAllocator, pAccelerationStructure);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateAccelerationStructureKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateAccelerationStructureKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateAccelerationStructureKHR(device, pCreateInfo, pAllocator, pAccelerationStructure);
     }
     VkResult result = DispatchCreateAccelerationStructureKHR(device, pCreateInfo, pAllocator, pAccelerationStructure);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateAccelerationStructureKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateAccelerationStructureKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateAccelerationStructureKHR(device, pCreateInfo, pAllocator, pAccelerationStructure, result);
     }
@@ -10476,16 +11784,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyAccelerationStructureKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyAccelerationStructureKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroyAccelerationStructureKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyAccelerationStructureKHR(device, accelerationStructure, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyAccelerationStructureKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroyAccelerationStructureKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyAccelerationStructureKHR(device, accelerationStructure, pAllocator);
     }
     DispatchDestroyAccelerationStructureKHR(device, accelerationStructure, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyAccelerationStructureKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroyAccelerationStructureKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyAccelerationStructureKHR(device, accelerationStructure, pAllocator);
     }
@@ -10498,17 +11809,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructuresKHR(
     const VkAccelerationStructureBuildRangeInfoKHR* const* ppBuildRangeInfos) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBuildAccelerationStructuresKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdBuildAccelerationStructuresKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdBuildAccelerationStructuresKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBuildAccelerationStructuresKHR(commandBuffer, infoCount, pInfos, ppBuildRangeInfos);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBuildAccelerationStructuresKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdBuildAccelerationStructuresKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdBuildAccelerationStructuresKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdBuildAccelerationStructuresKHR(commandBuffer, infoCount, pInfos, ppBuildRangeInfos);
     }
     DispatchCmdBuildAccelerationStructuresKHR(commandBuffer, infoCount, pInfos, ppBuildRangeInfos);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBuildAccelerationStructuresKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdBuildAccelerationStructuresKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdBuildAccelerationStructuresKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdBuildAccelerationStructuresKHR(commandBuffer, infoCount, pInfos, ppBuildRangeInfos);
     }
@@ -10523,17 +11837,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructuresIndirectKHR(
     const uint32_t* const*                      ppMaxPrimitiveCounts) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBuildAccelerationStructuresIndirectKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdBuildAccelerationStructuresIndirectKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdBuildAccelerationStructuresIndirectKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBuildAccelerationStructuresIndirectKHR(commandBuffer, infoCount, pInfos, pIndirectDeviceAddresses, pIndirectStrides, ppMaxPrimitiveCounts);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBuildAccelerationStructuresIndirectKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdBuildAccelerationStructuresIndirectKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdBuildAccelerationStructuresIndirectKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdBuildAccelerationStructuresIndirectKHR(commandBuffer, infoCount, pInfos, pIndirectDeviceAddresses, pIndirectStrides, ppMaxPrimitiveCounts);
     }
     DispatchCmdBuildAccelerationStructuresIndirectKHR(commandBuffer, infoCount, pInfos, pIndirectDeviceAddresses, pIndirectStrides, ppMaxPrimitiveCounts);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBuildAccelerationStructuresIndirectKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdBuildAccelerationStructuresIndirectKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdBuildAccelerationStructuresIndirectKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdBuildAccelerationStructuresIndirectKHR(commandBuffer, infoCount, pInfos, pIndirectDeviceAddresses, pIndirectStrides, ppMaxPrimitiveCounts);
     }
@@ -10548,16 +11865,19 @@ VKAPI_ATTR VkResult VKAPI_CALL BuildAccelerationStructuresKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBuildAccelerationStructuresKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkBuildAccelerationStructuresKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBuildAccelerationStructuresKHR(device, deferredOperation, infoCount, pInfos, ppBuildRangeInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBuildAccelerationStructuresKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkBuildAccelerationStructuresKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordBuildAccelerationStructuresKHR(device, deferredOperation, infoCount, pInfos, ppBuildRangeInfos);
     }
     VkResult result = DispatchBuildAccelerationStructuresKHR(device, deferredOperation, infoCount, pInfos, ppBuildRangeInfos);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBuildAccelerationStructuresKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkBuildAccelerationStructuresKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordBuildAccelerationStructuresKHR(device, deferredOperation, infoCount, pInfos, ppBuildRangeInfos, result);
     }
@@ -10571,16 +11891,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyAccelerationStructureKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCopyAccelerationStructureKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCopyAccelerationStructureKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCopyAccelerationStructureKHR(device, deferredOperation, pInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCopyAccelerationStructureKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCopyAccelerationStructureKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCopyAccelerationStructureKHR(device, deferredOperation, pInfo);
     }
     VkResult result = DispatchCopyAccelerationStructureKHR(device, deferredOperation, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCopyAccelerationStructureKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCopyAccelerationStructureKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCopyAccelerationStructureKHR(device, deferredOperation, pInfo, result);
     }
@@ -10594,16 +11917,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyAccelerationStructureToMemoryKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCopyAccelerationStructureToMemoryKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCopyAccelerationStructureToMemoryKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCopyAccelerationStructureToMemoryKHR(device, deferredOperation, pInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCopyAccelerationStructureToMemoryKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCopyAccelerationStructureToMemoryKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCopyAccelerationStructureToMemoryKHR(device, deferredOperation, pInfo);
     }
     VkResult result = DispatchCopyAccelerationStructureToMemoryKHR(device, deferredOperation, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCopyAccelerationStructureToMemoryKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCopyAccelerationStructureToMemoryKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCopyAccelerationStructureToMemoryKHR(device, deferredOperation, pInfo, result);
     }
@@ -10617,16 +11943,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyMemoryToAccelerationStructureKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCopyMemoryToAccelerationStructureKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCopyMemoryToAccelerationStructureKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCopyMemoryToAccelerationStructureKHR(device, deferredOperation, pInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCopyMemoryToAccelerationStructureKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCopyMemoryToAccelerationStructureKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCopyMemoryToAccelerationStructureKHR(device, deferredOperation, pInfo);
     }
     VkResult result = DispatchCopyMemoryToAccelerationStructureKHR(device, deferredOperation, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCopyMemoryToAccelerationStructureKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCopyMemoryToAccelerationStructureKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCopyMemoryToAccelerationStructureKHR(device, deferredOperation, pInfo, result);
     }
@@ -10644,16 +11973,19 @@ VKAPI_ATTR VkResult VKAPI_CALL WriteAccelerationStructuresPropertiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateWriteAccelerationStructuresPropertiesKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkWriteAccelerationStructuresPropertiesKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateWriteAccelerationStructuresPropertiesKHR(device, accelerationStructureCount, pAccelerationStructures, queryType, dataSize, pData, stride);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordWriteAccelerationStructuresPropertiesKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkWriteAccelerationStructuresPropertiesKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordWriteAccelerationStructuresPropertiesKHR(device, accelerationStructureCount, pAccelerationStructures, queryType, dataSize, pData, stride);
     }
     VkResult result = DispatchWriteAccelerationStructuresPropertiesKHR(device, accelerationStructureCount, pAccelerationStructures, queryType, dataSize, pData, stride);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordWriteAccelerationStructuresPropertiesKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkWriteAccelerationStructuresPropertiesKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordWriteAccelerationStructuresPropertiesKHR(device, accelerationStructureCount, pAccelerationStructures, queryType, dataSize, pData, stride, result);
     }
@@ -10665,17 +11997,20 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureKHR(
     const VkCopyAccelerationStructureInfoKHR*   pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyAccelerationStructureKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdCopyAccelerationStructureKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdCopyAccelerationStructureKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyAccelerationStructureKHR(commandBuffer, pInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyAccelerationStructureKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdCopyAccelerationStructureKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdCopyAccelerationStructureKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdCopyAccelerationStructureKHR(commandBuffer, pInfo);
     }
     DispatchCmdCopyAccelerationStructureKHR(commandBuffer, pInfo);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyAccelerationStructureKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdCopyAccelerationStructureKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdCopyAccelerationStructureKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdCopyAccelerationStructureKHR(commandBuffer, pInfo);
     }
@@ -10686,17 +12021,20 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureToMemoryKHR(
     const VkCopyAccelerationStructureToMemoryInfoKHR* pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyAccelerationStructureToMemoryKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdCopyAccelerationStructureToMemoryKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdCopyAccelerationStructureToMemoryKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyAccelerationStructureToMemoryKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdCopyAccelerationStructureToMemoryKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdCopyAccelerationStructureToMemoryKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo);
     }
     DispatchCmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyAccelerationStructureToMemoryKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdCopyAccelerationStructureToMemoryKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdCopyAccelerationStructureToMemoryKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo);
     }
@@ -10707,17 +12045,20 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryToAccelerationStructureKHR(
     const VkCopyMemoryToAccelerationStructureInfoKHR* pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyMemoryToAccelerationStructureKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdCopyMemoryToAccelerationStructureKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdCopyMemoryToAccelerationStructureKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyMemoryToAccelerationStructureKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdCopyMemoryToAccelerationStructureKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdCopyMemoryToAccelerationStructureKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo);
     }
     DispatchCmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyMemoryToAccelerationStructureKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdCopyMemoryToAccelerationStructureKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdCopyMemoryToAccelerationStructureKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo);
     }
@@ -10729,16 +12070,19 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetAccelerationStructureDeviceAddressKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetAccelerationStructureDeviceAddressKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetAccelerationStructureDeviceAddressKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetAccelerationStructureDeviceAddressKHR(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetAccelerationStructureDeviceAddressKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetAccelerationStructureDeviceAddressKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetAccelerationStructureDeviceAddressKHR(device, pInfo);
     }
     VkDeviceAddress result = DispatchGetAccelerationStructureDeviceAddressKHR(device, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetAccelerationStructureDeviceAddressKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetAccelerationStructureDeviceAddressKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetAccelerationStructureDeviceAddressKHR(device, pInfo, result);
     }
@@ -10754,17 +12098,20 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteAccelerationStructuresPropertiesKHR(
     uint32_t                                    firstQuery) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteAccelerationStructuresPropertiesKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdWriteAccelerationStructuresPropertiesKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdWriteAccelerationStructuresPropertiesKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteAccelerationStructuresPropertiesKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdWriteAccelerationStructuresPropertiesKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdWriteAccelerationStructuresPropertiesKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
     }
     DispatchCmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteAccelerationStructuresPropertiesKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdWriteAccelerationStructuresPropertiesKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdWriteAccelerationStructuresPropertiesKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
     }
@@ -10777,16 +12124,19 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceAccelerationStructureCompatibilityKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceAccelerationStructureCompatibilityKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetDeviceAccelerationStructureCompatibilityKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceAccelerationStructureCompatibilityKHR(device, pVersionInfo, pCompatibility);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceAccelerationStructureCompatibilityKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetDeviceAccelerationStructureCompatibilityKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDeviceAccelerationStructureCompatibilityKHR(device, pVersionInfo, pCompatibility);
     }
     DispatchGetDeviceAccelerationStructureCompatibilityKHR(device, pVersionInfo, pCompatibility);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceAccelerationStructureCompatibilityKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetDeviceAccelerationStructureCompatibilityKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDeviceAccelerationStructureCompatibilityKHR(device, pVersionInfo, pCompatibility);
     }
@@ -10801,16 +12151,19 @@ VKAPI_ATTR void VKAPI_CALL GetAccelerationStructureBuildSizesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetAccelerationStructureBuildSizesKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetAccelerationStructureBuildSizesKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetAccelerationStructureBuildSizesKHR(device, buildType, pBuildInfo, pMaxPrimitiveCounts, pSizeInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetAccelerationStructureBuildSizesKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetAccelerationStructureBuildSizesKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetAccelerationStructureBuildSizesKHR(device, buildType, pBuildInfo, pMaxPrimitiveCounts, pSizeInfo);
     }
     DispatchGetAccelerationStructureBuildSizesKHR(device, buildType, pBuildInfo, pMaxPrimitiveCounts, pSizeInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetAccelerationStructureBuildSizesKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetAccelerationStructureBuildSizesKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetAccelerationStructureBuildSizesKHR(device, buildType, pBuildInfo, pMaxPrimitiveCounts, pSizeInfo);
     }
@@ -10828,17 +12181,20 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysKHR(
     uint32_t                                    depth) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdTraceRaysKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdTraceRaysKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdTraceRaysKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdTraceRaysKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdTraceRaysKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdTraceRaysKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth);
     }
     DispatchCmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdTraceRaysKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdTraceRaysKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdTraceRaysKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth);
     }
@@ -10854,16 +12210,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRayTracingCaptureReplayShaderGroupHandlesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetRayTracingCaptureReplayShaderGroupHandlesKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRayTracingCaptureReplayShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
     }
     VkResult result = DispatchGetRayTracingCaptureReplayShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData, result);
     }
@@ -10879,17 +12238,20 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysIndirectKHR(
     VkDeviceAddress                             indirectDeviceAddress) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdTraceRaysIndirectKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdTraceRaysIndirectKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdTraceRaysIndirectKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdTraceRaysIndirectKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, indirectDeviceAddress);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdTraceRaysIndirectKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdTraceRaysIndirectKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdTraceRaysIndirectKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdTraceRaysIndirectKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, indirectDeviceAddress);
     }
     DispatchCmdTraceRaysIndirectKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, indirectDeviceAddress);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdTraceRaysIndirectKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdTraceRaysIndirectKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdTraceRaysIndirectKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdTraceRaysIndirectKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, indirectDeviceAddress);
     }
@@ -10903,16 +12265,19 @@ VKAPI_ATTR VkDeviceSize VKAPI_CALL GetRayTracingShaderGroupStackSizeKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetRayTracingShaderGroupStackSizeKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetRayTracingShaderGroupStackSizeKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRayTracingShaderGroupStackSizeKHR(device, pipeline, group, groupShader);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetRayTracingShaderGroupStackSizeKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetRayTracingShaderGroupStackSizeKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetRayTracingShaderGroupStackSizeKHR(device, pipeline, group, groupShader);
     }
     VkDeviceSize result = DispatchGetRayTracingShaderGroupStackSizeKHR(device, pipeline, group, groupShader);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetRayTracingShaderGroupStackSizeKHR]) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetRayTracingShaderGroupStackSizeKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetRayTracingShaderGroupStackSizeKHR(device, pipeline, group, groupShader);
     }
@@ -10924,17 +12289,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRayTracingPipelineStackSizeKHR(
     uint32_t                                    pipelineStackSize) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetRayTracingPipelineStackSizeKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidateCmdSetRayTracingPipelineStackSizeKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCmdSetRayTracingPipelineStackSizeKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetRayTracingPipelineStackSizeKHR(commandBuffer, pipelineStackSize);
         if (skip) return;
     }
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetRayTracingPipelineStackSizeKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecordCmdSetRayTracingPipelineStackSizeKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCmdSetRayTracingPipelineStackSizeKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdSetRayTracingPipelineStackSizeKHR(commandBuffer, pipelineStackSize);
     }
     DispatchCmdSetRayTracingPipelineStackSizeKHR(commandBuffer, pipelineStackSize);
-    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetRayTracingPipelineStackSizeKHR]) {
+    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecordCmdSetRayTracingPipelineStackSizeKHR, commandBuffer, false)) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCmdSetRayTracingPipelineStackSizeKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdSetRayTracingPipelineStackSizeKHR(commandBuffer, pipelineStackSize);
     }
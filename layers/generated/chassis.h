@@ -51,6 +51,8 @@
 #include "vk_extension_helper.h"
 #include "vk_safe_struct.h"
 #include "vk_typemap_helper.h"
+#include "intercept_stats.h"
+#include "validation_sampler.h"
 
 
 extern std::atomic<uint64_t> global_unique_id;
@@ -2851,6 +2853,7 @@ enum LayerObjectTypeId {
     LayerObjectTypeDebugPrintf,                 // Instance or device shader debug printf layer object
     LayerObjectTypeCommandCounter,              // Command Counter validation object, child of corechecks
     LayerObjectTypeSyncValidation,              // Instance or device synchronization validation layer object
+    LayerObjectTypeApiCapture,                  // Device API capture object, not a validation check
     LayerObjectTypeMaxEnum,                     // Max enum count
 };
 
@@ -2858,9 +2861,62 @@ struct TEMPLATE_STATE {
     VkDescriptorUpdateTemplate desc_update_template;
     safe_VkDescriptorUpdateTemplateCreateInfo create_info;
     bool destroyed;
+    // Number of bytes of pData read by an update using this template
+    size_t data_size;
+    // Set by the state tracker: the update entries decoded once against the layout definition held by decoded_layout_def
+    // into the writes of each update, along with the offset into pData of each write's descriptor info.  Left empty for
+    // templates that the state tracker decodes afresh on each update.
+    std::shared_ptr<const void> decoded_layout_def;
+    std::vector<VkWriteDescriptorSet> decoded_writes;
+    std::vector<size_t> decoded_write_offsets;
 
     TEMPLATE_STATE(VkDescriptorUpdateTemplate update_template, safe_VkDescriptorUpdateTemplateCreateInfo *pCreateInfo)
-        : desc_update_template(update_template), create_info(*pCreateInfo), destroyed(false) {}
+        : desc_update_template(update_template),
+          create_info(*pCreateInfo),
+          destroyed(false),
+          data_size(UpdateDataSize(create_info)) {}
+
+    static size_t UpdateDataSize(const safe_VkDescriptorUpdateTemplateCreateInfo &create_info) {
+        size_t data_size = 0;
+        for (uint32_t i = 0; i < create_info.descriptorUpdateEntryCount; i++) {
+            const auto &entry = create_info.pDescriptorUpdateEntries[i];
+            if (entry.descriptorCount == 0) continue;
+            size_t element_size = 0;
+            switch (entry.descriptorType) {
+                case VK_DESCRIPTOR_TYPE_SAMPLER:
+                case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+                case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+                case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+                case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+                    element_size = sizeof(VkDescriptorImageInfo);
+                    break;
+                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+                    element_size = sizeof(VkDescriptorBufferInfo);
+                    break;
+                case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+                case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                    element_size = sizeof(VkBufferView);
+                    break;
+                case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT:
+                    // descriptorCount is the size in bytes of the one block of data
+                    data_size = std::max(data_size, entry.offset + entry.descriptorCount);
+                    continue;
+                case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
+                    element_size = sizeof(VkAccelerationStructureKHR);
+                    break;
+                case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
+                    element_size = sizeof(VkAccelerationStructureNV);
+                    break;
+                default:
+                    break;
+            }
+            data_size = std::max(data_size, entry.offset + (entry.descriptorCount - 1) * entry.stride + element_size);
+        }
+        return data_size;
+    }
 };
 
 class LAYER_PHYS_DEV_PROPERTIES {
@@ -2881,6 +2937,10 @@ typedef enum ValidationCheckDisables {
 typedef enum ValidationCheckEnables {
     VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ARM,
     VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ALL,
+    VALIDATION_CHECK_ENABLE_PARALLEL_VALIDATE,
+    VALIDATION_CHECK_ENABLE_MAPPED_MEMORY_GUARD,
+    VALIDATION_CHECK_ENABLE_MAPPED_MEMORY_WRITE_TRACKING,
+    VALIDATION_CHECK_ENABLE_API_CAPTURE,
 } ValidationCheckEnables;
 
 typedef enum VkValidationFeatureEnable {
@@ -2914,6 +2974,10 @@ typedef enum EnableFlags {
     vendor_specific_arm,
     debug_printf,
     sync_validation,
+    parallel_validate,
+    guard_mapped_memory,
+    track_mapped_memory_writes,
+    api_capture,
     // Insert new enables above this line
     kMaxEnableFlags,
 } EnableFlags;
@@ -2946,6 +3010,17 @@ class ValidationObject {
 
         std::string layer_name = "CHASSIS";
 
+        // Device chassis only: workers for the PreCallValidate fan out enabled by VALIDATION_CHECK_ENABLE_PARALLEL_VALIDATE
+        std::unique_ptr<ValidationWorkerPool> parallel_validation_pool;
+        // Instance chassis only: the sampling_* layer settings for the validation_sampler of each device
+        ValidationSampler::Settings validation_sampler_settings;
+        // Device chassis only: selects the command buffer recordings that get full command validation, see validation_sampler.h
+        std::unique_ptr<ValidationSampler> validation_sampler;
+        // Device chassis only: intercept_vectors for the vkCmd* calls of unselected recordings, without best practices and
+        // synchronization validation, and also without core checks for the sampled_validation_commands
+        std::vector<std::vector<ValidationObject*>> unselected_intercept_vectors;
+        std::vector<std::vector<ValidationObject*>> sampled_out_intercept_vectors;
+
         // Constructor
         ValidationObject(){};
         // Destructor
@@ -3002,7 +3077,90 @@ class ValidationObject {
             return nullptr;
         };
 
+        void InitUnselectedInterceptVectors() {
+            unselected_intercept_vectors.resize(intercept_vectors.size());
+            sampled_out_intercept_vectors.resize(intercept_vectors.size());
+            for (size_t intercept_id = 0; intercept_id < intercept_vectors.size(); ++intercept_id) {
+                for (auto intercept : intercept_vectors[intercept_id]) {
+                    switch (intercept->container_type) {
+                        case LayerObjectTypeBestPractices:
+                        case LayerObjectTypeSyncValidation:
+                            break;
+                        case LayerObjectTypeCoreValidation:
+                            unselected_intercept_vectors[intercept_id].push_back(intercept);
+                            break;
+                        default:
+                            unselected_intercept_vectors[intercept_id].push_back(intercept);
+                            sampled_out_intercept_vectors[intercept_id].push_back(intercept);
+                    }
+                }
+            }
+        }
+
+        // The intercepts for a vkCmd* call recorded into commandBuffer.  Core checks are left out of unselected recordings only
+        // when sampled, which the chassis only sets for the validation of commands whose state recording stays safe without it.
+        const std::vector<ValidationObject*>& CommandIntercepts(size_t intercept_id, VkCommandBuffer commandBuffer,
+                                                                bool sampled) const {
+            if (validation_sampler && !validation_sampler->IsSelected(commandBuffer)) {
+                return sampled ? sampled_out_intercept_vectors[intercept_id] : unselected_intercept_vectors[intercept_id];
+            }
+            return intercept_vectors[intercept_id];
+        }
+
+        // Run PreCallValidate for each intercept concurrently, reporting their messages in intercept order and stopping at the
+        // first intercept that skips, as the serial loop would
+        template <typename Validate>
+        bool ParallelPreCallValidate(const std::vector<ValidationObject*> &intercepts, const Validate &validate) {
+            const uint32_t count = static_cast<uint32_t>(intercepts.size());
+            std::vector<std::vector<DeferredLogMessage>> messages(count);
+            std::unique_ptr<bool[]> skips(new bool[count]);
+            parallel_validation_pool->Run(count, [&](uint32_t index) {
+                ValidationObject *intercept = intercepts[index];
+                auto lock = intercept->read_lock();
+                auto &deferred_messages = DeferredLogMessages();
+                auto *const outer_messages = deferred_messages;
+                deferred_messages = &messages[index];
+                skips[index] = validate(const_cast<const ValidationObject*>(intercept));
+                deferred_messages = outer_messages;
+            });
+
+            bool skip = false;
+            for (uint32_t index = 0; index < count; ++index) {
+                if (skip) {
+                    DiscardDeferredMessages(messages[index]);
+                } else if (messages[index].empty()) {
+                    skip |= skips[index];
+                } else {
+                    // A validate that deferred messages returned true for them, the debug callbacks decide the skip here
+                    skip |= LogDeferredMessages(report_data, messages[index]);
+                }
+            }
+            return skip;
+        }
+
+        // Set by the chassis on the thread that runs a PreCallValidate for ParallelPreCallValidate, to collect its messages in
+        // order.  Per thread, so that the same validation object can validate other calls on other threads meanwhile.
+        static std::vector<DeferredLogMessage> *&DeferredLogMessages() {
+            static thread_local std::vector<DeferredLogMessage> *deferred_messages = nullptr;
+            return deferred_messages;
+        }
+
         // Debug Logging Helpers
+        bool LogMsgOrDefer(VkFlags msg_flags, const LogObjectList &objects, const std::string &vuid_text, char *err_msg) const {
+            auto *const deferred_log_messages = DeferredLogMessages();
+            if (deferred_log_messages) {
+                // The debug callbacks only decide on skipping once the message is reported, so report it as found, letting the
+                // caller's early exits on bad state fire as they would for a callback that skips
+                if (LogMsgIsFiltered(report_data, vuid_text)) {
+                    free(err_msg);
+                    return false;
+                }
+                deferred_log_messages->emplace_back(DeferredLogMessage{msg_flags, objects, vuid_text, err_msg});
+                return true;
+            }
+            return LogMsgLocked(report_data, msg_flags, objects, vuid_text, err_msg);
+        }
+
         bool LogError(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
@@ -3017,7 +3175,7 @@ class ValidationObject {
                 str = nullptr;
             }
             va_end(argptr);
-            return LogMsgLocked(report_data, kErrorBit, objects, vuid_text, str);
+            return LogMsgOrDefer(kErrorBit, objects, vuid_text, str);
         };
 
         template <typename HANDLE_T>
@@ -3036,7 +3194,7 @@ class ValidationObject {
             }
             va_end(argptr);
             LogObjectList single_object(src_object);
-            return LogMsgLocked(report_data, kErrorBit, single_object, vuid_text, str);
+            return LogMsgOrDefer(kErrorBit, single_object, vuid_text, str);
 
         };
 
@@ -3054,7 +3212,7 @@ class ValidationObject {
                 str = nullptr;
             }
             va_end(argptr);
-            return LogMsgLocked(report_data, kWarningBit, objects, vuid_text, str);
+            return LogMsgOrDefer(kWarningBit, objects, vuid_text, str);
         };
 
         template <typename HANDLE_T>
@@ -3073,7 +3231,7 @@ class ValidationObject {
             }
             va_end(argptr);
             LogObjectList single_object(src_object);
-            return LogMsgLocked(report_data, kWarningBit, single_object, vuid_text, str);
+            return LogMsgOrDefer(kWarningBit, single_object, vuid_text, str);
         };
 
         bool LogPerformanceWarning(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
@@ -3090,7 +3248,7 @@ class ValidationObject {
                 str = nullptr;
             }
             va_end(argptr);
-            return LogMsgLocked(report_data, kPerformanceWarningBit, objects, vuid_text, str);
+            return LogMsgOrDefer(kPerformanceWarningBit, objects, vuid_text, str);
         };
 
         template <typename HANDLE_T>
@@ -3109,7 +3267,7 @@ class ValidationObject {
             }
             va_end(argptr);
             LogObjectList single_object(src_object);
-            return LogMsgLocked(report_data, kPerformanceWarningBit, single_object, vuid_text, str);
+            return LogMsgOrDefer(kPerformanceWarningBit, single_object, vuid_text, str);
         };
 
         bool LogInfo(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
@@ -3126,7 +3284,7 @@ class ValidationObject {
                 str = nullptr;
             }
             va_end(argptr);
-            return LogMsgLocked(report_data, kInformationBit, objects, vuid_text, str);
+            return LogMsgOrDefer(kInformationBit, objects, vuid_text, str);
         };
 
         template <typename HANDLE_T>
@@ -3145,7 +3303,7 @@ class ValidationObject {
             }
             va_end(argptr);
             LogObjectList single_object(src_object);
-            return LogMsgLocked(report_data, kInformationBit, single_object, vuid_text, str);
+            return LogMsgOrDefer(kInformationBit, single_object, vuid_text, str);
         };
 
         // Handle Wrapping Data
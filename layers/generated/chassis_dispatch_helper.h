@@ -1069,6 +1069,9 @@ typedef enum InterceptId{
             case LayerObjectTypeSyncValidation: \
                 if (typeid(&SyncValidator::name) != typeid(&ValidationObject::name)) intercept_vector->push_back(item);     \
                 break;  \
+            case LayerObjectTypeApiCapture: \
+                if (typeid(&ApiCapture::name) != typeid(&ValidationObject::name)) intercept_vector->push_back(item);    \
+                break;  \
             case LayerObjectTypeInstance: \
             case LayerObjectTypeDevice:   \
                 break;  \
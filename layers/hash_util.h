@@ -20,15 +20,19 @@
 #ifndef HASH_UTIL_H_
 #define HASH_UTIL_H_
 
+#include <atomic>
 #include <cstdint>
 #include <functional>
 #include <limits>
 #include <memory>
 #include <mutex>
 #include <type_traits>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+#include "vk_layer_utils.h"
+
 // Hash and equality utilities for supporting hashing containers (e.g. unordered_set, unordered_map)
 namespace hash_util {
 
@@ -123,40 +127,83 @@ struct IsOrderedContainer {
 //
 // The entries of the dictionary are shared_pointers (the contents of
 // which are invariant with resize/insert), with the hash and equality
-// template arguments wrapped in a shared pointer dereferencing
-// function object
+// template arguments applied to the definitions through keys that
+// point at (and cache the hash of) the shared definition
 template <typename T, typename Hasher = std::hash<T>, typename KeyEqual = std::equal_to<T>>
 class Dictionary {
   public:
     using Def = T;
     using Id = std::shared_ptr<const Def>;
 
+    // Per dictionary interning counts, a hit being a look up that found an extant definition
+    struct Stats {
+        uint64_t hits;
+        uint64_t misses;
+    };
+
     // Find the unique entry match the provided value, adding if needed
-    // TODO: segregate lookup from insert, using reader/write locks to reduce contention -- if needed
     template <typename U = T>
     Id look_up(U &&value) {
-        // We create an Id from the value, which will either be retained by dict (if new) or deleted on return (if extant)
-        Id from_input = std::make_shared<T>(std::forward<U>(value));
-
-        // Insert takes care of the "unique" id part by rejecting the insert if a key matching by_value exists, but returning us
-        // the Id of the extant shared_pointer(id->def) instead.
-        // return the value of the Iterator from the <Iterator, bool> pair returned by insert
-        Guard g(lock);  // Dict isn't thread safe, and use is presumed to be multi-threaded
-        return *dict.insert(from_input).first;
+        const Def &def = value;
+        const Key key{&def, Hasher()(def)};
+        // The dictionary is split into independently locked shards to limit contention between threads
+        Shard &shard = shards_[key.hash % kShardCount];
+        {
+            // Look up before creating an Id, as almost all look ups are for extant definitions and need no allocation, and
+            // can share the lock
+            read_lock_guard_t guard(shard.lock);
+            const auto found = shard.dict.find(key);
+            if (found != shard.dict.cend()) {
+                shard.hits.fetch_add(1, std::memory_order_relaxed);
+                return found->second;
+            }
+        }
+
+        write_lock_guard_t guard(shard.lock);
+        // Another thread may have added the definition between the two locks
+        const auto found = shard.dict.find(key);
+        if (found != shard.dict.cend()) {
+            shard.hits.fetch_add(1, std::memory_order_relaxed);
+            return found->second;
+        }
+
+        shard.misses.fetch_add(1, std::memory_order_relaxed);
+        Id id = std::make_shared<T>(std::forward<U>(value));
+        shard.dict.emplace(Key{id.get(), key.hash}, id);
+        return id;
+    }
+
+    // The counts are kept per shard so look ups on different shards don't share them, and are summed here
+    Stats GetStats() const {
+        Stats stats{0, 0};
+        for (const auto &shard : shards_) {
+            stats.hits += shard.hits.load(std::memory_order_relaxed);
+            stats.misses += shard.misses.load(std::memory_order_relaxed);
+        }
+        return stats;
     }
 
   private:
-    struct HashKeyValue {
-        size_t operator()(const Id &value) const { return Hasher()(*value); }
+    // The key refers to the definition owned by the mapped Id, and carries the hash so it's only computed once per look up
+    struct Key {
+        const Def *def;
+        size_t hash;
+    };
+    struct KeyDefHash {
+        size_t operator()(const Key &key) const { return key.hash; }
+    };
+    struct KeyDefEqual {
+        bool operator()(const Key &lhs, const Key &rhs) const { return (lhs.hash == rhs.hash) && KeyEqual()(*lhs.def, *rhs.def); }
     };
-    struct KeyValueEqual {
-        bool operator()(const Id &lhs, const Id &rhs) const { return KeyEqual()(*lhs, *rhs); }
+    using Dict = std::unordered_map<Key, Id, KeyDefHash, KeyDefEqual>;
+    struct Shard {
+        ReadWriteLock lock;
+        Dict dict;
+        std::atomic<uint64_t> hits{0};
+        std::atomic<uint64_t> misses{0};
     };
-    using Dict = std::unordered_set<Id, HashKeyValue, KeyValueEqual>;
-    using Lock = std::mutex;
-    using Guard = std::lock_guard<Lock>;
-    Lock lock;
-    Dict dict;
+    static const size_t kShardCount = 16;
+    Shard shards_[kShardCount];
 };
 }  // namespace hash_util
 
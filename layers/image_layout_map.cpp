@@ -64,9 +64,13 @@ bool ImageSubresourceLayoutMap::SubresourceLayout::operator==(const ImageSubreso
 ImageSubresourceLayoutMap::ImageSubresourceLayoutMap(const IMAGE_STATE& image_state)
     : image_state_(image_state),
       encoder_(image_state.subresource_encoder),
-      layouts_(encoder_.SubresourceCount()),
+      layouts_(),
       initial_layout_states_(),
-      initial_layout_state_map_(encoder_.SubresourceCount()) {}
+      has_transitions_(false),
+      validated_generation_(0),
+      uniform_(true),
+      uniform_layouts_{kInvalidLayout, kInvalidLayout},
+      uniform_initial_state_(nullptr) {}
 
 ImageSubresourceLayoutMap::ConstIterator ImageSubresourceLayoutMap::Begin(bool always_get_initial) const {
     return Find(image_state_.full_range, /* skip_invalid */ true, always_get_initial);
@@ -77,7 +81,7 @@ template <typename LayoutMap, typename InitialStateMap>
 static bool SetSubresourceRangeLayoutImpl(LayoutMap* current_layouts, LayoutMap* initial_layouts,
                                           InitialStateMap* initial_state_map, InitialLayoutStates* initial_layout_states,
                                           RangeGenerator* range_gen_arg, const CMD_BUFFER_STATE& cb_state, VkImageLayout layout,
-                                          VkImageLayout expected_layout) {
+                                          VkImageLayout expected_layout, bool* has_transitions) {
     bool updated = false;
     auto& range_gen = *range_gen_arg;
     InitialLayoutState* initial_state = nullptr;
@@ -95,6 +99,10 @@ static bool SetSubresourceRangeLayoutImpl(LayoutMap* current_layouts, LayoutMap*
                 initial_state = UpdateInitialLayoutStateImpl(initial_state_map, initial_layout_states, *range_gen, initial_state,
                                                              cb_state, nullptr);
             }
+            // A previously set initial layout may differ from the new current layout, so count that as a transition too
+            if (!updated_init || (layout != expected_layout)) {
+                *has_transitions = true;
+            }
         }
     }
     return updated;
@@ -108,17 +116,36 @@ bool ImageSubresourceLayoutMap::SetSubresourceRangeLayout(const CMD_BUFFER_STATE
     }
     if (!InRange(range)) return false;  // Don't even try to track bogus subreources
 
+    if (uniform_ && (uniform_layouts_.current_layout == layout)) return false;  // Nothing would change
+
+    validated_generation_ = 0;
+    if (uniform_) {
+        if (IsFullRange(range)) {
+            // Same result as SetSubresourceRangeLayoutImpl on maps holding the uniform values
+            if (uniform_layouts_.initial_layout == kInvalidLayout) {
+                uniform_layouts_.initial_layout = expected_layout;
+                uniform_initial_state_ = AddInitialLayoutState(cb_state, nullptr);
+                if (layout != expected_layout) has_transitions_ = true;
+            } else {
+                has_transitions_ = true;
+            }
+            uniform_layouts_.current_layout = layout;
+            return true;
+        }
+        BuildRangeMaps();
+    }
+
     RangeGenerator range_gen(encoder_, range);
-    if (layouts_.initial.SmallMode()) {
-        return SetSubresourceRangeLayoutImpl(&layouts_.current.GetSmallMap(), &layouts_.initial.GetSmallMap(),
-                                             &initial_layout_state_map_.GetSmallMap(), &initial_layout_states_, &range_gen,
-                                             cb_state, layout, expected_layout);
-    } else {
-        assert(!layouts_.initial.Tristate());
-        return SetSubresourceRangeLayoutImpl(&layouts_.current.GetBigMap(), &layouts_.initial.GetBigMap(),
-                                             &initial_layout_state_map_.GetBigMap(), &initial_layout_states_, &range_gen, cb_state,
-                                             layout, expected_layout);
+    auto& maps = *layouts_;
+    if (maps.initial.SmallMode()) {
+        return SetSubresourceRangeLayoutImpl(&maps.current.GetSmallMap(), &maps.initial.GetSmallMap(),
+                                             &maps.initial_state.GetSmallMap(), &initial_layout_states_, &range_gen, cb_state,
+                                             layout, expected_layout, &has_transitions_);
     }
+    assert(!maps.initial.Tristate());
+    return SetSubresourceRangeLayoutImpl(&maps.current.GetBigMap(), &maps.initial.GetBigMap(), &maps.initial_state.GetBigMap(),
+                                         &initial_layout_states_, &range_gen, cb_state, layout, expected_layout,
+                                         &has_transitions_);
 }
 
 // Use the unwrapped maps from the BothMap in the actual implementation
@@ -143,36 +170,61 @@ static bool SetSubresourceRangeInitialLayoutImpl(LayoutMap* initial_layouts, Ini
 }
 
 // Unwrap the BothMaps entry here as this is a performance hotspot.
+bool ImageSubresourceLayoutMap::SetInitialLayout(const CMD_BUFFER_STATE& cb_state, bool full_range, RangeGenerator* range_gen,
+                                                 VkImageLayout layout, const IMAGE_VIEW_STATE* view_state) {
+    // Initial layouts are write once, so a uniformly set initial layout can't be updated
+    if (uniform_ && (uniform_layouts_.initial_layout != kInvalidLayout)) return false;
+
+    validated_generation_ = 0;
+    if (uniform_) {
+        if (full_range) {
+            uniform_layouts_.initial_layout = layout;
+            uniform_initial_state_ = AddInitialLayoutState(cb_state, view_state);
+            return true;
+        }
+        BuildRangeMaps();
+    }
+
+    auto& maps = *layouts_;
+    assert(maps.initial.GetMode() == maps.initial_state.GetMode());
+    if (maps.initial.SmallMode()) {
+        return SetSubresourceRangeInitialLayoutImpl(&maps.initial.GetSmallMap(), &maps.initial_state.GetSmallMap(),
+                                                    &initial_layout_states_, range_gen, cb_state, layout, view_state);
+    }
+    assert(!maps.initial.Tristate());
+    return SetSubresourceRangeInitialLayoutImpl(&maps.initial.GetBigMap(), &maps.initial_state.GetBigMap(), &initial_layout_states_,
+                                                range_gen, cb_state, layout, view_state);
+}
+
 bool ImageSubresourceLayoutMap::SetSubresourceRangeInitialLayout(const CMD_BUFFER_STATE& cb_state,
                                                                  const VkImageSubresourceRange& range, VkImageLayout layout,
                                                                  const IMAGE_VIEW_STATE* view_state) {
     if (!InRange(range)) return false;  // Don't even try to track bogus subreources
-
     RangeGenerator range_gen(encoder_, range);
-    assert(layouts_.initial.GetMode() == initial_layout_state_map_.GetMode());
-    if (layouts_.initial.SmallMode()) {
-        return SetSubresourceRangeInitialLayoutImpl(&layouts_.initial.GetSmallMap(), &initial_layout_state_map_.GetSmallMap(),
-                                                    &initial_layout_states_, &range_gen, cb_state, layout, view_state);
-    } else {
-        assert(!layouts_.initial.Tristate());
-        return SetSubresourceRangeInitialLayoutImpl(&layouts_.initial.GetBigMap(), &initial_layout_state_map_.GetBigMap(),
-                                                    &initial_layout_states_, &range_gen, cb_state, layout, view_state);
-    }
+    return SetInitialLayout(cb_state, IsFullRange(range), &range_gen, layout, view_state);
 }
 
-// Unwrap the BothMaps entry here as this is a performance hotspot.
 bool ImageSubresourceLayoutMap::SetSubresourceRangeInitialLayout(const CMD_BUFFER_STATE& cb_state, VkImageLayout layout,
                                                                  const IMAGE_VIEW_STATE& view_state) {
     RangeGenerator range_gen(view_state.range_generator);
-    assert(layouts_.initial.GetMode() == initial_layout_state_map_.GetMode());
-    if (layouts_.initial.SmallMode()) {
-        return SetSubresourceRangeInitialLayoutImpl(&layouts_.initial.GetSmallMap(), &initial_layout_state_map_.GetSmallMap(),
-                                                    &initial_layout_states_, &range_gen, cb_state, layout, &view_state);
-    } else {
-        assert(!layouts_.initial.Tristate());
-        return SetSubresourceRangeInitialLayoutImpl(&layouts_.initial.GetBigMap(), &initial_layout_state_map_.GetBigMap(),
-                                                    &initial_layout_states_, &range_gen, cb_state, layout, &view_state);
+    return SetInitialLayout(cb_state, IsFullRange(view_state.normalized_subresource_range), &range_gen, layout, &view_state);
+}
+
+void ImageSubresourceLayoutMap::BuildRangeMaps() {
+    assert(uniform_ && !layouts_);
+    layouts_.reset(new LayoutMaps(encoder_.SubresourceCount()));
+    const IndexRange full_range = FullIndexRange();
+    if (uniform_layouts_.current_layout != kInvalidLayout) {
+        sparse_container::update_range_value(layouts_->current, full_range, uniform_layouts_.current_layout,
+                                             WritePolicy::prefer_source);
     }
+    if (uniform_layouts_.initial_layout != kInvalidLayout) {
+        sparse_container::update_range_value(layouts_->initial, full_range, uniform_layouts_.initial_layout,
+                                             WritePolicy::prefer_dest);
+        assert(uniform_initial_state_);
+        sparse_container::update_range_value(layouts_->initial_state, full_range, uniform_initial_state_, WritePolicy::prefer_dest);
+    }
+    uniform_ = false;
 }
 
 static VkImageLayout FindInMap(IndexType index, const ImageSubresourceLayoutMap::RangeMap& map) {
@@ -184,29 +236,38 @@ static VkImageLayout FindInMap(IndexType index, const ImageSubresourceLayoutMap:
     return value;
 }
 VkImageLayout ImageSubresourceLayoutMap::GetSubresourceLayout(const VkImageSubresource& subresource) const {
+    if (uniform_) return uniform_layouts_.current_layout;
     IndexType index = encoder_.Encode(subresource);
-    return FindInMap(index, layouts_.current);
+    return FindInMap(index, layouts_->current);
 }
 
 VkImageLayout ImageSubresourceLayoutMap::GetSubresourceInitialLayout(const VkImageSubresource& subresource) const {
+    if (uniform_) return uniform_layouts_.initial_layout;
     IndexType index = encoder_.Encode(subresource);
-    return FindInMap(index, layouts_.initial);
+    return FindInMap(index, layouts_->initial);
 }
 
 // Saves an encode to fetch both in the same call
 ImageSubresourceLayoutMap::Layouts ImageSubresourceLayoutMap::GetSubresourceLayouts(const VkImageSubresource& subresource,
                                                                                     bool always_get_initial) const {
+    if (uniform_) {
+        Layouts layouts = uniform_layouts_;
+        if (!always_get_initial && (layouts.current_layout == kInvalidLayout)) layouts.initial_layout = kInvalidLayout;
+        return layouts;
+    }
     IndexType index = encoder_.Encode(subresource);
-    Layouts layouts{FindInMap(index, layouts_.current), kInvalidLayout};
+    Layouts layouts{FindInMap(index, layouts_->current), kInvalidLayout};
     if (always_get_initial || (layouts.current_layout != kInvalidLayout)) {
-        layouts.initial_layout = FindInMap(index, layouts_.initial);
+        layouts.initial_layout = FindInMap(index, layouts_->initial);
     }
     return layouts;
 }
 
 const InitialLayoutState* ImageSubresourceLayoutMap::GetSubresourceInitialLayoutState(const IndexType index) const {
-    const auto found = initial_layout_state_map_.find(index);
-    if (found != initial_layout_state_map_.end()) {
+    if (uniform_) return uniform_initial_state_;
+    const auto& initial_state_map = layouts_->initial_state;
+    const auto found = initial_state_map.find(index);
+    if (found != initial_state_map.end()) {
         return found->second;
     }
     return nullptr;
@@ -231,21 +292,84 @@ bool ImageSubresourceLayoutMap::UpdateFrom(const ImageSubresourceLayoutMap& othe
     assert(CompatibilityKey() == other.CompatibilityKey());
     if (CompatibilityKey() != other.CompatibilityKey()) return false;
 
-    bool updated = false;
-    updated |= sparse_container::splice(&layouts_.initial, other.layouts_.initial, Arbiter::prefer_dest);
-    updated |= sparse_container::splice(&layouts_.current, other.layouts_.current, Arbiter::prefer_source);
+    validated_generation_ = 0;
+    // Layouts imported on top of existing ones can differ from the initial layouts kept by prefer_dest
+    if (other.has_transitions_ || (CurrentLayoutSize() != 0)) {
+        has_transitions_ = true;
+    }
+
     // NOTE -- we are copying plain pointers from 'other' which owns them as unique_ptr.  This works because
     //         currently this function is only used to import from secondary command buffers, destruction of which
     //         invalidate the referencing primary command buffer, meaning that the dangling pointer will either be
     //         cleaned up in invalidation, on not referenced by validation code.
-    sparse_container::splice(&initial_layout_state_map_, other.initial_layout_state_map_, Arbiter::prefer_dest);
+    bool updated = false;
+    if (uniform_ && other.uniform_) {
+        // Splicing two uniform maps gives a uniform map, following the same precedence as the splices below
+        const auto& other_layouts = other.uniform_layouts_;
+        if ((uniform_layouts_.initial_layout == kInvalidLayout) && (other_layouts.initial_layout != kInvalidLayout)) {
+            uniform_layouts_.initial_layout = other_layouts.initial_layout;
+            uniform_initial_state_ = other.uniform_initial_state_;
+            updated = true;
+        }
+        if ((other_layouts.current_layout != kInvalidLayout) && (other_layouts.current_layout != uniform_layouts_.current_layout)) {
+            uniform_layouts_.current_layout = other_layouts.current_layout;
+            updated = true;
+        }
+        return updated;
+    }
+
+    if (uniform_) BuildRangeMaps();
+    auto& maps = *layouts_;
+    if (other.uniform_) {
+        const IndexRange full_range = FullIndexRange();
+        const auto& other_layouts = other.uniform_layouts_;
+        if (other_layouts.initial_layout != kInvalidLayout) {
+            updated |= sparse_container::update_range_value(maps.initial, full_range, other_layouts.initial_layout,
+                                                            WritePolicy::prefer_dest);
+            sparse_container::update_range_value(maps.initial_state, full_range, other.uniform_initial_state_,
+                                                 WritePolicy::prefer_dest);
+        }
+        if (other_layouts.current_layout != kInvalidLayout) {
+            updated |= sparse_container::update_range_value(maps.current, full_range, other_layouts.current_layout,
+                                                            WritePolicy::prefer_source);
+        }
+    } else {
+        const auto& other_maps = *other.layouts_;
+        updated |= sparse_container::splice(&maps.initial, other_maps.initial, Arbiter::prefer_dest);
+        updated |= sparse_container::splice(&maps.current, other_maps.current, Arbiter::prefer_source);
+        sparse_container::splice(&maps.initial_state, other_maps.initial_state, Arbiter::prefer_dest);
+    }
 
     return updated;
 }
 
+bool ImageSubresourceLayoutMap::SpliceCurrentLayouts(LayoutMap* layout_map) const {
+    if (uniform_) {
+        if (uniform_layouts_.current_layout == kInvalidLayout) return false;
+        return sparse_container::update_range_value(*layout_map, FullIndexRange(), uniform_layouts_.current_layout,
+                                                    WritePolicy::prefer_source);
+    }
+    return sparse_container::splice(layout_map, layouts_->current, sparse_container::value_precedence::prefer_source);
+}
+
 // This is the same constant value range, subreource position advance logic as ForRange above, but suitable for use with
 // an Increment operator.
 void ImageSubresourceLayoutMap::ConstIterator::UpdateRangeAndValue() {
+    if (uniform_) {
+        // Every index has the same value, so each generated range is a constant value range
+        if (!range_gen_->includes(current_index_)) {
+            ++range_gen_;  // ++range_gen will update subres_gen.
+            current_index_ = range_gen_->begin;
+        }
+        if (range_gen_->empty()) {
+            ForceEndCondition();
+        } else {
+            constant_value_bound_ = range_gen_->end;
+            pos_.subresource = range_gen_.GetSubresource();
+        }
+        return;
+    }
+
     bool not_found = true;
     while (range_gen_->non_empty() && not_found) {
         if (!parallel_it_->range.includes(current_index_)) {  // NOTE: empty ranges can't include anything
@@ -328,10 +452,33 @@ ImageSubresourceLayoutMap::ConstIterator::ConstIterator(const RangeMap& current,
       parallel_it_(current, initial, range_gen_->begin),
       skip_invalid_(skip_invalid),
       always_get_initial_(always_get_initial),
+      uniform_(false),
       pos_(),
       current_index_(range_gen_->begin),
       constant_value_bound_() {
     UpdateRangeAndValue();
 }
 
+ImageSubresourceLayoutMap::ConstIterator::ConstIterator(const Layouts& uniform_layouts, const Encoder& encoder,
+                                                        const VkImageSubresourceRange& subres, bool skip_invalid,
+                                                        bool always_get_initial)
+    : range_gen_(encoder, subres),
+      parallel_it_(),
+      skip_invalid_(skip_invalid),
+      always_get_initial_(always_get_initial),
+      uniform_(true),
+      pos_(),
+      current_index_(range_gen_->begin),
+      constant_value_bound_() {
+    pos_.current_layout = uniform_layouts.current_layout;
+    pos_.initial_layout = kInvalidLayout;
+    if ((pos_.current_layout == kInvalidLayout) || always_get_initial_) {
+        pos_.initial_layout = uniform_layouts.initial_layout;
+    }
+    // When skipping invalid layouts the whole range is skipped, leaving pos_ at the end condition
+    if (!skip_invalid_ || (pos_.current_layout != kInvalidLayout) || (pos_.initial_layout != kInvalidLayout)) {
+        UpdateRangeAndValue();
+    }
+}
+
 }  // namespace image_layout_map
@@ -22,6 +22,7 @@
 #ifndef IMAGE_LAYOUT_MAP_H_
 #define IMAGE_LAYOUT_MAP_H_
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -97,6 +98,8 @@ class ImageSubresourceLayoutMap {
     using LayoutMap = RangeMap;
     using InitialLayoutMap = RangeMap;
     using InitialLayoutStates = std::vector<std::unique_ptr<InitialLayoutState>>;
+    // This map *also* needs "write once" semantics
+    using InitialLayoutStateMap = subresource_adapter::BothRangeMap<InitialLayoutState*, 16>;
 
     class ConstIterator {
       public:
@@ -108,7 +111,8 @@ class ImageSubresourceLayoutMap {
         const SubresourceLayout* operator->() const { return &pos_; }
         const SubresourceLayout& operator*() const { return pos_; }
 
-        ConstIterator() : range_gen_(), parallel_it_(), skip_invalid_(false), always_get_initial_(false), pos_() {}
+        ConstIterator()
+            : range_gen_(), parallel_it_(), skip_invalid_(false), always_get_initial_(false), uniform_(false), pos_() {}
         bool AtEnd() const { return pos_.subresource.aspectMask == 0; }
 
         // Only for comparisons to end()
@@ -121,6 +125,9 @@ class ImageSubresourceLayoutMap {
         friend ImageSubresourceLayoutMap;
         ConstIterator(const RangeMap& current, const RangeMap& initial, const Encoder& encoder,
                       const VkImageSubresourceRange& subres, bool skip_invalid, bool always_get_initial);
+        // Iterates a map without range maps, where every subresource has the same layouts
+        ConstIterator(const Layouts& uniform_layouts, const Encoder& encoder, const VkImageSubresourceRange& subres,
+                      bool skip_invalid, bool always_get_initial);
         void UpdateRangeAndValue();
         void ForceEndCondition() { pos_.subresource.aspectMask = 0; }
 
@@ -128,6 +135,7 @@ class ImageSubresourceLayoutMap {
         ParallelIterator<const RangeMap, const RangeMap> parallel_it_;
         bool skip_invalid_;
         bool always_get_initial_;
+        bool uniform_;
         SubresourceLayout pos_;
         IndexType current_index_ = 0;
         IndexType constant_value_bound_ = 0;
@@ -136,7 +144,8 @@ class ImageSubresourceLayoutMap {
     ConstIterator Find(const VkImageSubresourceRange& subres_range, bool skip_invalid = true,
                        bool always_get_initial = false) const {
         if (InRange(subres_range)) {
-            return ConstIterator(layouts_.current, layouts_.initial, encoder_, subres_range, skip_invalid, always_get_initial);
+            if (uniform_) return ConstIterator(uniform_layouts_, encoder_, subres_range, skip_invalid, always_get_initial);
+            return ConstIterator(layouts_->current, layouts_->initial, encoder_, subres_range, skip_invalid, always_get_initial);
         }
         return End();
     }
@@ -146,8 +155,12 @@ class ImageSubresourceLayoutMap {
     inline ConstIterator begin() const { return Begin(); }  // STL style, for range based loops and familiarity
     const ConstIterator& End() const { return end_iterator; }
     const ConstIterator& end() const { return End(); }  // STL style, for range based loops and familiarity.
-    inline size_t InitialLayoutSize() const { return layouts_.initial.size(); }
-    inline size_t CurrentLayoutSize() const { return layouts_.current.size(); }
+    inline size_t InitialLayoutSize() const {
+        return uniform_ ? (uniform_layouts_.initial_layout != kInvalidLayout ? 1 : 0) : layouts_->initial.size();
+    }
+    inline size_t CurrentLayoutSize() const {
+        return uniform_ ? (uniform_layouts_.current_layout != kInvalidLayout ? 1 : 0) : layouts_->current.size();
+    }
 
     bool SetSubresourceRangeLayout(const CMD_BUFFER_STATE& cb_state, const VkImageSubresourceRange& range, VkImageLayout layout,
                                    VkImageLayout expected_layout = kInvalidLayout);
@@ -160,12 +173,38 @@ class ImageSubresourceLayoutMap {
     VkImageLayout GetSubresourceLayout(const VkImageSubresource& subresource) const;
     VkImageLayout GetSubresourceInitialLayout(const VkImageSubresource& subresource) const;
     Layouts GetSubresourceLayouts(const VkImageSubresource& subresource, bool always_get_initial = true) const;
+    // While every subresource shares one layout pair (including the "nothing recorded" pair of kInvalidLayout), report it,
+    // allowing callers to check an entire range at once instead of walking it
+    bool GetUniformLayouts(Layouts* layouts) const {
+        if (uniform_) *layouts = uniform_layouts_;
+        return uniform_;
+    }
     const InitialLayoutState* GetSubresourceInitialLayoutState(const IndexType index) const;
     const InitialLayoutState* GetSubresourceInitialLayoutState(const VkImageSubresource& subresource) const;
     bool UpdateFrom(const ImageSubresourceLayoutMap& from);
     uintptr_t CompatibilityKey() const;
-    const InitialLayoutMap& GetInitialLayoutMap() const { return layouts_.initial; }
-    const LayoutMap& GetCurrentLayoutMap() const { return layouts_.current; }
+    // True if any recorded layout may differ from the initial layout of the same subresource (conservative)
+    bool HasLayoutTransitions() const { return has_transitions_; }
+    // Global layout generation against which the initial layouts were last found to match exactly, 0 if not validated.
+    // Set from (const) submit time validation, where any stored generation is a correct result, hence the relaxed atomic.
+    uint64_t GetValidatedGeneration() const { return validated_generation_.load(std::memory_order_relaxed); }
+    void SetValidatedGeneration(uint64_t generation) const { validated_generation_.store(generation, std::memory_order_relaxed); }
+    bool HasInitialLayouts() const { return InitialLayoutSize() != 0; }
+    // Calls callback(const IndexRange&, VkImageLayout) for each index range of constant, valid initial layout, in index
+    // order, stopping early if the callback returns false
+    template <typename RangeCallback>
+    void ForEachInitialLayoutRange(RangeCallback&& callback) const {
+        if (uniform_) {
+            if (uniform_layouts_.initial_layout != kInvalidLayout) callback(FullIndexRange(), uniform_layouts_.initial_layout);
+            return;
+        }
+        const auto end = layouts_->initial.end();
+        for (auto pos = layouts_->initial.begin(); pos != end; ++pos) {
+            if (!callback(pos->first, pos->second)) break;
+        }
+    }
+    // Writes the current layouts over those of layout_map (which must be for the same image), returning true if any changed
+    bool SpliceCurrentLayouts(LayoutMap* layout_map) const;
     ImageSubresourceLayoutMap(const IMAGE_STATE& image_state);
     ~ImageSubresourceLayoutMap() {}
     const IMAGE_STATE* GetImageView() const { return &image_state_; };
@@ -173,7 +212,8 @@ class ImageSubresourceLayoutMap {
     struct LayoutMaps {
         LayoutMap current;
         InitialLayoutMap initial;
-        LayoutMaps(typename LayoutMap::index_type size) : current(size), initial(size) {}
+        InitialLayoutStateMap initial_state;
+        LayoutMaps(typename LayoutMap::index_type size) : current(size), initial(size), initial_state(size) {}
     };
 
   protected:
@@ -188,29 +228,36 @@ class ImageSubresourceLayoutMap {
 
     bool InRange(const VkImageSubresource& subres) const { return encoder_.InRange(subres); }
     bool InRange(const VkImageSubresourceRange& range) const { return encoder_.InRange(range); }
-
-    inline InitialLayoutState* UpdateInitialLayoutState(const IndexRange& range, InitialLayoutState* initial_state,
-                                                        const CMD_BUFFER_STATE& cb_state, const IMAGE_VIEW_STATE* view_state) {
-        if (!initial_state) {
-            // Allocate on demand...  initial_layout_states_ holds ownership as a unique_ptr, while
-            // each subresource has a non-owning copy of the plain pointer.
-            initial_state = new InitialLayoutState(cb_state, view_state);
-            initial_layout_states_.emplace_back(initial_state);
-        }
-        assert(initial_state);
-        sparse_container::update_range_value(initial_layout_state_map_, range, initial_state, WritePolicy::prefer_dest);
-        return initial_state;
+    // Note: range must be normalized
+    bool IsFullRange(const VkImageSubresourceRange& range) const {
+        const auto& full_range = encoder_.FullRange();
+        return (range.baseMipLevel == 0) && (range.levelCount == full_range.levelCount) && (range.baseArrayLayer == 0) &&
+               (range.layerCount == full_range.layerCount) && ((range.aspectMask & full_range.aspectMask) == full_range.aspectMask);
     }
 
-    // This map *also* needs "write once" semantics
-    using InitialLayoutStateMap = subresource_adapter::BothRangeMap<InitialLayoutState*, 16>;
+    IndexRange FullIndexRange() const { return IndexRange(0, encoder_.SubresourceCount()); }
+    // Allocates the range maps and fills them from the uniform summary, for an update that breaks uniformity
+    void BuildRangeMaps();
+    bool SetInitialLayout(const CMD_BUFFER_STATE& cb_state, bool full_range, RangeGenerator* range_gen, VkImageLayout layout,
+                          const IMAGE_VIEW_STATE* view_state);
+
+    inline InitialLayoutState* AddInitialLayoutState(const CMD_BUFFER_STATE& cb_state, const IMAGE_VIEW_STATE* view_state) {
+        // initial_layout_states_ holds ownership as a unique_ptr, while users have a non-owning copy of the plain pointer.
+        initial_layout_states_.emplace_back(new InitialLayoutState(cb_state, view_state));
+        return initial_layout_states_.back().get();
+    }
 
   private:
     const IMAGE_STATE& image_state_;
     const Encoder& encoder_;
-    LayoutMaps layouts_;
+    // Built by the first update that isn't to the full range, until then every subresource has the uniform_ summary values
+    std::unique_ptr<LayoutMaps> layouts_;
     InitialLayoutStates initial_layout_states_;
-    InitialLayoutStateMap initial_layout_state_map_;
+    bool has_transitions_;
+    mutable std::atomic<uint64_t> validated_generation_;
+    bool uniform_;
+    Layouts uniform_layouts_;
+    InitialLayoutState* uniform_initial_state_;  // Non-owning, shared by all subresources while uniform_
 
     static const ConstIterator end_iterator;  // Just to hold the end condition tombstone (aspectMask == 0)
 };
@@ -0,0 +1,249 @@
+/* Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "chassis.h"
+
+#ifdef INSTRUMENT_INTERCEPT_STATS
+
+#include <chrono>
+#include <functional>
+#include <signal.h>
+#include <string>
+
+namespace intercept_stats {
+
+static_assert(LayerObjectTypeMaxEnum <= kMaxObjectTypes, "intercept_stats::kMaxObjectTypes is too small");
+
+static const char *kObjectTypeNames[LayerObjectTypeMaxEnum] = {
+    "Instance",      "Device",      "Threading",   "ParameterValidation", "ObjectTracker", "CoreValidation",
+    "BestPractices", "GpuAssisted", "DebugPrintf", "CommandCounter",      "SyncValidation", "ApiCapture",
+};
+static const char *kPhaseNames[kPhaseCount] = {"PreCallValidate", "PreCallRecord", "PostCallRecord"};
+
+// Only the owning thread writes its counters, so relaxed load/store suffices; Dump may read a slightly stale total
+struct Counters {
+    std::atomic<uint64_t> calls;
+    std::atomic<uint64_t> ticks;
+    std::atomic<uint64_t> histogram[kBucketCount];
+};
+
+struct EntryPointCounters {
+    Counters counters[kPhaseCount][kMaxObjectTypes];
+    EntryPointCounters() {
+        for (auto &phase : counters) {
+            for (auto &counter : phase) {
+                counter.calls.store(0, std::memory_order_relaxed);
+                counter.ticks.store(0, std::memory_order_relaxed);
+                for (auto &bucket : counter.histogram) bucket.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+};
+
+// Allocated the first time a thread records an entry point, and published for Dump with a release store
+struct ThreadCounters {
+    std::atomic<EntryPointCounters *> entry_points[kMaxEntryPoints];
+    std::atomic<uint64_t> counters[kMaxCounters];
+    ThreadCounters() {
+        for (auto &entry_point : entry_points) entry_point.store(nullptr, std::memory_order_relaxed);
+        for (auto &counter : counters) counter.store(0, std::memory_order_relaxed);
+    }
+    ~ThreadCounters() {
+        for (auto &entry_point : entry_points) delete entry_point.load(std::memory_order_relaxed);
+    }
+};
+
+// Registration and thread setup are one-time events per entry point or thread, and may lock
+struct Registry {
+    std::mutex lock;
+    std::unordered_map<std::string, uint32_t> entry_point_ids;
+    std::vector<std::string> entry_point_names;
+    std::unordered_map<std::string, uint32_t> counter_ids;
+    std::vector<std::string> counter_names;
+    // Empty for counters accumulated through Count
+    std::vector<std::function<uint64_t()>> counter_sources;
+    // Thread counters outlive their threads so that a later Dump still includes them
+    std::vector<std::unique_ptr<ThreadCounters>> threads;
+    std::chrono::steady_clock::time_point start_time;
+    uint64_t start_ticks;
+    Registry() : start_time(std::chrono::steady_clock::now()), start_ticks(ReadTicks()) {}
+};
+
+static std::atomic<bool> dump_requested{false};
+
+#ifndef _WIN32
+static void RequestDump(int) { dump_requested.store(true, std::memory_order_relaxed); }
+#endif
+
+static Registry &GetRegistry() {
+    static Registry *registry = []() {
+#ifndef _WIN32
+        // Don't displace a handler the application installed
+        struct sigaction previous = {};
+        if ((sigaction(SIGUSR1, nullptr, &previous) == 0) && (previous.sa_handler == SIG_DFL)) {
+            struct sigaction action = {};
+            action.sa_handler = RequestDump;
+            sigemptyset(&action.sa_mask);
+            sigaction(SIGUSR1, &action, nullptr);
+        }
+#endif
+        // Leaked deliberately, as intercepts may still run during static destruction
+        return new Registry;
+    }();
+    return *registry;
+}
+
+static ThreadCounters &GetThreadCounters() {
+    thread_local ThreadCounters *thread_counters = nullptr;
+    if (!thread_counters) {
+        auto &registry = GetRegistry();
+        std::unique_ptr<ThreadCounters> counters(new ThreadCounters);
+        thread_counters = counters.get();
+        std::lock_guard<std::mutex> guard(registry.lock);
+        registry.threads.emplace_back(std::move(counters));
+    }
+    return *thread_counters;
+}
+
+static uint32_t BucketIndex(uint64_t ticks) {
+    uint32_t bucket = 0;
+    while ((ticks >>= 1) && (bucket < kBucketCount - 1)) ++bucket;
+    return bucket;
+}
+
+static void Increment(std::atomic<uint64_t> &value, uint64_t amount) {
+    value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+}
+
+uint32_t RegisterEntryPoint(const char *name) {
+    auto &registry = GetRegistry();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    auto found = registry.entry_point_ids.find(name);
+    if (found != registry.entry_point_ids.end()) return found->second;
+    if (registry.entry_point_names.size() >= kMaxEntryPoints) return kMaxEntryPoints;
+    const uint32_t id = static_cast<uint32_t>(registry.entry_point_names.size());
+    registry.entry_point_names.emplace_back(name);
+    registry.entry_point_ids.emplace(name, id);
+    return id;
+}
+
+static uint32_t AddCounter(const char *name, std::function<uint64_t()> &&source) {
+    auto &registry = GetRegistry();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    auto found = registry.counter_ids.find(name);
+    if (found != registry.counter_ids.end()) return found->second;
+    if (registry.counter_names.size() >= kMaxCounters) return kMaxCounters;
+    const uint32_t id = static_cast<uint32_t>(registry.counter_names.size());
+    registry.counter_names.emplace_back(name);
+    registry.counter_sources.emplace_back(std::move(source));
+    registry.counter_ids.emplace(name, id);
+    return id;
+}
+
+uint32_t RegisterCounter(const char *name) { return AddCounter(name, std::function<uint64_t()>()); }
+
+uint32_t RegisterCounterSource(const char *name, std::function<uint64_t()> source) {
+    return AddCounter(name, std::move(source));
+}
+
+void Count(uint32_t counter, uint64_t amount) {
+    if (counter < kMaxCounters) {
+        Increment(GetThreadCounters().counters[counter], amount);
+    }
+}
+
+void Record(uint32_t entry_point, Phase phase, uint32_t object_type, uint64_t ticks) {
+    if ((entry_point < kMaxEntryPoints) && (object_type < kMaxObjectTypes)) {
+        auto &slot = GetThreadCounters().entry_points[entry_point];
+        EntryPointCounters *entry_point_counters = slot.load(std::memory_order_relaxed);
+        if (!entry_point_counters) {
+            entry_point_counters = new EntryPointCounters;
+            slot.store(entry_point_counters, std::memory_order_release);
+        }
+        auto &counters = entry_point_counters->counters[phase][object_type];
+        Increment(counters.calls, 1);
+        Increment(counters.ticks, ticks);
+        Increment(counters.histogram[BucketIndex(ticks)], 1);
+    }
+
+    if (dump_requested.load(std::memory_order_relaxed) && dump_requested.exchange(false)) {
+        Dump();
+    }
+}
+
+void Dump() {
+    auto &registry = GetRegistry();
+    const char *filename = getLayerOption("khronos_validation.intercept_stats_file");
+    if (!filename || !*filename) filename = "vk_intercept_stats.csv";
+
+    std::lock_guard<std::mutex> guard(registry.lock);
+    FILE *out = fopen(filename, "w");
+    if (!out) return;
+
+    const auto elapsed = std::chrono::steady_clock::now() - registry.start_time;
+    const double elapsed_us = std::chrono::duration<double, std::micro>(elapsed).count();
+    const double ticks_per_us = (elapsed_us > 0.0) ? static_cast<double>(ReadTicks() - registry.start_ticks) / elapsed_us : 0.0;
+    fprintf(out, "# ticks_per_us=%.3f threads=%zu\n", ticks_per_us, registry.threads.size());
+    fprintf(out, "entry_point,validation_object,phase,calls,total_ticks,mean_ticks");
+    for (uint32_t bucket = 0; bucket < kBucketCount; ++bucket) fprintf(out, ",ticks_lt_2^%" PRIu32, bucket + 1);
+    fprintf(out, "\n");
+
+    for (uint32_t entry_point = 0; entry_point < registry.entry_point_names.size(); ++entry_point) {
+        for (uint32_t phase = 0; phase < kPhaseCount; ++phase) {
+            for (uint32_t object_type = 0; object_type < LayerObjectTypeMaxEnum; ++object_type) {
+                uint64_t calls = 0;
+                uint64_t ticks = 0;
+                uint64_t histogram[kBucketCount] = {};
+                for (const auto &thread : registry.threads) {
+                    const EntryPointCounters *entry_point_counters =
+                        thread->entry_points[entry_point].load(std::memory_order_acquire);
+                    if (!entry_point_counters) continue;
+                    const auto &counters = entry_point_counters->counters[phase][object_type];
+                    calls += counters.calls.load(std::memory_order_relaxed);
+                    ticks += counters.ticks.load(std::memory_order_relaxed);
+                    for (uint32_t bucket = 0; bucket < kBucketCount; ++bucket) {
+                        histogram[bucket] += counters.histogram[bucket].load(std::memory_order_relaxed);
+                    }
+                }
+                if (!calls) continue;
+
+                fprintf(out, "%s,%s,%s,%" PRIu64 ",%" PRIu64 ",%" PRIu64, registry.entry_point_names[entry_point].c_str(),
+                        kObjectTypeNames[object_type], kPhaseNames[phase], calls, ticks, ticks / calls);
+                for (const auto count : histogram) fprintf(out, ",%" PRIu64, count);
+                fprintf(out, "\n");
+            }
+        }
+    }
+
+    if (!registry.counter_names.empty()) {
+        fprintf(out, "\ncounter,value\n");
+        for (uint32_t counter = 0; counter < registry.counter_names.size(); ++counter) {
+            uint64_t value = 0;
+            if (registry.counter_sources[counter]) {
+                value = registry.counter_sources[counter]();
+            } else {
+                for (const auto &thread : registry.threads) value += thread->counters[counter].load(std::memory_order_relaxed);
+            }
+            fprintf(out, "%s,%" PRIu64 "\n", registry.counter_names[counter].c_str(), value);
+        }
+    }
+    fclose(out);
+}
+
+}  // namespace intercept_stats
+
+#endif  // INSTRUMENT_INTERCEPT_STATS
@@ -0,0 +1,120 @@
+/* Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+// Per intercept call counts and timing histograms for each ValidationObject.
+//
+// Built only with INSTRUMENT_INTERCEPT_STATS defined, otherwise the chassis macros below expand to nothing.  Each thread
+// accumulates into its own counters, so recording takes no locks.  The totals over all threads are written as CSV to the
+// file named by the khronos_validation.intercept_stats_file setting when a device is destroyed, or (on POSIX systems)
+// when the process receives SIGUSR1.
+//
+// Named counters let validation code report its own totals (e.g. range merging or cache hits) into the same file.  Counted
+// values accumulate per thread like the intercept timings, while counter sources are sampled only when the file is written.
+
+#ifdef INSTRUMENT_INTERCEPT_STATS
+
+#include <cstdint>
+#include <functional>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define INTERCEPT_STATS_USE_TSC
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define INTERCEPT_STATS_USE_TSC
+#else
+#include <chrono>
+#endif
+
+namespace intercept_stats {
+
+enum Phase : uint32_t { kPreCallValidate = 0, kPreCallRecord, kPostCallRecord, kPhaseCount };
+
+// Upper bounds on the distinct entry points and ValidationObject container types tracked
+const uint32_t kMaxEntryPoints = 2048;
+const uint32_t kMaxObjectTypes = 16;
+// Upper bound on the distinct named counters
+const uint32_t kMaxCounters = 64;
+// Histogram bucket N counts calls taking [2^N, 2^(N+1)) ticks, with the last bucket unbounded
+const uint32_t kBucketCount = 32;
+
+// Returns a dense id for the named entry point, or kMaxEntryPoints once the table is full (the calls are then ignored)
+uint32_t RegisterEntryPoint(const char *name);
+void Record(uint32_t entry_point, Phase phase, uint32_t object_type, uint64_t ticks);
+
+// Returns a dense id for the named counter, or kMaxCounters once the table is full (the counts are then ignored)
+uint32_t RegisterCounter(const char *name);
+void Count(uint32_t counter, uint64_t amount);
+// Adds a counter whose value is read from source when the statistics are written, the source must outlive the process
+uint32_t RegisterCounterSource(const char *name, std::function<uint64_t()> source);
+
+// Write the accumulated statistics to the configured file
+void Dump();
+
+static inline uint64_t ReadTicks() {
+#ifdef INTERCEPT_STATS_USE_TSC
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+// Times the enclosing intercept scope
+class Scope {
+  public:
+    Scope(uint32_t entry_point, Phase phase, uint32_t object_type)
+        : entry_point_(entry_point), phase_(phase), object_type_(object_type), start_(ReadTicks()) {}
+    ~Scope() { Record(entry_point_, phase_, object_type_, ReadTicks() - start_); }
+
+  private:
+    const uint32_t entry_point_;
+    const Phase phase_;
+    const uint32_t object_type_;
+    const uint64_t start_;
+};
+
+}  // namespace intercept_stats
+
+// The entry point registration is a function local static, so each call site looks up its id only once
+#define INTERCEPT_STATS_SCOPE(intercept, phase, entry_point_name)                                              \
+    static const uint32_t intercept_stats_entry_point = intercept_stats::RegisterEntryPoint(entry_point_name); \
+    intercept_stats::Scope intercept_stats_scope(intercept_stats_entry_point, intercept_stats::phase,          \
+                                                 static_cast<uint32_t>((intercept)->container_type))
+#define INTERCEPT_STATS_DUMP() intercept_stats::Dump()
+#define INTERCEPT_STATS_COUNT(counter_name, amount)                                                     \
+    do {                                                                                                \
+        static const uint32_t intercept_stats_counter = intercept_stats::RegisterCounter(counter_name); \
+        intercept_stats::Count(intercept_stats_counter, amount);                                        \
+    } while (0)
+#define INTERCEPT_STATS_CONCAT_(a, b) a##b
+#define INTERCEPT_STATS_CONCAT(a, b) INTERCEPT_STATS_CONCAT_(a, b)
+// For use at namespace scope, registers the source during static initialization
+#define INTERCEPT_STATS_COUNTER_SOURCE(counter_name, source)                                  \
+    static const uint32_t INTERCEPT_STATS_CONCAT(intercept_stats_counter_source_, __LINE__) = \
+        intercept_stats::RegisterCounterSource(counter_name, source)
+
+#else
+
+#define INTERCEPT_STATS_SCOPE(intercept, phase, entry_point_name)
+#define INTERCEPT_STATS_DUMP()
+#define INTERCEPT_STATS_COUNT(counter_name, amount)
+// Expands to a declaration, so the semicolon following it at namespace scope isn't an empty one
+#define INTERCEPT_STATS_COUNTER_SOURCE(counter_name, source) static_assert(true, "")
+
+#endif  // INSTRUMENT_INTERCEPT_STATS
@@ -85,6 +85,19 @@ void SetValidationEnable(CHECK_ENABLED &enable_data, const ValidationCheckEnable
         case VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ALL:
             enable_data[vendor_specific_arm] = true;
             break;
+        case VALIDATION_CHECK_ENABLE_PARALLEL_VALIDATE:
+            enable_data[parallel_validate] = true;
+            break;
+        case VALIDATION_CHECK_ENABLE_MAPPED_MEMORY_GUARD:
+            enable_data[guard_mapped_memory] = true;
+            break;
+        case VALIDATION_CHECK_ENABLE_MAPPED_MEMORY_WRITE_TRACKING:
+            enable_data[guard_mapped_memory] = true;
+            enable_data[track_mapped_memory_writes] = true;
+            break;
+        case VALIDATION_CHECK_ENABLE_API_CAPTURE:
+            enable_data[api_capture] = true;
+            break;
         default:
             assert(true);
     }
@@ -316,6 +329,13 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
                 CreateFilterMessageIdList(data, ",", settings_data->message_filter_list);
             } else if (name == "duplicate_message_limit") {
                 *settings_data->duplicate_message_limit = cur_setting.data.value32;
+            } else if (name == "sampling_rate") {
+                settings_data->sampling_settings->rate = cur_setting.data.value32;
+            } else if (name == "sampling_mode") {
+                settings_data->sampling_settings->mode = ValidationSampler::ModeFromName(cur_setting.data.arrayString.pCharArray);
+            } else if (name == "sampling_seed") {
+                const bool is_64_bit = (cur_setting.type == VK_LAYER_SETTING_VALUE_TYPE_UINT64_EXT);
+                settings_data->sampling_settings->seed = is_64_bit ? cur_setting.data.value64 : cur_setting.data.value32;
             } else if (name == "custom_stype_list") {
                 if (cur_setting.type == VK_LAYER_SETTING_VALUE_TYPE_STRING_ARRAY_EXT) {
                     std::string data(cur_setting.data.arrayString.pCharArray);
@@ -357,6 +377,9 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
     stypes_key.append(".custom_stype_list");
     filter_msg_key.append(".message_id_filter");
     message_limit.append(".duplicate_message_limit");
+    std::string sampling_rate_key = std::string(settings_data->layer_description) + ".sampling_rate";
+    std::string sampling_mode_key = std::string(settings_data->layer_description) + ".sampling_mode";
+    std::string sampling_seed_key = std::string(settings_data->layer_description) + ".sampling_seed";
     std::string list_of_config_enables = getLayerOption(enable_key.c_str());
     std::string list_of_env_enables = GetLayerEnvVar("VK_LAYER_ENABLES");
     std::string list_of_config_disables = getLayerOption(disable_key.c_str());
@@ -367,6 +390,9 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
     std::string list_of_env_stypes = GetLayerEnvVar("VK_LAYER_CUSTOM_STYPE_LIST");
     std::string config_message_limit = getLayerOption(message_limit.c_str());
     std::string env_message_limit = GetLayerEnvVar("VK_LAYER_DUPLICATE_MESSAGE_LIMIT");
+    std::string config_sampling_rate = getLayerOption(sampling_rate_key.c_str());
+    std::string config_sampling_mode = getLayerOption(sampling_mode_key.c_str());
+    std::string config_sampling_seed = getLayerOption(sampling_seed_key.c_str());
 
 #if defined(_WIN32)
     std::string env_delimiter = ";";
@@ -389,4 +415,14 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
     if (config_limit_setting != 0) {
         *settings_data->duplicate_message_limit = config_limit_setting;
     }
+    // Process command buffer sampling
+    if (!config_sampling_rate.empty()) {
+        settings_data->sampling_settings->rate = static_cast<uint32_t>(std::strtoul(config_sampling_rate.c_str(), nullptr, 0));
+    }
+    if (!config_sampling_mode.empty()) {
+        settings_data->sampling_settings->mode = ValidationSampler::ModeFromName(config_sampling_mode.c_str());
+    }
+    if (!config_sampling_seed.empty()) {
+        settings_data->sampling_settings->seed = std::strtoull(config_sampling_seed.c_str(), nullptr, 0);
+    }
 }
@@ -31,6 +31,7 @@ typedef struct {
     CHECK_DISABLED &disables;
     std::vector<uint32_t> &message_filter_list;
     int32_t *duplicate_message_limit;
+    ValidationSampler::Settings *sampling_settings;
 } ConfigAndEnvSettings;
 
 static const std::unordered_map<std::string, VkValidationFeatureDisableEXT> VkValFeatureDisableLookup = {
@@ -68,6 +69,10 @@ static const std::unordered_map<std::string, ValidationCheckDisables> Validation
 static const std::unordered_map<std::string, ValidationCheckEnables> ValidationEnableLookup = {
     {"VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ARM", VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ARM},
     {"VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ALL", VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ALL},
+    {"VALIDATION_CHECK_ENABLE_PARALLEL_VALIDATE", VALIDATION_CHECK_ENABLE_PARALLEL_VALIDATE},
+    {"VALIDATION_CHECK_ENABLE_MAPPED_MEMORY_GUARD", VALIDATION_CHECK_ENABLE_MAPPED_MEMORY_GUARD},
+    {"VALIDATION_CHECK_ENABLE_MAPPED_MEMORY_WRITE_TRACKING", VALIDATION_CHECK_ENABLE_MAPPED_MEMORY_WRITE_TRACKING},
+    {"VALIDATION_CHECK_ENABLE_API_CAPTURE", VALIDATION_CHECK_ENABLE_API_CAPTURE},
 };
 
 // This should mirror the 'DisableFlags' enumerated type
@@ -93,7 +98,11 @@ static const std::vector<std::string> EnableFlagNameHelper = {
     "VK_VALIDATION_FEATURE_ENABLE_BEST_PRACTICES_EXT",                     // best_practices,
     "VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ARM",                         // vendor_specific_arm,
     "VK_VALIDATION_FEATURE_ENABLE_DEBUG_PRINTF_EXT",                       // debug_printf,
-    "VK_VALIDATION_FEATURE_ENABLE_SYNCHRONIZATION_VALIDATION"              // sync_validation,
+    "VK_VALIDATION_FEATURE_ENABLE_SYNCHRONIZATION_VALIDATION",             // sync_validation,
+    "VALIDATION_CHECK_ENABLE_PARALLEL_VALIDATE",                           // parallel_validate,
+    "VALIDATION_CHECK_ENABLE_MAPPED_MEMORY_GUARD",                         // guard_mapped_memory,
+    "VALIDATION_CHECK_ENABLE_MAPPED_MEMORY_WRITE_TRACKING",                // track_mapped_memory_writes,
+    "VALIDATION_CHECK_ENABLE_API_CAPTURE"                                  // api_capture,
 };
 
 void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data);
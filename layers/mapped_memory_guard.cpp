@@ -0,0 +1,314 @@
+/* Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+
+#include "mapped_memory_guard.h"
+
+#if defined(__linux__)
+
+#include <atomic>
+#include <thread>
+
+#include <signal.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE 0x100000
+#endif
+
+namespace {
+
+// A guarded mapping, as seen by the fault handler.  The handler can't take locks, so it only reads regions that are active;
+// everything but the atomics is written before a region is made active and not changed until it is inactive again.
+struct GuardedRegion {
+    std::atomic<bool> active{false};
+    bool allocated = false;  // Guarded by region_lock
+    uintptr_t data_begin = 0;
+    uintptr_t data_end = 0;
+    uintptr_t low_guard = 0;  // Address of the guard page before or after the data, 0 if there is none
+    uintptr_t high_guard = 0;
+    // The write protected pages: only those wholly inside the data, so that pages shared with neighbouring mappings are
+    // never changed.  Empty unless writes are tracked.
+    uintptr_t pages_begin = 0;
+    uintptr_t pages_end = 0;
+    std::unique_ptr<std::atomic<bool>[]> dirty_pages;
+    std::atomic<uintptr_t> dirty_page_count{0};
+    std::atomic<uintptr_t> out_of_bounds{0};  // First address accessed in a guard page, 0 if none
+};
+
+const uint32_t kMaxGuardedRegions = 1024;
+GuardedRegion guarded_regions[kMaxGuardedRegions];
+std::atomic<uint32_t> guarded_region_limit{0};  // One past the highest region ever allocated
+std::atomic<uint32_t> handlers_running{0};
+uintptr_t guard_page_size = 0;
+
+std::mutex region_lock;  // Guards region allocation, the handler installation and its users
+uint32_t handler_users = 0;
+struct sigaction previous_action;
+
+bool Contains(uintptr_t begin, uintptr_t end, uintptr_t address) { return (begin <= address) && (address < end); }
+
+bool HandleRegionFault(GuardedRegion &region, uintptr_t address) {
+    const uintptr_t page_size = guard_page_size;
+    for (const uintptr_t guard : {region.low_guard, region.high_guard}) {
+        if (guard && Contains(guard, guard + page_size, address)) {
+            uintptr_t none = 0;
+            region.out_of_bounds.compare_exchange_strong(none, address);
+            mprotect(reinterpret_cast<void *>(guard), page_size, PROT_READ | PROT_WRITE);
+            return true;
+        }
+    }
+    if (Contains(region.pages_begin, region.pages_end, address)) {
+        const uintptr_t page = (address - region.pages_begin) / page_size;
+        if (!region.dirty_pages[page].exchange(true, std::memory_order_relaxed)) {
+            region.dirty_page_count.fetch_add(1, std::memory_order_relaxed);
+        }
+        mprotect(reinterpret_cast<void *>(region.pages_begin + page * page_size), page_size, PROT_READ | PROT_WRITE);
+        return true;
+    }
+    return false;
+}
+
+void HandleFault(int sig, siginfo_t *info, void *context) {
+    // Sequentially consistent with ReleaseRegion: either it sees this handler running, or this handler sees the region
+    // inactive.  Acquire and release alone would allow both to miss the other's store.
+    handlers_running.fetch_add(1, std::memory_order_seq_cst);
+    const uintptr_t address = reinterpret_cast<uintptr_t>(info->si_addr);
+    const uint32_t limit = guarded_region_limit.load(std::memory_order_acquire);
+    bool handled = false;
+    for (uint32_t i = 0; (i < limit) && !handled; ++i) {
+        if (guarded_regions[i].active.load(std::memory_order_seq_cst)) {
+            handled = HandleRegionFault(guarded_regions[i], address);
+        }
+    }
+    handlers_running.fetch_sub(1, std::memory_order_release);
+    if (handled) return;
+
+    // Not ours.  Pass it on, or let the faulting instruction rerun with the default action.
+    if (previous_action.sa_flags & SA_SIGINFO) {
+        previous_action.sa_sigaction(sig, info, context);
+    } else if ((previous_action.sa_handler != SIG_DFL) && (previous_action.sa_handler != SIG_IGN)) {
+        previous_action.sa_handler(sig);
+    } else {
+        signal(sig, SIG_DFL);
+    }
+}
+
+// Reserve an inaccessible page at address, unless something is already mapped there
+uintptr_t ReserveGuardPage(uintptr_t address) {
+    if (!address) return 0;
+    void *page = mmap(reinterpret_cast<void *>(address), guard_page_size, PROT_NONE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+    if (page == MAP_FAILED) return 0;
+    if (reinterpret_cast<uintptr_t>(page) != address) {  // Kernels before 4.17 take the address as a hint
+        munmap(page, guard_page_size);
+        return 0;
+    }
+    return address;
+}
+
+// Make the written pages of region from first up to last read only again.  Returns the index of the first of them, or
+// last if there were none.
+uintptr_t ProtectWrittenPages(GuardedRegion &region, uintptr_t first, uintptr_t last) {
+    uintptr_t first_written = last;
+    uintptr_t page = first;
+    while ((page < last) && region.dirty_page_count.load(std::memory_order_relaxed)) {
+        if (!region.dirty_pages[page].exchange(false, std::memory_order_relaxed)) {
+            ++page;
+            continue;
+        }
+        const uintptr_t run_begin = page;
+        while ((++page < last) && region.dirty_pages[page].exchange(false, std::memory_order_relaxed)) {
+        }
+        region.dirty_page_count.fetch_sub(page - run_begin, std::memory_order_relaxed);
+        mprotect(reinterpret_cast<void *>(region.pages_begin + run_begin * guard_page_size),
+                 (page - run_begin) * guard_page_size, PROT_READ);
+        if (first_written == last) first_written = run_begin;
+    }
+    return first_written;
+}
+
+void ReleaseRegion(uint32_t index) {
+    GuardedRegion &region = guarded_regions[index];
+    if (region.pages_begin < region.pages_end) {
+        mprotect(reinterpret_cast<void *>(region.pages_begin), region.pages_end - region.pages_begin, PROT_READ | PROT_WRITE);
+    }
+    region.active.store(false, std::memory_order_seq_cst);
+    while (handlers_running.load(std::memory_order_seq_cst)) {
+        std::this_thread::yield();
+    }
+    for (const uintptr_t guard : {region.low_guard, region.high_guard}) {
+        if (guard) munmap(reinterpret_cast<void *>(guard), guard_page_size);
+    }
+    region.dirty_pages.reset();
+
+    std::lock_guard<std::mutex> lock(region_lock);
+    region.allocated = false;
+}
+
+}  // namespace
+
+std::unique_ptr<MappedMemoryGuard> MappedMemoryGuard::Create(bool track_writes) {
+    std::lock_guard<std::mutex> lock(region_lock);
+    if (handler_users++ == 0) {
+        guard_page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+        struct sigaction action = {};
+        action.sa_sigaction = HandleFault;
+        action.sa_flags = SA_SIGINFO;
+        sigemptyset(&action.sa_mask);
+        sigaction(SIGSEGV, &action, &previous_action);
+    }
+    return std::unique_ptr<MappedMemoryGuard>(new MappedMemoryGuard(guard_page_size, track_writes));
+}
+
+MappedMemoryGuard::~MappedMemoryGuard() {
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        for (const auto &entry : regions_) {
+            ReleaseRegion(entry.second);
+        }
+        regions_.clear();
+    }
+    std::lock_guard<std::mutex> lock(region_lock);
+    if (--handler_users == 0) {
+        sigaction(SIGSEGV, &previous_action, nullptr);
+    }
+}
+
+void MappedMemoryGuard::Map(VkDeviceMemory mem, void *data, VkDeviceSize size, bool coherent) {
+    std::lock_guard<std::mutex> lock(lock_);
+    // Mapping memory that is already mapped is invalid, but a driver may still succeed.  Release the earlier region, as Unmap
+    // would, so that its fault handler slot and guard pages are not leaked
+    auto it = regions_.find(mem);
+    if (it != regions_.end()) {
+        ReleaseRegion(it->second);
+        regions_.erase(it);
+    }
+    if (!data || !size) return;
+
+    uint32_t index = 0;
+    {
+        std::lock_guard<std::mutex> region_guard(region_lock);
+        while ((index < kMaxGuardedRegions) && guarded_regions[index].allocated) ++index;
+        if (index == kMaxGuardedRegions) return;  // Leave the mapping unchecked
+        guarded_regions[index].allocated = true;
+        if (guarded_region_limit.load(std::memory_order_relaxed) <= index) {
+            guarded_region_limit.store(index + 1, std::memory_order_release);
+        }
+    }
+
+    GuardedRegion &region = guarded_regions[index];
+    region.data_begin = reinterpret_cast<uintptr_t>(data);
+    region.data_end = region.data_begin + static_cast<uintptr_t>(size);
+    const uintptr_t outer_begin = region.data_begin & ~(page_size_ - 1);
+    const uintptr_t outer_end = (region.data_end + page_size_ - 1) & ~(page_size_ - 1);
+    region.low_guard = ReserveGuardPage(outer_begin - page_size_);
+    region.high_guard = ReserveGuardPage(outer_end);
+    region.out_of_bounds.store(0, std::memory_order_relaxed);
+    region.dirty_page_count.store(0, std::memory_order_relaxed);
+    region.pages_begin = 0;
+    region.pages_end = 0;
+    if (track_writes_ && !coherent) {
+        const uintptr_t inner_begin = (region.data_begin + page_size_ - 1) & ~(page_size_ - 1);
+        const uintptr_t inner_end = region.data_end & ~(page_size_ - 1);
+        if ((inner_begin < inner_end) &&
+            (mprotect(reinterpret_cast<void *>(inner_begin), inner_end - inner_begin, PROT_READ) == 0)) {
+            region.dirty_pages.reset(new std::atomic<bool>[(inner_end - inner_begin) / page_size_]());
+            region.pages_begin = inner_begin;
+            region.pages_end = inner_end;
+        }
+    }
+    region.active.store(true, std::memory_order_seq_cst);
+    regions_[mem] = index;
+}
+
+void MappedMemoryGuard::Unmap(VkDeviceMemory mem) {
+    std::lock_guard<std::mutex> lock(lock_);
+    auto it = regions_.find(mem);
+    if (it == regions_.end()) return;
+    ReleaseRegion(it->second);
+    regions_.erase(it);
+}
+
+void MappedMemoryGuard::Flush(VkDeviceMemory mem, VkDeviceSize offset, VkDeviceSize size) {
+    std::lock_guard<std::mutex> lock(lock_);
+    auto it = regions_.find(mem);
+    if (it == regions_.end()) return;
+    GuardedRegion &region = guarded_regions[it->second];
+    if (region.pages_begin == region.pages_end) return;
+
+    // Pages the flushed range only partly covers count as flushed
+    const uintptr_t range_begin = region.data_begin + static_cast<uintptr_t>(offset);
+    const uintptr_t range_end = (size == VK_WHOLE_SIZE) ? region.data_end : range_begin + static_cast<uintptr_t>(size);
+    const uintptr_t begin = std::min(std::max(range_begin, region.pages_begin), region.pages_end);
+    const uintptr_t end = std::min(std::max(range_end, begin), region.pages_end);
+    const uintptr_t first_page = (begin - region.pages_begin) / page_size_;
+    const uintptr_t last_page = (end - region.pages_begin + page_size_ - 1) / page_size_;
+    ProtectWrittenPages(region, first_page, last_page);
+}
+
+std::vector<VkDeviceMemory> MappedMemoryGuard::GetAccessedMemory() const {
+    std::lock_guard<std::mutex> lock(lock_);
+    std::vector<VkDeviceMemory> accessed_memory;
+    for (const auto &entry : regions_) {
+        const GuardedRegion &region = guarded_regions[entry.second];
+        if (region.out_of_bounds.load(std::memory_order_relaxed) || region.dirty_page_count.load(std::memory_order_relaxed)) {
+            accessed_memory.push_back(entry.first);
+        }
+    }
+    return accessed_memory;
+}
+
+bool MappedMemoryGuard::TakeOutOfBoundsAccess(VkDeviceMemory mem, int64_t *offset) {
+    std::lock_guard<std::mutex> lock(lock_);
+    auto it = regions_.find(mem);
+    if (it == regions_.end()) return false;
+    GuardedRegion &region = guarded_regions[it->second];
+    const uintptr_t address = region.out_of_bounds.exchange(0, std::memory_order_relaxed);
+    if (!address) return false;
+    *offset = static_cast<int64_t>(address - region.data_begin);
+    return true;
+}
+
+bool MappedMemoryGuard::TakeUnflushedWrite(VkDeviceMemory mem, VkDeviceSize *offset) {
+    std::lock_guard<std::mutex> lock(lock_);
+    auto it = regions_.find(mem);
+    if (it == regions_.end()) return false;
+    GuardedRegion &region = guarded_regions[it->second];
+    if (!region.dirty_page_count.load(std::memory_order_relaxed)) return false;
+
+    const uintptr_t page_count = (region.pages_end - region.pages_begin) / page_size_;
+    const uintptr_t page = ProtectWrittenPages(region, 0, page_count);
+    if (page == page_count) return false;
+    *offset = std::max(region.pages_begin + page * page_size_, region.data_begin) - region.data_begin;
+    return true;
+}
+
+#else
+
+std::unique_ptr<MappedMemoryGuard> MappedMemoryGuard::Create(bool track_writes) { return nullptr; }
+MappedMemoryGuard::~MappedMemoryGuard() {}
+void MappedMemoryGuard::Map(VkDeviceMemory mem, void *data, VkDeviceSize size, bool coherent) {}
+void MappedMemoryGuard::Unmap(VkDeviceMemory mem) {}
+void MappedMemoryGuard::Flush(VkDeviceMemory mem, VkDeviceSize offset, VkDeviceSize size) {}
+std::vector<VkDeviceMemory> MappedMemoryGuard::GetAccessedMemory() const { return std::vector<VkDeviceMemory>(); }
+bool MappedMemoryGuard::TakeOutOfBoundsAccess(VkDeviceMemory mem, int64_t *offset) { return false; }
+bool MappedMemoryGuard::TakeUnflushedWrite(VkDeviceMemory mem, VkDeviceSize *offset) { return false; }
+
+#endif  // defined(__linux__)
@@ -0,0 +1,65 @@
+/* Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "vulkan/vulkan.h"
+
+// Checks host accesses through vkMapMemory pointers with page protection, without copying the mapped data.
+//
+// The pages on either side of each mapping are reserved as inaccessible guard pages, when the addresses are free, so that an
+// access just outside of the mapping faults.  With write tracking, the pages wholly inside mappings of memory that isn't
+// HOST_COHERENT are also made read only; the first write to each page faults, marks the page as written and makes it
+// writable again, and vkFlushMappedMemoryRanges makes the flushed pages read only again.  A process-wide SIGSEGV handler
+// records the faults and passes any other fault on to the handler it replaced.
+//
+// Only page granularity is checked: accesses within the page holding either end of a mapping aren't seen unless the
+// mapping ends at a page boundary, and a partly flushed page counts as flushed.  Writes by the kernel, such as a read()
+// into the mapping, don't fault but fail with EFAULT on a read only page, which is why write tracking is a separate opt in
+// (VALIDATION_CHECK_ENABLE_MAPPED_MEMORY_WRITE_TRACKING).  Only supported on Linux; elsewhere Create returns null.
+class MappedMemoryGuard {
+  public:
+    static std::unique_ptr<MappedMemoryGuard> Create(bool track_writes);
+    ~MappedMemoryGuard();
+
+    void Map(VkDeviceMemory mem, void *data, VkDeviceSize size, bool coherent);
+    void Unmap(VkDeviceMemory mem);
+    void Flush(VkDeviceMemory mem, VkDeviceSize offset, VkDeviceSize size);
+
+    // Mapped memory with accesses to report, in no particular order
+    std::vector<VkDeviceMemory> GetAccessedMemory() const;
+    // Returns whether there was an access to a guard page of mem since the last call, and the offset of the first one from
+    // the start of the mapping.  The guard page stays accessible afterwards.
+    bool TakeOutOfBoundsAccess(VkDeviceMemory mem, int64_t *offset);
+    // Returns whether any page of mem was written since it was last flushed or reported, and the offset of the first such
+    // page from the start of the mapping.  The pages are made read only again.
+    bool TakeUnflushedWrite(VkDeviceMemory mem, VkDeviceSize *offset);
+
+  private:
+    MappedMemoryGuard(uintptr_t page_size, bool track_writes) : page_size_(page_size), track_writes_(track_writes) {}
+
+    const uintptr_t page_size_;
+    const bool track_writes_;
+    mutable std::mutex lock_;
+    std::unordered_map<VkDeviceMemory, uint32_t> regions_;  // Index into the process-wide table used by the fault handler
+};
@@ -1783,6 +1783,36 @@ bool update_range_value(Map &map, const Range &range, MapValue &&value, value_pr
     return updated;
 }
 
+// Merge runs of abutting entries holding equal values into single entries, returning the number of entries removed.
+// Repeated partial updates leave maps fragmented even when the values later converge (e.g. after a barrier), and this
+// compacts them back down.
+template <typename RangeMap>
+size_t consolidate(RangeMap &map) {
+    using Key = typename RangeMap::key_type;
+    using Value = typename RangeMap::value_type;
+    size_t removed = 0;
+    auto current = map.begin();
+    while (current != map.end()) {
+        auto next = current;
+        ++next;
+        auto run_end = current->first.end;
+        size_t run_length = 1;
+        while ((next != map.end()) && (next->first.begin == run_end) && (next->second == current->second)) {
+            run_end = next->first.end;
+            ++next;
+            ++run_length;
+        }
+        if (run_length > 1) {
+            Value merged(Key(current->first.begin, run_end), std::move(current->second));
+            auto hint = map.erase(current, next);
+            current = map.insert(hint, std::move(merged));
+            removed += run_length - 1;
+        }
+        ++current;
+    }
+    return removed;
+}
+
 }  // namespace sparse_container
 
 #endif
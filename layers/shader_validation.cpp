@@ -108,9 +108,33 @@ static shader_stage_attributes shader_stage_attribs[] = {
 unsigned ExecutionModelToShaderStageFlagBits(unsigned mode);
 
 // SPIRV utility functions
-void SHADER_MODULE_STATE::BuildDefIndex() {
+const uint32_t SpirvModuleData::kNoDecorations;
+
+void SpirvModuleData::SetDef(uint32_t id, uint32_t offset) {
+    if (id < def_index.size()) {
+        def_index[id] = offset;
+    } else {
+        sparse_def_index[id] = offset;
+    }
+}
+
+decoration_set &SpirvModuleData::GetDecorationsForUpdate(uint32_t id) {
+    uint32_t &index = (id < decoration_index.size()) ? decoration_index[id]
+                                                     : sparse_decoration_index.emplace(id, kNoDecorations).first->second;
+    if (index == kNoDecorations) {
+        index = static_cast<uint32_t>(decorations.size());
+        decorations.emplace_back();
+    }
+    return decorations[index];
+}
+
+void SpirvModuleData::BuildDefIndex() {
     function_set func_set = {};
     EntryPoint *entry_point = nullptr;
+    const uint32_t id_bound = (words.size() > 3) ? words[3] : 0;
+    const size_t dense_ids = std::min<size_t>(id_bound, words.size());
+    def_index.assign(dense_ids, 0);
+    decoration_index.assign(dense_ids, kNoDecorations);
 
     for (auto insn : *this) {
         // offset is not 0, it means it's updated and the offset is in a Function.
@@ -144,7 +168,7 @@ void SHADER_MODULE_STATE::BuildDefIndex() {
             case spv::OpTypePipe:
             case spv::OpTypeAccelerationStructureNV:
             case spv::OpTypeCooperativeMatrixNV:
-                def_index[insn.word(1)] = insn.offset();
+                SetDef(insn.word(1), insn.offset());
                 break;
 
                 // Fixed constants
@@ -154,7 +178,7 @@ void SHADER_MODULE_STATE::BuildDefIndex() {
             case spv::OpConstantComposite:
             case spv::OpConstantSampler:
             case spv::OpConstantNull:
-                def_index[insn.word(2)] = insn.offset();
+                SetDef(insn.word(2), insn.offset());
                 break;
 
                 // Specialization constants
@@ -163,17 +187,17 @@ void SHADER_MODULE_STATE::BuildDefIndex() {
             case spv::OpSpecConstant:
             case spv::OpSpecConstantComposite:
             case spv::OpSpecConstantOp:
-                def_index[insn.word(2)] = insn.offset();
+                SetDef(insn.word(2), insn.offset());
                 break;
 
                 // Variables
             case spv::OpVariable:
-                def_index[insn.word(2)] = insn.offset();
+                SetDef(insn.word(2), insn.offset());
                 break;
 
                 // Functions
             case spv::OpFunction:
-                def_index[insn.word(2)] = insn.offset();
+                SetDef(insn.word(2), insn.offset());
                 func_set.id = insn.word(2);
                 func_set.offset = insn.offset();
                 func_set.op_lists.clear();
@@ -182,11 +206,12 @@ void SHADER_MODULE_STATE::BuildDefIndex() {
                 // Decorations
             case spv::OpDecorate: {
                 auto target_id = insn.word(1);
-                decorations[target_id].add(insn.word(2), insn.len() > 3u ? insn.word(3) : 0u);
+                GetDecorationsForUpdate(target_id).add(insn.word(2), insn.len() > 3u ? insn.word(3) : 0u);
             } break;
             case spv::OpGroupDecorate: {
-                auto const &src = decorations[insn.word(1)];
-                for (auto i = 2u; i < insn.len(); i++) decorations[insn.word(i)].merge(src);
+                // Copied, as adding decorations for the targets can reallocate the packed table
+                const auto src = GetDecorationsForUpdate(insn.word(1));
+                for (auto i = 2u; i < insn.len(); i++) GetDecorationsForUpdate(insn.word(i)).merge(src);
             } break;
 
                 // Entry points ... add to the entrypoint table
@@ -222,6 +247,24 @@ void SHADER_MODULE_STATE::BuildDefIndex() {
     }
 }
 
+std::shared_ptr<const ShaderEntryPointAnalysis> SHADER_MODULE_STATE::GetEntryPointAnalysis(spirv_inst_iter entrypoint) const {
+    const uint32_t key = entrypoint.offset();
+    {
+        std::lock_guard<std::mutex> guard(spirv->entry_point_analysis_lock);
+        const auto found = spirv->entry_point_analyses.find(key);
+        if (found != spirv->entry_point_analyses.cend()) return found->second;
+    }
+
+    // Analyze outside the lock, if another thread raced us here the first result inserted wins
+    auto analysis = std::make_shared<ShaderEntryPointAnalysis>();
+    analysis->accessible_ids = MarkAccessibleIds(this, entrypoint);
+    analysis->descriptor_uses = CollectInterfaceByDescriptorSlot(this, analysis->accessible_ids, &analysis->has_writable_descriptor,
+                                                                 &analysis->has_atomic_descriptor);
+
+    std::lock_guard<std::mutex> guard(spirv->entry_point_analysis_lock);
+    return spirv->entry_point_analyses.emplace(key, std::move(analysis)).first->second;
+}
+
 unsigned ExecutionModelToShaderStageFlagBits(unsigned mode) {
     switch (mode) {
         case spv::ExecutionModelVertex:
@@ -845,7 +888,7 @@ static std::vector<uint32_t> CollectBuiltinBlockMembers(SHADER_MODULE_STATE cons
 }
 
 static std::vector<std::pair<uint32_t, interface_var>> CollectInterfaceByInputAttachmentIndex(
-    SHADER_MODULE_STATE const *src, std::unordered_set<uint32_t> const &accessible_ids) {
+    SHADER_MODULE_STATE const *src, SpirvIdSet const &accessible_ids) {
     std::vector<std::pair<uint32_t, interface_var>> out;
 
     for (auto insn : *src) {
@@ -1223,8 +1266,7 @@ static void IsSpecificDescriptorType(SHADER_MODULE_STATE const *module, const sp
 }
 
 std::vector<std::pair<descriptor_slot_t, interface_var>> CollectInterfaceByDescriptorSlot(
-    SHADER_MODULE_STATE const *src, std::unordered_set<uint32_t> const &accessible_ids, bool *has_writable_descriptor,
-    bool *has_atomic_descriptor) {
+    SHADER_MODULE_STATE const *src, SpirvIdSet const &accessible_ids, bool *has_writable_descriptor, bool *has_atomic_descriptor) {
     std::vector<std::pair<descriptor_slot_t, interface_var>> out;
     shader_module_used_operators operators;
 
@@ -1423,8 +1465,9 @@ void SetUsedStructMember(const SHADER_MODULE_STATE &src, const uint32_t variable
     }
 }
 
-void SetPushConstantUsedInShader(SHADER_MODULE_STATE &src) {
-    for (auto &entrypoint : src.entry_points) {
+// Fills in the push constant use of each entry point of spirv, while it is still being built. src is a module over spirv.
+static void SetPushConstantUsedInShader(const SHADER_MODULE_STATE &src, SpirvModuleData *spirv) {
+    for (auto &entrypoint : spirv->entry_points) {
         auto range = entrypoint.second.decorate_list.equal_range(spv::OpVariable);
         for (auto it = range.first; it != range.second; ++it) {
             const auto def_insn = src.at(it->second);
@@ -1449,6 +1492,16 @@ void SetPushConstantUsedInShader(SHADER_MODULE_STATE &src) {
     }
 }
 
+std::shared_ptr<const SpirvModuleData> SHADER_MODULE_STATE::ParseSpirv(VkShaderModuleCreateInfo const *pCreateInfo,
+                                                                      spv_target_env env) {
+    auto spirv = std::make_shared<SpirvModuleData>();
+    spirv->code_hash = ValidationCache::MakeShaderHash(pCreateInfo);
+    spirv->words = spirv->PreprocessShaderBinary(pCreateInfo->pCode, pCreateInfo->codeSize, env);
+    spirv->BuildDefIndex();
+    SetPushConstantUsedInShader(SHADER_MODULE_STATE(spirv, VK_NULL_HANDLE, UINT32_MAX), spirv.get());
+    return spirv;
+}
+
 std::unordered_set<uint32_t> CollectWritableOutputLocationinFS(const SHADER_MODULE_STATE &module,
                                                                const VkPipelineShaderStageCreateInfo &stage_info) {
     std::unordered_set<uint32_t> location_list;
@@ -1744,8 +1797,9 @@ static bool IsBuiltInWritten(SHADER_MODULE_STATE const *src, spirv_inst_iter bui
 //
 // TODO: The set of interesting opcodes here was determined by eyeballing the SPIRV spec. It might be worth
 // converting parts of this to be generated from the machine-readable spec instead.
-std::unordered_set<uint32_t> MarkAccessibleIds(SHADER_MODULE_STATE const *src, spirv_inst_iter entrypoint) {
-    std::unordered_set<uint32_t> ids;
+SpirvIdSet MarkAccessibleIds(SHADER_MODULE_STATE const *src, spirv_inst_iter entrypoint) {
+    // Sized like BuildDefIndex, as a bogus id bound mustn't allocate more than the module could hold; insert grows the set
+    SpirvIdSet ids(static_cast<uint32_t>(std::min<size_t>(src->id_bound(), src->words.size())));
     std::unordered_set<uint32_t> worklist;
     worklist.insert(entrypoint.word(2));
 
@@ -1762,7 +1816,7 @@ std::unordered_set<uint32_t> MarkAccessibleIds(SHADER_MODULE_STATE const *src, s
         }
 
         // Try to add to the output set
-        if (!ids.insert(id).second) {
+        if (!ids.insert(id)) {
             continue;  // If we already saw this id, we don't want to walk it again.
         }
 
@@ -1935,7 +1989,7 @@ bool CoreChecks::ValidatePushConstantUsage(const PIPELINE_STATE &pipeline, SHADE
     return skip;
 }
 
-bool CoreChecks::ValidateBuiltinLimits(SHADER_MODULE_STATE const *src, const std::unordered_set<uint32_t> &accessible_ids,
+bool CoreChecks::ValidateBuiltinLimits(SHADER_MODULE_STATE const *src, const SpirvIdSet &accessible_ids,
                                        VkShaderStageFlagBits stage) const {
     bool skip = false;
 
@@ -3465,16 +3519,16 @@ bool CoreChecks::ValidatePipelineShaderStage(VkPipelineShaderStageCreateInfo con
     if (skip) return true;  // no point continuing beyond here, any analysis is just going to be garbage.
 
     // Mark accessible ids
-    auto &accessible_ids = stage_state.accessible_ids;
+    const auto &entry_point_analysis = *stage_state.entry_point_analysis;
+    auto &accessible_ids = entry_point_analysis.accessible_ids;
 
     // Validate descriptor set layout against what the entrypoint actually uses
-    bool has_writable_descriptor = stage_state.has_writable_descriptor;
-    auto &descriptor_uses = stage_state.descriptor_uses;
+    auto &descriptor_uses = entry_point_analysis.descriptor_uses;
 
     // Validate shader capabilities against enabled device features
     skip |= ValidateShaderCapabilitiesAndExtensions(module);
-    skip |=
-        ValidateShaderStageWritableOrAtomicDescriptor(pStage->stage, has_writable_descriptor, stage_state.has_atomic_descriptor);
+    skip |= ValidateShaderStageWritableOrAtomicDescriptor(pStage->stage, entry_point_analysis.has_writable_descriptor,
+                                                          entry_point_analysis.has_atomic_descriptor);
     skip |= ValidateShaderStageInputOutputLimits(module, pStage, pipeline, entrypoint);
     skip |= ValidateShaderStageMaxResources(pStage->stage, pipeline);
     skip |= ValidateShaderStageGroupNonUniform(module, pStage->stage);
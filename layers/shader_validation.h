@@ -23,6 +23,8 @@
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -184,13 +186,9 @@ struct shader_struct_member {
     std::vector<uint8_t> used_bytes;  // This only works for root. 0: not used. 1: used. The totally array * size.
 };
 
-struct SHADER_MODULE_STATE : public BASE_NODE {
-    // The spirv image itself
-    std::vector<uint32_t> words;
-    // A mapping of <id> to the first word of its def. this is useful because walking type
-    // trees, constant expressions, etc requires jumping all over the instruction stream.
-    std::unordered_map<unsigned, unsigned> def_index;
-    std::unordered_map<unsigned, decoration_set> decorations;
+// The parsed SPIR-V of a shader module. It depends only on the code, so once built it is immutable and shared by every
+// shader module created from identical code (see ValidationStateTracker::GetSharedShaderModuleSpirv).
+struct SpirvModuleData {
     struct EntryPoint {
         uint32_t offset;
         VkShaderStageFlagBits stage;
@@ -198,13 +196,32 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
         std::vector<function_set> function_set_list;
         shader_struct_member push_constant_used_in_shader;
     };
+
+    // The spirv image itself
+    std::vector<uint32_t> words;
+    // A mapping of <id> to the first word of its def. this is useful because walking type
+    // trees, constant expressions, etc requires jumping all over the instruction stream.
+    // Ids are dense below the module's bound, so this is indexed by id, with 0 (the header) for ids without a def. The dense
+    // index is limited to the size of the module, ids past that (sparsely numbered or corrupt modules) go to the sparse index.
+    std::vector<uint32_t> def_index;
+    std::unordered_map<uint32_t, uint32_t> sparse_def_index;
+    // The decoration sets of the decorated ids, packed, and the index of each id's set (kNoDecorations if it has none)
+    static const uint32_t kNoDecorations = UINT32_MAX;
+    std::vector<decoration_set> decorations;
+    std::vector<uint32_t> decoration_index;
+    std::unordered_map<uint32_t, uint32_t> sparse_decoration_index;
     std::unordered_multimap<std::string, EntryPoint> entry_points;
-    bool has_valid_spirv;
     bool has_specialization_constants{false};
-    VkShaderModule vk_shader_module;
-    uint32_t gpu_validation_shader_id;
+    // Hash of the code the module was created from, for the device's table of shared module data
+    uint32_t code_hash{0};
+    // Entry point analyses shared between pipelines, keyed by the offset of the OpEntryPoint instruction
+    mutable std::mutex entry_point_analysis_lock;
+    mutable std::unordered_map<uint32_t, std::shared_ptr<const ShaderEntryPointAnalysis>> entry_point_analyses;
+
+    SpirvModuleData() {}
+    explicit SpirvModuleData(const std::vector<uint32_t> &code) : words(code) {}
 
-    std::vector<uint32_t> PreprocessShaderBinary(uint32_t *src_binary, size_t binary_size, spv_target_env env) {
+    std::vector<uint32_t> PreprocessShaderBinary(const uint32_t *src_binary, size_t binary_size, spv_target_env env) {
         std::vector<uint32_t> src(src_binary, src_binary + binary_size / sizeof(uint32_t));
 
         // Check if there are any group decoration instructions, and flatten them if found.
@@ -255,22 +272,6 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
         return src;
     }
 
-    SHADER_MODULE_STATE(VkShaderModuleCreateInfo const *pCreateInfo, VkShaderModule shaderModule, spv_target_env env,
-                        uint32_t unique_shader_id)
-        : words(), def_index(), has_valid_spirv(true), vk_shader_module(shaderModule), gpu_validation_shader_id(unique_shader_id) {
-        words = PreprocessShaderBinary((uint32_t *)pCreateInfo->pCode, pCreateInfo->codeSize, env);
-        BuildDefIndex();
-    }
-
-    SHADER_MODULE_STATE() : has_valid_spirv(false), vk_shader_module(VK_NULL_HANDLE), gpu_validation_shader_id(UINT32_MAX) {}
-
-    decoration_set get_decorations(unsigned id) const {
-        // return the actual decorations for this id, or a default set.
-        auto it = decorations.find(id);
-        if (it != decorations.end()) return it->second;
-        return decoration_set();
-    }
-
     // Expose begin() / end() to enable range-based for
     spirv_inst_iter begin() const { return spirv_inst_iter(words.begin(), words.begin() + 5); }  // First insn
     spirv_inst_iter end() const { return spirv_inst_iter(words.begin(), words.end()); }          // Just past last insn
@@ -279,14 +280,78 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
 
     // Gets an iterator to the definition of an id
     spirv_inst_iter get_def(unsigned id) const {
-        auto it = def_index.find(id);
-        if (it == def_index.end()) {
-            return end();
-        }
-        return at(it->second);
+        const uint32_t offset = (id < def_index.size()) ? def_index[id] : FindSparse(sparse_def_index, id, 0);
+        return offset ? at(offset) : end();
+    }
+
+    decoration_set get_decorations(unsigned id) const {
+        // return the actual decorations for this id, or a default set.
+        const uint32_t index =
+            (id < decoration_index.size()) ? decoration_index[id] : FindSparse(sparse_decoration_index, id, kNoDecorations);
+        return (index != kNoDecorations) ? decorations[index] : decoration_set();
     }
 
     void BuildDefIndex();
+
+  private:
+    static uint32_t FindSparse(const std::unordered_map<uint32_t, uint32_t> &sparse_index, uint32_t id, uint32_t not_found) {
+        const auto it = sparse_index.find(id);
+        return (it != sparse_index.cend()) ? it->second : not_found;
+    }
+    void SetDef(uint32_t id, uint32_t offset);
+    decoration_set &GetDecorationsForUpdate(uint32_t id);
+};
+
+struct SHADER_MODULE_STATE : public BASE_NODE {
+    using EntryPoint = SpirvModuleData::EntryPoint;
+
+    std::shared_ptr<const SpirvModuleData> spirv;
+    // The members of the shared module data, named as they are used throughout shader validation
+    const std::vector<uint32_t> &words;
+    const std::unordered_multimap<std::string, EntryPoint> &entry_points;
+    const bool &has_specialization_constants;
+    bool has_valid_spirv;
+    VkShaderModule vk_shader_module;
+    uint32_t gpu_validation_shader_id;
+
+    // Parse the code of a new module (and compute everything derived from the code alone)
+    static std::shared_ptr<const SpirvModuleData> ParseSpirv(VkShaderModuleCreateInfo const *pCreateInfo, spv_target_env env);
+
+    SHADER_MODULE_STATE(std::shared_ptr<const SpirvModuleData> spirv_data, VkShaderModule shaderModule, uint32_t unique_shader_id)
+        : SHADER_MODULE_STATE(std::move(spirv_data), true, shaderModule, unique_shader_id) {}
+
+    SHADER_MODULE_STATE() : SHADER_MODULE_STATE(std::make_shared<const SpirvModuleData>(), false, VK_NULL_HANDLE, UINT32_MAX) {}
+
+    // A module over the given code, for walking its instructions only
+    explicit SHADER_MODULE_STATE(const std::vector<uint32_t> &code)
+        : SHADER_MODULE_STATE(std::make_shared<const SpirvModuleData>(code), false, VK_NULL_HANDLE, UINT32_MAX) {}
+
+    decoration_set get_decorations(unsigned id) const { return spirv->get_decorations(id); }
+
+    // Expose begin() / end() to enable range-based for
+    spirv_inst_iter begin() const { return spirv->begin(); }  // First insn
+    spirv_inst_iter end() const { return spirv->end(); }      // Just past last insn
+    // Given an offset into the module, produce an iterator there.
+    spirv_inst_iter at(unsigned offset) const { return spirv->at(offset); }
+
+    // Gets an iterator to the definition of an id
+    spirv_inst_iter get_def(unsigned id) const { return spirv->get_def(id); }
+
+    // The SPIR-V header's bound on the ids used in the module
+    uint32_t id_bound() const { return (words.size() > 3) ? words[3] : 0; }
+
+    std::shared_ptr<const ShaderEntryPointAnalysis> GetEntryPointAnalysis(spirv_inst_iter entrypoint) const;
+
+  private:
+    SHADER_MODULE_STATE(std::shared_ptr<const SpirvModuleData> &&spirv_data, bool valid_spirv, VkShaderModule shaderModule,
+                        uint32_t unique_shader_id)
+        : spirv(std::move(spirv_data)),
+          words(spirv->words),
+          entry_points(spirv->entry_points),
+          has_specialization_constants(spirv->has_specialization_constants),
+          has_valid_spirv(valid_spirv),
+          vk_shader_module(shaderModule),
+          gpu_validation_shader_id(unique_shader_id) {}
 };
 
 class ValidationCache {
@@ -395,7 +460,7 @@ spirv_inst_iter FindEntrypoint(SHADER_MODULE_STATE const *src, char const *name,
 //
 // TODO: The set of interesting opcodes here was determined by eyeballing the SPIRV spec. It might be worth
 // converting parts of this to be generated from the machine-readable spec instead.
-std::unordered_set<uint32_t> MarkAccessibleIds(SHADER_MODULE_STATE const *src, spirv_inst_iter entrypoint);
+SpirvIdSet MarkAccessibleIds(SHADER_MODULE_STATE const *src, spirv_inst_iter entrypoint);
 
 // Returns an int32_t corresponding to the spv::Dim of the given resource, when positive, and corresponding to an unknown type, when
 // negative.
@@ -406,10 +471,7 @@ bool FindLocalSize(SHADER_MODULE_STATE const *src, uint32_t &local_size_x, uint3
 void ProcessExecutionModes(SHADER_MODULE_STATE const *src, const spirv_inst_iter &entrypoint, PIPELINE_STATE *pipeline);
 
 std::vector<std::pair<descriptor_slot_t, interface_var>> CollectInterfaceByDescriptorSlot(
-    SHADER_MODULE_STATE const *src, std::unordered_set<uint32_t> const &accessible_ids, bool *has_writable_descriptor,
-    bool *has_atomic_descriptor);
-
-void SetPushConstantUsedInShader(SHADER_MODULE_STATE &src);
+    SHADER_MODULE_STATE const *src, SpirvIdSet const &accessible_ids, bool *has_writable_descriptor, bool *has_atomic_descriptor);
 
 std::unordered_set<uint32_t> CollectWritableOutputLocationinFS(const SHADER_MODULE_STATE &module,
                                                                const VkPipelineShaderStageCreateInfo &stage_info);
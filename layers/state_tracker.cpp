@@ -473,6 +473,7 @@ void ValidationStateTracker::PreCallRecordDestroyImage(VkDevice device, VkImage
     if (!image) return;
     IMAGE_STATE *image_state = GetImageState(image);
     const VulkanTypedHandle obj_struct(image, kVulkanObjectTypeImage);
+    InvalidateDescriptorCommandBuffers(image_state, obj_struct);
     InvalidateCommandBuffers(image_state->cb_bindings, obj_struct);
     // Clean up memory mapping, bindings and range references for image
     for (auto mem_binding : image_state->GetBoundMemory()) {
@@ -705,6 +706,7 @@ void ValidationStateTracker::PreCallRecordDestroyImageView(VkDevice device, VkIm
     const VulkanTypedHandle obj_struct(imageView, kVulkanObjectTypeImageView);
 
     // Any bound cmd buffers are now invalid
+    InvalidateDescriptorCommandBuffers(image_view_state, obj_struct);
     InvalidateCommandBuffers(image_view_state->cb_bindings, obj_struct);
     image_view_state->destroyed = true;
     imageViewMap.erase(imageView);
@@ -715,6 +717,7 @@ void ValidationStateTracker::PreCallRecordDestroyBuffer(VkDevice device, VkBuffe
     auto buffer_state = GetBufferState(buffer);
     const VulkanTypedHandle obj_struct(buffer, kVulkanObjectTypeBuffer);
 
+    InvalidateDescriptorCommandBuffers(buffer_state, obj_struct);
     InvalidateCommandBuffers(buffer_state->cb_bindings, obj_struct);
     for (auto mem_binding : buffer_state->GetBoundMemory()) {
         RemoveBufferMemoryRange(buffer, mem_binding);
@@ -731,6 +734,7 @@ void ValidationStateTracker::PreCallRecordDestroyBufferView(VkDevice device, VkB
     const VulkanTypedHandle obj_struct(bufferView, kVulkanObjectTypeBufferView);
 
     // Any bound cmd buffers are now invalid
+    InvalidateDescriptorCommandBuffers(buffer_view_state, obj_struct);
     InvalidateCommandBuffers(buffer_view_state->cb_bindings, obj_struct);
     buffer_view_state->destroyed = true;
     bufferViewMap.erase(bufferView);
@@ -811,31 +815,32 @@ const IMAGE_VIEW_STATE *ValidationStateTracker::GetActiveAttachmentImageViewStat
 }
 
 void ValidationStateTracker::AddAliasingImage(IMAGE_STATE *image_state) {
-    std::unordered_set<VkImage> *bound_images = nullptr;
+    auto add_aliasing_image = [this, image_state](VkImage handle) {
+        if (handle != image_state->image) {
+            auto is = GetImageState(handle);
+            if (is && is->IsCompatibleAliasing(image_state)) {
+                auto inserted = is->aliasing_images.emplace(image_state->image);
+                if (inserted.second) {
+                    image_state->aliasing_images.emplace(handle);
+                }
+            }
+        }
+    };
 
     if (image_state->bind_swapchain) {
         auto swapchain_state = GetSwapchainState(image_state->bind_swapchain);
         if (swapchain_state) {
-            bound_images = &swapchain_state->images[image_state->bind_swapchain_imageIndex].bound_images;
-        }
-    } else {
-        if (image_state->binding.mem_state) {
-            bound_images = &image_state->binding.mem_state->bound_images;
-        }
-    }
-
-    if (bound_images) {
-        for (const auto &handle : *bound_images) {
-            if (handle != image_state->image) {
-                auto is = GetImageState(handle);
-                if (is && is->IsCompatibleAliasing(image_state)) {
-                    auto inserted = is->aliasing_images.emplace(image_state->image);
-                    if (inserted.second) {
-                        image_state->aliasing_images.emplace(handle);
-                    }
-                }
+            for (const auto &handle : swapchain_state->images[image_state->bind_swapchain_imageIndex].bound_images) {
+                add_aliasing_image(handle);
             }
         }
+    } else if (image_state->binding.mem_state) {
+        // Compatible aliases are bound at the same offset, so only the bindings over that offset need be checked
+        const VkDeviceSize offset = image_state->binding.offset;
+        image_state->binding.mem_state->bound_ranges.ForEachBinding(
+            BoundMemoryRangeMap::RangeKey(offset, offset + 1), [&add_aliasing_image](const BoundMemoryRangeMap::Binding &binding) {
+                if (binding.handle.type == kVulkanObjectTypeImage) add_aliasing_image(binding.handle.Cast<VkImage>());
+            });
     }
 }
 
@@ -1185,11 +1190,16 @@ void ValidationStateTracker::UpdateDrawState(CMD_BUFFER_STATE *cb_state, CMD_TYP
     const auto lv_bind_point = ConvertToLvlBindPoint(bind_point);
     auto &state = cb_state->lastBound[lv_bind_point];
     PIPELINE_STATE *pipe = state.pipeline_state;
+    // Draws are recorded without core validation in the command buffers that validation sampling doesn't select, so don't
+    // count on a pipeline and its descriptor sets being bound
+    if (!pipe) return;
     if (VK_NULL_HANDLE != state.pipeline_layout) {
         for (const auto &set_binding_pair : pipe->active_slots) {
             uint32_t set_index = set_binding_pair.first;
+            if (set_index >= state.per_set.size()) continue;
             // Pull the set node
             cvdescriptorset::DescriptorSet *descriptor_set = state.per_set[set_index].bound_descriptor_set;
+            if (!descriptor_set) continue;
 
             // For the "bindless" style resource usage with many descriptors, need to optimize command <-> descriptor binding
 
@@ -1256,8 +1266,16 @@ void ValidationStateTracker::UpdateDrawState(CMD_BUFFER_STATE *cb_state, CMD_TYP
 void ValidationStateTracker::FreeDescriptorSet(cvdescriptorset::DescriptorSet *descriptor_set) {
     descriptor_set->destroyed = true;
     const VulkanTypedHandle obj_struct(descriptor_set->GetSet(), kVulkanObjectTypeDescriptorSet);
-    // Any bound cmd buffers are now invalid
+    // Any bound cmd buffers are now invalid, and no longer reach resources through the set
+    const auto set_command_buffers = descriptor_set_command_buffers.find(descriptor_set);
+    if (set_command_buffers != descriptor_set_command_buffers.end()) {
+        for (auto cb_node : set_command_buffers->second) {
+            cb_node->descriptor_set_bindings.erase(descriptor_set);
+        }
+        descriptor_set_command_buffers.erase(set_command_buffers);
+    }
     InvalidateCommandBuffers(descriptor_set->cb_bindings, obj_struct);
+    descriptor_set->UpdateResourceReferences(this, false);
 
     setMap.erase(descriptor_set->GetSet());
 }
@@ -1271,6 +1289,7 @@ void ValidationStateTracker::DeleteDescriptorSetPools() {
             FreeDescriptorSet(ds);
         }
         ii->second->sets.clear();
+        DropJournaledCommandBufferBindings(ii->second->cb_bindings);
         ii = descriptorPoolMap.erase(ii);
     }
 }
@@ -1409,6 +1428,17 @@ bool ValidationStateTracker::AddCommandBufferBinding(small_unordered_map<CMD_BUF
     if (disabled[command_buffer_state]) {
         return false;
     }
+    // While recording, the cb_binding goes into the command buffer's own journal until vkEndCommandBuffer
+    if (cb_node->journal_cb_bindings) {
+        auto pending = cb_node->pending_cb_bindings.insert({&cb_bindings, -1});
+        if (pending.second) {
+            cb_node->object_bindings.push_back(obj);
+            pending.first->second = static_cast<int>(cb_node->object_bindings.size()) - 1;
+            journaled_cb_bindings[&cb_bindings].insert(cb_node);
+            return true;
+        }
+        return false;
+    }
     // Insert the cb_binding with a default 'index' of -1. Then push the obj into the object_bindings
     // vector, and update cb_bindings[cb_node] with the index of that element of the vector.
     auto inserted = cb_bindings.insert({cb_node, -1});
@@ -1494,6 +1524,14 @@ void ValidationStateTracker::ResetCommandBufferState(const VkCommandBuffer cb) {
             RemoveCommandBufferBinding(obj, cb_state);
         }
         cb_state->object_bindings.clear();
+        ClearJournaledCommandBufferBindings(cb_state);
+        for (const auto &used_bindings : cb_state->descriptor_set_bindings) {
+            auto set_command_buffers = descriptor_set_command_buffers.find(used_bindings.first);
+            if (set_command_buffers == descriptor_set_command_buffers.end()) continue;
+            set_command_buffers->second.erase(cb_state);
+            if (set_command_buffers->second.empty()) descriptor_set_command_buffers.erase(set_command_buffers);
+        }
+        cb_state->descriptor_set_bindings.clear();
         // Remove this cmdBuffer's reference from each FrameBuffer's CB ref list
         for (auto framebuffer : cb_state->framebuffers) {
             framebuffer->cb_bindings.erase(cb_state);
@@ -2462,8 +2500,17 @@ void ValidationStateTracker::PreCallRecordFreeMemory(VkDevice device, VkDeviceMe
         }
     }
     // Any bound cmd buffers are now invalid
+    InvalidateDescriptorCommandBuffers(mem_info, obj_struct);
     InvalidateCommandBuffers(mem_info->cb_bindings, obj_struct);
-    RemoveAliasingImages(mem_info->bound_images);
+    // This is a one way clear, as in RemoveAliasingImages
+    mem_info->bound_ranges.ForEachBinding([this](const BoundMemoryRangeMap::Binding &binding) {
+        if (binding.handle.type == kVulkanObjectTypeImage) {
+            auto is = GetImageState(binding.handle.Cast<VkImage>());
+            if (is) {
+                is->aliasing_images.clear();
+            }
+        }
+    });
     mem_info->destroyed = true;
     fake_memory.Free(mem_info->fake_base_address);
     memObjMap.erase(mem);
@@ -2777,49 +2824,118 @@ void ValidationStateTracker::PreCallRecordDestroyQueryPool(VkDevice device, VkQu
     queryPoolMap.erase(queryPool);
 }
 
+void BoundMemoryRangeMap::Insert(const VulkanTypedHandle &handle, const RangeKey &range) {
+    if (!range.non_empty()) return;
+    ranges_by_handle_[handle].emplace_back(range);
+
+    const Binding binding = {handle, range};
+    auto pos = segments_.lower_bound(range);
+    VkDeviceSize current = range.begin;
+    while (current < range.end) {
+        if ((pos == segments_.end()) || (pos->first.begin >= range.end)) {
+            // Nothing else is bound over the rest of the range
+            Segment segment;
+            segment.emplace_back(binding);
+            segments_.insert(std::make_pair(RangeKey(current, range.end), std::move(segment)));
+            break;
+        }
+        if (pos->first.begin > current) {
+            // Fill the gap before the next segment, and come back to pos
+            Segment segment;
+            segment.emplace_back(binding);
+            segments_.insert(std::make_pair(RangeKey(current, pos->first.begin), std::move(segment)));
+            current = pos->first.begin;
+            continue;
+        }
+        // Trim the segment to the range and add the binding to it
+        pos = sparse_container::split(pos, segments_, RangeKey(current, range.end));
+        pos->second.emplace_back(binding);
+        current = pos->first.end;
+        ++pos;
+    }
+}
+
+void BoundMemoryRangeMap::Erase(const VulkanTypedHandle &handle) {
+    auto found = ranges_by_handle_.find(handle);
+    if (found == ranges_by_handle_.end()) return;
+
+    for (const auto &range : found->second) {
+        const Binding binding = {handle, range};
+        auto pos = segments_.lower_bound(range);
+        while ((pos != segments_.end()) && (pos->first.begin < range.end)) {
+            auto &bindings = pos->second;
+            for (uint32_t i = 0; i < bindings.size(); ++i) {
+                if (bindings[i] == binding) {
+                    bindings[i] = bindings.back();
+                    bindings.pop_back();
+                    break;
+                }
+            }
+            if (bindings.empty()) {
+                pos = segments_.erase(pos);
+            } else {
+                ++pos;
+            }
+        }
+        // The segment boundaries that this binding added may no longer be needed
+        MergeSegmentsAt(range.begin);
+        MergeSegmentsAt(range.end);
+    }
+    ranges_by_handle_.erase(found);
+}
+
+void BoundMemoryRangeMap::MergeSegmentsAt(VkDeviceSize offset) {
+    if (offset == 0) return;
+    auto upper = segments_.find(offset);
+    if ((upper == segments_.end()) || (upper->first.begin != offset)) return;
+    auto lower = segments_.find(offset - 1);
+    if ((lower == segments_.end()) || (lower->first.end != offset)) return;
+
+    const auto &lower_bindings = lower->second;
+    const auto &upper_bindings = upper->second;
+    if (lower_bindings.size() != upper_bindings.size()) return;
+    for (const auto &binding : lower_bindings) {
+        if (std::find(upper_bindings.begin(), upper_bindings.end(), binding) == upper_bindings.end()) return;
+    }
+
+    const RangeKey merged_range(lower->first.begin, upper->first.end);
+    Segment merged_bindings(std::move(upper->second));
+    segments_.erase(lower);
+    segments_.erase(segments_.find(offset));
+    segments_.insert(std::make_pair(merged_range, std::move(merged_bindings)));
+}
+
 // Object with given handle is being bound to memory w/ given mem_info struct.
-//  Track the newly bound memory range with given memoryOffset
-//  Also scan any previous ranges, track aliased ranges with new range, and flag an error if a linear
-//  and non-linear range incorrectly overlap.
+//  Track the newly bound memory range with given memoryOffset and size.  A size of zero, for a resource whose requirements
+//  are unknown, is tracked as one byte.
 void ValidationStateTracker::InsertMemoryRange(const VulkanTypedHandle &typed_handle, DEVICE_MEMORY_STATE *mem_info,
-                                               VkDeviceSize memoryOffset) {
-    if (typed_handle.type == kVulkanObjectTypeImage) {
-        mem_info->bound_images.insert(typed_handle.Cast<VkImage>());
-    } else if (typed_handle.type == kVulkanObjectTypeBuffer) {
-        mem_info->bound_buffers.insert(typed_handle.Cast<VkBuffer>());
-    } else if (typed_handle.type == kVulkanObjectTypeAccelerationStructureNV) {
-        mem_info->bound_acceleration_structures.insert(typed_handle.Cast<VkAccelerationStructureNV>());
-    } else {
-        // Unsupported object type
-        assert(false);
-    }
+                                               VkDeviceSize memoryOffset, VkDeviceSize size) {
+    assert((typed_handle.type == kVulkanObjectTypeImage) || (typed_handle.type == kVulkanObjectTypeBuffer) ||
+           (typed_handle.type == kVulkanObjectTypeAccelerationStructureNV));
+    const VkDeviceSize end = (size > std::numeric_limits<VkDeviceSize>::max() - memoryOffset)
+                                 ? std::numeric_limits<VkDeviceSize>::max()
+                                 : memoryOffset + std::max<VkDeviceSize>(size, 1);
+    mem_info->bound_ranges.Insert(typed_handle, BoundMemoryRangeMap::RangeKey(memoryOffset, end));
 }
 
-void ValidationStateTracker::InsertImageMemoryRange(VkImage image, DEVICE_MEMORY_STATE *mem_info, VkDeviceSize mem_offset) {
-    InsertMemoryRange(VulkanTypedHandle(image, kVulkanObjectTypeImage), mem_info, mem_offset);
+void ValidationStateTracker::InsertImageMemoryRange(VkImage image, DEVICE_MEMORY_STATE *mem_info, VkDeviceSize mem_offset,
+                                                    VkDeviceSize size) {
+    InsertMemoryRange(VulkanTypedHandle(image, kVulkanObjectTypeImage), mem_info, mem_offset, size);
 }
 
-void ValidationStateTracker::InsertBufferMemoryRange(VkBuffer buffer, DEVICE_MEMORY_STATE *mem_info, VkDeviceSize mem_offset) {
-    InsertMemoryRange(VulkanTypedHandle(buffer, kVulkanObjectTypeBuffer), mem_info, mem_offset);
+void ValidationStateTracker::InsertBufferMemoryRange(VkBuffer buffer, DEVICE_MEMORY_STATE *mem_info, VkDeviceSize mem_offset,
+                                                     VkDeviceSize size) {
+    InsertMemoryRange(VulkanTypedHandle(buffer, kVulkanObjectTypeBuffer), mem_info, mem_offset, size);
 }
 
 void ValidationStateTracker::InsertAccelerationStructureMemoryRange(VkAccelerationStructureNV as, DEVICE_MEMORY_STATE *mem_info,
-                                                                    VkDeviceSize mem_offset) {
-    InsertMemoryRange(VulkanTypedHandle(as, kVulkanObjectTypeAccelerationStructureNV), mem_info, mem_offset);
+                                                                    VkDeviceSize mem_offset, VkDeviceSize size) {
+    InsertMemoryRange(VulkanTypedHandle(as, kVulkanObjectTypeAccelerationStructureNV), mem_info, mem_offset, size);
 }
 
-// This function will remove the handle-to-index mapping from the appropriate map.
+// This function will remove the handle's ranges from the memory's range index.
 static void RemoveMemoryRange(const VulkanTypedHandle &typed_handle, DEVICE_MEMORY_STATE *mem_info) {
-    if (typed_handle.type == kVulkanObjectTypeImage) {
-        mem_info->bound_images.erase(typed_handle.Cast<VkImage>());
-    } else if (typed_handle.type == kVulkanObjectTypeBuffer) {
-        mem_info->bound_buffers.erase(typed_handle.Cast<VkBuffer>());
-    } else if (typed_handle.type == kVulkanObjectTypeAccelerationStructureNV) {
-        mem_info->bound_acceleration_structures.erase(typed_handle.Cast<VkAccelerationStructureNV>());
-    } else {
-        // Unsupported object type
-        assert(false);
-    }
+    mem_info->bound_ranges.Erase(typed_handle);
 }
 
 void ValidationStateTracker::RemoveBufferMemoryRange(VkBuffer buffer, DEVICE_MEMORY_STATE *mem_info) {
@@ -2836,7 +2952,7 @@ void ValidationStateTracker::UpdateBindBufferMemoryState(VkBuffer buffer, VkDevi
         // Track bound memory range information
         auto mem_info = GetDevMemState(mem);
         if (mem_info) {
-            InsertBufferMemoryRange(buffer, mem_info, memoryOffset);
+            InsertBufferMemoryRange(buffer, mem_info, memoryOffset, buffer_state->requirements.size);
         }
         // Track objects tied to memory
         SetMemBinding(mem, buffer_state, memoryOffset, VulkanTypedHandle(buffer, kVulkanObjectTypeBuffer));
@@ -2973,7 +3089,14 @@ void ValidationStateTracker::PreCallRecordDestroyShaderModule(VkDevice device, V
     if (!shaderModule) return;
     auto shader_module_state = GetShaderModuleState(shaderModule);
     shader_module_state->destroyed = true;
+    const uint32_t code_hash = shader_module_state->spirv->code_hash;
     shaderModuleMap.erase(shaderModule);
+
+    // Drop shared code table entries whose parsed SPIR-V is no longer in use
+    const auto range = shader_module_spirv_map.equal_range(code_hash);
+    for (auto it = range.first; it != range.second;) {
+        it = it->second.expired() ? shader_module_spirv_map.erase(it) : std::next(it);
+    }
 }
 
 void ValidationStateTracker::PreCallRecordDestroyPipeline(VkDevice device, VkPipeline pipeline,
@@ -3002,6 +3125,7 @@ void ValidationStateTracker::PreCallRecordDestroySampler(VkDevice device, VkSamp
     const VulkanTypedHandle obj_struct(sampler, kVulkanObjectTypeSampler);
     // Any bound cmd buffers are now invalid
     if (sampler_state) {
+        InvalidateDescriptorCommandBuffers(sampler_state, obj_struct);
         InvalidateCommandBuffers(sampler_state->cb_bindings, obj_struct);
 
         if (sampler_state->createInfo.borderColor == VK_BORDER_COLOR_INT_CUSTOM_EXT ||
@@ -3192,6 +3316,138 @@ void ValidationStateTracker::InvalidateCommandBuffers(small_unordered_map<CMD_BU
     if (unlink) {
         cb_nodes.clear();
     }
+
+    // Command buffers still recording hold their links to obj in their journals
+    const auto journaled = journaled_cb_bindings.find(&cb_nodes);
+    if (journaled == journaled_cb_bindings.end()) return;
+    for (auto cb_node : journaled->second) {
+        auto pending = cb_node->pending_cb_bindings.find(&cb_nodes);
+        assert(pending != cb_node->pending_cb_bindings.end());
+        if (cb_node->state == CB_RECORDING) {
+            cb_node->state = CB_INVALID_INCOMPLETE;
+        }
+        cb_node->broken_bindings.push_back(obj);
+
+        if (cb_node->createInfo.level == VK_COMMAND_BUFFER_LEVEL_SECONDARY) {
+            InvalidateLinkedCommandBuffers(cb_node->linkedCommandBuffers, obj);
+        }
+        if (unlink) {
+            assert(cb_node->object_bindings[pending->second] == obj);
+            cb_node->object_bindings[pending->second] = VulkanTypedHandle();
+            cb_node->pending_cb_bindings.erase(pending);
+        }
+    }
+    if (unlink) {
+        journaled_cb_bindings.erase(journaled);
+    }
+}
+
+// Drop the journaled links to an object that goes away without invalidating the command buffers using it, so that they
+// aren't published into its freed cb_bindings
+void ValidationStateTracker::DropJournaledCommandBufferBindings(small_unordered_map<CMD_BUFFER_STATE *, int, 8> &cb_bindings) {
+    const auto journaled = journaled_cb_bindings.find(&cb_bindings);
+    if (journaled == journaled_cb_bindings.end()) return;
+    for (auto cb_node : journaled->second) {
+        cb_node->pending_cb_bindings.erase(&cb_bindings);
+    }
+    journaled_cb_bindings.erase(journaled);
+}
+
+// Link the objects bound while recording back to the command buffer, in one pass at the end of recording
+void ValidationStateTracker::PublishCommandBufferBindings(CMD_BUFFER_STATE *cb_node) {
+    for (const auto &pending : cb_node->pending_cb_bindings) {
+        pending.first->insert({cb_node, pending.second});
+    }
+    ClearJournaledCommandBufferBindings(cb_node);
+}
+
+// Remove the command buffer's journal from the per object index and stop journaling
+void ValidationStateTracker::ClearJournaledCommandBufferBindings(CMD_BUFFER_STATE *cb_node) {
+    for (const auto &pending : cb_node->pending_cb_bindings) {
+        auto journaled = journaled_cb_bindings.find(pending.first);
+        if (journaled == journaled_cb_bindings.end()) continue;
+        journaled->second.erase(cb_node);
+        if (journaled->second.empty()) journaled_cb_bindings.erase(journaled);
+    }
+    cb_node->pending_cb_bindings.clear();
+    cb_node->journal_cb_bindings = false;
+}
+
+void ValidationStateTracker::AddDescriptorReference(const BASE_NODE *node, cvdescriptorset::DescriptorSet *descriptor_set,
+                                                    uint32_t binding) {
+    ++descriptor_references[node][descriptor_set][binding];
+}
+
+void ValidationStateTracker::RemoveDescriptorReference(const BASE_NODE *node, cvdescriptorset::DescriptorSet *descriptor_set,
+                                                       uint32_t binding) {
+    // The references of a destroyed resource are dropped with it
+    auto node_references = descriptor_references.find(node);
+    if (node_references == descriptor_references.end()) return;
+    auto set_references = node_references->second.find(descriptor_set);
+    if (set_references == node_references->second.end()) return;
+    auto binding_references = set_references->second.find(binding);
+    if (binding_references == set_references->second.end()) return;
+    if (--binding_references->second) return;
+    set_references->second.erase(binding_references);
+    if (!set_references->second.empty()) return;
+    node_references->second.erase(set_references);
+    if (node_references->second.empty()) descriptor_references.erase(node_references);
+}
+
+// Returns the bindings of descriptor_set used by cb_node, indexing cb_node under the set on its first use
+std::map<uint32_t, uint64_t> &ValidationStateTracker::GetDescriptorSetBindings(CMD_BUFFER_STATE *cb_node,
+                                                                             cvdescriptorset::DescriptorSet *descriptor_set) {
+    auto used_bindings = cb_node->descriptor_set_bindings.emplace(descriptor_set, std::map<uint32_t, uint64_t>());
+    if (used_bindings.second) {
+        descriptor_set_command_buffers[descriptor_set].insert(cb_node);
+    }
+    return used_bindings.first->second;
+}
+
+// Call fn for each command buffer (possibly more than once) that used a binding of a descriptor set with a descriptor
+// referencing node, in a draw or dispatch recorded since it was last reset
+template <typename Fn>
+static void ForEachDescriptorCommandBuffer(const ValidationStateTracker &state, const BASE_NODE *node, Fn &&fn) {
+    const auto node_references = state.descriptor_references.find(node);
+    if (node_references == state.descriptor_references.end()) return;
+    for (const auto &set_references : node_references->second) {
+        auto *descriptor_set = set_references.first;
+        auto used_referencing_binding = [descriptor_set, &set_references](const CMD_BUFFER_STATE *cb_node) {
+            const auto used_bindings = cb_node->descriptor_set_bindings.find(descriptor_set);
+            if (used_bindings == cb_node->descriptor_set_bindings.end()) return false;
+            for (const auto &binding_references : set_references.second) {
+                if (used_bindings->second.count(binding_references.first)) return true;
+            }
+            return false;
+        };
+        const auto set_command_buffers = state.descriptor_set_command_buffers.find(descriptor_set);
+        if (set_command_buffers == state.descriptor_set_command_buffers.end()) continue;
+        for (auto cb_node : set_command_buffers->second) {
+            if (used_referencing_binding(cb_node)) fn(cb_node);
+        }
+    }
+}
+
+// Invalidate the command buffers that used node through a descriptor, except those linked to it directly, whose invalidation
+// is left to InvalidateCommandBuffers, and drop the references to node as it's being destroyed
+void ValidationStateTracker::InvalidateDescriptorCommandBuffers(BASE_NODE *node, const VulkanTypedHandle &obj) {
+    std::unordered_set<CMD_BUFFER_STATE *> cb_nodes;
+    ForEachDescriptorCommandBuffer(*this, node, [node, &cb_nodes](CMD_BUFFER_STATE *cb_node) {
+        if (!node->cb_bindings.contains(cb_node) && !cb_node->pending_cb_bindings.count(&node->cb_bindings)) {
+            cb_nodes.insert(cb_node);
+        }
+    });
+    InvalidateLinkedCommandBuffers(cb_nodes, obj);
+    descriptor_references.erase(node);
+}
+
+// Returns whether a command buffer that used node through a descriptor is pending execution
+bool ValidationStateTracker::IsInUseThroughDescriptors(const BASE_NODE *node) const {
+    bool in_use = false;
+    ForEachDescriptorCommandBuffer(*this, node, [&in_use](const CMD_BUFFER_STATE *cb_node) {
+        in_use |= (cb_node->in_use.load() != 0);
+    });
+    return in_use;
 }
 
 void ValidationStateTracker::InvalidateLinkedCommandBuffers(std::unordered_set<CMD_BUFFER_STATE *> &cb_nodes,
@@ -3228,7 +3484,14 @@ void ValidationStateTracker::PreCallRecordDestroyRenderPass(VkDevice device, VkR
     const VulkanTypedHandle obj_struct(renderPass, kVulkanObjectTypeRenderPass);
     InvalidateCommandBuffers(rp_state->cb_bindings, obj_struct);
     rp_state->destroyed = true;
+    const auto analysis_hash = hash_util::HashCombiner().Combine(rp_state->analysis->key).Value();
     renderPassMap.erase(renderPass);
+
+    // Drop shared analysis table entries that are no longer in use
+    const auto range = render_pass_analysis_map.equal_range(analysis_hash);
+    for (auto it = range.first; it != range.second;) {
+        it = it->second.expired() ? render_pass_analysis_map.erase(it) : std::next(it);
+    }
 }
 
 void ValidationStateTracker::PostCallRecordCreateFence(VkDevice device, const VkFenceCreateInfo *pCreateInfo,
@@ -3401,6 +3664,8 @@ struct PushConstantRangeCompare {
 };
 
 static PushConstantRangesDict push_constant_ranges_dict;
+INTERCEPT_STATS_COUNTER_SOURCE("PushConstantRangesDictHits", [] { return push_constant_ranges_dict.GetStats().hits; });
+INTERCEPT_STATS_COUNTER_SOURCE("PushConstantRangesDictMisses", [] { return push_constant_ranges_dict.GetStats().misses; });
 
 PushConstantRangesId GetCanonicalId(const VkPipelineLayoutCreateInfo *info) {
     if (!info->pPushConstantRanges) {
@@ -3424,9 +3689,14 @@ PushConstantRangesId GetCanonicalId(const VkPipelineLayoutCreateInfo *info) {
 
 // Dictionary of canoncial form of the pipeline set layout of descriptor set layouts
 static PipelineLayoutSetLayoutsDict pipeline_layout_set_layouts_dict;
+INTERCEPT_STATS_COUNTER_SOURCE("PipelineLayoutSetLayoutsDictHits", [] { return pipeline_layout_set_layouts_dict.GetStats().hits; });
+INTERCEPT_STATS_COUNTER_SOURCE("PipelineLayoutSetLayoutsDictMisses",
+                               [] { return pipeline_layout_set_layouts_dict.GetStats().misses; });
 
 // Dictionary of canonical form of the "compatible for set" records
 static PipelineLayoutCompatDict pipeline_layout_compat_dict;
+INTERCEPT_STATS_COUNTER_SOURCE("PipelineLayoutCompatDictHits", [] { return pipeline_layout_compat_dict.GetStats().hits; });
+INTERCEPT_STATS_COUNTER_SOURCE("PipelineLayoutCompatDictMisses", [] { return pipeline_layout_compat_dict.GetStats().misses; });
 
 static PipelineLayoutCompatId GetCanonicalId(const uint32_t set_index, const PushConstantRangesId pcr_id,
                                              const PipelineLayoutSetLayoutsId set_layouts_id) {
@@ -3464,7 +3734,20 @@ void ValidationStateTracker::PostCallRecordCreateDescriptorPool(VkDevice device,
                                                                 const VkAllocationCallbacks *pAllocator,
                                                                 VkDescriptorPool *pDescriptorPool, VkResult result) {
     if (VK_SUCCESS != result) return;
-    descriptorPoolMap[*pDescriptorPool] = std::make_shared<DESCRIPTOR_POOL_STATE>(*pDescriptorPool, pCreateInfo);
+    auto pool_state = std::make_shared<DESCRIPTOR_POOL_STATE>(*pDescriptorPool, pCreateInfo);
+    if (!(pCreateInfo->flags & VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT)) {
+        // Size the arena's chunks for the whole pool, within limits, so that most pools need only one.  The estimate allows
+        // for the shared_ptr control block allocated along with each set.
+        const size_t kMinChunkSize = 4 * 1024;
+        const size_t kMaxChunkSize = 1024 * 1024;
+        size_t pool_size = pCreateInfo->maxSets * (sizeof(cvdescriptorset::DescriptorSet) + 64);
+        for (uint32_t i = 0; i < pCreateInfo->poolSizeCount; ++i) {
+            pool_size += pCreateInfo->pPoolSizes[i].descriptorCount *
+                         (cvdescriptorset::DescriptorSize(pCreateInfo->pPoolSizes[i].type) + sizeof(cvdescriptorset::Descriptor *));
+        }
+        pool_state->arena.reset(new LinearArena(std::min(std::max(pool_size, kMinChunkSize), kMaxChunkSize)));
+    }
+    descriptorPoolMap[*pDescriptorPool] = std::move(pool_state);
 }
 
 void ValidationStateTracker::PostCallRecordResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
@@ -3477,10 +3760,10 @@ void ValidationStateTracker::PostCallRecordResetDescriptorPool(VkDevice device,
         FreeDescriptorSet(ds);
     }
     pool->sets.clear();
+    // With the sets destroyed, their storage in the arena can be reused in one step
+    if (pool->arena) pool->arena->Reset();
     // Reset available count for each type and available sets for this pool
-    for (auto it = pool->availableDescriptorTypeCount.begin(); it != pool->availableDescriptorTypeCount.end(); ++it) {
-        pool->availableDescriptorTypeCount[it->first] = pool->maxDescriptorTypeCount[it->first];
-    }
+    pool->availableDescriptorTypeCount = pool->maxDescriptorTypeCount;
     pool->availableSets = pool->maxSets;
 }
 
@@ -3518,12 +3801,16 @@ void ValidationStateTracker::PreCallRecordFreeDescriptorSets(VkDevice device, Vk
             auto descriptor_set = setMap[pDescriptorSets[i]].get();
             uint32_t type_index = 0, descriptor_count = 0;
             for (uint32_t j = 0; j < descriptor_set->GetBindingCount(); ++j) {
-                type_index = static_cast<uint32_t>(descriptor_set->GetTypeFromIndex(j));
+                type_index = DescriptorTypeToIndex(descriptor_set->GetTypeFromIndex(j));
                 descriptor_count = descriptor_set->GetDescriptorCountFromIndex(j);
                 pool_state->availableDescriptorTypeCount[type_index] += descriptor_count;
             }
+            // Move the pool's last set into the freed set's slot
+            auto last_set = pool_state->sets.back();
+            last_set->SetPoolSlot(descriptor_set->GetPoolSlot());
+            pool_state->sets[last_set->GetPoolSlot()] = last_set;
+            pool_state->sets.pop_back();
             FreeDescriptorSet(descriptor_set);
-            pool_state->sets.erase(descriptor_set);
         }
     }
 }
@@ -3638,6 +3925,7 @@ void ValidationStateTracker::PreCallRecordBeginCommandBuffer(VkCommandBuffer com
     }
     // Set updated state here in case implicit reset occurs above
     cb_state->state = CB_RECORDING;
+    cb_state->journal_cb_bindings = !disabled[command_buffer_state];
     cb_state->beginInfo = *pBeginInfo;
     if (cb_state->beginInfo.pInheritanceInfo && (cb_state->createInfo.level == VK_COMMAND_BUFFER_LEVEL_SECONDARY)) {
         cb_state->inheritanceInfo = *(cb_state->beginInfo.pInheritanceInfo);
@@ -3692,6 +3980,7 @@ void ValidationStateTracker::PostCallRecordEndCommandBuffer(VkCommandBuffer comm
         descriptor_set->ClearCachedValidation(cb_state);
     }
     cb_state->validated_descriptor_sets.clear();
+    PublishCommandBufferBindings(cb_state);
     if (VK_SUCCESS == result) {
         cb_state->state = CB_RECORDED;
     }
@@ -3950,7 +4239,8 @@ void ValidationStateTracker::PostCallRecordBindAccelerationStructureMemoryNV(
             // Track bound memory range information
             auto mem_info = GetDevMemState(info.memory);
             if (mem_info) {
-                InsertAccelerationStructureMemoryRange(info.accelerationStructure, mem_info, info.memoryOffset);
+                InsertAccelerationStructureMemoryRange(info.accelerationStructure, mem_info, info.memoryOffset,
+                                                       as_state->memory_requirements.memoryRequirements.size);
             }
             // Track objects tied to memory
             SetMemBinding(info.memory, as_state, info.memoryOffset,
@@ -4010,6 +4300,7 @@ void ValidationStateTracker::PreCallRecordDestroyAccelerationStructureKHR(VkDevi
     auto *as_state = GetAccelerationStructureStateKHR(accelerationStructure);
     if (as_state) {
         const VulkanTypedHandle obj_struct(accelerationStructure, kVulkanObjectTypeAccelerationStructureKHR);
+        InvalidateDescriptorCommandBuffers(as_state, obj_struct);
         InvalidateCommandBuffers(as_state->cb_bindings, obj_struct);
         for (auto mem_binding : as_state->GetBoundMemory()) {
             RemoveMemoryRange(obj_struct, mem_binding);
@@ -4027,6 +4318,7 @@ void ValidationStateTracker::PreCallRecordDestroyAccelerationStructureNV(VkDevic
     auto *as_state = GetAccelerationStructureStateNV(accelerationStructure);
     if (as_state) {
         const VulkanTypedHandle obj_struct(accelerationStructure, kVulkanObjectTypeAccelerationStructureNV);
+        InvalidateDescriptorCommandBuffers(as_state, obj_struct);
         InvalidateCommandBuffers(as_state->cb_bindings, obj_struct);
         for (auto mem_binding : as_state->GetBoundMemory()) {
             RemoveMemoryRange(obj_struct, mem_binding);
@@ -4547,7 +4839,7 @@ void ValidationStateTracker::PostCallRecordCreateFramebuffer(VkDevice device, co
 }
 
 void ValidationStateTracker::RecordRenderPassDAG(RenderPassCreateVersion rp_version, const VkRenderPassCreateInfo2 *pCreateInfo,
-                                                 RENDER_PASS_STATE *render_pass) {
+                                                 RenderPassAnalysis *render_pass) {
     auto &subpass_to_node = render_pass->subpassToNode;
     subpass_to_node.resize(pCreateInfo->subpassCount);
     auto &self_dependencies = render_pass->self_dependencies;
@@ -4642,26 +4934,23 @@ static VkSubpassDependency2 ImplicitDependencyToExternal(uint32_t subpass) {
     return to_external;
 }
 
-void ValidationStateTracker::RecordCreateRenderPassState(RenderPassCreateVersion rp_version,
-                                                         std::shared_ptr<RENDER_PASS_STATE> &render_pass,
-                                                         VkRenderPass *pRenderPass) {
-    render_pass->renderPass = *pRenderPass;
+void ValidationStateTracker::RecordRenderPassAnalysis(RenderPassCreateVersion rp_version, RenderPassAnalysis *render_pass) {
     auto create_info = render_pass->createInfo.ptr();
 
-    RecordRenderPassDAG(RENDER_PASS_VERSION_1, create_info, render_pass.get());
+    RecordRenderPassDAG(RENDER_PASS_VERSION_1, create_info, render_pass);
 
     struct AttachmentTracker {  // This is really only of local interest, but a bit big for a lambda
-        RENDER_PASS_STATE *const rp;
+        RenderPassAnalysis *const rp;
         std::vector<uint32_t> &first;
         std::vector<bool> &first_is_transition;
         std::vector<uint32_t> &last;
-        std::vector<std::vector<RENDER_PASS_STATE::AttachmentTransition>> &subpass_transitions;
+        std::vector<std::vector<RenderPassAnalysis::AttachmentTransition>> &subpass_transitions;
         std::unordered_map<uint32_t, bool> &first_read;
         const uint32_t attachment_count;
         std::vector<VkImageLayout> attachment_layout;
         std::vector<std::vector<VkImageLayout>> subpass_attachment_layout;
-        explicit AttachmentTracker(std::shared_ptr<RENDER_PASS_STATE> &render_pass)
-            : rp(render_pass.get()),
+        explicit AttachmentTracker(RenderPassAnalysis *render_pass)
+            : rp(render_pass),
               first(rp->attachment_first_subpass),
               first_is_transition(rp->attachment_first_is_transition),
               last(rp->attachment_last_subpass),
@@ -4760,29 +5049,143 @@ void ValidationStateTracker::RecordCreateRenderPassState(RenderPassCreateVersion
             }
         }
     }
+}
+
+// The values of a render pass create info that RecordRenderPassAnalysis depends on.  Create infos with extension structures
+// on their dependencies, which the analysis points to, get an empty key and aren't shared.
+static std::vector<uint32_t> RenderPassAnalysisKey(const VkRenderPassCreateInfo2 *pCreateInfo) {
+    std::vector<uint32_t> key = {pCreateInfo->attachmentCount, pCreateInfo->subpassCount, pCreateInfo->dependencyCount};
+    for (uint32_t i = 0; i < pCreateInfo->attachmentCount; ++i) {
+        key.push_back(static_cast<uint32_t>(pCreateInfo->pAttachments[i].initialLayout));
+        key.push_back(static_cast<uint32_t>(pCreateInfo->pAttachments[i].finalLayout));
+    }
+    auto add_references = [&key](const VkAttachmentReference2 *references, uint32_t count) {
+        if (!references) count = 0;
+        key.push_back(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            key.push_back(references[i].attachment);
+            key.push_back(static_cast<uint32_t>(references[i].layout));
+        }
+    };
+    for (uint32_t i = 0; i < pCreateInfo->subpassCount; ++i) {
+        const auto &subpass = pCreateInfo->pSubpasses[i];
+        add_references(subpass.pColorAttachments, subpass.colorAttachmentCount);
+        add_references(subpass.pResolveAttachments, subpass.colorAttachmentCount);
+        add_references(subpass.pDepthStencilAttachment, 1);
+        add_references(subpass.pInputAttachments, subpass.inputAttachmentCount);
+    }
+    for (uint32_t i = 0; i < pCreateInfo->dependencyCount; ++i) {
+        const auto &dependency = pCreateInfo->pDependencies[i];
+        if (dependency.pNext) return std::vector<uint32_t>();
+        key.insert(key.end(), {dependency.srcSubpass, dependency.dstSubpass, dependency.srcStageMask, dependency.dstStageMask,
+                               dependency.srcAccessMask, dependency.dstAccessMask, dependency.dependencyFlags,
+                               static_cast<uint32_t>(dependency.viewOffset)});
+    }
+    return key;
+}
+
+// Render passes created with the same values share their analysis. As with shader modules' parsed SPIR-V, the table holds
+// weak references, so an analysis is released with the last render pass using it.
+std::shared_ptr<const RenderPassAnalysis> ValidationStateTracker::GetSharedRenderPassAnalysis(
+    RenderPassCreateVersion rp_version, const VkRenderPassCreateInfo2 *pCreateInfo) {
+    auto key = RenderPassAnalysisKey(pCreateInfo);
+    const size_t hash = hash_util::HashCombiner().Combine(key).Value();
+    if (!key.empty()) {
+        const auto range = render_pass_analysis_map.equal_range(hash);
+        for (auto it = range.first; it != range.second;) {
+            auto analysis = it->second.lock();
+            if (!analysis) {
+                it = render_pass_analysis_map.erase(it);
+                continue;
+            }
+            if (analysis->key == key) return analysis;
+            ++it;
+        }
+    }
+
+    auto analysis = std::make_shared<RenderPassAnalysis>(std::move(key), pCreateInfo);
+    RecordRenderPassAnalysis(rp_version, analysis.get());
+    if (!analysis->key.empty()) {
+        render_pass_analysis_map.emplace(hash, analysis);
+    }
+    return analysis;
+}
+
+static RenderPassCompatibilityDict render_pass_compatibility_dict;
+INTERCEPT_STATS_COUNTER_SOURCE("RenderPassCompatibilityDictHits", [] { return render_pass_compatibility_dict.GetStats().hits; });
+INTERCEPT_STATS_COUNTER_SOURCE("RenderPassCompatibilityDictMisses",
+                               [] { return render_pass_compatibility_dict.GetStats().misses; });
+
+// Add the values of an attachment that ValidateAttachmentCompatibility compares
+static void AddAttachmentCompatibility(const VkRenderPassCreateInfo2 *pCreateInfo, uint32_t attachment,
+                                       RenderPassCompatibilityDef *def) {
+    if (attachment < pCreateInfo->attachmentCount) {
+        const auto &description = pCreateInfo->pAttachments[attachment];
+        def->push_back(1);
+        def->push_back(static_cast<uint32_t>(description.format));
+        def->push_back(static_cast<uint32_t>(description.samples));
+        def->push_back(description.flags);
+    } else {
+        def->push_back(0);  // Unused, including VK_ATTACHMENT_UNUSED
+    }
+}
+
+static void AddAttachmentListCompatibility(const VkRenderPassCreateInfo2 *pCreateInfo, const VkAttachmentReference2 *references,
+                                           uint32_t count, RenderPassCompatibilityDef *def) {
+    // Unused references at the end of a list are compatible with a shorter list
+    if (!references) count = 0;
+    while ((count > 0) && (references[count - 1].attachment >= pCreateInfo->attachmentCount)) --count;
+    def->push_back(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        AddAttachmentCompatibility(pCreateInfo, references[i].attachment, def);
+    }
+}
 
-    // Even though render_pass is an rvalue-ref parameter, still must move s.t. move assignment is invoked.
+// The canonical form of the values ValidateRenderPassCompatibility compares
+static RenderPassCompatibilityId GetRenderPassCompatibility(const VkRenderPassCreateInfo2 *pCreateInfo) {
+    RenderPassCompatibilityDef def = {pCreateInfo->flags, pCreateInfo->subpassCount};
+    for (uint32_t i = 0; i < pCreateInfo->subpassCount; ++i) {
+        const auto &subpass = pCreateInfo->pSubpasses[i];
+        AddAttachmentListCompatibility(pCreateInfo, subpass.pInputAttachments, subpass.inputAttachmentCount, &def);
+        AddAttachmentListCompatibility(pCreateInfo, subpass.pColorAttachments, subpass.colorAttachmentCount, &def);
+        if (pCreateInfo->subpassCount > 1) {
+            AddAttachmentListCompatibility(pCreateInfo, subpass.pResolveAttachments, subpass.colorAttachmentCount, &def);
+        }
+        AddAttachmentCompatibility(
+            pCreateInfo, subpass.pDepthStencilAttachment ? subpass.pDepthStencilAttachment->attachment : VK_ATTACHMENT_UNUSED,
+            &def);
+        def.push_back(subpass.viewMask);
+    }
+    const auto fdm = LvlFindInChain<VkRenderPassFragmentDensityMapCreateInfoEXT>(pCreateInfo->pNext);
+    def.push_back(fdm ? 1 : 0);
+    if (fdm) {
+        AddAttachmentCompatibility(pCreateInfo, fdm->fragmentDensityMapAttachment.attachment, &def);
+    }
+    return render_pass_compatibility_dict.look_up(std::move(def));
+}
+
+void ValidationStateTracker::RecordCreateRenderPassState(RenderPassCreateVersion rp_version,
+                                                         const VkRenderPassCreateInfo2 *pCreateInfo, VkRenderPass *pRenderPass) {
+    auto render_pass = std::make_shared<RENDER_PASS_STATE>(pCreateInfo, GetRenderPassCompatibility(pCreateInfo),
+                                                           GetSharedRenderPassAnalysis(rp_version, pCreateInfo));
+    render_pass->renderPass = *pRenderPass;
     renderPassMap[*pRenderPass] = std::move(render_pass);
 }
 
-// Style note:
-// Use of rvalue reference exceeds reccommended usage of rvalue refs in google style guide, but intentionally forces caller to move
-// or copy.  This is clearer than passing a pointer to shared_ptr and avoids the atomic increment/decrement of shared_ptr copy
-// construction or assignment.
 void ValidationStateTracker::PostCallRecordCreateRenderPass(VkDevice device, const VkRenderPassCreateInfo *pCreateInfo,
                                                             const VkAllocationCallbacks *pAllocator, VkRenderPass *pRenderPass,
                                                             VkResult result) {
     if (VK_SUCCESS != result) return;
-    auto render_pass_state = std::make_shared<RENDER_PASS_STATE>(pCreateInfo);
-    RecordCreateRenderPassState(RENDER_PASS_VERSION_1, render_pass_state, pRenderPass);
+    safe_VkRenderPassCreateInfo2 create_info;
+    ConvertVkRenderPassCreateInfoToV2KHR(*pCreateInfo, &create_info);
+    RecordCreateRenderPassState(RENDER_PASS_VERSION_1, create_info.ptr(), pRenderPass);
 }
 
 void ValidationStateTracker::RecordCreateRenderPass2(VkDevice device, const VkRenderPassCreateInfo2 *pCreateInfo,
                                                      const VkAllocationCallbacks *pAllocator, VkRenderPass *pRenderPass,
                                                      VkResult result) {
     if (VK_SUCCESS != result) return;
-    auto render_pass_state = std::make_shared<RENDER_PASS_STATE>(pCreateInfo);
-    RecordCreateRenderPassState(RENDER_PASS_VERSION_2, render_pass_state, pRenderPass);
+    RecordCreateRenderPassState(RENDER_PASS_VERSION_2, pCreateInfo, pRenderPass);
 }
 
 void ValidationStateTracker::PostCallRecordCreateRenderPass2KHR(VkDevice device, const VkRenderPassCreateInfo2 *pCreateInfo,
@@ -5011,7 +5414,22 @@ void ValidationStateTracker::UpdateBindImageMemoryState(const VkBindImageMemoryI
             // Track bound memory range information
             auto mem_info = GetDevMemState(bindInfo.memory);
             if (mem_info) {
-                InsertImageMemoryRange(bindInfo.image, mem_info, bindInfo.memoryOffset);
+                VkDeviceSize size = image_state->requirements.size;
+                const auto plane_info = LvlFindInChain<VkBindImagePlaneMemoryInfo>(bindInfo.pNext);
+                if (image_state->disjoint && plane_info) {
+                    switch (plane_info->planeAspect) {
+                        case VK_IMAGE_ASPECT_PLANE_1_BIT:
+                            size = image_state->plane1_requirements.size;
+                            break;
+                        case VK_IMAGE_ASPECT_PLANE_2_BIT:
+                            size = image_state->plane2_requirements.size;
+                            break;
+                        default:
+                            size = image_state->plane0_requirements.size;
+                            break;
+                    }
+                }
+                InsertImageMemoryRange(bindInfo.image, mem_info, bindInfo.memoryOffset, size);
             }
 
             // Track objects tied to memory
@@ -5191,6 +5609,8 @@ void ValidationStateTracker::PreCallRecordDestroySwapchainKHR(VkDevice device, V
     auto swapchain_data = GetSwapchainState(swapchain);
     if (swapchain_data) {
         for (const auto &swapchain_image : swapchain_data->images) {
+            auto image_state = GetImageState(swapchain_image.image);
+            if (image_state) DropJournaledCommandBufferBindings(image_state->cb_bindings);
             ClearMemoryObjectBindings(VulkanTypedHandle(swapchain_image.image, kVulkanObjectTypeImage));
             imageMap.erase(swapchain_image.image);
             RemoveAliasingImages(swapchain_image.bound_images);
@@ -5706,6 +6126,7 @@ void ValidationStateTracker::RecordCreateDescriptorUpdateTemplateState(const VkD
                                                                        VkDescriptorUpdateTemplate *pDescriptorUpdateTemplate) {
     safe_VkDescriptorUpdateTemplateCreateInfo local_create_info(pCreateInfo);
     auto template_state = std::make_shared<TEMPLATE_STATE>(*pDescriptorUpdateTemplate, &local_create_info);
+    cvdescriptorset::DecodedTemplateUpdate::DecodeAhead(this, template_state.get());
     desc_template_map[*pDescriptorUpdateTemplate] = std::move(template_state);
 }
 
@@ -5928,7 +6349,7 @@ void ValidationStateTracker::UpdateAllocateDescriptorSetsData(const VkDescriptor
             // Count total descriptors required per type
             for (uint32_t j = 0; j < layout->GetBindingCount(); ++j) {
                 const auto &binding_layout = layout->GetDescriptorSetLayoutBindingPtrFromIndex(j);
-                uint32_t type_index = static_cast<uint32_t>(binding_layout->descriptorType);
+                uint32_t type_index = DescriptorTypeToIndex(binding_layout->descriptorType);
                 ds_data->required_descriptors_by_type[type_index] += binding_layout->descriptorCount;
             }
         }
@@ -5943,8 +6364,8 @@ void ValidationStateTracker::PerformAllocateDescriptorSets(const VkDescriptorSet
     auto pool_state = descriptorPoolMap[p_alloc_info->descriptorPool].get();
     // Account for sets and individual descriptors allocated from pool
     pool_state->availableSets -= p_alloc_info->descriptorSetCount;
-    for (auto it = ds_data->required_descriptors_by_type.begin(); it != ds_data->required_descriptors_by_type.end(); ++it) {
-        pool_state->availableDescriptorTypeCount[it->first] -= ds_data->required_descriptors_by_type.at(it->first);
+    for (uint32_t type_index = 0; type_index < kDescriptorTypeIndexCount; ++type_index) {
+        pool_state->availableDescriptorTypeCount[type_index] -= ds_data->required_descriptors_by_type[type_index];
     }
 
     const auto *variable_count_info = LvlFindInChain<VkDescriptorSetVariableDescriptorCountAllocateInfo>(p_alloc_info->pNext);
@@ -5954,10 +6375,20 @@ void ValidationStateTracker::PerformAllocateDescriptorSets(const VkDescriptorSet
     for (uint32_t i = 0; i < p_alloc_info->descriptorSetCount; i++) {
         uint32_t variable_count = variable_count_valid ? variable_count_info->pDescriptorCounts[i] : 0;
 
-        auto new_ds = std::make_shared<cvdescriptorset::DescriptorSet>(descriptor_sets[i], pool_state, ds_data->layout_nodes[i],
-                                                                       variable_count, this);
-        pool_state->sets.insert(new_ds.get());
+        std::shared_ptr<cvdescriptorset::DescriptorSet> new_ds;
+        if (pool_state->arena) {
+            new_ds = std::allocate_shared<cvdescriptorset::DescriptorSet>(
+                LinearArenaAllocator<cvdescriptorset::DescriptorSet>(pool_state->arena.get()), descriptor_sets[i], pool_state,
+                ds_data->layout_nodes[i], variable_count, this);
+        } else {
+            new_ds = std::make_shared<cvdescriptorset::DescriptorSet>(descriptor_sets[i], pool_state, ds_data->layout_nodes[i],
+                                                                      variable_count, this);
+        }
+        new_ds->SetPoolSlot(static_cast<uint32_t>(pool_state->sets.size()));
+        pool_state->sets.push_back(new_ds.get());
         new_ds->in_use.store(0);
+        // Immutable samplers are referenced from the start
+        new_ds->UpdateResourceReferences(this, true);
         setMap[descriptor_sets[i]] = std::move(new_ds);
     }
 }
@@ -6112,18 +6543,51 @@ void ValidationStateTracker::PostCallRecordCreateShaderModule(VkDevice device, c
     if (VK_SUCCESS != result) return;
     create_shader_module_api_state *csm_state = reinterpret_cast<create_shader_module_api_state *>(csm_state_data);
 
-    spv_target_env spirv_environment = PickSpirvEnv(api_version, (device_extensions.vk_khr_spirv_1_4 != kNotEnabled));
     bool is_spirv = (pCreateInfo->pCode[0] == spv::MagicNumber);
-    auto new_shader_module = is_spirv ? std::make_shared<SHADER_MODULE_STATE>(pCreateInfo, *pShaderModule, spirv_environment,
-                                                                              csm_state->unique_shader_id)
-                                      : std::make_shared<SHADER_MODULE_STATE>();
-    SetPushConstantUsedInShader(*new_shader_module);
+    auto new_shader_module =
+        is_spirv ? std::make_shared<SHADER_MODULE_STATE>(GetSharedShaderModuleSpirv(pCreateInfo), *pShaderModule,
+                                                         csm_state->unique_shader_id)
+                 : std::make_shared<SHADER_MODULE_STATE>();
     shaderModuleMap[*pShaderModule] = std::move(new_shader_module);
 }
 
+// Modules created from identical code share their parsed SPIR-V. The table holds weak references, so the parsed data is
+// released with the last module (or pipeline) using it.
+std::shared_ptr<const SpirvModuleData> ValidationStateTracker::GetSharedShaderModuleSpirv(
+    const VkShaderModuleCreateInfo *pCreateInfo) {
+    const uint32_t hash = ValidationCache::MakeShaderHash(pCreateInfo);
+    const size_t word_count = pCreateInfo->codeSize / sizeof(uint32_t);
+    auto matches_code = [pCreateInfo, word_count](const SpirvModuleData &spirv) {
+        return (spirv.words.size() == word_count) && std::equal(spirv.words.cbegin(), spirv.words.cend(), pCreateInfo->pCode);
+    };
+    const auto range = shader_module_spirv_map.equal_range(hash);
+    for (auto it = range.first; it != range.second;) {
+        auto spirv = it->second.lock();
+        if (!spirv) {
+            it = shader_module_spirv_map.erase(it);
+            continue;
+        }
+        // The hash only narrows the search, the code itself must match
+        if (matches_code(*spirv)) {
+            return spirv;
+        }
+        ++it;
+    }
+
+    spv_target_env spirv_environment = PickSpirvEnv(api_version, (device_extensions.vk_khr_spirv_1_4 != kNotEnabled));
+    auto spirv = SHADER_MODULE_STATE::ParseSpirv(pCreateInfo, spirv_environment);
+    // Code rewritten by preprocessing (e.g. flattened decoration groups) would never match a later module, so isn't shared
+    if (matches_code(*spirv)) {
+        shader_module_spirv_map.emplace(hash, spirv);
+    }
+    return spirv;
+}
+
 void ValidationStateTracker::RecordPipelineShaderStage(VkPipelineShaderStageCreateInfo const *pStage, PIPELINE_STATE *pipeline,
                                                        PIPELINE_STATE::StageState *stage_state) const {
     // Validation shouldn't rely on anything in stage state being valid if the spirv isn't
+    static const auto kEmptyEntryPointAnalysis = std::make_shared<const ShaderEntryPointAnalysis>();
+    stage_state->entry_point_analysis = kEmptyEntryPointAnalysis;
     stage_state->entry_point_name = pStage->pName;
     stage_state->shader_state = GetShared<SHADER_MODULE_STATE>(pStage->module);
     auto module = stage_state->shader_state.get();
@@ -6135,14 +6599,12 @@ void ValidationStateTracker::RecordPipelineShaderStage(VkPipelineShaderStageCrea
 
     stage_state->stage_flag = pStage->stage;
 
-    // Mark accessible ids
-    stage_state->accessible_ids = MarkAccessibleIds(module, entrypoint);
+    // Mark accessible ids and collect the descriptor uses, shared with other pipelines using this entry point
+    stage_state->entry_point_analysis = module->GetEntryPointAnalysis(entrypoint);
     ProcessExecutionModes(module, entrypoint, pipeline);
 
-    stage_state->descriptor_uses = CollectInterfaceByDescriptorSlot(
-        module, stage_state->accessible_ids, &stage_state->has_writable_descriptor, &stage_state->has_atomic_descriptor);
     // Capture descriptor uses for the pipeline
-    for (const auto &use : stage_state->descriptor_uses) {
+    for (const auto &use : stage_state->entry_point_analysis->descriptor_uses) {
         // While validating shaders capture which slots are used by the pipeline
         const uint32_t slot = use.first.first;
         pipeline->active_slots[slot][use.first.second].is_writable |= use.second.is_writable;
@@ -360,6 +360,7 @@ enum PushConstantByteState {
 };
 
 struct SHADER_MODULE_STATE;
+struct SpirvModuleData;
 
 class ValidationStateTracker : public ValidationObject {
   public:
@@ -395,6 +396,8 @@ class ValidationStateTracker : public ValidationObject {
     void InitDeviceValidationObject(bool add_obj, ValidationObject* inst_obj, ValidationObject* dev_obj) override;
 
     VALSTATETRACK_MAP_AND_TRAITS(VkRenderPass, RENDER_PASS_STATE, renderPassMap)
+    // Analyses shared between render passes created with the same values, keyed by a hash of RenderPassAnalysis::key
+    std::unordered_multimap<size_t, std::weak_ptr<const RenderPassAnalysis>> render_pass_analysis_map;
     VALSTATETRACK_MAP_AND_TRAITS(VkDescriptorSetLayout, cvdescriptorset::DescriptorSetLayout, descriptorSetLayoutMap)
     VALSTATETRACK_MAP_AND_TRAITS(VkSampler, SAMPLER_STATE, samplerMap)
     VALSTATETRACK_MAP_AND_TRAITS(VkImageView, IMAGE_VIEW_STATE, imageViewMap)
@@ -405,11 +408,26 @@ class ValidationStateTracker : public ValidationObject {
     VALSTATETRACK_MAP_AND_TRAITS(VkDeviceMemory, DEVICE_MEMORY_STATE, memObjMap)
     VALSTATETRACK_MAP_AND_TRAITS(VkFramebuffer, FRAMEBUFFER_STATE, frameBufferMap)
     VALSTATETRACK_MAP_AND_TRAITS(VkShaderModule, SHADER_MODULE_STATE, shaderModuleMap)
+    // Parsed SPIR-V shared between shader modules created from identical code, keyed by a hash of the code
+    std::unordered_multimap<uint32_t, std::weak_ptr<const SpirvModuleData>> shader_module_spirv_map;
     VALSTATETRACK_MAP_AND_TRAITS(VkDescriptorUpdateTemplate, TEMPLATE_STATE, desc_template_map)
     VALSTATETRACK_MAP_AND_TRAITS(VkSwapchainKHR, SWAPCHAIN_NODE, swapchainMap)
     VALSTATETRACK_MAP_AND_TRAITS(VkDescriptorPool, DESCRIPTOR_POOL_STATE, descriptorPoolMap)
     VALSTATETRACK_MAP_AND_TRAITS(VkDescriptorSet, cvdescriptorset::DescriptorSet, setMap)
     VALSTATETRACK_MAP_AND_TRAITS(VkCommandBuffer, CMD_BUFFER_STATE, commandBufferMap)
+    // The recording command buffers journaling a link to each object, keyed by the object's cb_bindings, so that an
+    // invalidation only visits the command buffers that reference the object.  See CMD_BUFFER_STATE::pending_cb_bindings.
+    std::unordered_map<small_unordered_map<CMD_BUFFER_STATE*, int, 8>*, std::unordered_set<CMD_BUFFER_STATE*>>
+        journaled_cb_bindings;
+    // The bindings of descriptor sets with descriptors referencing each sampler, view, image, buffer, acceleration structure and
+    // memory object, with the number of such descriptors in each.  Draws and dispatches only link the command buffer to the
+    // sets they use and record the used bindings, in CMD_BUFFER_STATE::descriptor_set_bindings, so this is how a destroyed or
+    // in use resource finds the command buffers that used it through a descriptor.
+    typedef std::unordered_map<cvdescriptorset::DescriptorSet*, std::unordered_map<uint32_t, uint32_t>> DescriptorBindingReferences;
+    std::unordered_map<const BASE_NODE*, DescriptorBindingReferences> descriptor_references;
+    // The command buffers with used bindings of each descriptor set in their descriptor_set_bindings, recording or not, so
+    // that freeing a set or finding the users of a resource only visits the command buffers that used its sets
+    std::unordered_map<cvdescriptorset::DescriptorSet*, std::unordered_set<CMD_BUFFER_STATE*>> descriptor_set_command_buffers;
     VALSTATETRACK_MAP_AND_TRAITS(VkCommandPool, COMMAND_POOL_STATE, commandPoolMap)
     VALSTATETRACK_MAP_AND_TRAITS(VkPipelineLayout, PIPELINE_LAYOUT_STATE, pipelineLayoutMap)
     VALSTATETRACK_MAP_AND_TRAITS(VkFence, FENCE_STATE, fenceMap)
@@ -975,6 +993,7 @@ class ValidationStateTracker : public ValidationObject {
                                           void* csm_state) override;
     void PreCallRecordDestroyShaderModule(VkDevice device, VkShaderModule shaderModule,
                                           const VkAllocationCallbacks* pAllocator) override;
+    std::shared_ptr<const SpirvModuleData> GetSharedShaderModuleSpirv(const VkShaderModuleCreateInfo* pCreateInfo);
     void PreCallRecordDestroySurfaceKHR(VkInstance instance, VkSurfaceKHR surface,
                                         const VkAllocationCallbacks* pAllocator) override;
     void PostCallRecordCreateSharedSwapchainsKHR(VkDevice device, uint32_t swapchainCount,
@@ -1276,6 +1295,11 @@ class ValidationStateTracker : public ValidationObject {
     void AddCommandBufferBindingImage(CMD_BUFFER_STATE*, IMAGE_STATE*);
     void AddCommandBufferBindingImageView(CMD_BUFFER_STATE*, IMAGE_VIEW_STATE*);
     void AddCommandBufferBindingSampler(CMD_BUFFER_STATE*, SAMPLER_STATE*);
+    void AddDescriptorReference(const BASE_NODE* node, cvdescriptorset::DescriptorSet* descriptor_set, uint32_t binding);
+    void RemoveDescriptorReference(const BASE_NODE* node, cvdescriptorset::DescriptorSet* descriptor_set, uint32_t binding);
+    std::map<uint32_t, uint64_t>& GetDescriptorSetBindings(CMD_BUFFER_STATE* cb_node,
+                                                           cvdescriptorset::DescriptorSet* descriptor_set);
+    bool IsInUseThroughDescriptors(const BASE_NODE* node) const;
     void AddMemObjInfo(void* object, const VkDeviceMemory mem, const VkMemoryAllocateInfo* pAllocateInfo);
     void AddFramebufferBinding(CMD_BUFFER_STATE* cb_state, FRAMEBUFFER_STATE* fb_state);
     void ClearMemoryObjectBindings(const VulkanTypedHandle& typed_handle);
@@ -1296,13 +1320,18 @@ class ValidationStateTracker : public ValidationObject {
     void IncrementBoundObjects(CMD_BUFFER_STATE const* cb_node);
     void IncrementResources(CMD_BUFFER_STATE* cb_node);
     void InsertAccelerationStructureMemoryRange(VkAccelerationStructureNV as, DEVICE_MEMORY_STATE* mem_info,
-                                                VkDeviceSize mem_offset);
-    void InsertBufferMemoryRange(VkBuffer buffer, DEVICE_MEMORY_STATE* mem_info, VkDeviceSize mem_offset);
-    void InsertImageMemoryRange(VkImage image, DEVICE_MEMORY_STATE* mem_info, VkDeviceSize mem_offset);
-    void InsertMemoryRange(const VulkanTypedHandle& typed_handle, DEVICE_MEMORY_STATE* mem_info, VkDeviceSize memoryOffset);
+                                                VkDeviceSize mem_offset, VkDeviceSize size);
+    void InsertBufferMemoryRange(VkBuffer buffer, DEVICE_MEMORY_STATE* mem_info, VkDeviceSize mem_offset, VkDeviceSize size);
+    void InsertImageMemoryRange(VkImage image, DEVICE_MEMORY_STATE* mem_info, VkDeviceSize mem_offset, VkDeviceSize size);
+    void InsertMemoryRange(const VulkanTypedHandle& typed_handle, DEVICE_MEMORY_STATE* mem_info, VkDeviceSize memoryOffset,
+                           VkDeviceSize size);
     void InvalidateCommandBuffers(small_unordered_map<CMD_BUFFER_STATE*, int, 8>& cb_nodes, const VulkanTypedHandle& obj,
                                   bool unlink = true);
     void InvalidateLinkedCommandBuffers(std::unordered_set<CMD_BUFFER_STATE*>& cb_nodes, const VulkanTypedHandle& obj);
+    void InvalidateDescriptorCommandBuffers(BASE_NODE* node, const VulkanTypedHandle& obj);
+    void PublishCommandBufferBindings(CMD_BUFFER_STATE* cb_node);
+    void ClearJournaledCommandBufferBindings(CMD_BUFFER_STATE* cb_node);
+    void DropJournaledCommandBufferBindings(small_unordered_map<CMD_BUFFER_STATE*, int, 8>& cb_bindings);
     void PerformAllocateDescriptorSets(const VkDescriptorSetAllocateInfo*, const VkDescriptorSet*,
                                        const cvdescriptorset::AllocateDescriptorSetsData*);
     void PerformUpdateDescriptorSetsWithTemplateKHR(VkDescriptorSet descriptorSet, const TEMPLATE_STATE* template_state,
@@ -1320,8 +1349,11 @@ class ValidationStateTracker : public ValidationObject {
                                          const VkWriteDescriptorSet* pDescriptorWrites);
     void RecordCreateImageANDROID(const VkImageCreateInfo* create_info, IMAGE_STATE* is_node);
     void RecordCreateBufferANDROID(const VkBufferCreateInfo* create_info, BUFFER_STATE* bs_node);
-    void RecordCreateRenderPassState(RenderPassCreateVersion rp_version, std::shared_ptr<RENDER_PASS_STATE>& render_pass,
+    void RecordCreateRenderPassState(RenderPassCreateVersion rp_version, const VkRenderPassCreateInfo2* pCreateInfo,
                                      VkRenderPass* pRenderPass);
+    std::shared_ptr<const RenderPassAnalysis> GetSharedRenderPassAnalysis(RenderPassCreateVersion rp_version,
+                                                                          const VkRenderPassCreateInfo2* pCreateInfo);
+    void RecordRenderPassAnalysis(RenderPassCreateVersion rp_version, RenderPassAnalysis* analysis);
     void RecordCreateSamplerYcbcrConversionState(const VkSamplerYcbcrConversionCreateInfo* create_info,
                                                  VkSamplerYcbcrConversion ycbcr_conversion);
     void RecordCreateSamplerYcbcrConversionANDROID(const VkSamplerYcbcrConversionCreateInfo* create_info,
@@ -1354,7 +1386,7 @@ class ValidationStateTracker : public ValidationObject {
     void RecordPipelineShaderStage(const VkPipelineShaderStageCreateInfo* pStage, PIPELINE_STATE* pipeline,
                                    PIPELINE_STATE::StageState* stage_state) const;
     void RecordRenderPassDAG(RenderPassCreateVersion rp_version, const VkRenderPassCreateInfo2* pCreateInfo,
-                             RENDER_PASS_STATE* render_pass);
+                             RenderPassAnalysis* render_pass);
     void RecordVulkanSurface(VkSurfaceKHR* pSurface);
     void RemoveCommandBufferBinding(const VulkanTypedHandle& object, CMD_BUFFER_STATE* cb_node);
     void RemoveBufferMemoryRange(VkBuffer buffer, DEVICE_MEMORY_STATE* mem_info);
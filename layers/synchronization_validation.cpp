@@ -886,6 +886,28 @@ void AccessContext::ResolvePreviousAccesses() {
     for (const auto address_type : kAddressTypes) {
         ResolvePreviousAccess(address_type, kFullRange, &GetAccessStateMap(address_type), &default_state);
     }
+    ConsolidateAccessStateMaps();
+}
+
+// Barriers and resolves frequently leave neighboring ranges with identical state, merge them so the maps don't grow
+// without bound over long command buffers. The pass is linear, so only run it once the maps have doubled in size since
+// the last one.
+void AccessContext::ConsolidateAccessStateMaps() {
+    static const size_t kMinimumConsolidationSize = 16;
+    size_t ranges_before = 0;
+    for (const auto &map : access_state_maps_) {
+        ranges_before += map.size();
+    }
+    if (ranges_before < std::max(kMinimumConsolidationSize, 2 * consolidated_size_)) return;
+
+    size_t removed = 0;
+    for (auto &map : access_state_maps_) {
+        removed += sparse_container::consolidate(map);
+    }
+    consolidated_size_ = ranges_before - removed;
+    INTERCEPT_STATS_COUNT("SyncConsolidationPasses", 1);
+    INTERCEPT_STATS_COUNT("SyncConsolidationRangesBefore", ranges_before);
+    INTERCEPT_STATS_COUNT("SyncConsolidationRangesAfter", consolidated_size_);
 }
 
 AccessAddressType AccessContext::ImageAddressType(const IMAGE_STATE &image) {
@@ -1142,28 +1164,28 @@ bool AccessContext::ValidateResolveOperations(const CommandExecutionContext &ex_
 }
 
 class HazardDetector {
-    SyncStageAccessIndex usage_index_;
+    const SyncAccessUsage usage_;
 
   public:
-    HazardResult Detect(const ResourceAccessRangeMap::const_iterator &pos) const { return pos->second.DetectHazard(usage_index_); }
+    HazardResult Detect(const ResourceAccessRangeMap::const_iterator &pos) const { return pos->second.DetectHazard(usage_); }
     HazardResult DetectAsync(const ResourceAccessRangeMap::const_iterator &pos, const ResourceUsageTag &start_tag) const {
-        return pos->second.DetectAsyncHazard(usage_index_, start_tag);
+        return pos->second.DetectAsyncHazard(usage_, start_tag);
     }
-    explicit HazardDetector(SyncStageAccessIndex usage) : usage_index_(usage) {}
+    explicit HazardDetector(SyncStageAccessIndex usage) : usage_(usage) {}
 };
 
 class HazardDetectorWithOrdering {
-    const SyncStageAccessIndex usage_index_;
+    const SyncAccessUsage usage_;
     const SyncOrdering ordering_rule_;
 
   public:
     HazardResult Detect(const ResourceAccessRangeMap::const_iterator &pos) const {
-        return pos->second.DetectHazard(usage_index_, ordering_rule_);
+        return pos->second.DetectHazard(usage_, ordering_rule_);
     }
     HazardResult DetectAsync(const ResourceAccessRangeMap::const_iterator &pos, const ResourceUsageTag &start_tag) const {
-        return pos->second.DetectAsyncHazard(usage_index_, start_tag);
+        return pos->second.DetectAsyncHazard(usage_, start_tag);
     }
-    HazardDetectorWithOrdering(SyncStageAccessIndex usage, SyncOrdering ordering) : usage_index_(usage), ordering_rule_(ordering) {}
+    HazardDetectorWithOrdering(SyncStageAccessIndex usage, SyncOrdering ordering) : usage_(usage), ordering_rule_(ordering) {}
 };
 
 HazardResult AccessContext::DetectHazard(const BUFFER_STATE &buffer, SyncStageAccessIndex usage_index,
@@ -1241,18 +1263,18 @@ class BarrierHazardDetector {
   public:
     BarrierHazardDetector(SyncStageAccessIndex usage_index, VkPipelineStageFlags src_exec_scope,
                           SyncStageAccessFlags src_access_scope)
-        : usage_index_(usage_index), src_exec_scope_(src_exec_scope), src_access_scope_(src_access_scope) {}
+        : usage_(usage_index), src_exec_scope_(src_exec_scope), src_access_scope_(src_access_scope) {}
 
     HazardResult Detect(const ResourceAccessRangeMap::const_iterator &pos) const {
-        return pos->second.DetectBarrierHazard(usage_index_, src_exec_scope_, src_access_scope_);
+        return pos->second.DetectBarrierHazard(usage_.index, src_exec_scope_, src_access_scope_);
     }
     HazardResult DetectAsync(const ResourceAccessRangeMap::const_iterator &pos, const ResourceUsageTag &start_tag) const {
         // Async barrier hazard detection can use the same path as the usage index is not IsRead, but is IsWrite
-        return pos->second.DetectAsyncHazard(usage_index_, start_tag);
+        return pos->second.DetectAsyncHazard(usage_, start_tag);
     }
 
   private:
-    SyncStageAccessIndex usage_index_;
+    const SyncAccessUsage usage_;
     VkPipelineStageFlags src_exec_scope_;
     SyncStageAccessFlags src_access_scope_;
 };
@@ -1262,7 +1284,7 @@ class EventBarrierHazardDetector {
     EventBarrierHazardDetector(SyncStageAccessIndex usage_index, VkPipelineStageFlags src_exec_scope,
                                SyncStageAccessFlags src_access_scope, const SyncEventState::ScopeMap &event_scope,
                                const ResourceUsageTag &scope_tag)
-        : usage_index_(usage_index),
+        : usage_(usage_index),
           src_exec_scope_(src_exec_scope),
           src_access_scope_(src_access_scope),
           event_scope_(event_scope),
@@ -1281,15 +1303,15 @@ class EventBarrierHazardDetector {
         }
 
         // Some portion of this pos is in the event_scope, so check for a barrier hazard
-        return pos->second.DetectBarrierHazard(usage_index_, src_exec_scope_, src_access_scope_, scope_tag_);
+        return pos->second.DetectBarrierHazard(usage_.index, src_exec_scope_, src_access_scope_, scope_tag_);
     }
     HazardResult DetectAsync(const ResourceAccessRangeMap::const_iterator &pos, const ResourceUsageTag &start_tag) const {
         // Async barrier hazard detection can use the same path as the usage index is not IsRead, but is IsWrite
-        return pos->second.DetectAsyncHazard(usage_index_, start_tag);
+        return pos->second.DetectAsyncHazard(usage_, start_tag);
     }
 
   private:
-    SyncStageAccessIndex usage_index_;
+    const SyncAccessUsage usage_;
     VkPipelineStageFlags src_exec_scope_;
     SyncStageAccessFlags src_access_scope_;
     const SyncEventState::ScopeMap &event_scope_;
@@ -1670,6 +1692,7 @@ void AccessContext::ApplyToContext(const Action &barrier_action) {
     for (const auto address_type : kAddressTypes) {
         UpdateMemoryAccessState(&GetAccessStateMap(address_type), kFullRange, barrier_action);
     }
+    ConsolidateAccessStateMaps();
 }
 
 void AccessContext::ResolveChildContexts(const std::vector<AccessContext> &contexts) {
@@ -1680,6 +1703,7 @@ void AccessContext::ResolveChildContexts(const std::vector<AccessContext> &conte
             context.ResolveAccessRange(address_type, kFullRange, barrier_action, &GetAccessStateMap(address_type), nullptr, false);
         }
     }
+    ConsolidateAccessStateMaps();
 }
 
 // Suitable only for *subpass* access contexts
@@ -1777,7 +1801,7 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
             pipe->graphicsPipelineCI.pRasterizationState->rasterizerDiscardEnable) {
             continue;
         }
-        for (const auto &set_binding : stage_state.descriptor_uses) {
+        for (const auto &set_binding : stage_state.entry_point_analysis->descriptor_uses) {
             cvdescriptorset::DescriptorSet *descriptor_set = (*per_sets)[set_binding.first.first].bound_descriptor_set;
             cvdescriptorset::DescriptorSetLayout::ConstBindingIterator binding_it(descriptor_set->GetLayout().get(),
                                                                                   set_binding.first.second);
@@ -1913,7 +1937,7 @@ void CommandBufferAccessContext::RecordDispatchDrawDescriptorSet(VkPipelineBindP
             pipe->graphicsPipelineCI.pRasterizationState->rasterizerDiscardEnable) {
             continue;
         }
-        for (const auto &set_binding : stage_state.descriptor_uses) {
+        for (const auto &set_binding : stage_state.entry_point_analysis->descriptor_uses) {
             cvdescriptorset::DescriptorSet *descriptor_set = (*per_sets)[set_binding.first.first].bound_descriptor_set;
             cvdescriptorset::DescriptorSetLayout::ConstBindingIterator binding_it(descriptor_set->GetLayout().get(),
                                                                                   set_binding.first.second);
@@ -2525,13 +2549,12 @@ void ResourceAccessState::ApplyBarriers(const std::vector<SyncBarrier> &barriers
     }
     ApplyPendingBarriers(tag);
 }
-HazardResult ResourceAccessState::DetectHazard(SyncStageAccessIndex usage_index) const {
+HazardResult ResourceAccessState::DetectHazard(const SyncAccessUsage &usage) const {
     HazardResult hazard;
-    auto usage = FlagBit(usage_index);
-    const auto usage_stage = PipelineStageBit(usage_index);
-    if (IsRead(usage)) {
-        if (IsRAWHazard(usage_stage, usage)) {
-            hazard.Set(this, usage_index, READ_AFTER_WRITE, last_write, write_tag);
+    const auto usage_stage = usage.stage;
+    if (usage.is_read) {
+        if (IsRAWHazard(usage_stage, usage.bit)) {
+            hazard.Set(this, usage.index, READ_AFTER_WRITE, last_write, write_tag);
         }
     } else {
         // Write operation:
@@ -2546,27 +2569,28 @@ HazardResult ResourceAccessState::DetectHazard(SyncStageAccessIndex usage_index)
         if (last_reads.size()) {
             for (const auto &read_access : last_reads) {
                 if (IsReadHazard(usage_stage, read_access)) {
-                    hazard.Set(this, usage_index, WRITE_AFTER_READ, read_access.access, read_access.tag);
+                    hazard.Set(this, usage.index, WRITE_AFTER_READ, read_access.access, read_access.tag);
                     break;
                 }
             }
-        } else if (last_write.any() && IsWriteHazard(usage)) {
+        } else if (last_write.any() && IsWriteHazard(usage.bit)) {
             // Write-After-Write check -- if we have a previous write to test against
-            hazard.Set(this, usage_index, WRITE_AFTER_WRITE, last_write, write_tag);
+            hazard.Set(this, usage.index, WRITE_AFTER_WRITE, last_write, write_tag);
         }
     }
     return hazard;
 }
 
-HazardResult ResourceAccessState::DetectHazard(SyncStageAccessIndex usage_index, const SyncOrdering &ordering_rule) const {
+HazardResult ResourceAccessState::DetectHazard(const SyncAccessUsage &usage, const SyncOrdering &ordering_rule) const {
     const auto &ordering = GetOrderingRules(ordering_rule);
     // The ordering guarantees act as barriers to the last accesses, independent of synchronization operations
     HazardResult hazard;
-    const auto usage_bit = FlagBit(usage_index);
-    const auto usage_stage = PipelineStageBit(usage_index);
+    const auto &usage_bit = usage.bit;
+    const auto usage_index = usage.index;
+    const auto usage_stage = usage.stage;
     const bool input_attachment_ordering = (ordering.access_scope & SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ_BIT).any();
     const bool last_write_is_ordered = (last_write & ordering.access_scope).any();
-    if (IsRead(usage_bit)) {
+    if (usage.is_read) {
         // Exclude RAW if no write, or write not most "most recent" operation w.r.t. usage;
         bool is_raw_hazard = IsRAWHazard(usage_stage, usage_bit);
         if (is_raw_hazard) {
@@ -2615,13 +2639,13 @@ HazardResult ResourceAccessState::DetectHazard(SyncStageAccessIndex usage_index,
 }
 
 // Asynchronous Hazards occur between subpasses with no connection through the DAG
-HazardResult ResourceAccessState::DetectAsyncHazard(SyncStageAccessIndex usage_index, const ResourceUsageTag &start_tag) const {
+HazardResult ResourceAccessState::DetectAsyncHazard(const SyncAccessUsage &usage, const ResourceUsageTag &start_tag) const {
     HazardResult hazard;
-    auto usage = FlagBit(usage_index);
+    const auto usage_index = usage.index;
     // Async checks need to not go back further than the start of the subpass, as we only want to find hazards between the async
     // subpasses.  Anything older than that should have been checked at the start of each subpass, taking into account all of
     // the raster ordering rules.
-    if (IsRead(usage)) {
+    if (usage.is_read) {
         if (last_write.any() && (write_tag.index >= start_tag.index)) {
             hazard.Set(this, usage_index, READ_RACING_WRITE, last_write, write_tag);
         }
@@ -2649,6 +2673,9 @@ HazardResult ResourceAccessState::DetectBarrierHazard(SyncStageAccessIndex usage
     // only test for WAW if there no intervening read operations.
     // See DetectHazard(SyncStagetAccessIndex) above for more details.
     if (last_reads.size()) {
+        // When the source scope holds every read stage none of the reads can be a hazard, which is the common case of a
+        // transition after reads that saves scanning them
+        if ((last_read_stages & ~src_exec_scope) == 0) return hazard;
         // Look at the reads if any
         for (const auto &read_access : last_reads) {
             if (read_access.IsReadBarrierHazard(src_exec_scope)) {
@@ -4966,6 +4993,7 @@ void SyncOpPipelineBarrier::Record(CommandBufferAccessContext *cb_context) const
     ApplyBarriers(buffer_memory_barriers_, factory, tag, access_context);
     ApplyBarriers(image_memory_barriers_, factory, tag, access_context);
     ApplyGlobalBarriers(memory_barriers_, factory, tag, access_context);
+    access_context->ConsolidateAccessStateMaps();
 
     cb_context->ApplyGlobalBarriersToEvents(src_exec_scope_, dst_exec_scope_);
 }
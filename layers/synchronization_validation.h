@@ -85,6 +85,19 @@ struct SyncStageAccess {
     }
 };
 
+// The usage dependent terms of hazard detection, looked up once per detector rather than once per access state checked
+struct SyncAccessUsage {
+    SyncStageAccessIndex index;
+    SyncStageAccessFlags bit;
+    VkPipelineStageFlagBits stage;
+    bool is_read;
+    explicit SyncAccessUsage(SyncStageAccessIndex usage_index)
+        : index(usage_index),
+          bit(SyncStageAccess::FlagBit(usage_index)),
+          stage(SyncStageAccess::PipelineStageBit(usage_index)),
+          is_read(SyncStageAccess::IsRead(bit)) {}
+};
+
 // The resource tag is relative to the command buffer or queue in which it's found
 struct ResourceUsageTag {
     using TagIndex = uint64_t;
@@ -300,12 +313,19 @@ class ResourceAccessState : public SyncStageAccess {
     };
 
   public:
-    HazardResult DetectHazard(SyncStageAccessIndex usage_index) const;
-    HazardResult DetectHazard(SyncStageAccessIndex usage_index, const SyncOrdering &ordering_rule) const;
+    HazardResult DetectHazard(SyncStageAccessIndex usage_index) const { return DetectHazard(SyncAccessUsage(usage_index)); }
+    HazardResult DetectHazard(const SyncAccessUsage &usage) const;
+    HazardResult DetectHazard(SyncStageAccessIndex usage_index, const SyncOrdering &ordering_rule) const {
+        return DetectHazard(SyncAccessUsage(usage_index), ordering_rule);
+    }
+    HazardResult DetectHazard(const SyncAccessUsage &usage, const SyncOrdering &ordering_rule) const;
 
     HazardResult DetectBarrierHazard(SyncStageAccessIndex usage_index, VkPipelineStageFlags source_exec_scope,
                                      const SyncStageAccessFlags &source_access_scope) const;
-    HazardResult DetectAsyncHazard(SyncStageAccessIndex usage_index, const ResourceUsageTag &start_tag) const;
+    HazardResult DetectAsyncHazard(SyncStageAccessIndex usage_index, const ResourceUsageTag &start_tag) const {
+        return DetectAsyncHazard(SyncAccessUsage(usage_index), start_tag);
+    }
+    HazardResult DetectAsyncHazard(const SyncAccessUsage &usage, const ResourceUsageTag &start_tag) const;
     HazardResult DetectBarrierHazard(SyncStageAccessIndex usage_index, VkPipelineStageFlags source_exec_scope,
                                      const SyncStageAccessFlags &source_access_scope, const ResourceUsageTag &event_tag) const;
 
@@ -669,8 +689,11 @@ class AccessContext {
         for (auto &map : access_state_maps_) {
             map.clear();
         }
+        consolidated_size_ = 0;
     }
 
+    void ConsolidateAccessStateMaps();
+
     // Follow the context previous to access the access state, supporting "lazy" import into the context. Not intended for
     // subpass layout transition, as the pending state handling is more complex
     // TODO: See if returning the lower_bound would be useful from a performance POV -- look at the lower_bound overhead
@@ -774,6 +797,7 @@ class AccessContext {
     TrackBack src_external_;
     TrackBack dst_external_;
     ResourceUsageTag start_tag_;
+    size_t consolidated_size_ = 0;
 };
 
 class RenderPassAccessContext {
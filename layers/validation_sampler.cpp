@@ -0,0 +1,61 @@
+/* Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "validation_sampler.h"
+
+std::unique_ptr<ValidationSampler> ValidationSampler::Create(const Settings &settings) {
+    if (settings.rate <= 1) return nullptr;
+    return std::unique_ptr<ValidationSampler>(new ValidationSampler(settings.mode, settings.rate, settings.seed));
+}
+
+bool ValidationSampler::Select(uint64_t index) const {
+    // splitmix64 finalizer
+    uint64_t hash = seed_ + (index + 1) * 0x9e3779b97f4a7c15ULL;
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+    hash ^= hash >> 31;
+    return (hash % rate_) == 0;
+}
+
+void ValidationSampler::AllocateCommandBuffers(const VkCommandBufferAllocateInfo *pAllocateInfo,
+                                               const VkCommandBuffer *pCommandBuffers) {
+    for (uint32_t i = 0; i < pAllocateInfo->commandBufferCount; ++i) {
+        command_buffers_.insert_or_assign(pCommandBuffers[i], CommandBufferInfo{pAllocateInfo->commandPool, true});
+    }
+}
+
+void ValidationSampler::BeginCommandBuffer(VkCommandBuffer commandBuffer) {
+    const uint64_t index = (mode_ == kFrameMode) ? frame_count_.load(std::memory_order_relaxed)
+                                                 : begin_count_.fetch_add(1, std::memory_order_relaxed);
+    const VkCommandPool pool = command_buffers_.find(commandBuffer)->second.pool;
+    command_buffers_.insert_or_assign(commandBuffer, CommandBufferInfo{pool, Select(index)});
+}
+
+void ValidationSampler::FreeCommandBuffers(uint32_t commandBufferCount, const VkCommandBuffer *pCommandBuffers) {
+    for (uint32_t i = 0; i < commandBufferCount; ++i) {
+        command_buffers_.erase(pCommandBuffers[i]);
+    }
+}
+
+void ValidationSampler::DestroyCommandPool(VkCommandPool commandPool) {
+    if (commandPool == VK_NULL_HANDLE) return;
+    const auto pool_command_buffers =
+        command_buffers_.snapshot([commandPool](CommandBufferInfo info) { return info.pool == commandPool; });
+    for (const auto &entry : pool_command_buffers) {
+        command_buffers_.erase(entry.first);
+    }
+}
@@ -0,0 +1,79 @@
+/* Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+#include "vulkan/vulkan.h"
+#include "vk_layer_utils.h"
+
+// Statistical validation: selects which command buffer recordings get command validation at full depth.
+//
+// A recording is selected when it begins, either on its own (command_buffer mode) or by the frame it begins in, counted
+// by vkQueuePresentKHR calls (frame mode).  On average one recording or frame in sampling_rate is selected; the choice is
+// a hash of the sampling_seed and the recording or frame number, so that a run can be repeated exactly and the selection
+// doesn't beat against an application that cycles through a fixed set of command buffers.  For recordings that aren't
+// selected, the chassis leaves best practices and synchronization validation out of every vkCmd* call, and skips the core
+// checks of the commands whose state recording doesn't depend on them having passed.  All other state tracking and
+// validation runs for every recording.
+class ValidationSampler {
+  public:
+    enum Mode { kCommandBufferMode, kFrameMode };
+
+    // The sampling_rate, sampling_mode and sampling_seed layer settings
+    struct Settings {
+        uint32_t rate = 0;
+        Mode mode = kCommandBufferMode;
+        uint64_t seed = 0;
+    };
+
+    ValidationSampler(Mode mode, uint32_t rate, uint64_t seed) : mode_(mode), rate_(rate), seed_(seed) {}
+
+    // Returns null unless the sampling rate is more than 1
+    static std::unique_ptr<ValidationSampler> Create(const Settings &settings);
+    static Mode ModeFromName(const char *name) { return strcmp(name, "frame") ? kCommandBufferMode : kFrameMode; }
+
+    void AllocateCommandBuffers(const VkCommandBufferAllocateInfo *pAllocateInfo, const VkCommandBuffer *pCommandBuffers);
+    // Select (or not) the recording that commandBuffer is about to begin
+    void BeginCommandBuffer(VkCommandBuffer commandBuffer);
+    void FreeCommandBuffers(uint32_t commandBufferCount, const VkCommandBuffer *pCommandBuffers);
+    void DestroyCommandPool(VkCommandPool commandPool);
+    void QueuePresent() { frame_count_.fetch_add(1, std::memory_order_relaxed); }
+
+    bool IsSelected(VkCommandBuffer commandBuffer) const { return command_buffers_.find(commandBuffer)->second.selected; }
+
+  private:
+    struct CommandBufferInfo {
+        VkCommandPool pool = VK_NULL_HANDLE;
+        bool selected = true;
+    };
+
+    bool Select(uint64_t index) const;
+
+    const Mode mode_;
+    const uint32_t rate_;
+    const uint64_t seed_;
+    std::atomic<uint64_t> frame_count_{0};
+    std::atomic<uint64_t> begin_count_{0};
+    // Command buffers are validated until a recording that isn't selected begins, and are dropped when freed directly or
+    // with their pool
+    vl_concurrent_unordered_map<VkCommandBuffer, CommandBufferInfo, 4> command_buffers_;
+};
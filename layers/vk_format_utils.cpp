@@ -20,10 +20,9 @@
  */
 
 #include <string.h>
+#include <algorithm>
 #include <string>
 #include <vector>
-#include <map>
-#include <set>
 #include "vulkan/vulkan.h"
 #include "vk_format_utils.h"
 
@@ -33,12 +32,62 @@ struct VULKAN_FORMAT_INFO {
     VkFormatCompatibilityClass format_class;
 };
 
+struct VULKAN_FORMAT_TABLE_ENTRY {
+    VkFormat format;
+    VULKAN_FORMAT_INFO info;
+};
+
+struct VULKAN_PER_PLANE_COMPATIBILITY {
+    uint32_t width_divisor;
+    uint32_t height_divisor;
+    VkFormat compatible_format;
+};
+
+struct VULKAN_MULTIPLANE_COMPATIBILITY {
+    VULKAN_PER_PLANE_COMPATIBILITY per_plane[VK_MULTIPLANE_FORMAT_MAX_PLANES];
+};
+
+struct VULKAN_MULTIPLANE_TABLE_ENTRY {
+    VkFormat format;
+    VULKAN_MULTIPLANE_COMPATIBILITY compatibility;
+};
+
+// Bits of FormatTraits::flags
+static const uint16_t kFormatUNorm = 1 << 0;
+static const uint16_t kFormatSNorm = 1 << 1;
+static const uint16_t kFormatUScaled = 1 << 2;
+static const uint16_t kFormatSScaled = 1 << 3;
+static const uint16_t kFormatUInt = 1 << 4;
+static const uint16_t kFormatSInt = 1 << 5;
+static const uint16_t kFormatFloat = 1 << 6;
+static const uint16_t kFormatSRGB = 1 << 7;
+static const uint16_t kFormatCompressed = 1 << 8;
+static const uint16_t kFormatRequiresYcbcrConversion = 1 << 9;
+
+// Everything the common format queries look up, gathered into one record per format.  The records are built once, from the
+// tables and switches in this file, into a dense array indexed by format (see FormatTraitsTable below).
+struct FormatTraits {
+    uint32_t size;  // Bytes per texel, or per compressed or shared block
+    uint16_t flags;
+    uint8_t channel_count;
+    uint8_t format_class;  // VkFormatCompatibilityClass
+    uint8_t block_extent[3];
+    uint8_t plane_count;
+    uint8_t depth_stencil_aspects;  // VK_IMAGE_ASPECT_DEPTH_BIT and/or VK_IMAGE_ASPECT_STENCIL_BIT
+    uint8_t multiplane_index;       // Index in kVkMultiplaneCompatibilityTable, or kNotMultiplane
+};
+
+static const uint8_t kNotMultiplane = UINT8_MAX;
+
+static const FormatTraits &GetFormatTraits(VkFormat format);
+static const VULKAN_MULTIPLANE_COMPATIBILITY *GetMultiplaneCompatibility(const FormatTraits &traits);
+
 // Disable auto-formatting for this large table
 // clang-format off
 
 // Set up data structure with size(bytes) and number of channels for each Vulkan format
 // For compressed and multi-plane formats, size is bytes per compressed or shared block
-const std::map<VkFormat, VULKAN_FORMAT_INFO> kVkFormatTable = {
+static const VULKAN_FORMAT_TABLE_ENTRY kVkFormatTable[] = {
     {VK_FORMAT_UNDEFINED,                   {0, 0, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT }},
     {VK_FORMAT_R4G4_UNORM_PACK8,            {1, 2, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT}},
     {VK_FORMAT_R4G4B4A4_UNORM_PACK16,       {2, 4, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
@@ -463,10 +512,7 @@ VK_LAYER_EXPORT bool FormatIsSinglePlane_422(VkFormat format) {
 }
 
 // Return true if format is compressed
-VK_LAYER_EXPORT bool FormatIsCompressed(VkFormat format) {
-    return (FormatIsCompressed_ASTC(format) || FormatIsCompressed_BC(format) || FormatIsCompressed_ETC2_EAC(format) ||
-            FormatIsCompressed_PVRTC(format));
-}
+VK_LAYER_EXPORT bool FormatIsCompressed(VkFormat format) { return (GetFormatTraits(format).flags & kFormatCompressed) != 0; }
 // Return true if format is packed
 VK_LAYER_EXPORT bool FormatIsPacked(VkFormat format) {
     bool found = false;
@@ -542,51 +588,28 @@ VK_LAYER_EXPORT bool FormatElementIsTexel(VkFormat format) {
 }
 
 // Return true if format is a depth or stencil format
-VK_LAYER_EXPORT bool FormatIsDepthOrStencil(VkFormat format) {
-    return (FormatIsDepthAndStencil(format) || FormatIsDepthOnly(format) || FormatIsStencilOnly(format));
-}
+VK_LAYER_EXPORT bool FormatIsDepthOrStencil(VkFormat format) { return GetFormatTraits(format).depth_stencil_aspects != 0; }
 
 // Return true if format contains depth and stencil information
 VK_LAYER_EXPORT bool FormatIsDepthAndStencil(VkFormat format) {
-    bool is_ds = false;
-
-    switch (format) {
-        case VK_FORMAT_D16_UNORM_S8_UINT:
-        case VK_FORMAT_D24_UNORM_S8_UINT:
-        case VK_FORMAT_D32_SFLOAT_S8_UINT:
-            is_ds = true;
-            break;
-        default:
-            break;
-    }
-    return is_ds;
+    return GetFormatTraits(format).depth_stencil_aspects == (VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT);
 }
 
 // Return true if format is a stencil-only format
-VK_LAYER_EXPORT bool FormatIsStencilOnly(VkFormat format) { return (format == VK_FORMAT_S8_UINT); }
+VK_LAYER_EXPORT bool FormatIsStencilOnly(VkFormat format) {
+    return GetFormatTraits(format).depth_stencil_aspects == VK_IMAGE_ASPECT_STENCIL_BIT;
+}
 
 // Return true if format is a depth-only format
 VK_LAYER_EXPORT bool FormatIsDepthOnly(VkFormat format) {
-    bool is_depth = false;
-
-    switch (format) {
-        case VK_FORMAT_D16_UNORM:
-        case VK_FORMAT_X8_D24_UNORM_PACK32:
-        case VK_FORMAT_D32_SFLOAT:
-            is_depth = true;
-            break;
-        default:
-            break;
-    }
-
-    return is_depth;
+    return GetFormatTraits(format).depth_stencil_aspects == VK_IMAGE_ASPECT_DEPTH_BIT;
 }
 
 // Return true if format is of type NORM
 VK_LAYER_EXPORT bool FormatIsNorm(VkFormat format) { return (FormatIsUNorm(format) || FormatIsSNorm(format)); }
 
 // Return true if format is of type UNORM
-VK_LAYER_EXPORT bool FormatIsUNorm(VkFormat format) {
+static bool ComputeFormatIsUNorm(VkFormat format) {
     bool is_unorm = false;
 
     switch (format) {
@@ -687,7 +710,7 @@ VK_LAYER_EXPORT bool FormatIsUNorm(VkFormat format) {
 }
 
 // Return true if format is of type SNORM
-VK_LAYER_EXPORT bool FormatIsSNorm(VkFormat format) {
+static bool ComputeFormatIsSNorm(VkFormat format) {
     bool is_snorm = false;
 
     switch (format) {
@@ -721,7 +744,7 @@ VK_LAYER_EXPORT bool FormatIsSNorm(VkFormat format) {
 VK_LAYER_EXPORT bool FormatIsInt(VkFormat format) { return (FormatIsSInt(format) || FormatIsUInt(format)); }
 
 // Return true if format is an unsigned integer format
-VK_LAYER_EXPORT bool FormatIsUInt(VkFormat format) {
+static bool ComputeFormatIsUInt(VkFormat format) {
     bool is_uint = false;
 
     switch (format) {
@@ -757,7 +780,7 @@ VK_LAYER_EXPORT bool FormatIsUInt(VkFormat format) {
 }
 
 // Return true if format is a signed integer format
-VK_LAYER_EXPORT bool FormatIsSInt(VkFormat format) {
+static bool ComputeFormatIsSInt(VkFormat format) {
     bool is_sint = false;
 
     switch (format) {
@@ -792,7 +815,7 @@ VK_LAYER_EXPORT bool FormatIsSInt(VkFormat format) {
 }
 
 // Return true if format is a floating-point format
-VK_LAYER_EXPORT bool FormatIsFloat(VkFormat format) {
+static bool ComputeFormatIsFloat(VkFormat format) {
     bool is_float = false;
 
     switch (format) {
@@ -822,7 +845,7 @@ VK_LAYER_EXPORT bool FormatIsFloat(VkFormat format) {
 }
 
 // Return true if format is in the SRGB colorspace
-VK_LAYER_EXPORT bool FormatIsSRGB(VkFormat format) {
+static bool ComputeFormatIsSRGB(VkFormat format) {
     bool is_srgb = false;
 
     switch (format) {
@@ -864,7 +887,7 @@ VK_LAYER_EXPORT bool FormatIsSRGB(VkFormat format) {
 }
 
 // Return true if format is a USCALED format
-VK_LAYER_EXPORT bool FormatIsUScaled(VkFormat format) {
+static bool ComputeFormatIsUScaled(VkFormat format) {
     bool is_uscaled = false;
 
     switch (format) {
@@ -891,7 +914,7 @@ VK_LAYER_EXPORT bool FormatIsUScaled(VkFormat format) {
 }
 
 // Return true if format is a SSCALED format
-VK_LAYER_EXPORT bool FormatIsSScaled(VkFormat format) {
+static bool ComputeFormatIsSScaled(VkFormat format) {
     bool is_sscaled = false;
 
     switch (format) {
@@ -917,6 +940,16 @@ VK_LAYER_EXPORT bool FormatIsSScaled(VkFormat format) {
     return is_sscaled;
 }
 
+// The numeric types are looked up in the format traits, which are built from the switches above
+VK_LAYER_EXPORT bool FormatIsUNorm(VkFormat format) { return (GetFormatTraits(format).flags & kFormatUNorm) != 0; }
+VK_LAYER_EXPORT bool FormatIsSNorm(VkFormat format) { return (GetFormatTraits(format).flags & kFormatSNorm) != 0; }
+VK_LAYER_EXPORT bool FormatIsUInt(VkFormat format) { return (GetFormatTraits(format).flags & kFormatUInt) != 0; }
+VK_LAYER_EXPORT bool FormatIsSInt(VkFormat format) { return (GetFormatTraits(format).flags & kFormatSInt) != 0; }
+VK_LAYER_EXPORT bool FormatIsFloat(VkFormat format) { return (GetFormatTraits(format).flags & kFormatFloat) != 0; }
+VK_LAYER_EXPORT bool FormatIsSRGB(VkFormat format) { return (GetFormatTraits(format).flags & kFormatSRGB) != 0; }
+VK_LAYER_EXPORT bool FormatIsUScaled(VkFormat format) { return (GetFormatTraits(format).flags & kFormatUScaled) != 0; }
+VK_LAYER_EXPORT bool FormatIsSScaled(VkFormat format) { return (GetFormatTraits(format).flags & kFormatSScaled) != 0; }
+
 // Types from "Interpretation of Numeric Format" table
 VK_LAYER_EXPORT bool FormatIsSampledInt(VkFormat format) { return FormatIsInt(format); }
 VK_LAYER_EXPORT bool FormatIsSampledFloat(VkFormat format) {
@@ -928,7 +961,7 @@ VK_LAYER_EXPORT bool FormatIsSampledFloat(VkFormat format) {
 // Uncompressed formats return {1, 1, 1}
 // Compressed formats return the compression block extents
 // Multiplane formats return the 'shared' extent of their low-res channel(s)
-VK_LAYER_EXPORT VkExtent3D FormatTexelBlockExtent(VkFormat format) {
+static VkExtent3D ComputeTexelBlockExtent(VkFormat format) {
     VkExtent3D block_size = {1, 1, 1};
     switch (format) {
         case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
@@ -1157,7 +1190,7 @@ VK_LAYER_EXPORT VkFormatNumericalType FormatStencilNumericalType(VkFormat format
     return numerical_type;
 }
 
-VK_LAYER_EXPORT uint32_t FormatPlaneCount(VkFormat format) {
+static uint32_t ComputePlaneCount(VkFormat format) {
     switch (format) {
         case VK_FORMAT_G8_B8_R8_3PLANE_420_UNORM:
         case VK_FORMAT_G8_B8_R8_3PLANE_422_UNORM:
@@ -1189,13 +1222,16 @@ VK_LAYER_EXPORT uint32_t FormatPlaneCount(VkFormat format) {
     }
 }
 
+VK_LAYER_EXPORT VkExtent3D FormatTexelBlockExtent(VkFormat format) {
+    const auto &traits = GetFormatTraits(format);
+    return {traits.block_extent[0], traits.block_extent[1], traits.block_extent[2]};
+}
+
+VK_LAYER_EXPORT uint32_t FormatPlaneCount(VkFormat format) { return GetFormatTraits(format).plane_count; }
+
 // Return format class of the specified format
 VK_LAYER_EXPORT VkFormatCompatibilityClass FormatCompatibilityClass(VkFormat format) {
-    auto item = kVkFormatTable.find(format);
-    if (item != kVkFormatTable.end()) {
-        return item->second.format_class;
-    }
-    return VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT;
+    return static_cast<VkFormatCompatibilityClass>(GetFormatTraits(format).format_class);
 }
 
 // Return size, in bytes, of one element of the specified format
@@ -1222,11 +1258,7 @@ VK_LAYER_EXPORT uint32_t FormatElementSize(VkFormat format, VkImageAspectFlags a
         format = FindMultiplaneCompatibleFormat(format, aspectMask);
     }
 
-    auto item = kVkFormatTable.find(format);
-    if (item != kVkFormatTable.end()) {
-        return item->second.size;
-    }
-    return 0;
+    return GetFormatTraits(format).size;
 }
 
 // Return the size in bytes of one texel of given foramt
@@ -1242,13 +1274,7 @@ VK_LAYER_EXPORT double FormatTexelSize(VkFormat format, VkImageAspectFlags aspec
 }
 
 // Return the number of channels for a given format
-uint32_t FormatChannelCount(VkFormat format) {
-    auto item = kVkFormatTable.find(format);
-    if (item != kVkFormatTable.end()) {
-        return item->second.channel_count;
-    }
-    return 0;
-}
+uint32_t FormatChannelCount(VkFormat format) { return GetFormatTraits(format).channel_count; }
 
 // Perform a zero-tolerant modulo operation
 VK_LAYER_EXPORT VkDeviceSize SafeModulo(VkDeviceSize dividend, VkDeviceSize divisor) {
@@ -1267,19 +1293,9 @@ VK_LAYER_EXPORT VkDeviceSize SafeDivision(VkDeviceSize dividend, VkDeviceSize di
     return result;
 }
 
-struct VULKAN_PER_PLANE_COMPATIBILITY {
-    uint32_t width_divisor;
-    uint32_t height_divisor;
-    VkFormat compatible_format;
-};
-
-struct VULKAN_MULTIPLANE_COMPATIBILITY {
-    VULKAN_PER_PLANE_COMPATIBILITY per_plane[VK_MULTIPLANE_FORMAT_MAX_PLANES];
-};
-
 // Source: Vulkan spec Table 47. Plane Format Compatibility Table
 // clang-format off
-static const std::map<VkFormat, VULKAN_MULTIPLANE_COMPATIBILITY>kVkMultiplaneCompatibilityMap {
+static const VULKAN_MULTIPLANE_TABLE_ENTRY kVkMultiplaneCompatibilityTable[] = {
     { VK_FORMAT_G8_B8_R8_3PLANE_420_UNORM,                  { { { 1, 1, VK_FORMAT_R8_UNORM },
                                                                 { 2, 2, VK_FORMAT_R8_UNORM },
                                                                 { 2, 2, VK_FORMAT_R8_UNORM } } } },
@@ -1364,24 +1380,24 @@ uint32_t GetPlaneIndex(VkImageAspectFlags aspect) {
 
 VK_LAYER_EXPORT VkFormat FindMultiplaneCompatibleFormat(VkFormat mp_fmt, VkImageAspectFlags plane_aspect) {
     uint32_t plane_idx = GetPlaneIndex(plane_aspect);
-    auto it = kVkMultiplaneCompatibilityMap.find(mp_fmt);
-    if ((it == kVkMultiplaneCompatibilityMap.end()) || (plane_idx >= VK_MULTIPLANE_FORMAT_MAX_PLANES)) {
+    const VULKAN_MULTIPLANE_COMPATIBILITY *planes = GetMultiplaneCompatibility(GetFormatTraits(mp_fmt));
+    if (!planes || (plane_idx >= VK_MULTIPLANE_FORMAT_MAX_PLANES)) {
         return VK_FORMAT_UNDEFINED;
     }
 
-    return it->second.per_plane[plane_idx].compatible_format;
+    return planes->per_plane[plane_idx].compatible_format;
 }
 
 VK_LAYER_EXPORT VkExtent2D FindMultiplaneExtentDivisors(VkFormat mp_fmt, VkImageAspectFlags plane_aspect) {
     VkExtent2D divisors = {1, 1};
     uint32_t plane_idx = GetPlaneIndex(plane_aspect);
-    auto it = kVkMultiplaneCompatibilityMap.find(mp_fmt);
-    if ((it == kVkMultiplaneCompatibilityMap.end()) || (plane_idx >= VK_MULTIPLANE_FORMAT_MAX_PLANES)) {
+    const VULKAN_MULTIPLANE_COMPATIBILITY *planes = GetMultiplaneCompatibility(GetFormatTraits(mp_fmt));
+    if (!planes || (plane_idx >= VK_MULTIPLANE_FORMAT_MAX_PLANES)) {
         return divisors;
     }
 
-    divisors.width = it->second.per_plane[plane_idx].width_divisor;
-    divisors.height = it->second.per_plane[plane_idx].height_divisor;
+    divisors.width = planes->per_plane[plane_idx].width_divisor;
+    divisors.height = planes->per_plane[plane_idx].height_divisor;
     return divisors;
 }
 
@@ -1414,40 +1430,39 @@ VK_LAYER_EXPORT bool FormatSizesAreEqual(VkFormat srcFormat, VkFormat dstFormat,
 }
 
 // Source: Vulkan spec Table 69. Formats requiring sampler YCBCR conversion for VK_IMAGE_ASPECT_COLOR_BIT image views
-const std::set<VkFormat> kVkFormatsRequiringYcbcrConversion{VK_FORMAT_G8B8G8R8_422_UNORM,
-                                                            VK_FORMAT_B8G8R8G8_422_UNORM,
-                                                            VK_FORMAT_G8_B8_R8_3PLANE_420_UNORM,
-                                                            VK_FORMAT_G8_B8R8_2PLANE_420_UNORM,
-                                                            VK_FORMAT_G8_B8_R8_3PLANE_422_UNORM,
-                                                            VK_FORMAT_G8_B8R8_2PLANE_422_UNORM,
-                                                            VK_FORMAT_G8_B8_R8_3PLANE_444_UNORM,
-                                                            VK_FORMAT_R10X6G10X6B10X6A10X6_UNORM_4PACK16,
-                                                            VK_FORMAT_G10X6B10X6G10X6R10X6_422_UNORM_4PACK16,
-                                                            VK_FORMAT_B10X6G10X6R10X6G10X6_422_UNORM_4PACK16,
-                                                            VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_420_UNORM_3PACK16,
-                                                            VK_FORMAT_G10X6_B10X6R10X6_2PLANE_420_UNORM_3PACK16,
-                                                            VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_422_UNORM_3PACK16,
-                                                            VK_FORMAT_G10X6_B10X6R10X6_2PLANE_422_UNORM_3PACK16,
-                                                            VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_444_UNORM_3PACK16,
-                                                            VK_FORMAT_R12X4G12X4B12X4A12X4_UNORM_4PACK16,
-                                                            VK_FORMAT_G12X4B12X4G12X4R12X4_422_UNORM_4PACK16,
-                                                            VK_FORMAT_B12X4G12X4R12X4G12X4_422_UNORM_4PACK16,
-                                                            VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_420_UNORM_3PACK16,
-                                                            VK_FORMAT_G12X4_B12X4R12X4_2PLANE_420_UNORM_3PACK16,
-                                                            VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_422_UNORM_3PACK16,
-                                                            VK_FORMAT_G12X4_B12X4R12X4_2PLANE_422_UNORM_3PACK16,
-                                                            VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_444_UNORM_3PACK16,
-                                                            VK_FORMAT_G16B16G16R16_422_UNORM,
-                                                            VK_FORMAT_B16G16R16G16_422_UNORM,
-                                                            VK_FORMAT_G16_B16_R16_3PLANE_420_UNORM,
-                                                            VK_FORMAT_G16_B16R16_2PLANE_420_UNORM,
-                                                            VK_FORMAT_G16_B16_R16_3PLANE_422_UNORM,
-                                                            VK_FORMAT_G16_B16R16_2PLANE_422_UNORM,
-                                                            VK_FORMAT_G16_B16_R16_3PLANE_444_UNORM};
+static const VkFormat kVkFormatsRequiringYcbcrConversion[] = {VK_FORMAT_G8B8G8R8_422_UNORM,
+                                                              VK_FORMAT_B8G8R8G8_422_UNORM,
+                                                              VK_FORMAT_G8_B8_R8_3PLANE_420_UNORM,
+                                                              VK_FORMAT_G8_B8R8_2PLANE_420_UNORM,
+                                                              VK_FORMAT_G8_B8_R8_3PLANE_422_UNORM,
+                                                              VK_FORMAT_G8_B8R8_2PLANE_422_UNORM,
+                                                              VK_FORMAT_G8_B8_R8_3PLANE_444_UNORM,
+                                                              VK_FORMAT_R10X6G10X6B10X6A10X6_UNORM_4PACK16,
+                                                              VK_FORMAT_G10X6B10X6G10X6R10X6_422_UNORM_4PACK16,
+                                                              VK_FORMAT_B10X6G10X6R10X6G10X6_422_UNORM_4PACK16,
+                                                              VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_420_UNORM_3PACK16,
+                                                              VK_FORMAT_G10X6_B10X6R10X6_2PLANE_420_UNORM_3PACK16,
+                                                              VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_422_UNORM_3PACK16,
+                                                              VK_FORMAT_G10X6_B10X6R10X6_2PLANE_422_UNORM_3PACK16,
+                                                              VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_444_UNORM_3PACK16,
+                                                              VK_FORMAT_R12X4G12X4B12X4A12X4_UNORM_4PACK16,
+                                                              VK_FORMAT_G12X4B12X4G12X4R12X4_422_UNORM_4PACK16,
+                                                              VK_FORMAT_B12X4G12X4R12X4G12X4_422_UNORM_4PACK16,
+                                                              VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_420_UNORM_3PACK16,
+                                                              VK_FORMAT_G12X4_B12X4R12X4_2PLANE_420_UNORM_3PACK16,
+                                                              VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_422_UNORM_3PACK16,
+                                                              VK_FORMAT_G12X4_B12X4R12X4_2PLANE_422_UNORM_3PACK16,
+                                                              VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_444_UNORM_3PACK16,
+                                                              VK_FORMAT_G16B16G16R16_422_UNORM,
+                                                              VK_FORMAT_B16G16R16G16_422_UNORM,
+                                                              VK_FORMAT_G16_B16_R16_3PLANE_420_UNORM,
+                                                              VK_FORMAT_G16_B16R16_2PLANE_420_UNORM,
+                                                              VK_FORMAT_G16_B16_R16_3PLANE_422_UNORM,
+                                                              VK_FORMAT_G16_B16R16_2PLANE_422_UNORM,
+                                                              VK_FORMAT_G16_B16_R16_3PLANE_444_UNORM};
 
 VK_LAYER_EXPORT bool FormatRequiresYcbcrConversion(VkFormat format) {
-    auto it = kVkFormatsRequiringYcbcrConversion.find(format);
-    return (it != kVkFormatsRequiringYcbcrConversion.end());
+    return (GetFormatTraits(format).flags & kFormatRequiresYcbcrConversion) != 0;
 }
 
 VK_LAYER_EXPORT bool FormatIsXChromaSubsampled(VkFormat format) {
@@ -1523,3 +1538,145 @@ VK_LAYER_EXPORT VkDeviceSize GetIndexAlignment(VkIndexType indexType) {
             return 1;
     }
 }
+
+// Dense table of FormatTraits.  The core formats are indexed directly by value.  Extension formats are numbered
+// 1000000000 + 1000 * (extension number - 1) + offset, and each extension that adds formats gets its own block of records,
+// found through a short list of those blocks.  The blocks and the size of the core range are taken from kVkFormatTable, so
+// a new format only needs to be added there (and to the switches that describe it).
+class FormatTraitsTable {
+  public:
+    FormatTraitsTable();
+
+    const FormatTraits &Get(VkFormat format) const {
+        const uint32_t value = static_cast<uint32_t>(format);
+        if (value < core_count_) return traits_[value];
+        const uint32_t index = Index(format);
+        return (index < traits_.size()) ? traits_[index] : unknown_;
+    }
+
+  private:
+    static const uint32_t kExtensionBase = 1000000000;
+    static const uint32_t kExtensionBlockSize = 1000;
+
+    struct ExtensionBlock {
+        uint32_t block;        // Extension number - 1
+        uint32_t count;        // Offsets [0, count) are in the table
+        uint32_t first_index;  // Index of the record for offset 0
+    };
+
+    uint32_t Index(VkFormat format) const {
+        const uint32_t value = static_cast<uint32_t>(format);
+        if (value < core_count_) return value;
+        if (value >= kExtensionBase) {
+            const uint32_t block = (value - kExtensionBase) / kExtensionBlockSize;
+            const uint32_t offset = (value - kExtensionBase) % kExtensionBlockSize;
+            for (const auto &extension_block : extension_blocks_) {
+                if (extension_block.block == block) {
+                    return (offset < extension_block.count) ? extension_block.first_index + offset : kInvalidIndex;
+                }
+            }
+        }
+        return kInvalidIndex;
+    }
+
+    static FormatTraits ComputeFormatTraits(VkFormat format);
+
+    static const uint32_t kInvalidIndex = UINT32_MAX;
+    uint32_t core_count_;
+    std::vector<ExtensionBlock> extension_blocks_;
+    std::vector<FormatTraits> traits_;
+    FormatTraits unknown_;
+};
+
+FormatTraits FormatTraitsTable::ComputeFormatTraits(VkFormat format) {
+    FormatTraits traits = {};
+    traits.format_class = VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT;
+    traits.multiplane_index = kNotMultiplane;
+
+    const VkExtent3D block_extent = ComputeTexelBlockExtent(format);
+    traits.block_extent[0] = static_cast<uint8_t>(block_extent.width);
+    traits.block_extent[1] = static_cast<uint8_t>(block_extent.height);
+    traits.block_extent[2] = static_cast<uint8_t>(block_extent.depth);
+    traits.plane_count = static_cast<uint8_t>(ComputePlaneCount(format));
+    if (FormatDepthSize(format)) traits.depth_stencil_aspects |= VK_IMAGE_ASPECT_DEPTH_BIT;
+    if (FormatStencilSize(format)) traits.depth_stencil_aspects |= VK_IMAGE_ASPECT_STENCIL_BIT;
+
+    if (ComputeFormatIsUNorm(format)) traits.flags |= kFormatUNorm;
+    if (ComputeFormatIsSNorm(format)) traits.flags |= kFormatSNorm;
+    if (ComputeFormatIsUScaled(format)) traits.flags |= kFormatUScaled;
+    if (ComputeFormatIsSScaled(format)) traits.flags |= kFormatSScaled;
+    if (ComputeFormatIsUInt(format)) traits.flags |= kFormatUInt;
+    if (ComputeFormatIsSInt(format)) traits.flags |= kFormatSInt;
+    if (ComputeFormatIsFloat(format)) traits.flags |= kFormatFloat;
+    if (ComputeFormatIsSRGB(format)) traits.flags |= kFormatSRGB;
+    if (FormatIsCompressed_ASTC(format) || FormatIsCompressed_BC(format) || FormatIsCompressed_ETC2_EAC(format) ||
+        FormatIsCompressed_PVRTC(format)) {
+        traits.flags |= kFormatCompressed;
+    }
+    return traits;
+}
+
+FormatTraitsTable::FormatTraitsTable() : core_count_(0) {
+    for (const auto &entry : kVkFormatTable) {
+        const uint32_t value = static_cast<uint32_t>(entry.format);
+        if (value < kExtensionBase) {
+            core_count_ = std::max(core_count_, value + 1);
+            continue;
+        }
+        const uint32_t block = (value - kExtensionBase) / kExtensionBlockSize;
+        const uint32_t offset = (value - kExtensionBase) % kExtensionBlockSize;
+        auto extension_block = std::find_if(extension_blocks_.begin(), extension_blocks_.end(),
+                                            [block](const ExtensionBlock &candidate) { return candidate.block == block; });
+        if (extension_block == extension_blocks_.end()) {
+            extension_blocks_.push_back({block, offset + 1, 0});
+        } else {
+            extension_block->count = std::max(extension_block->count, offset + 1);
+        }
+    }
+
+    uint32_t record_count = core_count_;
+    for (auto &extension_block : extension_blocks_) {
+        extension_block.first_index = record_count;
+        record_count += extension_block.count;
+    }
+    traits_.resize(record_count);
+    for (uint32_t value = 0; value < core_count_; ++value) {
+        traits_[value] = ComputeFormatTraits(static_cast<VkFormat>(value));
+    }
+    for (const auto &extension_block : extension_blocks_) {
+        for (uint32_t offset = 0; offset < extension_block.count; ++offset) {
+            const uint32_t value = kExtensionBase + extension_block.block * kExtensionBlockSize + offset;
+            traits_[extension_block.first_index + offset] = ComputeFormatTraits(static_cast<VkFormat>(value));
+        }
+    }
+    unknown_ = ComputeFormatTraits(VK_FORMAT_MAX_ENUM);
+
+    for (const auto &entry : kVkFormatTable) {
+        FormatTraits &traits = traits_[Index(entry.format)];
+        traits.size = entry.info.size;
+        traits.channel_count = static_cast<uint8_t>(entry.info.channel_count);
+        traits.format_class = static_cast<uint8_t>(entry.info.format_class);
+    }
+    // Every format below is also in kVkFormatTable, but check rather than assume
+    const uint32_t multiplane_count = sizeof(kVkMultiplaneCompatibilityTable) / sizeof(kVkMultiplaneCompatibilityTable[0]);
+    static_assert(multiplane_count < kNotMultiplane, "FormatTraits::multiplane_index is too small");
+    for (uint32_t i = 0; i < multiplane_count; ++i) {
+        const uint32_t index = Index(kVkMultiplaneCompatibilityTable[i].format);
+        if (index < traits_.size()) traits_[index].multiplane_index = static_cast<uint8_t>(i);
+    }
+    for (const auto format : kVkFormatsRequiringYcbcrConversion) {
+        const uint32_t index = Index(format);
+        if (index < traits_.size()) traits_[index].flags |= kFormatRequiresYcbcrConversion;
+    }
+}
+
+static const FormatTraits &GetFormatTraits(VkFormat format) {
+    // Built on first use, which C++11 makes thread safe
+    static const FormatTraitsTable table;
+    return table.Get(format);
+}
+
+static const VULKAN_MULTIPLANE_COMPATIBILITY *GetMultiplaneCompatibility(const FormatTraits &traits) {
+    return (traits.multiplane_index != kNotMultiplane) ? &kVkMultiplaneCompatibilityTable[traits.multiplane_index].compatibility
+                                                       : nullptr;
+}
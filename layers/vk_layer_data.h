@@ -192,6 +192,13 @@ class small_vector {
         return GetWorkingStore()[size_ - 1];
     }
 
+    // Like std::vector::pop_back, calling pop_back on an empty container causes undefined behavior
+    void pop_back() {
+        assert(size_ > 0);
+        back().~value_type();
+        size_--;
+    }
+
     bool empty() const { return size_ == 0; }
 
     template <class... Args>
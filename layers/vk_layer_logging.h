@@ -647,15 +647,21 @@ static inline int vasprintf(char **strp, char const *fmt, va_list ap) {
 }
 #endif
 
+// True if the message is in the filter list of messages to ignore
+static inline bool LogMsgIsFiltered(const debug_report_data *debug_data, const std::string &vuid_text) {
+    size_t message_id = XXH32(vuid_text.c_str(), strlen(vuid_text.c_str()), 8);
+    return std::find(debug_data->filter_message_ids.begin(), debug_data->filter_message_ids.end(),
+                     static_cast<uint32_t>(message_id)) != debug_data->filter_message_ids.end();
+}
+
 static inline bool LogMsgLocked(const debug_report_data *debug_data, VkFlags msg_flags, const LogObjectList &objects,
                                 const std::string &vuid_text, char *err_msg) {
-    std::string str_plus_spec_text(err_msg ? err_msg : "Allocation failure");
-
     // If message is in filter list, bail out very early
-    size_t message_id = XXH32(vuid_text.c_str(), strlen(vuid_text.c_str()), 8);
-    if (std::find(debug_data->filter_message_ids.begin(), debug_data->filter_message_ids.end(),
-                  static_cast<uint32_t>(message_id)) != debug_data->filter_message_ids.end())
+    if (LogMsgIsFiltered(debug_data, vuid_text)) {
+        free(err_msg);
         return false;
+    }
+    std::string str_plus_spec_text(err_msg ? err_msg : "Allocation failure");
 
     // Append the spec error text to the error message, unless it's an UNASSIGNED or UNDEFINED vuid
     if ((vuid_text.find("UNASSIGNED-") == std::string::npos) && (vuid_text.find(kVUIDUndefined) == std::string::npos) &&
@@ -715,6 +721,31 @@ static inline bool LogMsgLocked(const debug_report_data *debug_data, VkFlags msg
     return result;
 }
 
+// A message logged while validation runs on a parallel validation worker, held so that it can be reported in the same order
+// as serial validation would have produced it
+struct DeferredLogMessage {
+    VkFlags msg_flags;
+    LogObjectList objects;
+    std::string vuid_text;
+    char *err_msg;  // Owned; released by LogDeferredMessages or DiscardDeferredMessages
+};
+
+static inline bool LogDeferredMessages(const debug_report_data *debug_data, std::vector<DeferredLogMessage> &messages) {
+    std::unique_lock<std::mutex> lock(debug_data->debug_output_mutex);
+    bool skip = false;
+    for (auto &message : messages) {
+        skip |= LogMsgLocked(debug_data, message.msg_flags, message.objects, message.vuid_text, message.err_msg);
+        message.err_msg = nullptr;
+    }
+    messages.clear();
+    return skip;
+}
+
+static inline void DiscardDeferredMessages(std::vector<DeferredLogMessage> &messages) {
+    for (auto &message : messages) free(message.err_msg);
+    messages.clear();
+}
+
 static inline VKAPI_ATTR VkBool32 VKAPI_CALL report_log_callback(VkFlags msg_flags, VkDebugReportObjectTypeEXT obj_type,
                                                                  uint64_t src_object, size_t location, int32_t msg_code,
                                                                  const char *layer_prefix, const char *message, void *user_data) {
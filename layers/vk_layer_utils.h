@@ -21,9 +21,16 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cassert>
+#include <condition_variable>
 #include <cstddef>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <stdbool.h>
 #include <string>
 #include <vector>
@@ -188,6 +195,50 @@ static inline uint32_t SampleCountSize(VkSampleCountFlagBits sample_count) {
     return size;
 }
 
+// Dense index of each VkDescriptorType, for per-type descriptor counts kept in flat arrays
+enum DescriptorTypeIndex : uint32_t {
+    kDescriptorTypeIndexCoreCount = VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT + 1,
+    kDescriptorTypeIndexInlineUniformBlock = kDescriptorTypeIndexCoreCount,
+    kDescriptorTypeIndexAccelerationStructureKHR,
+    kDescriptorTypeIndexAccelerationStructureNV,
+    kDescriptorTypeIndexMutable,
+    kDescriptorTypeIndexUnknown,  // Any other value; these are rejected by parameter validation
+    kDescriptorTypeIndexCount,
+};
+typedef std::array<uint32_t, kDescriptorTypeIndexCount> DescriptorTypeCounts;
+
+static inline uint32_t DescriptorTypeToIndex(VkDescriptorType type) {
+    if (static_cast<uint32_t>(type) < kDescriptorTypeIndexCoreCount) return static_cast<uint32_t>(type);
+    switch (type) {
+        case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT:
+            return kDescriptorTypeIndexInlineUniformBlock;
+        case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
+            return kDescriptorTypeIndexAccelerationStructureKHR;
+        case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
+            return kDescriptorTypeIndexAccelerationStructureNV;
+        case VK_DESCRIPTOR_TYPE_MUTABLE_VALVE:
+            return kDescriptorTypeIndexMutable;
+        default:
+            return kDescriptorTypeIndexUnknown;
+    }
+}
+
+static inline VkDescriptorType DescriptorTypeFromIndex(uint32_t index) {
+    if (index < kDescriptorTypeIndexCoreCount) return static_cast<VkDescriptorType>(index);
+    switch (index) {
+        case kDescriptorTypeIndexInlineUniformBlock:
+            return VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT;
+        case kDescriptorTypeIndexAccelerationStructureKHR:
+            return VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR;
+        case kDescriptorTypeIndexAccelerationStructureNV:
+            return VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV;
+        case kDescriptorTypeIndexMutable:
+            return VK_DESCRIPTOR_TYPE_MUTABLE_VALVE;
+        default:
+            return VK_DESCRIPTOR_TYPE_MAX_ENUM;
+    }
+}
+
 static inline bool IsIdentitySwizzle(VkComponentMapping components) {
     // clang-format off
     return (
@@ -419,3 +470,168 @@ class vl_concurrent_unordered_map {
         return hash;
     }
 };
+
+// Small pool of persistent worker threads for fanning independent work out across cores.
+//
+// Run(count, task) calls task(i) for each i in [0, count) and returns once all have completed, with the calling thread
+// taking its share of the work.  One Run is in flight at a time; a Run that finds the pool busy executes inline on the
+// calling thread rather than waiting, so concurrent API calls never serialize behind one another.
+class ValidationWorkerPool {
+  public:
+    explicit ValidationWorkerPool(uint32_t worker_count) {
+        for (uint32_t i = 0; i < worker_count; ++i) {
+            workers_.emplace_back([this]() { WorkerLoop(); });
+        }
+    }
+    ~ValidationWorkerPool() {
+        {
+            std::lock_guard<std::mutex> guard(lock_);
+            shutdown_ = true;
+        }
+        work_ready_.notify_all();
+        for (auto &worker : workers_) worker.join();
+    }
+
+    uint32_t WorkerCount() const { return static_cast<uint32_t>(workers_.size()); }
+
+    void Run(uint32_t count, const std::function<void(uint32_t)> &task) {
+        std::unique_lock<std::mutex> run_guard(run_lock_, std::try_to_lock);
+        if (!run_guard.owns_lock() || workers_.empty() || (count < 2)) {
+            for (uint32_t i = 0; i < count; ++i) task(i);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> guard(lock_);
+            task_ = &task;
+            count_ = count;
+            next_.store(0);
+            remaining_ = count;
+            ++generation_;
+        }
+        work_ready_.notify_all();
+        DoWork(task, count);
+
+        std::unique_lock<std::mutex> guard(lock_);
+        // Wait for the workers to leave DoWork too, so none can claim an index of the next Run with this task
+        work_done_.wait(guard, [this]() { return (remaining_ == 0) && (active_ == 0); });
+        task_ = nullptr;
+    }
+
+  private:
+    void DoWork(const std::function<void(uint32_t)> &task, uint32_t count) {
+        uint32_t completed = 0;
+        for (uint32_t i = next_.fetch_add(1); i < count; i = next_.fetch_add(1)) {
+            task(i);
+            ++completed;
+        }
+        if (completed) {
+            std::lock_guard<std::mutex> guard(lock_);
+            remaining_ -= completed;
+            if (remaining_ == 0) work_done_.notify_all();
+        }
+    }
+
+    void WorkerLoop() {
+        uint64_t seen_generation = 0;
+        std::unique_lock<std::mutex> guard(lock_);
+        while (true) {
+            work_ready_.wait(guard, [this, seen_generation]() { return shutdown_ || (generation_ != seen_generation); });
+            if (shutdown_) return;
+            seen_generation = generation_;
+            if (!task_) continue;
+            const std::function<void(uint32_t)> &task = *task_;
+            const uint32_t count = count_;
+            ++active_;
+            guard.unlock();
+            DoWork(task, count);
+            guard.lock();
+            if (--active_ == 0) work_done_.notify_all();
+        }
+    }
+
+    std::vector<std::thread> workers_;
+    std::mutex run_lock_;
+    std::mutex lock_;
+    std::condition_variable work_ready_;
+    std::condition_variable work_done_;
+    const std::function<void(uint32_t)> *task_ = nullptr;
+    uint32_t count_ = 0;
+    std::atomic<uint32_t> next_{0};
+    uint32_t remaining_ = 0;
+    uint32_t active_ = 0;
+    uint64_t generation_ = 0;
+    bool shutdown_ = false;
+};
+
+// Bump allocator for objects that are all released together.  Memory comes from chunks of at least chunk_size bytes,
+// which are kept by Reset() for reuse, so that a steady allocate/reset cycle stops allocating from the heap after its
+// first pass.  The objects placed in the arena must be destroyed by their owner before Reset().
+class LinearArena {
+  public:
+    explicit LinearArena(size_t chunk_size) : chunk_size_(chunk_size) {}
+
+    void *Allocate(size_t size, size_t alignment) {
+        while (current_ < chunks_.size()) {
+            auto &chunk = chunks_[current_];
+            const size_t aligned_offset = (offset_ + alignment - 1) & ~(alignment - 1);
+            if (aligned_offset + size <= chunk.size) {
+                offset_ = aligned_offset + size;
+                return chunk.data.get() + aligned_offset;
+            }
+            ++current_;
+            offset_ = 0;
+        }
+        // Chunks from new[] are suitably aligned for any fundamental type
+        Chunk chunk;
+        chunk.size = std::max(size, chunk_size_);
+        chunk.data.reset(new uint8_t[chunk.size]);
+        chunks_.emplace_back(std::move(chunk));
+        offset_ = size;
+        return chunks_.back().data.get();
+    }
+
+    void Reset() {
+        current_ = 0;
+        offset_ = 0;
+    }
+
+  private:
+    struct Chunk {
+        std::unique_ptr<uint8_t[]> data;
+        size_t size;
+    };
+    std::vector<Chunk> chunks_;
+    const size_t chunk_size_;
+    size_t current_ = 0;  // Chunk being allocated from
+    size_t offset_ = 0;   // First free byte in chunks_[current_]
+};
+
+// Allocator over a LinearArena, for containers and std::allocate_shared.  Deallocation is a no-op; the memory is
+// reclaimed when the arena is reset.
+template <typename T>
+class LinearArenaAllocator {
+  public:
+    typedef T value_type;
+
+    explicit LinearArenaAllocator(LinearArena *arena) : arena_(arena) {}
+    template <typename U>
+    LinearArenaAllocator(const LinearArenaAllocator<U> &other) : arena_(other.arena_) {}
+
+    T *allocate(size_t n) { return static_cast<T *>(arena_->Allocate(n * sizeof(T), alignof(T))); }
+    void deallocate(T *, size_t) {}
+
+    template <typename U>
+    bool operator==(const LinearArenaAllocator<U> &other) const {
+        return arena_ == other.arena_;
+    }
+    template <typename U>
+    bool operator!=(const LinearArenaAllocator<U> &other) const {
+        return arena_ != other.arena_;
+    }
+
+  private:
+    template <typename U>
+    friend class LinearArenaAllocator;
+    LinearArena *arena_;
+};
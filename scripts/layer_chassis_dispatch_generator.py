@@ -672,112 +672,62 @@ void DispatchDestroyDescriptorUpdateTemplateKHR(VkDevice device, VkDescriptorUpd
     layer_data->device_dispatch_table.DestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
 }
 
+// Copy the descriptor infos read by the template from pData to a buffer owned by the calling thread, unwrapping their handles
+// on the way.  The buffer is reused by the thread's next update, so callers don't free it.
 void *BuildUnwrappedUpdateTemplateBuffer(ValidationObject *layer_data, uint64_t descriptorUpdateTemplate, const void *pData) {
     auto const template_map_entry = layer_data->desc_template_createinfo_map.find(descriptorUpdateTemplate);
     auto const &create_info = template_map_entry->second->create_info;
-    size_t allocation_size = 0;
-    std::vector<std::tuple<size_t, VulkanObjectType, uint64_t, size_t>> template_entries;
+    thread_local std::vector<uint8_t> unwrapped_data;
+    if (unwrapped_data.size() < template_map_entry->second->data_size) {
+        unwrapped_data.resize(template_map_entry->second->data_size);
+    }
+    const uint8_t *source_data = static_cast<const uint8_t *>(pData);
 
     for (uint32_t i = 0; i < create_info.descriptorUpdateEntryCount; i++) {
-        for (uint32_t j = 0; j < create_info.pDescriptorUpdateEntries[i].descriptorCount; j++) {
-            size_t offset = create_info.pDescriptorUpdateEntries[i].offset + j * create_info.pDescriptorUpdateEntries[i].stride;
-            char *update_entry = (char *)(pData) + offset;
+        const auto &update_entry = create_info.pDescriptorUpdateEntries[i];
+        if (update_entry.descriptorType == VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT) {
+            // nothing to unwrap, just plain data
+            memcpy(unwrapped_data.data() + update_entry.offset, source_data + update_entry.offset, update_entry.descriptorCount);
+            continue;
+        }
+        for (uint32_t j = 0; j < update_entry.descriptorCount; j++) {
+            const size_t offset = update_entry.offset + j * update_entry.stride;
+            const uint8_t *source = source_data + offset;
+            uint8_t *destination = unwrapped_data.data() + offset;
 
-            switch (create_info.pDescriptorUpdateEntries[i].descriptorType) {
+            switch (update_entry.descriptorType) {
                 case VK_DESCRIPTOR_TYPE_SAMPLER:
                 case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
                 case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
                 case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
                 case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT: {
-                    auto image_entry = reinterpret_cast<VkDescriptorImageInfo *>(update_entry);
-                    allocation_size = std::max(allocation_size, offset + sizeof(VkDescriptorImageInfo));
-
-                    VkDescriptorImageInfo *wrapped_entry = new VkDescriptorImageInfo(*image_entry);
-                    wrapped_entry->sampler = layer_data->Unwrap(image_entry->sampler);
-                    wrapped_entry->imageView = layer_data->Unwrap(image_entry->imageView);
-                    template_entries.emplace_back(offset, kVulkanObjectTypeImage, CastToUint64(wrapped_entry), 0);
+                    auto image_entry = reinterpret_cast<VkDescriptorImageInfo *>(destination);
+                    *image_entry = *reinterpret_cast<const VkDescriptorImageInfo *>(source);
+                    image_entry->sampler = layer_data->Unwrap(image_entry->sampler);
+                    image_entry->imageView = layer_data->Unwrap(image_entry->imageView);
                 } break;
 
                 case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
                 case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
                 case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
                 case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC: {
-                    auto buffer_entry = reinterpret_cast<VkDescriptorBufferInfo *>(update_entry);
-                    allocation_size = std::max(allocation_size, offset + sizeof(VkDescriptorBufferInfo));
-
-                    VkDescriptorBufferInfo *wrapped_entry = new VkDescriptorBufferInfo(*buffer_entry);
-                    wrapped_entry->buffer = layer_data->Unwrap(buffer_entry->buffer);
-                    template_entries.emplace_back(offset, kVulkanObjectTypeBuffer, CastToUint64(wrapped_entry), 0);
+                    auto buffer_entry = reinterpret_cast<VkDescriptorBufferInfo *>(destination);
+                    *buffer_entry = *reinterpret_cast<const VkDescriptorBufferInfo *>(source);
+                    buffer_entry->buffer = layer_data->Unwrap(buffer_entry->buffer);
                 } break;
 
                 case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
-                case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER: {
-                    auto buffer_view_handle = reinterpret_cast<VkBufferView *>(update_entry);
-                    allocation_size = std::max(allocation_size, offset + sizeof(VkBufferView));
-
-                    VkBufferView wrapped_entry = layer_data->Unwrap(*buffer_view_handle);
-                    template_entries.emplace_back(offset, kVulkanObjectTypeBufferView, CastToUint64(wrapped_entry), 0);
-                } break;
-                case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT: {
-                    size_t numBytes = create_info.pDescriptorUpdateEntries[i].descriptorCount;
-                    allocation_size = std::max(allocation_size, offset + numBytes);
-                    // nothing to unwrap, just plain data
-                    template_entries.emplace_back(offset, kVulkanObjectTypeUnknown, CastToUint64(update_entry),
-                                                  numBytes);
-                    // to break out of the loop
-                    j = create_info.pDescriptorUpdateEntries[i].descriptorCount;
-                } break;
-                case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:{
-                    auto accstruct_nv_handle = reinterpret_cast<VkAccelerationStructureNV *>(update_entry);
-                    allocation_size = std::max(allocation_size, offset + sizeof(VkAccelerationStructureNV ));
-
-                    VkAccelerationStructureNV  wrapped_entry = layer_data->Unwrap(*accstruct_nv_handle);
-                    template_entries.emplace_back(offset, kVulkanObjectTypeAccelerationStructureNV, CastToUint64(wrapped_entry), 0);
-                } break;
-                case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR: {
-                    auto accstruct_khr_handle = reinterpret_cast<VkAccelerationStructureKHR *>(update_entry);
-                    allocation_size = std::max(allocation_size, offset + sizeof(VkAccelerationStructureKHR ));
-
-                    VkAccelerationStructureKHR  wrapped_entry = layer_data->Unwrap(*accstruct_khr_handle);
-                    template_entries.emplace_back(offset, kVulkanObjectTypeAccelerationStructureKHR, CastToUint64(wrapped_entry), 0);
-                } break;
-                default:
-                    assert(0);
-                    break;
-            }
-        }
-    }
-    // Allocate required buffer size and populate with source/unwrapped data
-    void *unwrapped_data = malloc(allocation_size);
-    for (auto &this_entry : template_entries) {
-        VulkanObjectType type = std::get<1>(this_entry);
-        void *destination = (char *)unwrapped_data + std::get<0>(this_entry);
-        uint64_t source = std::get<2>(this_entry);
-        size_t size = std::get<3>(this_entry);
-
-        if (size != 0) {
-            assert(type == kVulkanObjectTypeUnknown);
-            memcpy(destination, CastFromUint64<void *>(source), size);
-        } else {
-            switch (type) {
-                case kVulkanObjectTypeImage:
-                    *(reinterpret_cast<VkDescriptorImageInfo *>(destination)) =
-                        *(reinterpret_cast<VkDescriptorImageInfo *>(source));
-                    delete CastFromUint64<VkDescriptorImageInfo *>(source);
-                    break;
-                case kVulkanObjectTypeBuffer:
-                    *(reinterpret_cast<VkDescriptorBufferInfo *>(destination)) =
-                        *(CastFromUint64<VkDescriptorBufferInfo *>(source));
-                    delete CastFromUint64<VkDescriptorBufferInfo *>(source);
-                    break;
-                case kVulkanObjectTypeBufferView:
-                    *(reinterpret_cast<VkBufferView *>(destination)) = CastFromUint64<VkBufferView>(source);
+                case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                    *reinterpret_cast<VkBufferView *>(destination) =
+                        layer_data->Unwrap(*reinterpret_cast<const VkBufferView *>(source));
                     break;
-                case kVulkanObjectTypeAccelerationStructureKHR:
-                    *(reinterpret_cast<VkAccelerationStructureKHR *>(destination)) = CastFromUint64<VkAccelerationStructureKHR>(source);
+                case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
+                    *reinterpret_cast<VkAccelerationStructureNV *>(destination) =
+                        layer_data->Unwrap(*reinterpret_cast<const VkAccelerationStructureNV *>(source));
                     break;
-                case kVulkanObjectTypeAccelerationStructureNV:
-                    *(reinterpret_cast<VkAccelerationStructureNV *>(destination)) = CastFromUint64<VkAccelerationStructureNV>(source);
+                case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
+                    *reinterpret_cast<VkAccelerationStructureKHR *>(destination) =
+                        layer_data->Unwrap(*reinterpret_cast<const VkAccelerationStructureKHR *>(source));
                     break;
                 default:
                     assert(0);
@@ -785,7 +735,7 @@ void *BuildUnwrappedUpdateTemplateBuffer(ValidationObject *layer_data, uint64_t
             }
         }
     }
-    return (void *)unwrapped_data;
+    return unwrapped_data.data();
 }
 
 void DispatchUpdateDescriptorSetWithTemplate(VkDevice device, VkDescriptorSet descriptorSet,
@@ -803,7 +753,6 @@ void DispatchUpdateDescriptorSetWithTemplate(VkDevice device, VkDescriptorSet de
         unwrapped_buffer = BuildUnwrappedUpdateTemplateBuffer(layer_data, template_handle, pData);
     }
     layer_data->device_dispatch_table.UpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, unwrapped_buffer);
-    free(unwrapped_buffer);
 }
 
 void DispatchUpdateDescriptorSetWithTemplateKHR(VkDevice device, VkDescriptorSet descriptorSet,
@@ -821,7 +770,6 @@ void DispatchUpdateDescriptorSetWithTemplateKHR(VkDevice device, VkDescriptorSet
         unwrapped_buffer = BuildUnwrappedUpdateTemplateBuffer(layer_data, template_handle, pData);
     }
     layer_data->device_dispatch_table.UpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, unwrapped_buffer);
-    free(unwrapped_buffer);
 }
 
 void DispatchCmdPushDescriptorSetWithTemplateKHR(VkCommandBuffer commandBuffer,
@@ -841,7 +789,6 @@ void DispatchCmdPushDescriptorSetWithTemplateKHR(VkCommandBuffer commandBuffer,
     }
     layer_data->device_dispatch_table.CmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set,
                                                                  unwrapped_buffer);
-    free(unwrapped_buffer);
 }
 
 VkResult DispatchGetPhysicalDeviceDisplayPropertiesKHR(VkPhysicalDevice physicalDevice, uint32_t *pPropertyCount,
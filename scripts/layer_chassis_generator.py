@@ -209,6 +209,58 @@ class LayerChassisOutputGenerator(OutputGenerator):
         'vkDestroyDebugUtilsMessengerEXT' : 'layer_destroy_callback(layer_data->report_data, messenger, pAllocator);',
         }
 
+    # Entry points whose validation is costly enough to fan out across ValidationObjects when
+    # VALIDATION_CHECK_ENABLE_PARALLEL_VALIDATE is set (the pipeline creation functions are special-cased below)
+    parallel_validate_functions = [
+        'vkQueueSubmit',
+        'vkUpdateDescriptorSets',
+        ]
+
+    # Entry points that feed the ValidationSampler enabled by the sampling_rate layer setting, before and after the dispatch
+    validation_sampler_hooks = {
+        'vkBeginCommandBuffer' : 'BeginCommandBuffer(commandBuffer)',
+        'vkFreeCommandBuffers' : 'FreeCommandBuffers(commandBufferCount, pCommandBuffers)',
+        'vkDestroyCommandPool' : 'DestroyCommandPool(commandPool)',
+        'vkQueuePresentKHR' : 'QueuePresent()',
+        }
+    validation_sampler_post_hooks = {
+        'vkAllocateCommandBuffers' : 'AllocateCommandBuffers(pAllocateInfo, pCommandBuffers)',
+        }
+
+    # Commands whose core checks the ValidationSampler can leave out of unselected recordings.  Core validation still records
+    # their state, so this is limited to commands whose state recording is safe with arguments that would fail validation.
+    sampled_validation_commands = [
+        'vkCmdBindIndexBuffer',
+        'vkCmdBindVertexBuffers',
+        'vkCmdCopyBuffer',
+        'vkCmdCopyBuffer2KHR',
+        'vkCmdDispatch',
+        'vkCmdDispatchBase',
+        'vkCmdDispatchBaseKHR',
+        'vkCmdDispatchIndirect',
+        'vkCmdDraw',
+        'vkCmdDrawIndexed',
+        'vkCmdDrawIndexedIndirect',
+        'vkCmdDrawIndexedIndirectCount',
+        'vkCmdDrawIndexedIndirectCountAMD',
+        'vkCmdDrawIndexedIndirectCountKHR',
+        'vkCmdDrawIndirect',
+        'vkCmdDrawIndirectCount',
+        'vkCmdDrawIndirectCountAMD',
+        'vkCmdDrawIndirectCountKHR',
+        'vkCmdFillBuffer',
+        'vkCmdSetBlendConstants',
+        'vkCmdSetDepthBias',
+        'vkCmdSetDepthBounds',
+        'vkCmdSetLineWidth',
+        'vkCmdSetScissor',
+        'vkCmdSetStencilCompareMask',
+        'vkCmdSetStencilReference',
+        'vkCmdSetStencilWriteMask',
+        'vkCmdSetViewport',
+        'vkCmdUpdateBuffer',
+        ]
+
     precallvalidate_loop = "for (auto intercept : layer_data->object_dispatch) {"
     precallrecord_loop = precallvalidate_loop
     postcallrecord_loop = "for (auto intercept : layer_data->object_dispatch) {"
@@ -241,6 +293,8 @@ class LayerChassisOutputGenerator(OutputGenerator):
 #include "vk_extension_helper.h"
 #include "vk_safe_struct.h"
 #include "vk_typemap_helper.h"
+#include "intercept_stats.h"
+#include "validation_sampler.h"
 
 
 extern std::atomic<uint64_t> global_unique_id;
@@ -281,6 +335,7 @@ enum LayerObjectTypeId {
     LayerObjectTypeDebugPrintf,                 // Instance or device shader debug printf layer object
     LayerObjectTypeCommandCounter,              // Command Counter validation object, child of corechecks
     LayerObjectTypeSyncValidation,              // Instance or device synchronization validation layer object
+    LayerObjectTypeApiCapture,                  // Device API capture object, not a validation check
     LayerObjectTypeMaxEnum,                     // Max enum count
 };
 
@@ -288,9 +343,62 @@ struct TEMPLATE_STATE {
     VkDescriptorUpdateTemplate desc_update_template;
     safe_VkDescriptorUpdateTemplateCreateInfo create_info;
     bool destroyed;
+    // Number of bytes of pData read by an update using this template
+    size_t data_size;
+    // Set by the state tracker: the update entries decoded once against the layout definition held by decoded_layout_def
+    // into the writes of each update, along with the offset into pData of each write's descriptor info.  Left empty for
+    // templates that the state tracker decodes afresh on each update.
+    std::shared_ptr<const void> decoded_layout_def;
+    std::vector<VkWriteDescriptorSet> decoded_writes;
+    std::vector<size_t> decoded_write_offsets;
 
     TEMPLATE_STATE(VkDescriptorUpdateTemplate update_template, safe_VkDescriptorUpdateTemplateCreateInfo *pCreateInfo)
-        : desc_update_template(update_template), create_info(*pCreateInfo), destroyed(false) {}
+        : desc_update_template(update_template),
+          create_info(*pCreateInfo),
+          destroyed(false),
+          data_size(UpdateDataSize(create_info)) {}
+
+    static size_t UpdateDataSize(const safe_VkDescriptorUpdateTemplateCreateInfo &create_info) {
+        size_t data_size = 0;
+        for (uint32_t i = 0; i < create_info.descriptorUpdateEntryCount; i++) {
+            const auto &entry = create_info.pDescriptorUpdateEntries[i];
+            if (entry.descriptorCount == 0) continue;
+            size_t element_size = 0;
+            switch (entry.descriptorType) {
+                case VK_DESCRIPTOR_TYPE_SAMPLER:
+                case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+                case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+                case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+                case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+                    element_size = sizeof(VkDescriptorImageInfo);
+                    break;
+                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+                    element_size = sizeof(VkDescriptorBufferInfo);
+                    break;
+                case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+                case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                    element_size = sizeof(VkBufferView);
+                    break;
+                case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT:
+                    // descriptorCount is the size in bytes of the one block of data
+                    data_size = std::max(data_size, entry.offset + entry.descriptorCount);
+                    continue;
+                case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
+                    element_size = sizeof(VkAccelerationStructureKHR);
+                    break;
+                case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
+                    element_size = sizeof(VkAccelerationStructureNV);
+                    break;
+                default:
+                    break;
+            }
+            data_size = std::max(data_size, entry.offset + (entry.descriptorCount - 1) * entry.stride + element_size);
+        }
+        return data_size;
+    }
 };
 
 class LAYER_PHYS_DEV_PROPERTIES {
@@ -311,6 +419,10 @@ typedef enum ValidationCheckDisables {
 typedef enum ValidationCheckEnables {
     VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ARM,
     VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ALL,
+    VALIDATION_CHECK_ENABLE_PARALLEL_VALIDATE,
+    VALIDATION_CHECK_ENABLE_MAPPED_MEMORY_GUARD,
+    VALIDATION_CHECK_ENABLE_MAPPED_MEMORY_WRITE_TRACKING,
+    VALIDATION_CHECK_ENABLE_API_CAPTURE,
 } ValidationCheckEnables;
 
 typedef enum VkValidationFeatureEnable {
@@ -344,6 +456,10 @@ typedef enum EnableFlags {
     vendor_specific_arm,
     debug_printf,
     sync_validation,
+    parallel_validate,
+    guard_mapped_memory,
+    track_mapped_memory_writes,
+    api_capture,
     // Insert new enables above this line
     kMaxEnableFlags,
 } EnableFlags;
@@ -376,6 +492,17 @@ class ValidationObject {
 
         std::string layer_name = "CHASSIS";
 
+        // Device chassis only: workers for the PreCallValidate fan out enabled by VALIDATION_CHECK_ENABLE_PARALLEL_VALIDATE
+        std::unique_ptr<ValidationWorkerPool> parallel_validation_pool;
+        // Instance chassis only: the sampling_* layer settings for the validation_sampler of each device
+        ValidationSampler::Settings validation_sampler_settings;
+        // Device chassis only: selects the command buffer recordings that get full command validation, see validation_sampler.h
+        std::unique_ptr<ValidationSampler> validation_sampler;
+        // Device chassis only: intercept_vectors for the vkCmd* calls of unselected recordings, without best practices and
+        // synchronization validation, and also without core checks for the sampled_validation_commands
+        std::vector<std::vector<ValidationObject*>> unselected_intercept_vectors;
+        std::vector<std::vector<ValidationObject*>> sampled_out_intercept_vectors;
+
         // Constructor
         ValidationObject(){};
         // Destructor
@@ -432,7 +559,90 @@ class ValidationObject {
             return nullptr;
         };
 
+        void InitUnselectedInterceptVectors() {
+            unselected_intercept_vectors.resize(intercept_vectors.size());
+            sampled_out_intercept_vectors.resize(intercept_vectors.size());
+            for (size_t intercept_id = 0; intercept_id < intercept_vectors.size(); ++intercept_id) {
+                for (auto intercept : intercept_vectors[intercept_id]) {
+                    switch (intercept->container_type) {
+                        case LayerObjectTypeBestPractices:
+                        case LayerObjectTypeSyncValidation:
+                            break;
+                        case LayerObjectTypeCoreValidation:
+                            unselected_intercept_vectors[intercept_id].push_back(intercept);
+                            break;
+                        default:
+                            unselected_intercept_vectors[intercept_id].push_back(intercept);
+                            sampled_out_intercept_vectors[intercept_id].push_back(intercept);
+                    }
+                }
+            }
+        }
+
+        // The intercepts for a vkCmd* call recorded into commandBuffer.  Core checks are left out of unselected recordings only
+        // when sampled, which the chassis only sets for the validation of commands whose state recording stays safe without it.
+        const std::vector<ValidationObject*>& CommandIntercepts(size_t intercept_id, VkCommandBuffer commandBuffer,
+                                                                bool sampled) const {
+            if (validation_sampler && !validation_sampler->IsSelected(commandBuffer)) {
+                return sampled ? sampled_out_intercept_vectors[intercept_id] : unselected_intercept_vectors[intercept_id];
+            }
+            return intercept_vectors[intercept_id];
+        }
+
+        // Run PreCallValidate for each intercept concurrently, reporting their messages in intercept order and stopping at the
+        // first intercept that skips, as the serial loop would
+        template <typename Validate>
+        bool ParallelPreCallValidate(const std::vector<ValidationObject*> &intercepts, const Validate &validate) {
+            const uint32_t count = static_cast<uint32_t>(intercepts.size());
+            std::vector<std::vector<DeferredLogMessage>> messages(count);
+            std::unique_ptr<bool[]> skips(new bool[count]);
+            parallel_validation_pool->Run(count, [&](uint32_t index) {
+                ValidationObject *intercept = intercepts[index];
+                auto lock = intercept->read_lock();
+                auto &deferred_messages = DeferredLogMessages();
+                auto *const outer_messages = deferred_messages;
+                deferred_messages = &messages[index];
+                skips[index] = validate(const_cast<const ValidationObject*>(intercept));
+                deferred_messages = outer_messages;
+            });
+
+            bool skip = false;
+            for (uint32_t index = 0; index < count; ++index) {
+                if (skip) {
+                    DiscardDeferredMessages(messages[index]);
+                } else if (messages[index].empty()) {
+                    skip |= skips[index];
+                } else {
+                    // A validate that deferred messages returned true for them, the debug callbacks decide the skip here
+                    skip |= LogDeferredMessages(report_data, messages[index]);
+                }
+            }
+            return skip;
+        }
+
+        // Set by the chassis on the thread that runs a PreCallValidate for ParallelPreCallValidate, to collect its messages in
+        // order.  Per thread, so that the same validation object can validate other calls on other threads meanwhile.
+        static std::vector<DeferredLogMessage> *&DeferredLogMessages() {
+            static thread_local std::vector<DeferredLogMessage> *deferred_messages = nullptr;
+            return deferred_messages;
+        }
+
         // Debug Logging Helpers
+        bool LogMsgOrDefer(VkFlags msg_flags, const LogObjectList &objects, const std::string &vuid_text, char *err_msg) const {
+            auto *const deferred_log_messages = DeferredLogMessages();
+            if (deferred_log_messages) {
+                // The debug callbacks only decide on skipping once the message is reported, so report it as found, letting the
+                // caller's early exits on bad state fire as they would for a callback that skips
+                if (LogMsgIsFiltered(report_data, vuid_text)) {
+                    free(err_msg);
+                    return false;
+                }
+                deferred_log_messages->emplace_back(DeferredLogMessage{msg_flags, objects, vuid_text, err_msg});
+                return true;
+            }
+            return LogMsgLocked(report_data, msg_flags, objects, vuid_text, err_msg);
+        }
+
         bool LogError(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
@@ -447,7 +657,7 @@ class ValidationObject {
                 str = nullptr;
             }
             va_end(argptr);
-            return LogMsgLocked(report_data, kErrorBit, objects, vuid_text, str);
+            return LogMsgOrDefer(kErrorBit, objects, vuid_text, str);
         };
 
         template <typename HANDLE_T>
@@ -466,7 +676,7 @@ class ValidationObject {
             }
             va_end(argptr);
             LogObjectList single_object(src_object);
-            return LogMsgLocked(report_data, kErrorBit, single_object, vuid_text, str);
+            return LogMsgOrDefer(kErrorBit, single_object, vuid_text, str);
 
         };
 
@@ -484,7 +694,7 @@ class ValidationObject {
                 str = nullptr;
             }
             va_end(argptr);
-            return LogMsgLocked(report_data, kWarningBit, objects, vuid_text, str);
+            return LogMsgOrDefer(kWarningBit, objects, vuid_text, str);
         };
 
         template <typename HANDLE_T>
@@ -503,7 +713,7 @@ class ValidationObject {
             }
             va_end(argptr);
             LogObjectList single_object(src_object);
-            return LogMsgLocked(report_data, kWarningBit, single_object, vuid_text, str);
+            return LogMsgOrDefer(kWarningBit, single_object, vuid_text, str);
         };
 
         bool LogPerformanceWarning(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
@@ -520,7 +730,7 @@ class ValidationObject {
                 str = nullptr;
             }
             va_end(argptr);
-            return LogMsgLocked(report_data, kPerformanceWarningBit, objects, vuid_text, str);
+            return LogMsgOrDefer(kPerformanceWarningBit, objects, vuid_text, str);
         };
 
         template <typename HANDLE_T>
@@ -539,7 +749,7 @@ class ValidationObject {
             }
             va_end(argptr);
             LogObjectList single_object(src_object);
-            return LogMsgLocked(report_data, kPerformanceWarningBit, single_object, vuid_text, str);
+            return LogMsgOrDefer(kPerformanceWarningBit, single_object, vuid_text, str);
         };
 
         bool LogInfo(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
@@ -556,7 +766,7 @@ class ValidationObject {
                 str = nullptr;
             }
             va_end(argptr);
-            return LogMsgLocked(report_data, kInformationBit, objects, vuid_text, str);
+            return LogMsgOrDefer(kInformationBit, objects, vuid_text, str);
         };
 
         template <typename HANDLE_T>
@@ -575,7 +785,7 @@ class ValidationObject {
             }
             va_end(argptr);
             LogObjectList single_object(src_object);
-            return LogMsgLocked(report_data, kInformationBit, single_object, vuid_text, str);
+            return LogMsgOrDefer(kInformationBit, single_object, vuid_text, str);
         };
 
         // Handle Wrapping Data
@@ -683,6 +893,7 @@ bool wrap_handles = true;
 #define OBJECT_LAYER_DESCRIPTION "khronos_validation"
 
 // Include layer validation object definitions
+#include "api_capture.h"
 #include "best_practices_validation.h"
 #include "core_validation.h"
 #include "corechecks_optick_instrumentation.h"
@@ -917,8 +1128,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     // Set up enable and disable features flags
     CHECK_ENABLED local_enables {};
     CHECK_DISABLED local_disables {};
+    ValidationSampler::Settings local_sampling_settings {};
     ConfigAndEnvSettings config_and_env_settings_data {OBJECT_LAYER_DESCRIPTION, pCreateInfo->pNext, local_enables, local_disables,
-        report_data->filter_message_ids, &report_data->duplicate_message_limit};
+        report_data->filter_message_ids, &report_data->duplicate_message_limit, &local_sampling_settings};
     ProcessConfigAndEnvSettings(&config_and_env_settings_data);
     layer_debug_messenger_actions(report_data, pAllocator, OBJECT_LAYER_DESCRIPTION);
 
@@ -958,11 +1170,13 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     // Init dispatch array and call registration functions
     bool skip = false;
     for (auto intercept : local_object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateInstance");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateInstance(pCreateInfo, pAllocator, pInstance);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : local_object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateInstance");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateInstance(pCreateInfo, pAllocator, pInstance);
     }
@@ -976,6 +1190,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     framework->container_type = LayerObjectTypeInstance;
     framework->disabled = local_disables;
     framework->enabled = local_enables;
+    framework->validation_sampler_settings = local_sampling_settings;
 
     framework->instance = *pInstance;
     layer_init_instance_dispatch_table(*pInstance, &framework->instance_dispatch_table, fpGetInstanceProcAddr);
@@ -997,6 +1212,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     sync_validation_obj->FinalizeInstanceValidationObject(framework);
 
     for (auto intercept : framework->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateInstance");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateInstance(pCreateInfo, pAllocator, pInstance, result);
     }
@@ -1005,7 +1221,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     std::vector<ValidationObject*> local_objs = {
         thread_checker_obj, object_tracker_obj, parameter_validation_obj,
         core_checks_obj, best_practices_obj, gpu_assisted_obj, debug_printf_obj,
-        sync_validation_obj,
+        sync_validation_obj, api_capture_obj,
     };
     for (auto obj : local_objs) {
         if (std::find(local_object_dispatch.begin(), local_object_dispatch.end(), obj) == local_object_dispatch.end()) {
@@ -1025,11 +1241,13 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
 
     bool skip = false;
     """ + precallvalidate_loop + """
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroyInstance");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyInstance(instance, pAllocator);
         //if (skip) return; // WORKAROUD: does not currently work properly
     }
     """ + precallrecord_loop + """
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroyInstance");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyInstance(instance, pAllocator);
     }
@@ -1037,6 +1255,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
     layer_data->instance_dispatch_table.DestroyInstance(instance, pAllocator);
 
     """ + postcallrecord_loop + """
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroyInstance");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyInstance(instance, pAllocator);
     }
@@ -1083,11 +1302,13 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
 
     bool skip = false;
     for (auto intercept : instance_interceptor->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateDevice");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDevice(gpu, pCreateInfo, pAllocator, pDevice);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : instance_interceptor->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateDevice");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, &modified_create_info);
     }
@@ -1141,6 +1362,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
     auto sync_validation_obj = new SyncValidator;
     sync_validation_obj->InitDeviceValidationObject(enables[sync_validation], instance_interceptor, device_interceptor);
 
+    auto api_capture_obj = new ApiCapture(pCreateInfo);
+    api_capture_obj->InitDeviceValidationObject(enables[api_capture], instance_interceptor, device_interceptor);
+
     // Delete unused validation objects to avoid memory leak.
     std::vector<ValidationObject *> local_objs = {
         thread_safety_obj, stateless_validation_obj, object_tracker_obj,
@@ -1155,12 +1379,28 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
     }
 
     for (auto intercept : instance_interceptor->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateDevice");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, result);
     }
 
     device_interceptor->InitObjectDispatchVectors();
 
+    if (enables[parallel_validate] && (device_interceptor->object_dispatch.size() > 1)) {
+        // The calling thread validates too, so one worker fewer than objects suffices
+        const uint32_t hardware_threads = std::max(std::thread::hardware_concurrency(), 1U);
+        const uint32_t worker_count =
+            std::min(static_cast<uint32_t>(device_interceptor->object_dispatch.size()) - 1, hardware_threads - 1);
+        if (worker_count) {
+            device_interceptor->parallel_validation_pool.reset(new ValidationWorkerPool(worker_count));
+        }
+    }
+
+    device_interceptor->validation_sampler = ValidationSampler::Create(instance_interceptor->validation_sampler_settings);
+    if (device_interceptor->validation_sampler) {
+        device_interceptor->InitUnselectedInterceptVectors();
+    }
+
     DeviceExtensionWhitelist(device_interceptor, pCreateInfo, *pDevice);
 
     return result;
@@ -1171,11 +1411,13 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
     auto layer_data = GetLayerDataPtr(key, layer_data_map);
     bool skip = false;
     """ + precallvalidate_loop + """
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkDestroyDevice");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDevice(device, pAllocator);
         if (skip) return;
     }
     """ + precallrecord_loop + """
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkDestroyDevice");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyDevice(device, pAllocator);
     }
@@ -1183,9 +1425,11 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
     layer_data->device_dispatch_table.DestroyDevice(device, pAllocator);
 
     """ + postcallrecord_loop + """
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkDestroyDevice");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyDevice(device, pAllocator);
     }
+    INTERCEPT_STATS_DUMP();
 
     for (auto item = layer_data->object_dispatch.begin(); item != layer_data->object_dispatch.end(); item++) {
         delete *item;
@@ -1208,13 +1452,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(
 
     create_graphics_pipeline_api_state cgpl_state[LayerObjectTypeMaxEnum]{};
 
-    for (auto intercept : layer_data->object_dispatch) {
-        cgpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
-        auto lock = intercept->read_lock();
-        skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(cgpl_state[intercept->container_type]));
+    if (layer_data->parallel_validation_pool) {
+        skip = layer_data->ParallelPreCallValidate(layer_data->object_dispatch, [&](const ValidationObject *intercept) {
+            cgpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
+            INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateGraphicsPipelines");
+            return intercept->PreCallValidateCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(cgpl_state[intercept->container_type]));
+        });
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
+    } else {
+        for (auto intercept : layer_data->object_dispatch) {
+            cgpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
+            INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateGraphicsPipelines");
+            auto lock = intercept->read_lock();
+            skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(cgpl_state[intercept->container_type]));
+            if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
+        }
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateGraphicsPipelines");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(cgpl_state[intercept->container_type]));
     }
@@ -1225,6 +1480,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(
     VkResult result = DispatchCreateGraphicsPipelines(device, pipelineCache, createInfoCount, usepCreateInfos, pAllocator, pPipelines);
 
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateGraphicsPipelines");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, result, &(cgpl_state[intercept->container_type]));
     }
@@ -1244,13 +1500,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(
 
     create_compute_pipeline_api_state ccpl_state[LayerObjectTypeMaxEnum]{};
 
-    for (auto intercept : layer_data->object_dispatch) {
-        ccpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
-        auto lock = intercept->read_lock();
-        skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(ccpl_state[intercept->container_type]));
+    if (layer_data->parallel_validation_pool) {
+        skip = layer_data->ParallelPreCallValidate(layer_data->object_dispatch, [&](const ValidationObject *intercept) {
+            ccpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
+            INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateComputePipelines");
+            return intercept->PreCallValidateCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(ccpl_state[intercept->container_type]));
+        });
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
+    } else {
+        for (auto intercept : layer_data->object_dispatch) {
+            ccpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
+            INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateComputePipelines");
+            auto lock = intercept->read_lock();
+            skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(ccpl_state[intercept->container_type]));
+            if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
+        }
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateComputePipelines");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(ccpl_state[intercept->container_type]));
     }
@@ -1261,6 +1528,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(
     VkResult result = DispatchCreateComputePipelines(device, pipelineCache, createInfoCount, usepCreateInfos, pAllocator, pPipelines);
 
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateComputePipelines");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, result, &(ccpl_state[intercept->container_type]));
     }
@@ -1281,12 +1549,14 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(
 
     for (auto intercept : layer_data->object_dispatch) {
         crtpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateRayTracingPipelinesNV");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos,
                                                                       pAllocator, pPipelines, &(crtpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateRayTracingPipelinesNV");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                             pPipelines, &(crtpl_state[intercept->container_type]));
@@ -1295,6 +1565,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(
     VkResult result = DispatchCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
 
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateRayTracingPipelinesNV");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                              pPipelines, result, &(crtpl_state[intercept->container_type]));
@@ -1317,12 +1588,14 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesKHR(
 
     for (auto intercept : layer_data->object_dispatch) {
         crtpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateRayTracingPipelinesKHR");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos,
                                                                       pAllocator, pPipelines, &(crtpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateRayTracingPipelinesKHR");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                             pPipelines, &(crtpl_state[intercept->container_type]));
@@ -1331,6 +1604,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesKHR(
     VkResult result = DispatchCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
 
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateRayTracingPipelinesKHR");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                              pPipelines, result, &(crtpl_state[intercept->container_type]));
@@ -1351,16 +1625,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(
     cpl_state.modified_create_info = *pCreateInfo;
 
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreatePipelineLayout");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreatePipelineLayout");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, &cpl_state);
     }
     VkResult result = DispatchCreatePipelineLayout(device, &cpl_state.modified_create_info, pAllocator, pPipelineLayout);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreatePipelineLayout");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, result);
     }
@@ -1380,16 +1657,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(
     csm_state.instrumented_create_info = *pCreateInfo;
 
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateShaderModule");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, &csm_state);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateShaderModule");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, &csm_state);
     }
     VkResult result = DispatchCreateShaderModule(device, &csm_state.instrumented_create_info, pAllocator, pShaderModule);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateShaderModule");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, result, &csm_state);
     }
@@ -1407,17 +1687,20 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(
 
     for (auto intercept : layer_data->object_dispatch) {
         ads_state[intercept->container_type].Init(pAllocateInfo->descriptorSetCount);
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkAllocateDescriptorSets");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAllocateDescriptorSets(device,
             pAllocateInfo, pDescriptorSets, &(ads_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkAllocateDescriptorSets");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
     }
     VkResult result = DispatchAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkAllocateDescriptorSets");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets,
             result, &(ads_state[intercept->container_type]));
@@ -1438,16 +1721,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(
     cb_state.modified_create_info = *pCreateInfo;
 
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkCreateBuffer");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateBuffer(device, pCreateInfo, pAllocator, pBuffer);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkCreateBuffer");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, &cb_state);
     }
     VkResult result = DispatchCreateBuffer(device, &cb_state.modified_create_info, pAllocator, pBuffer);
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkCreateBuffer");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, result);
     }
@@ -1484,12 +1770,14 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceToolPropertiesEXT(
     }
 
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "vkGetPhysicalDeviceToolPropertiesEXT");
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
 
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "vkGetPhysicalDeviceToolPropertiesEXT");
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties);
     }
@@ -1502,6 +1790,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceToolPropertiesEXT(
     (*pToolCount)++;
 
     for (auto intercept : layer_data->object_dispatch) {
+        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "vkGetPhysicalDeviceToolPropertiesEXT");
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties, result);
     }
@@ -1747,6 +2036,9 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
             case LayerObjectTypeSyncValidation: \\
                 if (typeid(&SyncValidator::name) != typeid(&ValidationObject::name)) intercept_vector->push_back(item);     \\
                 break;  \\
+            case LayerObjectTypeApiCapture: \\
+                if (typeid(&ApiCapture::name) != typeid(&ValidationObject::name)) intercept_vector->push_back(item);    \\
+                break;  \\
             case LayerObjectTypeInstance: \\
             case LayerObjectTypeDevice:   \\
                 break;  \\
@@ -2028,20 +2320,43 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
             self.appendSection('command', '    bool skip = false;')
 
             # Generate pre-call validation source code
-            if dispatchable_type != 'VkInstance' and dispatchable_type != 'VkPhysicalDevice':
-                self.appendSection('command', '    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidate%s]) {' % api_function_name[2:])
+            validate_indent = '    '
+            if name in self.parallel_validate_functions:
+                self.appendSection('command', '    if (layer_data->parallel_validation_pool) {')
+                self.appendSection('command', '        skip = layer_data->ParallelPreCallValidate(')
+                self.appendSection('command', '            layer_data->intercept_vectors[InterceptIdPreCallValidate%s], [&](const ValidationObject *intercept) {' % api_function_name[2:])
+                self.appendSection('command', '                INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "%s");' % api_function_name)
+                self.appendSection('command', '                return intercept->PreCallValidate%s(%s);' % (api_function_name[2:], paramstext))
+                self.appendSection('command', '            });')
+                self.appendSection('command', '        if (skip) %s' % return_map[resulttype.text])
+                self.appendSection('command', '    } else {')
+                validate_indent = '        '
+            command_intercepts = dispatchable_type == 'VkCommandBuffer' and name.startswith('vkCmd')
+            if command_intercepts:
+                sampled = 'true' if name in self.sampled_validation_commands else 'false'
+                self.appendSection('command', validate_indent + 'for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallValidate%s, %s, %s)) {' % (api_function_name[2:], dispatchable_name, sampled))
+            elif dispatchable_type != 'VkInstance' and dispatchable_type != 'VkPhysicalDevice':
+                self.appendSection('command', validate_indent + 'for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidate%s]) {' % api_function_name[2:])
             else:
-                self.appendSection('command', '    for (auto intercept : layer_data->object_dispatch) {')
-            self.appendSection('command', '        auto lock = intercept->read_lock();')
-            self.appendSection('command', '        skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidate%s(%s);' % (api_function_name[2:], paramstext))
-            self.appendSection('command', '        if (skip) %s' % return_map[resulttype.text])
-            self.appendSection('command', '    }')
+                self.appendSection('command', validate_indent + 'for (auto intercept : layer_data->object_dispatch) {')
+            self.appendSection('command', validate_indent + '    INTERCEPT_STATS_SCOPE(intercept, kPreCallValidate, "%s");' % api_function_name)
+            self.appendSection('command', validate_indent + '    auto lock = intercept->read_lock();')
+            self.appendSection('command', validate_indent + '    skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidate%s(%s);' % (api_function_name[2:], paramstext))
+            self.appendSection('command', validate_indent + '    if (skip) %s' % return_map[resulttype.text])
+            self.appendSection('command', validate_indent + '}')
+            if name in self.parallel_validate_functions:
+                self.appendSection('command', '    }')
+            if name in self.validation_sampler_hooks:
+                self.appendSection('command', '    if (layer_data->validation_sampler) layer_data->validation_sampler->%s;' % self.validation_sampler_hooks[name])
 
             # Generate pre-call state recording source code
-            if dispatchable_type != 'VkInstance' and dispatchable_type != 'VkPhysicalDevice':
+            if command_intercepts:
+                self.appendSection('command', '    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPreCallRecord%s, %s, false)) {' % (api_function_name[2:], dispatchable_name))
+            elif dispatchable_type != 'VkInstance' and dispatchable_type != 'VkPhysicalDevice':
                 self.appendSection('command', '    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecord%s]) {' % api_function_name[2:])
             else:
                 self.appendSection('command', '    for (auto intercept : layer_data->object_dispatch) {')
+            self.appendSection('command', '        INTERCEPT_STATS_SCOPE(intercept, kPreCallRecord, "%s");' % api_function_name)
             self.appendSection('command', '        auto lock = intercept->write_lock();')
             self.appendSection('command', '        intercept->PreCallRecord%s(%s);' % (api_function_name[2:], paramstext))
             self.appendSection('command', '    }')
@@ -2057,14 +2372,20 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
             if name in self.post_dispatch_debug_utils_functions:
                 self.appendSection('command', '    %s' % self.post_dispatch_debug_utils_functions[name])
 
+            if name in self.validation_sampler_post_hooks:
+                self.appendSection('command', '    if (layer_data->validation_sampler && (result == VK_SUCCESS)) layer_data->validation_sampler->%s;' % self.validation_sampler_post_hooks[name])
+
             # Generate post-call object processing source code
-            if dispatchable_type != 'VkInstance' and dispatchable_type != 'VkPhysicalDevice':
+            if command_intercepts:
+                self.appendSection('command', '    for (auto intercept : layer_data->CommandIntercepts(InterceptIdPostCallRecord%s, %s, false)) {' % (api_function_name[2:], dispatchable_name))
+            elif dispatchable_type != 'VkInstance' and dispatchable_type != 'VkPhysicalDevice':
                 self.appendSection('command', '    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecord%s]) {' % api_function_name[2:])
             else:
                 self.appendSection('command', '    for (auto intercept : layer_data->object_dispatch) {')
             returnparam = ''
             if (resulttype.text == 'VkResult' or resulttype.text == 'VkDeviceAddress'):
                 returnparam = ', result'
+            self.appendSection('command', '        INTERCEPT_STATS_SCOPE(intercept, kPostCallRecord, "%s");' % api_function_name)
             self.appendSection('command', '        auto lock = intercept->write_lock();')
             self.appendSection('command', '        intercept->PostCallRecord%s(%s%s);' % (api_function_name[2:], paramstext, returnparam))
             self.appendSection('command', '    }')
@@ -0,0 +1,921 @@
+/*
+ * Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ */
+
+#include "vkcapturereplay.h"
+
+#include <chrono>
+
+#include "lvt_function_pointers.h"
+#include "vk_typemap_helper.h"
+
+using namespace api_capture;
+
+bool CaptureReplay::Open(const char *filename) {
+    Command command;
+    if (!reader_.Open(filename) || !reader_.NextRecord(&command) || (command != kDevice)) return false;
+    const uint32_t extension_count = reader_.Read<uint32_t>();
+    for (uint32_t i = 0; (i < extension_count) && !reader_.Overrun(); ++i) device_extensions_.emplace_back(reader_.ReadString());
+    const auto *features = reader_.ReadOptional<VkPhysicalDeviceFeatures>();
+    has_features_ = (features != nullptr);
+    if (features) device_features_ = *features;
+    return !reader_.Overrun();
+}
+
+bool CaptureReplay::Replay(VkPhysicalDevice gpu, VkDevice device, VkQueue queue, uint32_t queue_family_index) {
+    device_ = device;
+    queue_ = queue;
+    queue_family_index_ = queue_family_index;
+    vk::GetPhysicalDeviceMemoryProperties(gpu, &memory_properties_);
+
+    Command command;
+    while (reader_.NextRecord(&command)) {
+        const auto start = std::chrono::steady_clock::now();
+        ReplayRecord(command);
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        timings_[command].calls++;
+        timings_[command].ns += std::chrono::duration<double, std::nano>(elapsed).count();
+        if (reader_.Overrun()) break;
+    }
+    DestroyLiveObjects();
+    return !reader_.Overrun();
+}
+
+uint32_t CaptureReplay::MemoryTypeIndex(VkMemoryPropertyFlags property_flags, uint32_t type_bits) const {
+    for (uint32_t i = 0; i < memory_properties_.memoryTypeCount; ++i) {
+        if ((type_bits & (1u << i)) && ((memory_properties_.memoryTypes[i].propertyFlags & property_flags) == property_flags)) {
+            return i;
+        }
+    }
+    // Fall back to the first allowed type, the replay is only slower for it
+    for (uint32_t i = 0; i < memory_properties_.memoryTypeCount; ++i) {
+        if (type_bits & (1u << i)) return i;
+    }
+    return 0;
+}
+
+void CaptureReplay::ReadShaderStage(VkPipelineShaderStageCreateInfo *stage) {
+    *stage = reader_.Read<VkPipelineShaderStageCreateInfo>();
+    stage->pNext = nullptr;
+    stage->module = reader_.Map(stage->module);
+    stage->pName = reader_.ReadString();
+    auto *specialization = reader_.ReadOptional<VkSpecializationInfo>();
+    if (specialization) {
+        specialization->pMapEntries = reader_.ReadArray<VkSpecializationMapEntry>(&specialization->mapEntryCount);
+        uint32_t data_size;
+        specialization->pData = reader_.ReadArray<uint8_t>(&data_size);
+        specialization->dataSize = data_size;
+    }
+    stage->pSpecializationInfo = specialization;
+}
+
+void CaptureReplay::ReplaceSwapchainImages(const VkSwapchainCreateInfoKHR &swapchain, const uint64_t *images, uint32_t count) {
+    auto image_ci = LvlInitStruct<VkImageCreateInfo>();
+    image_ci.imageType = VK_IMAGE_TYPE_2D;
+    image_ci.format = swapchain.imageFormat;
+    image_ci.extent = {swapchain.imageExtent.width, swapchain.imageExtent.height, 1};
+    image_ci.mipLevels = 1;
+    image_ci.arrayLayers = swapchain.imageArrayLayers;
+    image_ci.samples = VK_SAMPLE_COUNT_1_BIT;
+    image_ci.tiling = VK_IMAGE_TILING_OPTIMAL;
+    image_ci.usage = swapchain.imageUsage;
+    image_ci.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    image_ci.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    for (uint32_t i = 0; i < count; ++i) {
+        // Applications usually query the images more than once
+        if (!captured_swapchain_images_.insert(images[i]).second) continue;
+        VkImage image = VK_NULL_HANDLE;
+        if (vk::CreateImage(device_, &image_ci, nullptr, &image) != VK_SUCCESS) continue;
+        VkMemoryRequirements requirements;
+        vk::GetImageMemoryRequirements(device_, image, &requirements);
+        auto alloc_info = LvlInitStruct<VkMemoryAllocateInfo>();
+        alloc_info.allocationSize = requirements.size;
+        alloc_info.memoryTypeIndex = MemoryTypeIndex(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, requirements.memoryTypeBits);
+        VkDeviceMemory memory = VK_NULL_HANDLE;
+        if (vk::AllocateMemory(device_, &alloc_info, nullptr, &memory) == VK_SUCCESS) {
+            vk::BindImageMemory(device_, image, memory, 0);
+        }
+        swapchain_images_.emplace_back(image, memory);
+        reader_.AddHandle(images[i], image);
+    }
+}
+
+void CaptureReplay::DestroyLiveObjects() {
+    vk::DeviceWaitIdle(device_);
+    for (size_t index = live_order_.size(); index-- > 0;) {
+        const uint64_t captured = live_order_[index].second;
+        const auto found = live_.find(captured);
+        if ((found == live_.end()) || (found->second != index)) continue;
+        switch (live_order_[index].first) {
+            case kAllocateMemory:
+                vk::FreeMemory(device_, reader_.Map(CastFromUint64<VkDeviceMemory>(captured)), nullptr);
+                break;
+            case kCreateBuffer:
+                vk::DestroyBuffer(device_, reader_.Map(CastFromUint64<VkBuffer>(captured)), nullptr);
+                break;
+            case kCreateBufferView:
+                vk::DestroyBufferView(device_, reader_.Map(CastFromUint64<VkBufferView>(captured)), nullptr);
+                break;
+            case kCreateImage:
+                vk::DestroyImage(device_, reader_.Map(CastFromUint64<VkImage>(captured)), nullptr);
+                break;
+            case kCreateImageView:
+                vk::DestroyImageView(device_, reader_.Map(CastFromUint64<VkImageView>(captured)), nullptr);
+                break;
+            case kCreateSampler:
+                vk::DestroySampler(device_, reader_.Map(CastFromUint64<VkSampler>(captured)), nullptr);
+                break;
+            case kCreateShaderModule:
+                vk::DestroyShaderModule(device_, reader_.Map(CastFromUint64<VkShaderModule>(captured)), nullptr);
+                break;
+            case kCreateDescriptorSetLayout:
+                vk::DestroyDescriptorSetLayout(device_, reader_.Map(CastFromUint64<VkDescriptorSetLayout>(captured)), nullptr);
+                break;
+            case kCreatePipelineLayout:
+                vk::DestroyPipelineLayout(device_, reader_.Map(CastFromUint64<VkPipelineLayout>(captured)), nullptr);
+                break;
+            case kCreateDescriptorPool:
+                vk::DestroyDescriptorPool(device_, reader_.Map(CastFromUint64<VkDescriptorPool>(captured)), nullptr);
+                break;
+            case kCreateRenderPass:
+                vk::DestroyRenderPass(device_, reader_.Map(CastFromUint64<VkRenderPass>(captured)), nullptr);
+                break;
+            case kCreateFramebuffer:
+                vk::DestroyFramebuffer(device_, reader_.Map(CastFromUint64<VkFramebuffer>(captured)), nullptr);
+                break;
+            case kCreateGraphicsPipelines:
+            case kCreateComputePipelines:
+                vk::DestroyPipeline(device_, reader_.Map(CastFromUint64<VkPipeline>(captured)), nullptr);
+                break;
+            case kCreateFence:
+                vk::DestroyFence(device_, reader_.Map(CastFromUint64<VkFence>(captured)), nullptr);
+                break;
+            case kCreateCommandPool:
+                vk::DestroyCommandPool(device_, reader_.Map(CastFromUint64<VkCommandPool>(captured)), nullptr);
+                break;
+            default:
+                break;
+        }
+    }
+    live_.clear();
+    live_order_.clear();
+    for (const auto &image : swapchain_images_) {
+        vk::DestroyImage(device_, image.first, nullptr);
+        vk::FreeMemory(device_, image.second, nullptr);
+    }
+    swapchain_images_.clear();
+}
+
+void CaptureReplay::ReplayRecord(Command command) {
+    auto &r = reader_;
+    switch (command) {
+        case kGetDeviceQueue: {
+            r.Read<uint32_t>();
+            r.Read<uint32_t>();
+            // Not kept in live_, there's nothing to destroy
+            r.AddHandle(r.ReadNewHandle(), queue_);
+            break;
+        }
+        case kDeviceWaitIdle:
+            vk::DeviceWaitIdle(device_);
+            break;
+        case kQueueSubmit: {
+            r.ReadHandle<VkQueue>();
+            // Each submit is stored as at least the count of its command buffers
+            const uint32_t submit_count = static_cast<uint32_t>(
+                std::min<size_t>(r.Read<uint32_t>(), r.RemainingBytes() / sizeof(uint32_t)));
+            auto *submits = r.Allocate<VkSubmitInfo>(submit_count);
+            for (uint32_t i = 0; i < submit_count; ++i) {
+                submits[i] = LvlInitStruct<VkSubmitInfo>();
+                submits[i].pCommandBuffers = r.ReadHandles<VkCommandBuffer>(&submits[i].commandBufferCount);
+            }
+            const auto fence = r.ReadHandle<VkFence>();
+            vk::QueueSubmit(queue_, submit_count, submits, fence);
+            break;
+        }
+        case kQueueWaitIdle:
+            r.ReadHandle<VkQueue>();
+            vk::QueueWaitIdle(queue_);
+            break;
+        case kAllocateMemory: {
+            auto alloc_info = r.Read<VkMemoryAllocateInfo>();
+            const auto property_flags = r.Read<VkMemoryPropertyFlags>();
+            const uint64_t captured = r.ReadNewHandle();
+            alloc_info.pNext = nullptr;
+            alloc_info.memoryTypeIndex = MemoryTypeIndex(property_flags, ~0u);
+            VkDeviceMemory memory = VK_NULL_HANDLE;
+            vk::AllocateMemory(device_, &alloc_info, nullptr, &memory);
+            AddHandle(command, captured, memory);
+            break;
+        }
+        case kFreeMemory:
+            vk::FreeMemory(device_, TakeHandle<VkDeviceMemory>(), nullptr);
+            break;
+        case kCreateBuffer: {
+            auto create_info = r.Read<VkBufferCreateInfo>();
+            create_info.pNext = nullptr;
+            create_info.pQueueFamilyIndices = r.ReadArray<uint32_t>(&create_info.queueFamilyIndexCount);
+            const uint64_t captured = r.ReadNewHandle();
+            VkBuffer buffer = VK_NULL_HANDLE;
+            vk::CreateBuffer(device_, &create_info, nullptr, &buffer);
+            AddHandle(command, captured, buffer);
+            break;
+        }
+        case kDestroyBuffer:
+            vk::DestroyBuffer(device_, TakeHandle<VkBuffer>(), nullptr);
+            break;
+        case kBindBufferMemory: {
+            const auto buffer = r.ReadHandle<VkBuffer>();
+            const auto memory = r.ReadHandle<VkDeviceMemory>();
+            vk::BindBufferMemory(device_, buffer, memory, r.Read<VkDeviceSize>());
+            break;
+        }
+        case kCreateBufferView: {
+            auto create_info = r.Read<VkBufferViewCreateInfo>();
+            create_info.pNext = nullptr;
+            create_info.buffer = r.Map(create_info.buffer);
+            const uint64_t captured = r.ReadNewHandle();
+            VkBufferView view = VK_NULL_HANDLE;
+            vk::CreateBufferView(device_, &create_info, nullptr, &view);
+            AddHandle(command, captured, view);
+            break;
+        }
+        case kDestroyBufferView:
+            vk::DestroyBufferView(device_, TakeHandle<VkBufferView>(), nullptr);
+            break;
+        case kCreateImage: {
+            auto create_info = r.Read<VkImageCreateInfo>();
+            create_info.pNext = nullptr;
+            create_info.pQueueFamilyIndices = r.ReadArray<uint32_t>(&create_info.queueFamilyIndexCount);
+            const uint64_t captured = r.ReadNewHandle();
+            VkImage image = VK_NULL_HANDLE;
+            vk::CreateImage(device_, &create_info, nullptr, &image);
+            AddHandle(command, captured, image);
+            break;
+        }
+        case kDestroyImage:
+            vk::DestroyImage(device_, TakeHandle<VkImage>(), nullptr);
+            break;
+        case kBindImageMemory: {
+            const auto image = r.ReadHandle<VkImage>();
+            const auto memory = r.ReadHandle<VkDeviceMemory>();
+            vk::BindImageMemory(device_, image, memory, r.Read<VkDeviceSize>());
+            break;
+        }
+        case kCreateImageView: {
+            auto create_info = r.Read<VkImageViewCreateInfo>();
+            create_info.pNext = nullptr;
+            create_info.image = r.Map(create_info.image);
+            const uint64_t captured = r.ReadNewHandle();
+            VkImageView view = VK_NULL_HANDLE;
+            vk::CreateImageView(device_, &create_info, nullptr, &view);
+            AddHandle(command, captured, view);
+            break;
+        }
+        case kDestroyImageView:
+            vk::DestroyImageView(device_, TakeHandle<VkImageView>(), nullptr);
+            break;
+        case kCreateSampler: {
+            auto create_info = r.Read<VkSamplerCreateInfo>();
+            create_info.pNext = nullptr;
+            const uint64_t captured = r.ReadNewHandle();
+            VkSampler sampler = VK_NULL_HANDLE;
+            vk::CreateSampler(device_, &create_info, nullptr, &sampler);
+            AddHandle(command, captured, sampler);
+            break;
+        }
+        case kDestroySampler:
+            vk::DestroySampler(device_, TakeHandle<VkSampler>(), nullptr);
+            break;
+        case kCreateShaderModule: {
+            auto create_info = r.Read<VkShaderModuleCreateInfo>();
+            create_info.pNext = nullptr;
+            uint32_t word_count;
+            create_info.pCode = r.ReadArray<uint32_t>(&word_count);
+            create_info.codeSize = word_count * sizeof(uint32_t);
+            const uint64_t captured = r.ReadNewHandle();
+            VkShaderModule module = VK_NULL_HANDLE;
+            vk::CreateShaderModule(device_, &create_info, nullptr, &module);
+            AddHandle(command, captured, module);
+            break;
+        }
+        case kDestroyShaderModule:
+            vk::DestroyShaderModule(device_, TakeHandle<VkShaderModule>(), nullptr);
+            break;
+        case kCreateDescriptorSetLayout: {
+            auto create_info = r.Read<VkDescriptorSetLayoutCreateInfo>();
+            create_info.pNext = nullptr;
+            auto *bindings = AllocateStructs<VkDescriptorSetLayoutBinding>(&create_info.bindingCount);
+            for (uint32_t i = 0; i < create_info.bindingCount; ++i) {
+                bindings[i] = r.Read<VkDescriptorSetLayoutBinding>();
+                bindings[i].pImmutableSamplers = r.ReadHandles<VkSampler>();
+            }
+            create_info.pBindings = bindings;
+            const uint64_t captured = r.ReadNewHandle();
+            VkDescriptorSetLayout layout = VK_NULL_HANDLE;
+            vk::CreateDescriptorSetLayout(device_, &create_info, nullptr, &layout);
+            AddHandle(command, captured, layout);
+            break;
+        }
+        case kDestroyDescriptorSetLayout:
+            vk::DestroyDescriptorSetLayout(device_, TakeHandle<VkDescriptorSetLayout>(), nullptr);
+            break;
+        case kCreatePipelineLayout: {
+            auto create_info = r.Read<VkPipelineLayoutCreateInfo>();
+            create_info.pNext = nullptr;
+            create_info.pSetLayouts = r.ReadHandles<VkDescriptorSetLayout>(&create_info.setLayoutCount);
+            create_info.pPushConstantRanges = r.ReadArray<VkPushConstantRange>(&create_info.pushConstantRangeCount);
+            const uint64_t captured = r.ReadNewHandle();
+            VkPipelineLayout layout = VK_NULL_HANDLE;
+            vk::CreatePipelineLayout(device_, &create_info, nullptr, &layout);
+            AddHandle(command, captured, layout);
+            break;
+        }
+        case kDestroyPipelineLayout:
+            vk::DestroyPipelineLayout(device_, TakeHandle<VkPipelineLayout>(), nullptr);
+            break;
+        case kCreateDescriptorPool: {
+            auto create_info = r.Read<VkDescriptorPoolCreateInfo>();
+            create_info.pNext = nullptr;
+            create_info.pPoolSizes = r.ReadArray<VkDescriptorPoolSize>(&create_info.poolSizeCount);
+            const uint64_t captured = r.ReadNewHandle();
+            VkDescriptorPool pool = VK_NULL_HANDLE;
+            vk::CreateDescriptorPool(device_, &create_info, nullptr, &pool);
+            AddHandle(command, captured, pool);
+            break;
+        }
+        case kDestroyDescriptorPool:
+            vk::DestroyDescriptorPool(device_, TakeHandle<VkDescriptorPool>(), nullptr);
+            break;
+        case kResetDescriptorPool: {
+            const auto pool = r.ReadHandle<VkDescriptorPool>();
+            vk::ResetDescriptorPool(device_, pool, r.Read<VkDescriptorPoolResetFlags>());
+            break;
+        }
+        case kAllocateDescriptorSets: {
+            auto alloc_info = LvlInitStruct<VkDescriptorSetAllocateInfo>();
+            alloc_info.descriptorPool = r.ReadHandle<VkDescriptorPool>();
+            alloc_info.pSetLayouts = r.ReadHandles<VkDescriptorSetLayout>(&alloc_info.descriptorSetCount);
+            uint32_t captured_count;
+            const auto *captured = r.ReadArray<uint64_t>(&captured_count);
+            if (!alloc_info.descriptorSetCount || (captured_count != alloc_info.descriptorSetCount)) break;
+            auto *sets = r.Allocate<VkDescriptorSet>(alloc_info.descriptorSetCount);
+            if (vk::AllocateDescriptorSets(device_, &alloc_info, sets) != VK_SUCCESS) break;
+            // Sets are freed with their pool, so aren't kept in live_
+            for (uint32_t i = 0; i < captured_count; ++i) r.AddHandle(captured[i], sets[i]);
+            break;
+        }
+        case kFreeDescriptorSets: {
+            const auto pool = r.ReadHandle<VkDescriptorPool>();
+            uint32_t count;
+            const auto *captured = r.ReadArray<uint64_t>(&count);
+            auto *sets = r.Allocate<VkDescriptorSet>(count);
+            for (uint32_t i = 0; i < count; ++i) {
+                sets[i] = r.Map(CastFromUint64<VkDescriptorSet>(captured[i]));
+                r.RemoveHandle(captured[i]);
+            }
+            vk::FreeDescriptorSets(device_, pool, count, sets);
+            break;
+        }
+        case kUpdateDescriptorSets: {
+            uint32_t write_count = r.Read<uint32_t>();
+            auto *writes = AllocateStructs<VkWriteDescriptorSet>(&write_count);
+            uint32_t replayed_count = 0;
+            for (uint32_t i = 0; i < write_count; ++i) {
+                auto write = r.Read<VkWriteDescriptorSet>();
+                write.pNext = nullptr;
+                write.dstSet = r.Map(write.dstSet);
+                write.pImageInfo = nullptr;
+                write.pBufferInfo = nullptr;
+                write.pTexelBufferView = nullptr;
+                switch (write.descriptorType) {
+                    case VK_DESCRIPTOR_TYPE_SAMPLER:
+                    case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+                    case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+                    case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+                    case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT: {
+                        auto *image_infos = r.ReadArray<VkDescriptorImageInfo>(&write.descriptorCount);
+                        for (uint32_t j = 0; j < write.descriptorCount; ++j) {
+                            image_infos[j].sampler = r.Map(image_infos[j].sampler);
+                            image_infos[j].imageView = r.Map(image_infos[j].imageView);
+                        }
+                        write.pImageInfo = image_infos;
+                        break;
+                    }
+                    case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+                    case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+                    case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+                    case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC: {
+                        auto *buffer_infos = r.ReadArray<VkDescriptorBufferInfo>(&write.descriptorCount);
+                        for (uint32_t j = 0; j < write.descriptorCount; ++j) {
+                            buffer_infos[j].buffer = r.Map(buffer_infos[j].buffer);
+                        }
+                        write.pBufferInfo = buffer_infos;
+                        break;
+                    }
+                    case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+                    case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                        write.pTexelBufferView = r.ReadHandles<VkBufferView>(&write.descriptorCount);
+                        break;
+                    default:
+                        // The data of the other types is in the pNext chain, which isn't captured
+                        continue;
+                }
+                if (write.descriptorCount) writes[replayed_count++] = write;
+            }
+            uint32_t copy_count;
+            auto *copies = r.ReadArray<VkCopyDescriptorSet>(&copy_count);
+            for (uint32_t i = 0; i < copy_count; ++i) {
+                copies[i].pNext = nullptr;
+                copies[i].srcSet = r.Map(copies[i].srcSet);
+                copies[i].dstSet = r.Map(copies[i].dstSet);
+            }
+            vk::UpdateDescriptorSets(device_, replayed_count, writes, copy_count, copies);
+            break;
+        }
+        case kCreateRenderPass: {
+            auto create_info = r.Read<VkRenderPassCreateInfo>();
+            create_info.pNext = nullptr;
+            create_info.pAttachments = r.ReadArray<VkAttachmentDescription>(&create_info.attachmentCount);
+            auto *subpasses = AllocateStructs<VkSubpassDescription>(&create_info.subpassCount);
+            for (uint32_t i = 0; i < create_info.subpassCount; ++i) {
+                auto &subpass = subpasses[i];
+                subpass = r.Read<VkSubpassDescription>();
+                subpass.pInputAttachments = r.ReadArray<VkAttachmentReference>(&subpass.inputAttachmentCount);
+                subpass.pColorAttachments = r.ReadArray<VkAttachmentReference>(&subpass.colorAttachmentCount);
+                subpass.pResolveAttachments = r.ReadArray<VkAttachmentReference>();
+                subpass.pDepthStencilAttachment = r.ReadOptional<VkAttachmentReference>();
+                subpass.pPreserveAttachments = r.ReadArray<uint32_t>(&subpass.preserveAttachmentCount);
+            }
+            create_info.pSubpasses = subpasses;
+            create_info.pDependencies = r.ReadArray<VkSubpassDependency>(&create_info.dependencyCount);
+            const uint64_t captured = r.ReadNewHandle();
+            VkRenderPass render_pass = VK_NULL_HANDLE;
+            vk::CreateRenderPass(device_, &create_info, nullptr, &render_pass);
+            AddHandle(command, captured, render_pass);
+            break;
+        }
+        case kDestroyRenderPass:
+            vk::DestroyRenderPass(device_, TakeHandle<VkRenderPass>(), nullptr);
+            break;
+        case kCreateFramebuffer: {
+            auto create_info = r.Read<VkFramebufferCreateInfo>();
+            // An imageless framebuffer loses its attachment infos with the pNext chain, so its creation fails validation
+            create_info.pNext = nullptr;
+            create_info.renderPass = r.Map(create_info.renderPass);
+            uint32_t attachment_count;
+            create_info.pAttachments = r.ReadHandles<VkImageView>(&attachment_count);
+            if (create_info.pAttachments) create_info.attachmentCount = attachment_count;
+            const uint64_t captured = r.ReadNewHandle();
+            VkFramebuffer framebuffer = VK_NULL_HANDLE;
+            vk::CreateFramebuffer(device_, &create_info, nullptr, &framebuffer);
+            AddHandle(command, captured, framebuffer);
+            break;
+        }
+        case kDestroyFramebuffer:
+            vk::DestroyFramebuffer(device_, TakeHandle<VkFramebuffer>(), nullptr);
+            break;
+        case kCreateGraphicsPipelines: {
+            uint32_t count = r.Read<uint32_t>();
+            auto *create_infos = AllocateStructs<VkGraphicsPipelineCreateInfo>(&count);
+            for (uint32_t i = 0; i < count; ++i) {
+                auto &create_info = create_infos[i];
+                create_info = r.Read<VkGraphicsPipelineCreateInfo>();
+                create_info.pNext = nullptr;
+                auto *stages = AllocateStructs<VkPipelineShaderStageCreateInfo>(&create_info.stageCount);
+                for (uint32_t stage = 0; stage < create_info.stageCount; ++stage) ReadShaderStage(&stages[stage]);
+                create_info.pStages = stages;
+
+                auto *vertex_input = r.ReadOptional<VkPipelineVertexInputStateCreateInfo>();
+                if (vertex_input) {
+                    vertex_input->pNext = nullptr;
+                    vertex_input->pVertexBindingDescriptions =
+                        r.ReadArray<VkVertexInputBindingDescription>(&vertex_input->vertexBindingDescriptionCount);
+                    vertex_input->pVertexAttributeDescriptions =
+                        r.ReadArray<VkVertexInputAttributeDescription>(&vertex_input->vertexAttributeDescriptionCount);
+                }
+                create_info.pVertexInputState = vertex_input;
+                auto *input_assembly = r.ReadOptional<VkPipelineInputAssemblyStateCreateInfo>();
+                if (input_assembly) input_assembly->pNext = nullptr;
+                create_info.pInputAssemblyState = input_assembly;
+                auto *tessellation = r.ReadOptional<VkPipelineTessellationStateCreateInfo>();
+                if (tessellation) tessellation->pNext = nullptr;
+                create_info.pTessellationState = tessellation;
+                auto *viewport = r.ReadOptional<VkPipelineViewportStateCreateInfo>();
+                if (viewport) {
+                    viewport->pNext = nullptr;
+                    viewport->pViewports = r.ReadArray<VkViewport>();
+                    viewport->pScissors = r.ReadArray<VkRect2D>();
+                }
+                create_info.pViewportState = viewport;
+                auto *rasterization = r.ReadOptional<VkPipelineRasterizationStateCreateInfo>();
+                if (rasterization) rasterization->pNext = nullptr;
+                create_info.pRasterizationState = rasterization;
+                auto *multisample = r.ReadOptional<VkPipelineMultisampleStateCreateInfo>();
+                if (multisample) {
+                    multisample->pNext = nullptr;
+                    multisample->pSampleMask = r.ReadArray<VkSampleMask>();
+                }
+                create_info.pMultisampleState = multisample;
+                auto *depth_stencil = r.ReadOptional<VkPipelineDepthStencilStateCreateInfo>();
+                if (depth_stencil) depth_stencil->pNext = nullptr;
+                create_info.pDepthStencilState = depth_stencil;
+                auto *color_blend = r.ReadOptional<VkPipelineColorBlendStateCreateInfo>();
+                if (color_blend) {
+                    color_blend->pNext = nullptr;
+                    color_blend->pAttachments = r.ReadArray<VkPipelineColorBlendAttachmentState>(&color_blend->attachmentCount);
+                }
+                create_info.pColorBlendState = color_blend;
+                auto *dynamic = r.ReadOptional<VkPipelineDynamicStateCreateInfo>();
+                if (dynamic) {
+                    dynamic->pNext = nullptr;
+                    dynamic->pDynamicStates = r.ReadArray<VkDynamicState>(&dynamic->dynamicStateCount);
+                }
+                create_info.pDynamicState = dynamic;
+
+                create_info.layout = r.Map(create_info.layout);
+                create_info.renderPass = r.Map(create_info.renderPass);
+                create_info.basePipelineHandle = r.Map(create_info.basePipelineHandle);
+            }
+            uint32_t captured_count;
+            const auto *captured = r.ReadArray<uint64_t>(&captured_count);
+            if (!count || (captured_count != count)) break;
+            auto *pipelines = r.Allocate<VkPipeline>(count);
+            vk::CreateGraphicsPipelines(device_, VK_NULL_HANDLE, count, create_infos, nullptr, pipelines);
+            for (uint32_t i = 0; i < count; ++i) AddHandle(command, captured[i], pipelines[i]);
+            break;
+        }
+        case kCreateComputePipelines: {
+            uint32_t count = r.Read<uint32_t>();
+            auto *create_infos = AllocateStructs<VkComputePipelineCreateInfo>(&count);
+            for (uint32_t i = 0; i < count; ++i) {
+                auto &create_info = create_infos[i];
+                create_info = r.Read<VkComputePipelineCreateInfo>();
+                create_info.pNext = nullptr;
+                ReadShaderStage(&create_info.stage);
+                create_info.layout = r.Map(create_info.layout);
+                create_info.basePipelineHandle = r.Map(create_info.basePipelineHandle);
+            }
+            uint32_t captured_count;
+            const auto *captured = r.ReadArray<uint64_t>(&captured_count);
+            if (!count || (captured_count != count)) break;
+            auto *pipelines = r.Allocate<VkPipeline>(count);
+            vk::CreateComputePipelines(device_, VK_NULL_HANDLE, count, create_infos, nullptr, pipelines);
+            for (uint32_t i = 0; i < count; ++i) AddHandle(command, captured[i], pipelines[i]);
+            break;
+        }
+        case kDestroyPipeline:
+            vk::DestroyPipeline(device_, TakeHandle<VkPipeline>(), nullptr);
+            break;
+        case kCreateFence: {
+            auto create_info = r.Read<VkFenceCreateInfo>();
+            create_info.pNext = nullptr;
+            const uint64_t captured = r.ReadNewHandle();
+            VkFence fence = VK_NULL_HANDLE;
+            vk::CreateFence(device_, &create_info, nullptr, &fence);
+            AddHandle(command, captured, fence);
+            break;
+        }
+        case kDestroyFence:
+            vk::DestroyFence(device_, TakeHandle<VkFence>(), nullptr);
+            break;
+        case kResetFences: {
+            uint32_t count;
+            const auto *fences = r.ReadHandles<VkFence>(&count);
+            vk::ResetFences(device_, count, fences);
+            break;
+        }
+        case kWaitForFences: {
+            uint32_t count;
+            const auto *fences = r.ReadHandles<VkFence>(&count);
+            const auto wait_all = r.Read<VkBool32>();
+            const auto timeout = r.Read<uint64_t>();
+            if (count) vk::WaitForFences(device_, count, fences, wait_all, timeout);
+            break;
+        }
+        case kCreateCommandPool: {
+            auto create_info = r.Read<VkCommandPoolCreateInfo>();
+            create_info.pNext = nullptr;
+            create_info.queueFamilyIndex = queue_family_index_;
+            const uint64_t captured = r.ReadNewHandle();
+            VkCommandPool pool = VK_NULL_HANDLE;
+            vk::CreateCommandPool(device_, &create_info, nullptr, &pool);
+            AddHandle(command, captured, pool);
+            break;
+        }
+        case kDestroyCommandPool:
+            vk::DestroyCommandPool(device_, TakeHandle<VkCommandPool>(), nullptr);
+            break;
+        case kResetCommandPool: {
+            const auto pool = r.ReadHandle<VkCommandPool>();
+            vk::ResetCommandPool(device_, pool, r.Read<VkCommandPoolResetFlags>());
+            break;
+        }
+        case kAllocateCommandBuffers: {
+            auto alloc_info = r.Read<VkCommandBufferAllocateInfo>();
+            alloc_info.pNext = nullptr;
+            alloc_info.commandPool = r.Map(alloc_info.commandPool);
+            const auto *captured = r.ReadArray<uint64_t>(&alloc_info.commandBufferCount);
+            if (!captured) break;
+            auto *command_buffers = r.Allocate<VkCommandBuffer>(alloc_info.commandBufferCount);
+            if (vk::AllocateCommandBuffers(device_, &alloc_info, command_buffers) != VK_SUCCESS) break;
+            // Command buffers are freed with their pool, so aren't kept in live_
+            for (uint32_t i = 0; i < alloc_info.commandBufferCount; ++i) r.AddHandle(captured[i], command_buffers[i]);
+            break;
+        }
+        case kFreeCommandBuffers: {
+            const auto pool = r.ReadHandle<VkCommandPool>();
+            uint32_t count;
+            const auto *captured = r.ReadArray<uint64_t>(&count);
+            auto *command_buffers = r.Allocate<VkCommandBuffer>(count);
+            for (uint32_t i = 0; i < count; ++i) {
+                command_buffers[i] = r.Map(CastFromUint64<VkCommandBuffer>(captured[i]));
+                r.RemoveHandle(captured[i]);
+            }
+            vk::FreeCommandBuffers(device_, pool, count, command_buffers);
+            break;
+        }
+        case kBeginCommandBuffer: {
+            const auto command_buffer = r.ReadHandle<VkCommandBuffer>();
+            auto begin_info = r.Read<VkCommandBufferBeginInfo>();
+            begin_info.pNext = nullptr;
+            auto *inheritance = r.ReadOptional<VkCommandBufferInheritanceInfo>();
+            if (inheritance) {
+                inheritance->pNext = nullptr;
+                inheritance->renderPass = r.Map(inheritance->renderPass);
+                inheritance->framebuffer = r.Map(inheritance->framebuffer);
+            }
+            begin_info.pInheritanceInfo = inheritance;
+            vk::BeginCommandBuffer(command_buffer, &begin_info);
+            break;
+        }
+        case kEndCommandBuffer:
+            vk::EndCommandBuffer(r.ReadHandle<VkCommandBuffer>());
+            break;
+        case kResetCommandBuffer: {
+            const auto command_buffer = r.ReadHandle<VkCommandBuffer>();
+            vk::ResetCommandBuffer(command_buffer, r.Read<VkCommandBufferResetFlags>());
+            break;
+        }
+        case kCmdBindPipeline: {
+            const auto command_buffer = r.ReadHandle<VkCommandBuffer>();
+            const auto bind_point = r.Read<VkPipelineBindPoint>();
+            vk::CmdBindPipeline(command_buffer, bind_point, r.ReadHandle<VkPipeline>());
+            break;
+        }
+        case kCmdSetViewport: {
+            const auto command_buffer = r.ReadHandle<VkCommandBuffer>();
+            const auto first = r.Read<uint32_t>();
+            uint32_t count;
+            const auto *viewports = r.ReadArray<VkViewport>(&count);
+            vk::CmdSetViewport(command_buffer, first, count, viewports);
+            break;
+        }
+        case kCmdSetScissor: {
+            const auto command_buffer = r.ReadHandle<VkCommandBuffer>();
+            const auto first = r.Read<uint32_t>();
+            uint32_t count;
+            const auto *scissors = r.ReadArray<VkRect2D>(&count);
+            vk::CmdSetScissor(command_buffer, first, count, scissors);
+            break;
+        }
+        case kCmdBindDescriptorSets: {
+            const auto command_buffer = r.ReadHandle<VkCommandBuffer>();
+            const auto bind_point = r.Read<VkPipelineBindPoint>();
+            const auto layout = r.ReadHandle<VkPipelineLayout>();
+            const auto first_set = r.Read<uint32_t>();
+            uint32_t set_count;
+            const auto *sets = r.ReadHandles<VkDescriptorSet>(&set_count);
+            uint32_t offset_count;
+            const auto *offsets = r.ReadArray<uint32_t>(&offset_count);
+            vk::CmdBindDescriptorSets(command_buffer, bind_point, layout, first_set, set_count, sets, offset_count, offsets);
+            break;
+        }
+        case kCmdBindIndexBuffer: {
+            const auto command_buffer = r.ReadHandle<VkCommandBuffer>();
+            const auto buffer = r.ReadHandle<VkBuffer>();
+            const auto offset = r.Read<VkDeviceSize>();
+            vk::CmdBindIndexBuffer(command_buffer, buffer, offset, r.Read<VkIndexType>());
+            break;
+        }
+        case kCmdBindVertexBuffers: {
+            const auto command_buffer = r.ReadHandle<VkCommandBuffer>();
+            const auto first_binding = r.Read<uint32_t>();
+            uint32_t count;
+            const auto *buffers = r.ReadHandles<VkBuffer>(&count);
+            uint32_t offset_count;
+            const auto *offsets = r.ReadArray<VkDeviceSize>(&offset_count);
+            if (offset_count == count) vk::CmdBindVertexBuffers(command_buffer, first_binding, count, buffers, offsets);
+            break;
+        }
+        case kCmdDraw: {
+            const auto command_buffer = r.ReadHandle<VkCommandBuffer>();
+            const auto vertex_count = r.Read<uint32_t>();
+            const auto instance_count = r.Read<uint32_t>();
+            const auto first_vertex = r.Read<uint32_t>();
+            vk::CmdDraw(command_buffer, vertex_count, instance_count, first_vertex, r.Read<uint32_t>());
+            break;
+        }
+        case kCmdDrawIndexed: {
+            const auto command_buffer = r.ReadHandle<VkCommandBuffer>();
+            const auto index_count = r.Read<uint32_t>();
+            const auto instance_count = r.Read<uint32_t>();
+            const auto first_index = r.Read<uint32_t>();
+            const auto vertex_offset = r.Read<int32_t>();
+            vk::CmdDrawIndexed(command_buffer, index_count, instance_count, first_index, vertex_offset, r.Read<uint32_t>());
+            break;
+        }
+        case kCmdDrawIndirect:
+        case kCmdDrawIndexedIndirect: {
+            const auto command_buffer = r.ReadHandle<VkCommandBuffer>();
+            const auto buffer = r.ReadHandle<VkBuffer>();
+            const auto offset = r.Read<VkDeviceSize>();
+            const auto draw_count = r.Read<uint32_t>();
+            const auto stride = r.Read<uint32_t>();
+            if (command == kCmdDrawIndirect) {
+                vk::CmdDrawIndirect(command_buffer, buffer, offset, draw_count, stride);
+            } else {
+                vk::CmdDrawIndexedIndirect(command_buffer, buffer, offset, draw_count, stride);
+            }
+            break;
+        }
+        case kCmdDispatch: {
+            const auto command_buffer = r.ReadHandle<VkCommandBuffer>();
+            const auto x = r.Read<uint32_t>();
+            const auto y = r.Read<uint32_t>();
+            vk::CmdDispatch(command_buffer, x, y, r.Read<uint32_t>());
+            break;
+        }
+        case kCmdDispatchIndirect: {
+            const auto command_buffer = r.ReadHandle<VkCommandBuffer>();
+            const auto buffer = r.ReadHandle<VkBuffer>();
+            vk::CmdDispatchIndirect(command_buffer, buffer, r.Read<VkDeviceSize>());
+            break;
+        }
+        case kCmdCopyBuffer: {
+            const auto command_buffer = r.ReadHandle<VkCommandBuffer>();
+            const auto src = r.ReadHandle<VkBuffer>();
+            const auto dst = r.ReadHandle<VkBuffer>();
+            uint32_t count;
+            const auto *regions = r.ReadArray<VkBufferCopy>(&count);
+            vk::CmdCopyBuffer(command_buffer, src, dst, count, regions);
+            break;
+        }
+        case kCmdCopyImage:
+        case kCmdBlitImage: {
+            const auto command_buffer = r.ReadHandle<VkCommandBuffer>();
+            const auto src = r.ReadHandle<VkImage>();
+            const auto src_layout = r.Read<VkImageLayout>();
+            const auto dst = r.ReadHandle<VkImage>();
+            const auto dst_layout = r.Read<VkImageLayout>();
+            uint32_t count;
+            if (command == kCmdCopyImage) {
+                const auto *regions = r.ReadArray<VkImageCopy>(&count);
+                vk::CmdCopyImage(command_buffer, src, src_layout, dst, dst_layout, count, regions);
+            } else {
+                const auto *regions = r.ReadArray<VkImageBlit>(&count);
+                vk::CmdBlitImage(command_buffer, src, src_layout, dst, dst_layout, count, regions, r.Read<VkFilter>());
+            }
+            break;
+        }
+        case kCmdCopyBufferToImage: {
+            const auto command_buffer = r.ReadHandle<VkCommandBuffer>();
+            const auto src = r.ReadHandle<VkBuffer>();
+            const auto dst = r.ReadHandle<VkImage>();
+            const auto dst_layout = r.Read<VkImageLayout>();
+            uint32_t count;
+            const auto *regions = r.ReadArray<VkBufferImageCopy>(&count);
+            vk::CmdCopyBufferToImage(command_buffer, src, dst, dst_layout, count, regions);
+            break;
+        }
+        case kCmdCopyImageToBuffer: {
+            const auto command_buffer = r.ReadHandle<VkCommandBuffer>();
+            const auto src = r.ReadHandle<VkImage>();
+            const auto src_layout = r.Read<VkImageLayout>();
+            const auto dst = r.ReadHandle<VkBuffer>();
+            uint32_t count;
+            const auto *regions = r.ReadArray<VkBufferImageCopy>(&count);
+            vk::CmdCopyImageToBuffer(command_buffer, src, src_layout, dst, count, regions);
+            break;
+        }
+        case kCmdUpdateBuffer: {
+            const auto command_buffer = r.ReadHandle<VkCommandBuffer>();
+            const auto buffer = r.ReadHandle<VkBuffer>();
+            const auto offset = r.Read<VkDeviceSize>();
+            uint32_t size;
+            const auto *data = r.ReadArray<uint8_t>(&size);
+            vk::CmdUpdateBuffer(command_buffer, buffer, offset, size, data);
+            break;
+        }
+        case kCmdFillBuffer: {
+            const auto command_buffer = r.ReadHandle<VkCommandBuffer>();
+            const auto buffer = r.ReadHandle<VkBuffer>();
+            const auto offset = r.Read<VkDeviceSize>();
+            const auto size = r.Read<VkDeviceSize>();
+            vk::CmdFillBuffer(command_buffer, buffer, offset, size, r.Read<uint32_t>());
+            break;
+        }
+        case kCmdClearColorImage: {
+            const auto command_buffer = r.ReadHandle<VkCommandBuffer>();
+            const auto image = r.ReadHandle<VkImage>();
+            const auto layout = r.Read<VkImageLayout>();
+            const auto color = r.Read<VkClearColorValue>();
+            uint32_t count;
+            const auto *ranges = r.ReadArray<VkImageSubresourceRange>(&count);
+            vk::CmdClearColorImage(command_buffer, image, layout, &color, count, ranges);
+            break;
+        }
+        case kCmdClearAttachments: {
+            const auto command_buffer = r.ReadHandle<VkCommandBuffer>();
+            uint32_t attachment_count;
+            const auto *attachments = r.ReadArray<VkClearAttachment>(&attachment_count);
+            uint32_t rect_count;
+            const auto *rects = r.ReadArray<VkClearRect>(&rect_count);
+            vk::CmdClearAttachments(command_buffer, attachment_count, attachments, rect_count, rects);
+            break;
+        }
+        case kCmdPipelineBarrier: {
+            const auto command_buffer = r.ReadHandle<VkCommandBuffer>();
+            const auto src_stages = r.Read<VkPipelineStageFlags>();
+            const auto dst_stages = r.Read<VkPipelineStageFlags>();
+            const auto dependency_flags = r.Read<VkDependencyFlags>();
+            uint32_t memory_count;
+            auto *memory_barriers = r.ReadArray<VkMemoryBarrier>(&memory_count);
+            for (uint32_t i = 0; i < memory_count; ++i) memory_barriers[i].pNext = nullptr;
+            uint32_t buffer_count;
+            auto *buffer_barriers = r.ReadArray<VkBufferMemoryBarrier>(&buffer_count);
+            for (uint32_t i = 0; i < buffer_count; ++i) {
+                buffer_barriers[i].pNext = nullptr;
+                buffer_barriers[i].buffer = r.Map(buffer_barriers[i].buffer);
+            }
+            uint32_t image_count;
+            auto *image_barriers = r.ReadArray<VkImageMemoryBarrier>(&image_count);
+            for (uint32_t i = 0; i < image_count; ++i) {
+                image_barriers[i].pNext = nullptr;
+                image_barriers[i].image = r.Map(image_barriers[i].image);
+            }
+            vk::CmdPipelineBarrier(command_buffer, src_stages, dst_stages, dependency_flags, memory_count, memory_barriers,
+                                   buffer_count, buffer_barriers, image_count, image_barriers);
+            break;
+        }
+        case kCmdPushConstants: {
+            const auto command_buffer = r.ReadHandle<VkCommandBuffer>();
+            const auto layout = r.ReadHandle<VkPipelineLayout>();
+            const auto stages = r.Read<VkShaderStageFlags>();
+            const auto offset = r.Read<uint32_t>();
+            uint32_t size;
+            const auto *values = r.ReadArray<uint8_t>(&size);
+            vk::CmdPushConstants(command_buffer, layout, stages, offset, size, values);
+            break;
+        }
+        case kCmdBeginRenderPass: {
+            const auto command_buffer = r.ReadHandle<VkCommandBuffer>();
+            auto begin_info = r.Read<VkRenderPassBeginInfo>();
+            begin_info.pNext = nullptr;
+            begin_info.renderPass = r.Map(begin_info.renderPass);
+            begin_info.framebuffer = r.Map(begin_info.framebuffer);
+            begin_info.pClearValues = r.ReadArray<VkClearValue>(&begin_info.clearValueCount);
+            vk::CmdBeginRenderPass(command_buffer, &begin_info, r.Read<VkSubpassContents>());
+            break;
+        }
+        case kCmdNextSubpass: {
+            const auto command_buffer = r.ReadHandle<VkCommandBuffer>();
+            vk::CmdNextSubpass(command_buffer, r.Read<VkSubpassContents>());
+            break;
+        }
+        case kCmdEndRenderPass:
+            vk::CmdEndRenderPass(r.ReadHandle<VkCommandBuffer>());
+            break;
+        case kCmdExecuteCommands: {
+            const auto command_buffer = r.ReadHandle<VkCommandBuffer>();
+            uint32_t count;
+            const auto *command_buffers = r.ReadHandles<VkCommandBuffer>(&count);
+            if (count) vk::CmdExecuteCommands(command_buffer, count, command_buffers);
+            break;
+        }
+        case kCreateSwapchainKHR: {
+            // Only the image properties are kept, the replay has no surface
+            const auto create_info = r.Read<VkSwapchainCreateInfoKHR>();
+            swapchains_[r.ReadNewHandle()] = create_info;
+            break;
+        }
+        case kGetSwapchainImagesKHR: {
+            const auto swapchain = swapchains_.find(r.ReadNewHandle());
+            uint32_t count;
+            const auto *images = r.ReadArray<uint64_t>(&count);
+            if (swapchain != swapchains_.end()) ReplaceSwapchainImages(swapchain->second, images, count);
+            break;
+        }
+        default:
+            break;
+    }
+}
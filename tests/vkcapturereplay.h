@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "api_capture_stream.h"
+
+// Replays a capture written by the layer's ApiCapture object (VALIDATION_CHECK_ENABLE_API_CAPTURE) on a device created by the
+// test framework, timing each type of call.
+//
+// All queues of the capture are replayed on the one queue given to Replay, and command pools are created on its family.
+// Memory is allocated from the first memory type with the captured type's property flags, and the swapchain images the
+// capture used are replaced by images of the same format, extent and usage.  Whatever the capture leaves alive is destroyed
+// in reverse creation order at the end of Replay.
+class CaptureReplay {
+  public:
+    struct Timing {
+        uint64_t calls = 0;
+        double ns = 0.0;
+    };
+
+    // Reads the device record of the capture, returning false if the file can't be read or doesn't start with one
+    bool Open(const char *filename);
+    const std::vector<std::string> &DeviceExtensions() const { return device_extensions_; }
+    const VkPhysicalDeviceFeatures *DeviceFeatures() const { return has_features_ ? &device_features_ : nullptr; }
+
+    // Replays the remaining records, returning false if the capture ends in a truncated or corrupt record.  The time of each
+    // record includes reading it, which a replay with validation disabled measures as the baseline.
+    bool Replay(VkPhysicalDevice gpu, VkDevice device, VkQueue queue, uint32_t queue_family_index);
+
+    const Timing &GetTiming(api_capture::Command command) const { return timings_[command]; }
+    // Captured handles that the replay didn't know, such as those of calls outside of the captured subset
+    uint64_t UnknownHandleCount() const { return reader_.UnknownHandleCount(); }
+
+  private:
+    void ReplayRecord(api_capture::Command command);
+    void ReadShaderStage(VkPipelineShaderStageCreateInfo *stage);
+    void ReplaceSwapchainImages(const VkSwapchainCreateInfoKHR &swapchain, const uint64_t *images, uint32_t count);
+    uint32_t MemoryTypeIndex(VkMemoryPropertyFlags property_flags, uint32_t type_bits) const;
+    void DestroyLiveObjects();
+
+    // Scratch for count structures that are each stored in full, with count clamped to what the record can hold
+    template <typename T>
+    T *AllocateStructs(uint32_t *count) {
+        *count = static_cast<uint32_t>(std::min<size_t>(*count, reader_.RemainingBytes() / sizeof(T)));
+        return reader_.Allocate<T>(*count);
+    }
+    // Maps a captured handle that the record creates, and keeps it for destruction at the end of the replay
+    template <typename HandleType>
+    void AddHandle(api_capture::Command creator, uint64_t captured, HandleType replayed) {
+        if (!captured || !replayed) return;
+        reader_.AddHandle(captured, replayed);
+        live_[captured] = live_order_.size();
+        live_order_.push_back({creator, captured});
+    }
+    // The replay handle for a captured handle the record destroys, which is unmapped
+    template <typename HandleType>
+    HandleType TakeHandle() {
+        const uint64_t captured = reader_.ReadNewHandle();
+        const HandleType replayed = reader_.Map(CastFromUint64<HandleType>(captured));
+        reader_.RemoveHandle(captured);
+        live_.erase(captured);
+        return replayed;
+    }
+
+    api_capture::Reader reader_;
+    std::vector<std::string> device_extensions_;
+    bool has_features_ = false;
+    VkPhysicalDeviceFeatures device_features_ = {};
+
+    VkDevice device_ = VK_NULL_HANDLE;
+    VkQueue queue_ = VK_NULL_HANDLE;
+    uint32_t queue_family_index_ = 0;
+    VkPhysicalDeviceMemoryProperties memory_properties_ = {};
+    Timing timings_[api_capture::kCommandCount];
+
+    // Captured handles that are still alive, with their index in live_order_, which a reused handle value makes stale
+    std::unordered_map<uint64_t, size_t> live_;
+    std::vector<std::pair<api_capture::Command, uint64_t>> live_order_;
+    std::unordered_map<uint64_t, VkSwapchainCreateInfoKHR> swapchains_;
+    // The captured swapchain images, and the images and memory that replace them
+    std::unordered_set<uint64_t> captured_swapchain_images_;
+    std::vector<std::pair<VkImage, VkDeviceMemory>> swapchain_images_;
+};
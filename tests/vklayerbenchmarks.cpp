@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ */
+
+// Layer overhead benchmarks
+//
+// Each workload drives the full VK_LAYER_KHRONOS_validation chassis with a scripted stream of API calls, once per set of
+// enabled validation areas, and reports the mean wall clock time per call.  Run against the Mock ICD (see BUILD.md) the driver
+// cost is negligible, so the numbers are the layer's own overhead and can be compared between builds on headless machines.
+
+#include <chrono>
+#include <cinttypes>
+
+#include "layer_validation_tests.h"
+#include "vkcapturereplay.h"
+
+struct BenchmarkAreas {
+    const char *name;
+    std::vector<VkValidationFeatureEnableEXT> enables;
+    std::vector<VkValidationFeatureDisableEXT> disables;
+};
+
+static void PrintTo(const BenchmarkAreas &areas, std::ostream *os) { *os << areas.name; }
+
+static const std::vector<BenchmarkAreas> kBenchmarkAreas = {
+    // The chassis and dispatch alone
+    {"NoValidation", {}, {VK_VALIDATION_FEATURE_DISABLE_ALL_EXT}},
+    // Thread safety, stateless, object lifetimes and core checks
+    {"Default", {}, {}},
+    {"CoreChecks",
+     {},
+     {VK_VALIDATION_FEATURE_DISABLE_THREAD_SAFETY_EXT, VK_VALIDATION_FEATURE_DISABLE_API_PARAMETERS_EXT,
+      VK_VALIDATION_FEATURE_DISABLE_OBJECT_LIFETIMES_EXT}},
+    {"ThreadSafety",
+     {},
+     {VK_VALIDATION_FEATURE_DISABLE_API_PARAMETERS_EXT, VK_VALIDATION_FEATURE_DISABLE_OBJECT_LIFETIMES_EXT,
+      VK_VALIDATION_FEATURE_DISABLE_CORE_CHECKS_EXT}},
+    {"Stateless",
+     {},
+     {VK_VALIDATION_FEATURE_DISABLE_THREAD_SAFETY_EXT, VK_VALIDATION_FEATURE_DISABLE_OBJECT_LIFETIMES_EXT,
+      VK_VALIDATION_FEATURE_DISABLE_CORE_CHECKS_EXT}},
+    {"ObjectLifetimes",
+     {},
+     {VK_VALIDATION_FEATURE_DISABLE_THREAD_SAFETY_EXT, VK_VALIDATION_FEATURE_DISABLE_API_PARAMETERS_EXT,
+      VK_VALIDATION_FEATURE_DISABLE_CORE_CHECKS_EXT}},
+    {"SyncValidation",
+     {VK_VALIDATION_FEATURE_ENABLE_SYNCHRONIZATION_VALIDATION_EXT},
+     {VK_VALIDATION_FEATURE_DISABLE_THREAD_SAFETY_EXT, VK_VALIDATION_FEATURE_DISABLE_API_PARAMETERS_EXT,
+      VK_VALIDATION_FEATURE_DISABLE_OBJECT_LIFETIMES_EXT, VK_VALIDATION_FEATURE_DISABLE_CORE_CHECKS_EXT}},
+    {"BestPractices",
+     {VK_VALIDATION_FEATURE_ENABLE_BEST_PRACTICES_EXT},
+     {VK_VALIDATION_FEATURE_DISABLE_THREAD_SAFETY_EXT, VK_VALIDATION_FEATURE_DISABLE_API_PARAMETERS_EXT,
+      VK_VALIDATION_FEATURE_DISABLE_OBJECT_LIFETIMES_EXT, VK_VALIDATION_FEATURE_DISABLE_CORE_CHECKS_EXT}},
+};
+
+class VkLayerBenchmark : public VkLayerTest, public ::testing::WithParamInterface<BenchmarkAreas> {
+  public:
+    void InitBenchmarkFramework() {
+        const auto &areas = GetParam();
+        features_.enabledValidationFeatureCount = static_cast<uint32_t>(areas.enables.size());
+        features_.pEnabledValidationFeatures = areas.enables.data();
+        features_.disabledValidationFeatureCount = static_cast<uint32_t>(areas.disables.size());
+        features_.pDisabledValidationFeatures = areas.disables.data();
+        InitFramework(m_errorMonitor, &features_);
+    }
+
+    // Time count repetitions of call, reporting the mean per repetition
+    template <typename Call>
+    void Measure(const char *workload, uint32_t count, const Call &call) {
+        const auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < count; ++i) {
+            call(i);
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        const double ns_per_call = std::chrono::duration<double, std::nano>(elapsed).count() / count;
+
+        printf("[ BENCHMARK] %-28s %-16s %12.1f ns/call (%u calls)\n", workload, GetParam().name, ns_per_call, count);
+        RecordProperty(workload, std::to_string(static_cast<uint64_t>(ns_per_call)));
+    }
+
+  protected:
+    VkValidationFeaturesEXT features_ = {VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT};
+};
+
+TEST_P(VkLayerBenchmark, DrawHeavy) {
+    ASSERT_NO_FATAL_FAILURE(InitBenchmarkFramework());
+    ASSERT_NO_FATAL_FAILURE(InitState());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    CreatePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.InitState();
+    ASSERT_VK_SUCCESS(pipe.CreateGraphicsPipeline());
+
+    m_errorMonitor->ExpectSuccess();
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_);
+    Measure("vkCmdDraw", 20000, [this](uint32_t i) { vk::CmdDraw(m_commandBuffer->handle(), 3, 1, 0, i); });
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+
+    Measure("vkQueueSubmit+vkQueueWaitIdle", 200, [this](uint32_t) { m_commandBuffer->QueueCommandBuffer(); });
+    m_errorMonitor->VerifyNotFound();
+}
+
+TEST_P(VkLayerBenchmark, DescriptorHeavy) {
+    ASSERT_NO_FATAL_FAILURE(InitBenchmarkFramework());
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    const uint32_t kSetCount = 1000;
+    VkDescriptorPoolSize pool_size = {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, kSetCount};
+    auto pool_ci = LvlInitStruct<VkDescriptorPoolCreateInfo>();
+    pool_ci.maxSets = kSetCount;
+    pool_ci.poolSizeCount = 1;
+    pool_ci.pPoolSizes = &pool_size;
+    vk_testing::DescriptorPool pool;
+    pool.init(*m_device, pool_ci);
+
+    const VkDescriptorSetLayoutObj layout(m_device, {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr}});
+    const VkPipelineLayoutObj pipeline_layout(m_device, {&layout});
+    std::vector<VkDescriptorSetLayout> set_layouts(kSetCount, layout.handle());
+    std::vector<VkDescriptorSet> sets(kSetCount);
+    auto alloc_info = LvlInitStruct<VkDescriptorSetAllocateInfo>();
+    alloc_info.descriptorPool = pool.handle();
+    alloc_info.descriptorSetCount = kSetCount;
+    alloc_info.pSetLayouts = set_layouts.data();
+    ASSERT_VK_SUCCESS(vk::AllocateDescriptorSets(device(), &alloc_info, sets.data()));
+
+    VkBufferObj buffer;
+    buffer.init(*m_device, 256, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    VkDescriptorBufferInfo buffer_info = {buffer.handle(), 0, 256};
+    auto write = LvlInitStruct<VkWriteDescriptorSet>();
+    write.descriptorCount = 1;
+    write.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    write.pBufferInfo = &buffer_info;
+
+    m_errorMonitor->ExpectSuccess();
+    Measure("vkUpdateDescriptorSets", kSetCount, [&](uint32_t i) {
+        write.dstSet = sets[i];
+        vk::UpdateDescriptorSets(device(), 1, &write, 0, nullptr);
+    });
+
+    m_commandBuffer->begin();
+    Measure("vkCmdBindDescriptorSets", kSetCount, [&](uint32_t i) {
+        vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout.handle(), 0, 1,
+                                  &sets[i], 0, nullptr);
+    });
+    m_commandBuffer->end();
+    m_errorMonitor->VerifyNotFound();
+}
+
+TEST_P(VkLayerBenchmark, BarrierHeavy) {
+    ASSERT_NO_FATAL_FAILURE(InitBenchmarkFramework());
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    VkBufferObj buffer_a;
+    VkBufferObj buffer_b;
+    VkMemoryPropertyFlags mem_prop = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    buffer_a.init_as_src_and_dst(*m_device, 4096, mem_prop);
+    buffer_b.init_as_src_and_dst(*m_device, 4096, mem_prop);
+
+    auto buffer_barrier = LvlInitStruct<VkBufferMemoryBarrier>();
+    buffer_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    buffer_barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    buffer_barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    buffer_barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    buffer_barrier.buffer = buffer_a.handle();
+    buffer_barrier.size = VK_WHOLE_SIZE;
+
+    m_errorMonitor->ExpectSuccess();
+    const auto cb = m_commandBuffer->handle();
+    m_commandBuffer->begin();
+    // Interleave copies so each barrier has prior accesses to apply to
+    Measure("vkCmdCopyBuffer+vkCmdPipelineBarrier", 5000, [&](uint32_t i) {
+        const VkBufferCopy region = {(i % 64) * 64, (i % 64) * 64, 64};
+        vk::CmdCopyBuffer(cb, buffer_b.handle(), buffer_a.handle(), 1, &region);
+        vk::CmdPipelineBarrier(cb, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 1,
+                               &buffer_barrier, 0, nullptr);
+    });
+    m_commandBuffer->end();
+    m_errorMonitor->VerifyNotFound();
+}
+
+TEST_P(VkLayerBenchmark, PipelineCreationHeavy) {
+    ASSERT_NO_FATAL_FAILURE(InitBenchmarkFramework());
+    ASSERT_NO_FATAL_FAILURE(InitState());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    CreatePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.InitState();
+
+    m_errorMonitor->ExpectSuccess();
+    // CreateGraphicsPipeline destroys the previous pipeline, so this times a create/destroy pair
+    Measure("vkCreateGraphicsPipelines", 500, [&](uint32_t) { pipe.CreateGraphicsPipeline(); });
+    m_errorMonitor->VerifyNotFound();
+}
+
+// Replays the capture named by the VK_LAYER_REPLAY_FILE environment variable, written by a layer with
+// VALIDATION_CHECK_ENABLE_API_CAPTURE (see docs/layer_performance.md), reporting the mean time of each type of call
+TEST_P(VkLayerBenchmark, Replay) {
+    const char *filename = getenv("VK_LAYER_REPLAY_FILE");
+    if (!filename) {
+        printf("%s VK_LAYER_REPLAY_FILE not set, skipping capture replay.\n", kSkipPrefix);
+        return;
+    }
+    CaptureReplay replay;
+    ASSERT_TRUE(replay.Open(filename)) << "Cannot read the capture " << filename;
+    ASSERT_NO_FATAL_FAILURE(InitBenchmarkFramework());
+
+    // The swapchain images are replaced by plain images, so the replay needs no surface
+    for (const auto &extension : replay.DeviceExtensions()) {
+        if ((extension != VK_KHR_SWAPCHAIN_EXTENSION_NAME) && DeviceExtensionSupported(gpu(), nullptr, extension.c_str())) {
+            m_device_extension_names.push_back(extension.c_str());
+        }
+    }
+    VkPhysicalDeviceFeatures features = {};
+    if (replay.DeviceFeatures()) {
+        VkPhysicalDeviceFeatures supported;
+        vk::GetPhysicalDeviceFeatures(gpu(), &supported);
+        const auto *captured_bools = reinterpret_cast<const VkBool32 *>(replay.DeviceFeatures());
+        const auto *supported_bools = reinterpret_cast<const VkBool32 *>(&supported);
+        auto *enabled_bools = reinterpret_cast<VkBool32 *>(&features);
+        for (size_t i = 0; i < sizeof(features) / sizeof(VkBool32); ++i) {
+            enabled_bools[i] = captured_bools[i] && supported_bools[i];
+        }
+    }
+    ASSERT_NO_FATAL_FAILURE(InitState(&features));
+
+    // The capture was valid on its own device, the messages of the replay's differences aren't of interest
+    m_errorMonitor->SetAllowedFailureMsg("");
+    EXPECT_TRUE(replay.Replay(gpu(), device(), m_device->m_queue, m_device->graphics_queue_node_index_))
+        << "The capture " << filename << " ends in a truncated record";
+
+    double total_ns = 0.0;
+    for (uint32_t command = 0; command < api_capture::kCommandCount; ++command) {
+        const auto &timing = replay.GetTiming(static_cast<api_capture::Command>(command));
+        if (!timing.calls) continue;
+        total_ns += timing.ns;
+        printf("[ BENCHMARK] %-28s %-16s %12.1f ns/call (%" PRIu64 " calls)\n", api_capture::kCommandNames[command],
+               GetParam().name, timing.ns / timing.calls, timing.calls);
+    }
+    printf("[ BENCHMARK] %-28s %-16s %12.1f ms (%" PRIu64 " unknown handles)\n", "Replay", GetParam().name, total_ns / 1e6,
+           replay.UnknownHandleCount());
+    RecordProperty("Replay", std::to_string(static_cast<uint64_t>(total_ns)));
+}
+
+INSTANTIATE_TEST_CASE_P(ValidationAreas, VkLayerBenchmark, ::testing::ValuesIn(kBenchmarkAreas),
+                        [](const ::testing::TestParamInfo<BenchmarkAreas> &info) { return std::string(info.param.name); });
+
+// The format queries sit on the hot paths of image, copy and descriptor validation, so are timed on their own
+TEST(VkFormatUtilsBenchmark, FormatQueries) {
+    std::vector<VkFormat> formats;
+    for (uint32_t i = VK_FORMAT_UNDEFINED; i <= VK_FORMAT_ASTC_12x12_SRGB_BLOCK; ++i) {
+        formats.push_back(static_cast<VkFormat>(i));
+    }
+    for (uint32_t i = VK_FORMAT_G8B8G8R8_422_UNORM; i <= VK_FORMAT_G16_B16_R16_3PLANE_444_UNORM; ++i) {
+        formats.push_back(static_cast<VkFormat>(i));
+    }
+    formats.push_back(VK_FORMAT_PVRTC1_2BPP_UNORM_BLOCK_IMG);
+    formats.push_back(VK_FORMAT_ASTC_4x4_SFLOAT_BLOCK_EXT);
+
+    const uint32_t kRepeatCount = 2000;
+    uint64_t sink = 0;
+    auto measure = [&](const char *query, uint32_t (*call)(VkFormat)) {
+        const auto start = std::chrono::steady_clock::now();
+        for (uint32_t repeat = 0; repeat < kRepeatCount; ++repeat) {
+            for (const auto format : formats) sink += call(format);
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        const uint32_t count = kRepeatCount * static_cast<uint32_t>(formats.size());
+        const double ns_per_call = std::chrono::duration<double, std::nano>(elapsed).count() / count;
+        printf("[ BENCHMARK] %-28s %-16s %12.1f ns/call (%u calls)\n", query, "FormatUtils", ns_per_call, count);
+    };
+
+    measure("FormatElementSize", [](VkFormat format) { return FormatElementSize(format); });
+    measure("FormatChannelCount", [](VkFormat format) { return FormatChannelCount(format); });
+    measure("FormatCompatibilityClass",
+            [](VkFormat format) { return static_cast<uint32_t>(FormatCompatibilityClass(format)); });
+    measure("FormatPlaneCount", [](VkFormat format) { return FormatPlaneCount(format); });
+    measure("FormatTexelBlockExtent", [](VkFormat format) { return FormatTexelBlockExtent(format).width; });
+    measure("FormatIsCompressed", [](VkFormat format) { return static_cast<uint32_t>(FormatIsCompressed(format)); });
+    measure("FormatIsDepthOrStencil", [](VkFormat format) { return static_cast<uint32_t>(FormatIsDepthOrStencil(format)); });
+    measure("FormatIsUInt", [](VkFormat format) { return static_cast<uint32_t>(FormatIsUInt(format)); });
+    measure("FormatRequiresYcbcrConversion",
+            [](VkFormat format) { return static_cast<uint32_t>(FormatRequiresYcbcrConversion(format)); });
+    EXPECT_NE(sink, 0u);
+}
@@ -129,6 +129,12 @@ TEST_F(VkLayerTest, BufferExtents) {
     vk::CmdCopyBuffer(m_commandBuffer->handle(), buffer_two.handle(), buffer_two.handle(), 1, &copy_info);
     m_errorMonitor->VerifyFound();
 
+    // The destination of pRegions[1] lies inside of the source of pRegions[0], while neither region overlaps itself
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-vkCmdCopyBuffer-pRegions-00117");
+    const VkBufferCopy nested_copies[2] = {{0, 1536, 512}, {1024, 128, 64}};
+    vk::CmdCopyBuffer(m_commandBuffer->handle(), buffer_two.handle(), buffer_two.handle(), 2, nested_copies);
+    m_errorMonitor->VerifyFound();
+
     m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-VkBufferCopy-size-01988");
     copy_info = {256, 256, 0};
     vk::CmdCopyBuffer(m_commandBuffer->handle(), buffer_two.handle(), buffer_two.handle(), 1, &copy_info);
@@ -3365,6 +3371,112 @@ TEST_F(VkLayerTest, BlitImageLayout) {
     ASSERT_VK_SUCCESS(err);
 }
 
+TEST_F(VkLayerTest, ImageLayoutChangedBetweenSubmits) {
+    TEST_DESCRIPTION("Resubmit a command buffer after another submission changed the layout its images are expected in");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    VkImageObj src_image(m_device);
+    VkImageObj dst_image(m_device);
+    src_image.Init(64, 64, 1, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_USAGE_TRANSFER_SRC_BIT, VK_IMAGE_TILING_OPTIMAL, 0);
+    dst_image.Init(64, 64, 1, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_USAGE_TRANSFER_DST_BIT, VK_IMAGE_TILING_OPTIMAL, 0);
+    ASSERT_TRUE(src_image.initialized());
+    ASSERT_TRUE(dst_image.initialized());
+    src_image.SetLayout(VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+    dst_image.SetLayout(VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+
+    VkImageCopy copy_region = {};
+    copy_region.srcSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+    copy_region.dstSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+    copy_region.extent = {64, 64, 1};
+
+    VkCommandBufferBeginInfo begin_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO, nullptr, 0, nullptr};
+    m_commandBuffer->begin(&begin_info);
+    vk::CmdCopyImage(m_commandBuffer->handle(), src_image.image(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, dst_image.image(),
+                     VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &copy_region);
+    m_commandBuffer->end();
+
+    // Layouts are unchanged between these submits, so both are valid
+    m_errorMonitor->ExpectSuccess();
+    m_commandBuffer->QueueCommandBuffer();
+    m_commandBuffer->QueueCommandBuffer();
+    m_errorMonitor->VerifyNotFound();
+
+    // Now the source is no longer in the layout the command buffer was recorded for
+    src_image.SetLayout(VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_GENERAL);
+
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "UNASSIGNED-CoreValidation-DrawState-InvalidImageLayout");
+    m_commandBuffer->QueueCommandBuffer(false);
+    m_errorMonitor->VerifyFound();
+}
+
+TEST_F(VkLayerTest, ImageLayoutUniformThenPartialTransition) {
+    TEST_DESCRIPTION("Transition whole images, which keeps one layout for all subresources, then only one mip level of them");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    VkImageObj image(m_device);
+    image.Init(64, 64, 2, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+               VK_IMAGE_TILING_OPTIMAL, 0);
+    ASSERT_TRUE(image.initialized());
+    image.SetLayout(VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+
+    VkImageMemoryBarrier barrier = {VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+                                    nullptr,
+                                    VK_ACCESS_TRANSFER_WRITE_BIT,
+                                    VK_ACCESS_TRANSFER_WRITE_BIT,
+                                    VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                    VK_IMAGE_LAYOUT_GENERAL,
+                                    VK_QUEUE_FAMILY_IGNORED,
+                                    VK_QUEUE_FAMILY_IGNORED,
+                                    image.handle(),
+                                    {VK_IMAGE_ASPECT_COLOR_BIT, 0, 2, 0, 1}};
+    const VkImageSubresourceRange full_range = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 2, 0, 1};
+    const VkImageSubresourceRange mip_0 = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+    const VkImageSubresourceRange mip_1 = {VK_IMAGE_ASPECT_COLOR_BIT, 1, 1, 0, 1};
+    const VkClearColorValue clear_color = {};
+
+    // Only full range transitions, validated against the one layout shared by all subresources
+    VkCommandBufferObj uniform_cb(m_device, m_commandPool);
+    m_errorMonitor->ExpectSuccess();
+    uniform_cb.begin();
+    uniform_cb.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1,
+                               &barrier);
+    uniform_cb.ClearColorImage(image.handle(), VK_IMAGE_LAYOUT_GENERAL, &clear_color, 1, &full_range);
+    uniform_cb.end();
+    uniform_cb.QueueCommandBuffer();
+    m_errorMonitor->VerifyNotFound();
+
+    // A full range transition followed by one of mip level 1 only, after which the mip levels have different layouts
+    m_errorMonitor->ExpectSuccess();
+    m_commandBuffer->begin();
+    barrier.oldLayout = VK_IMAGE_LAYOUT_GENERAL;
+    barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    m_commandBuffer->PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1,
+                                     &barrier);
+    barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    barrier.subresourceRange = mip_1;
+    m_commandBuffer->PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1,
+                                     &barrier);
+    m_commandBuffer->ClearColorImage(image.handle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &clear_color, 1, &mip_0);
+    m_errorMonitor->VerifyNotFound();
+
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-vkCmdClearColorImage-imageLayout-00004");
+    m_commandBuffer->ClearColorImage(image.handle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &clear_color, 1, &mip_1);
+    m_errorMonitor->VerifyFound();
+    m_commandBuffer->end();
+
+    m_errorMonitor->ExpectSuccess();
+    m_commandBuffer->QueueCommandBuffer();
+    m_errorMonitor->VerifyNotFound();
+
+    // The uniform command buffer expects all of the image in TRANSFER_DST_OPTIMAL, which mip level 1 now isn't
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "UNASSIGNED-CoreValidation-DrawState-InvalidImageLayout");
+    uniform_cb.QueueCommandBuffer(false);
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(VkLayerTest, BlitImageOffsets) {
     ASSERT_NO_FATAL_FAILURE(Init());
 
@@ -4112,6 +4224,44 @@ TEST_F(VkLayerTest, InvalidCmdBufferBufferDestroyed) {
     vk::FreeMemory(m_device->handle(), mem, NULL);
 }
 
+TEST_F(VkLayerTest, InvalidCmdBufferBufferDestroyedWhileRecording) {
+    TEST_DESCRIPTION("End a command buffer that is invalid due to a buffer dependency being destroyed during recording.");
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    VkBufferCreateInfo buf_info = {};
+    buf_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buf_info.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    buf_info.size = 256;
+    buf_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    VkBuffer buffer;
+    ASSERT_VK_SUCCESS(vk::CreateBuffer(m_device->device(), &buf_info, NULL, &buffer));
+
+    VkMemoryRequirements mem_reqs;
+    vk::GetBufferMemoryRequirements(m_device->device(), buffer, &mem_reqs);
+    VkMemoryAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    alloc_info.allocationSize = mem_reqs.size;
+    if (!m_device->phy().set_memory_type(mem_reqs.memoryTypeBits, &alloc_info, 0)) {
+        printf("%s Failed to set memory type.\n", kSkipPrefix);
+        vk::DestroyBuffer(m_device->device(), buffer, NULL);
+        return;
+    }
+    VkDeviceMemory mem;
+    ASSERT_VK_SUCCESS(vk::AllocateMemory(m_device->device(), &alloc_info, NULL, &mem));
+    ASSERT_VK_SUCCESS(vk::BindBufferMemory(m_device->device(), buffer, mem, 0));
+
+    m_commandBuffer->begin();
+    vk::CmdFillBuffer(m_commandBuffer->handle(), buffer, 0, VK_WHOLE_SIZE, 0);
+
+    // Links from objects to a command buffer are only published when recording ends, but must be invalidated before that
+    vk::DestroyBuffer(m_device->device(), buffer, NULL);
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "UNASSIGNED-CoreValidation-DrawState-InvalidCommandBuffer-VkBuffer");
+    vk::EndCommandBuffer(m_commandBuffer->handle());
+    m_errorMonitor->VerifyFound();
+
+    vk::FreeMemory(m_device->handle(), mem, NULL);
+}
+
 TEST_F(VkLayerTest, InvalidCmdBufferBufferViewDestroyed) {
     TEST_DESCRIPTION("Delete bufferView bound to cmd buffer, then attempt to submit cmd buffer.");
 
@@ -7007,6 +7157,54 @@ TEST_F(VkLayerTest, ClearColorImageInvalidImageLayout) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(VkLayerTest, CopyImageOverlappingRegions) {
+    TEST_DESCRIPTION("Copy within an image with the source of a region overlapping the destination of the same or another one.");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    VkImageObj image(m_device);
+    image.Init(64, 64, 2, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+               VK_IMAGE_TILING_OPTIMAL, 0);
+    ASSERT_TRUE(image.initialized());
+    image.SetLayout(VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_GENERAL);
+
+    VkImageCopy copy_regions[2] = {};
+    copy_regions[0].srcSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+    copy_regions[0].dstSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+    copy_regions[0].dstOffset = {16, 16, 0};
+    copy_regions[0].extent = {32, 32, 1};
+
+    m_commandBuffer->begin();
+
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-vkCmdCopyImage-pRegions-00124");
+    vk::CmdCopyImage(m_commandBuffer->handle(), image.handle(), VK_IMAGE_LAYOUT_GENERAL, image.handle(), VK_IMAGE_LAYOUT_GENERAL, 1,
+                     copy_regions);
+    m_errorMonitor->VerifyFound();
+
+    // The same offsets in different mip levels don't overlap
+    m_errorMonitor->ExpectSuccess();
+    copy_regions[0].dstSubresource.mipLevel = 1;
+    copy_regions[0].dstOffset = {0, 0, 0};
+    vk::CmdCopyImage(m_commandBuffer->handle(), image.handle(), VK_IMAGE_LAYOUT_GENERAL, image.handle(), VK_IMAGE_LAYOUT_GENERAL, 1,
+                     copy_regions);
+    m_errorMonitor->VerifyNotFound();
+
+    // The destination of pRegions[1] lies inside of the source of pRegions[0], while neither region overlaps itself
+    copy_regions[0].dstSubresource.mipLevel = 0;
+    copy_regions[0].dstOffset = {32, 32, 0};
+    copy_regions[1].srcSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+    copy_regions[1].srcOffset = {32, 0, 0};
+    copy_regions[1].dstSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+    copy_regions[1].dstOffset = {8, 8, 0};
+    copy_regions[1].extent = {16, 16, 1};
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-vkCmdCopyImage-pRegions-00124");
+    vk::CmdCopyImage(m_commandBuffer->handle(), image.handle(), VK_IMAGE_LAYOUT_GENERAL, image.handle(), VK_IMAGE_LAYOUT_GENERAL, 2,
+                     copy_regions);
+    m_errorMonitor->VerifyFound();
+
+    m_commandBuffer->end();
+}
+
 TEST_F(VkLayerTest, CopyInvalidImageMemory) {
     TEST_DESCRIPTION("Validate 4 invalid image memory VUIDs ");
     SetTargetApiVersion(VK_API_VERSION_1_1);
@@ -12930,3 +13128,45 @@ TEST_F(VkLayerTest, InvalidShadingRateUsage) {
         }
     }
 }
+
+#if defined(__linux__)
+TEST_F(VkLayerTest, MappedMemoryUnflushedWrite) {
+    TEST_DESCRIPTION("Write to mapped non-coherent memory and submit without flushing it.");
+
+    VkLayerSettingValueDataEXT enables_value{};
+    enables_value.arrayString.pCharArray = "VALIDATION_CHECK_ENABLE_MAPPED_MEMORY_WRITE_TRACKING";
+    enables_value.arrayString.count = sizeof(enables_value.arrayString.pCharArray);
+    VkLayerSettingValueEXT enables_setting = {"enables", VK_LAYER_SETTING_VALUE_TYPE_STRING_ARRAY_EXT, enables_value};
+    VkLayerSettingsEXT layer_settings{static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr, 1,
+                                      &enables_setting};
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, &layer_settings));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    // Large enough to hold whole pages away from both ends of the mapping
+    VkMemoryAllocateInfo alloc_info = LvlInitStruct<VkMemoryAllocateInfo>();
+    alloc_info.allocationSize = 1024 * 1024;
+    if (!m_device->phy().set_memory_type(0xFFFFFFFF, &alloc_info, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+                                         VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)) {
+        printf("%s No non-coherent host visible memory type, skipping test.\n", kSkipPrefix);
+        return;
+    }
+    VkDeviceMemory mem;
+    ASSERT_VK_SUCCESS(vk::AllocateMemory(m_device->device(), &alloc_info, nullptr, &mem));
+
+    uint8_t *data = nullptr;
+    ASSERT_VK_SUCCESS(vk::MapMemory(m_device->device(), mem, 0, VK_WHOLE_SIZE, 0, reinterpret_cast<void **>(&data)));
+    data[alloc_info.allocationSize / 2] = 1;
+
+    m_errorMonitor->SetDesiredFailureMsg(kWarningBit, "UNASSIGNED-CoreValidation-MemTrack-UnflushedWrite");
+    vk::QueueSubmit(m_device->m_queue, 0, nullptr, VK_NULL_HANDLE);
+    m_errorMonitor->VerifyFound();
+
+    // The write was reported, so a second submit doesn't report it again
+    m_errorMonitor->ExpectSuccess();
+    vk::QueueSubmit(m_device->m_queue, 0, nullptr, VK_NULL_HANDLE);
+    m_errorMonitor->VerifyNotFound();
+
+    vk::UnmapMemory(m_device->device(), mem);
+    vk::FreeMemory(m_device->device(), mem, nullptr);
+}
+#endif  // defined(__linux__)
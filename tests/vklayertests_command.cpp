@@ -8770,3 +8770,44 @@ TEST_F(VkLayerTest, InvalidPrimitiveFragmentShadingRateWriteMultiViewportLimitDy
     m_commandBuffer->EndRenderPass();
     m_commandBuffer->end();
 }
+
+TEST_F(VkLayerTest, SampledCommandValidation) {
+    TEST_DESCRIPTION("Leave the checks of some commands out of command buffer recordings that sampling doesn't select.");
+
+    // With a rate of 2 and the default seed of 0, the first recording isn't selected and the second one is
+    VkLayerSettingValueDataEXT rate_value{};
+    rate_value.value32 = 2;
+    VkLayerSettingValueEXT rate_setting = {"sampling_rate", VK_LAYER_SETTING_VALUE_TYPE_UINT32_EXT, rate_value};
+    VkLayerSettingsEXT layer_settings{static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr, 1,
+                                      &rate_setting};
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, &layer_settings));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    VkBufferObj buffer;
+    buffer.init_as_dst(*m_device, 20, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+
+    OneOffDescriptorSet descriptor_set(m_device, {
+                                                     {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT, nullptr},
+                                                 });
+    const VkPipelineLayoutObj pipeline_layout(m_device, {&descriptor_set.layout_});
+
+    m_commandBuffer->begin();
+    // The core checks of draws and buffer fills are sampled out, and recording the draw without a pipeline is still safe
+    m_errorMonitor->ExpectSuccess();
+    vk::CmdDraw(m_commandBuffer->handle(), 3, 1, 0, 0);
+    m_commandBuffer->FillBuffer(buffer.handle(), 0, 40, 0x11111111);
+    m_errorMonitor->VerifyNotFound();
+
+    // Recording a descriptor set bind depends on its checks, so they run in every recording
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-vkCmdBindDescriptorSets-firstSet-00360");
+    vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout.handle(), 1, 1,
+                              &descriptor_set.set_, 0, nullptr);
+    m_errorMonitor->VerifyFound();
+    m_commandBuffer->end();
+
+    m_commandBuffer->begin();
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-vkCmdFillBuffer-size-00027");
+    m_commandBuffer->FillBuffer(buffer.handle(), 0, 40, 0x11111111);
+    m_errorMonitor->VerifyFound();
+    m_commandBuffer->end();
+}
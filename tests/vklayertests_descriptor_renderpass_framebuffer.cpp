@@ -1908,6 +1908,68 @@ TEST_F(VkLayerTest, RenderPassBeginIncompatibleFramebufferRenderPass) {
     vk::DestroyImageView(m_device->device(), dsv, nullptr);
 }
 
+TEST_F(VkLayerTest, RenderPassBeginCompatibilityIds) {
+    TEST_DESCRIPTION("Begin render passes that differ from the framebuffer's in trailing unused references, or in a format.");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    const VkFormat format = VK_FORMAT_R8G8B8A8_UNORM;
+    VkImageObj image(m_device);
+    image.Init(32, 32, 1, format, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT, VK_IMAGE_TILING_OPTIMAL);
+    ASSERT_TRUE(image.initialized());
+    VkImageView view = image.targetView(format);
+
+    VkAttachmentDescription attachment = {0,
+                                          format,
+                                          VK_SAMPLE_COUNT_1_BIT,
+                                          VK_ATTACHMENT_LOAD_OP_DONT_CARE,
+                                          VK_ATTACHMENT_STORE_OP_DONT_CARE,
+                                          VK_ATTACHMENT_LOAD_OP_DONT_CARE,
+                                          VK_ATTACHMENT_STORE_OP_DONT_CARE,
+                                          VK_IMAGE_LAYOUT_UNDEFINED,
+                                          VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL};
+    const VkAttachmentReference color_refs[2] = {{0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL},
+                                                 {VK_ATTACHMENT_UNUSED, VK_IMAGE_LAYOUT_UNDEFINED}};
+    VkSubpassDescription subpass = {0, VK_PIPELINE_BIND_POINT_GRAPHICS, 0, nullptr, 1, color_refs, nullptr, nullptr, 0, nullptr};
+    const VkRenderPassCreateInfo rpci = {VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO, nullptr, 0, 1, &attachment, 1, &subpass, 0,
+                                         nullptr};
+
+    VkRenderPass rp;
+    ASSERT_VK_SUCCESS(vk::CreateRenderPass(device(), &rpci, nullptr, &rp));
+    VkFramebuffer fb;
+    const VkFramebufferCreateInfo fbci = {VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO, nullptr, 0, rp, 1, &view, 32, 32, 1};
+    ASSERT_VK_SUCCESS(vk::CreateFramebuffer(device(), &fbci, nullptr, &fb));
+
+    // A trailing unused color reference is compatible with the shorter list of the framebuffer's render pass
+    subpass.colorAttachmentCount = 2;
+    VkRenderPass rp_unused_ref;
+    ASSERT_VK_SUCCESS(vk::CreateRenderPass(device(), &rpci, nullptr, &rp_unused_ref));
+    VkRenderPassBeginInfo rp_begin = {
+        VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO, nullptr, rp_unused_ref, fb, {{0, 0}, {32, 32}}, 0, nullptr};
+
+    m_errorMonitor->ExpectSuccess();
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(rp_begin);
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+    m_errorMonitor->VerifyNotFound();
+
+    // An attachment of another format is not
+    subpass.colorAttachmentCount = 1;
+    attachment.format = VK_FORMAT_B8G8R8A8_UNORM;
+    VkRenderPass rp_other_format;
+    ASSERT_VK_SUCCESS(vk::CreateRenderPass(device(), &rpci, nullptr, &rp_other_format));
+    rp_begin.renderPass = rp_other_format;
+    m_commandBuffer->reset();
+    TestRenderPassBegin(m_errorMonitor, device(), m_commandBuffer->handle(), &rp_begin, false,
+                        "VUID-VkRenderPassBeginInfo-renderPass-00904", nullptr);
+
+    vk::DestroyFramebuffer(device(), fb, nullptr);
+    vk::DestroyRenderPass(device(), rp, nullptr);
+    vk::DestroyRenderPass(device(), rp_unused_ref, nullptr);
+    vk::DestroyRenderPass(device(), rp_other_format, nullptr);
+}
+
 TEST_F(VkLayerTest, RenderPassBeginLayoutsFramebufferImageUsageMismatches) {
     TEST_DESCRIPTION(
         "Test that renderpass initial/final layouts match up with the usage bits set for each attachment of the framebuffer");
@@ -3952,6 +4014,97 @@ TEST_F(VkLayerTest, InvalidDrawDescriptorSetBufferDestroyed) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(VkLayerTest, InvalidCmdBufferDescriptorSetBufferDestroyedWhileRecording) {
+    TEST_DESCRIPTION(
+        "End a command buffer that is invalid due to a buffer used through a descriptor set being destroyed during recording.");
+    ASSERT_NO_FATAL_FAILURE(Init());
+    ASSERT_NO_FATAL_FAILURE(InitViewport());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    char const *fsSource =
+        "#version 450\n"
+        "\n"
+        "layout(location=0) out vec4 x;\n"
+        "layout(set=0) layout(binding=0) uniform foo { int x; int y; } bar;\n"
+        "void main(){\n"
+        "   x = vec4(bar.y);\n"
+        "}\n";
+    VkShaderObj fs(m_device, fsSource, VK_SHADER_STAGE_FRAGMENT_BIT, this);
+    CreatePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.shader_stages_ = {pipe.vs_->GetStageCreateInfo(), fs.GetStageCreateInfo()};
+    pipe.InitState();
+    pipe.CreateGraphicsPipeline();
+
+    m_commandBuffer->begin();
+    {
+        VkBufferObj buffer;
+        buffer.init(*m_device, 1024, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+        pipe.descriptor_set_->WriteDescriptorBufferInfo(0, buffer.handle(), 1024);
+        pipe.descriptor_set_->UpdateDescriptorSets();
+
+        m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+        vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_);
+        vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_layout_.handle(), 0,
+                                  1, &pipe.descriptor_set_->set_, 0, NULL);
+        m_commandBuffer->Draw(1, 0, 0, 0);
+        m_commandBuffer->EndRenderPass();
+    }
+    // The destroyed buffer and its memory are found through the descriptor set binding the draw used
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "UNASSIGNED-CoreValidation-DrawState-InvalidCommandBuffer-VkBuffer");
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "UNASSIGNED-CoreValidation-DrawState-InvalidCommandBuffer-VkDeviceMemory");
+    vk::EndCommandBuffer(m_commandBuffer->handle());
+    m_errorMonitor->VerifyFound();
+}
+
+TEST_F(VkLayerTest, DescriptorSetBufferInUseDestroyed) {
+    TEST_DESCRIPTION("Destroy a buffer used only through a descriptor set by a pending command buffer.");
+    ASSERT_NO_FATAL_FAILURE(Init());
+    ASSERT_NO_FATAL_FAILURE(InitViewport());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    char const *fsSource =
+        "#version 450\n"
+        "\n"
+        "layout(location=0) out vec4 x;\n"
+        "layout(set=0) layout(binding=0) uniform foo { int x; int y; } bar;\n"
+        "void main(){\n"
+        "   x = vec4(bar.y);\n"
+        "}\n";
+    VkShaderObj fs(m_device, fsSource, VK_SHADER_STAGE_FRAGMENT_BIT, this);
+    CreatePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.shader_stages_ = {pipe.vs_->GetStageCreateInfo(), fs.GetStageCreateInfo()};
+    pipe.InitState();
+    pipe.CreateGraphicsPipeline();
+
+    VkBufferObj buffer;
+    buffer.init(*m_device, 1024, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    pipe.descriptor_set_->WriteDescriptorBufferInfo(0, buffer.handle(), 1024);
+    pipe.descriptor_set_->UpdateDescriptorSets();
+
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_);
+    vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_layout_.handle(), 0, 1,
+                              &pipe.descriptor_set_->set_, 0, NULL);
+    m_commandBuffer->Draw(1, 0, 0, 0);
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+
+    VkSubmitInfo submit_info = {};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &m_commandBuffer->handle();
+    vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+
+    // The buffer isn't bound to the command buffer, it's in use through the set binding the draw used
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-vkDestroyBuffer-buffer-00922");
+    vk::DestroyBuffer(m_device->device(), buffer.handle(), nullptr);
+    m_errorMonitor->VerifyFound();
+    vk::QueueWaitIdle(m_device->m_queue);
+}
+
 TEST_F(VkLayerTest, InvalidCmdBufferDescriptorSetImageSamplerDestroyed) {
     TEST_DESCRIPTION(
         "Attempt to draw with a command buffer that is invalid due to a bound descriptor sets with a combined image sampler having "
@@ -5378,6 +5531,46 @@ TEST_F(VkLayerTest, DSBufferInfoErrors) {
     }
 }
 
+TEST_F(VkLayerTest, DSBufferInfoErrorsInBatch) {
+    TEST_DESCRIPTION(
+        "Update a batch of buffer descriptors from one buffer, where only the last VkDescriptorBufferInfo has an offset out of "
+        "range. The checks of the buffer itself are made once per call, but the offset of every write must still be checked.");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    std::vector<VkDescriptorSetLayoutBinding> ds_bindings = {
+        {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 4, VK_SHADER_STAGE_ALL, nullptr}};
+    OneOffDescriptorSet descriptor_set(m_device, ds_bindings);
+
+    const VkDeviceSize alignment = m_device->props.limits.minUniformBufferOffsetAlignment;
+    VkBufferObj buffer;
+    buffer.init(*m_device, 4 * alignment, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+
+    VkDescriptorBufferInfo buff_infos[4] = {};
+    VkWriteDescriptorSet descriptor_writes[4] = {};
+    for (uint32_t i = 0; i < 4; ++i) {
+        buff_infos[i].buffer = buffer.handle();
+        buff_infos[i].offset = i * alignment;
+        buff_infos[i].range = alignment;
+        descriptor_writes[i] = LvlInitStruct<VkWriteDescriptorSet>();
+        descriptor_writes[i].dstSet = descriptor_set.set_;
+        descriptor_writes[i].dstBinding = 0;
+        descriptor_writes[i].dstArrayElement = i;
+        descriptor_writes[i].descriptorCount = 1;
+        descriptor_writes[i].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        descriptor_writes[i].pBufferInfo = &buff_infos[i];
+    }
+
+    m_errorMonitor->ExpectSuccess();
+    vk::UpdateDescriptorSets(m_device->device(), 4, descriptor_writes, 0, nullptr);
+    m_errorMonitor->VerifyNotFound();
+
+    buff_infos[3].offset = 4 * alignment;
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-VkDescriptorBufferInfo-offset-00340");
+    vk::UpdateDescriptorSets(m_device->device(), 4, descriptor_writes, 0, nullptr);
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(VkLayerTest, DSBufferLimitErrors) {
     TEST_DESCRIPTION(
         "Attempt to update buffer descriptor set that has VkDescriptorBufferInfo values that violate device limits.\n"
@@ -7585,6 +7778,74 @@ TEST_F(VkLayerTest, CreateDescriptorUpdateTemplate) {
     do_test("VUID-VkDescriptorUpdateTemplateCreateInfo-templateType-00350");
 }
 
+TEST_F(VkLayerTest, UpdateDescriptorSetWithTemplateAcrossBindings) {
+    TEST_DESCRIPTION("Update two array bindings with one packed template entry, with an invalid descriptor in the second.");
+
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor));
+    if (DeviceExtensionSupported(gpu(), nullptr, VK_KHR_DESCRIPTOR_UPDATE_TEMPLATE_EXTENSION_NAME)) {
+        m_device_extension_names.push_back(VK_KHR_DESCRIPTOR_UPDATE_TEMPLATE_EXTENSION_NAME);
+    } else {
+        printf("%s Descriptor Update Template Extensions not supported, skipping test.\n", kSkipPrefix);
+        return;
+    }
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    auto vkCreateDescriptorUpdateTemplateKHR =
+        (PFN_vkCreateDescriptorUpdateTemplateKHR)vk::GetDeviceProcAddr(m_device->device(), "vkCreateDescriptorUpdateTemplateKHR");
+    auto vkDestroyDescriptorUpdateTemplateKHR =
+        (PFN_vkDestroyDescriptorUpdateTemplateKHR)vk::GetDeviceProcAddr(m_device->device(), "vkDestroyDescriptorUpdateTemplateKHR");
+    auto vkUpdateDescriptorSetWithTemplateKHR =
+        (PFN_vkUpdateDescriptorSetWithTemplateKHR)vk::GetDeviceProcAddr(m_device->device(), "vkUpdateDescriptorSetWithTemplateKHR");
+    ASSERT_NE(vkCreateDescriptorUpdateTemplateKHR, nullptr);
+    ASSERT_NE(vkDestroyDescriptorUpdateTemplateKHR, nullptr);
+    ASSERT_NE(vkUpdateDescriptorSetWithTemplateKHR, nullptr);
+
+    OneOffDescriptorSet descriptor_set(m_device, {
+                                                     {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 2, VK_SHADER_STAGE_ALL, nullptr},
+                                                     {1, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 2, VK_SHADER_STAGE_ALL, nullptr},
+                                                 });
+
+    VkBufferObj buffer;
+    buffer.init(*m_device, 256, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+
+    // One entry covering both bindings, rolling over from binding 0 into binding 1
+    VkDescriptorUpdateTemplateEntry update_template_entry = {};
+    update_template_entry.dstBinding = 0;
+    update_template_entry.dstArrayElement = 0;
+    update_template_entry.descriptorCount = 4;
+    update_template_entry.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    update_template_entry.offset = 0;
+    update_template_entry.stride = sizeof(VkDescriptorBufferInfo);
+
+    auto update_template_ci = LvlInitStruct<VkDescriptorUpdateTemplateCreateInfoKHR>();
+    update_template_ci.descriptorUpdateEntryCount = 1;
+    update_template_ci.pDescriptorUpdateEntries = &update_template_entry;
+    update_template_ci.templateType = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+    update_template_ci.descriptorSetLayout = descriptor_set.layout_.handle();
+
+    VkDescriptorUpdateTemplate update_template = VK_NULL_HANDLE;
+    ASSERT_VK_SUCCESS(vkCreateDescriptorUpdateTemplateKHR(m_device->device(), &update_template_ci, nullptr, &update_template));
+
+    VkDescriptorBufferInfo buffer_infos[4];
+    for (auto &buffer_info : buffer_infos) {
+        buffer_info.buffer = buffer.handle();
+        buffer_info.offset = 0;
+        buffer_info.range = VK_WHOLE_SIZE;
+    }
+
+    m_errorMonitor->ExpectSuccess();
+    vkUpdateDescriptorSetWithTemplateKHR(m_device->device(), descriptor_set.set_, update_template, buffer_infos);
+    m_errorMonitor->VerifyNotFound();
+
+    // Array element 1 of binding 1
+    buffer_infos[3].range = 0;
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-VkDescriptorBufferInfo-range-00341");
+    vkUpdateDescriptorSetWithTemplateKHR(m_device->device(), descriptor_set.set_, update_template, buffer_infos);
+    m_errorMonitor->VerifyFound();
+
+    vkDestroyDescriptorUpdateTemplateKHR(m_device->device(), update_template, nullptr);
+}
+
 TEST_F(VkLayerTest, InlineUniformBlockEXT) {
     TEST_DESCRIPTION("Test VK_EXT_inline_uniform_block.");
 
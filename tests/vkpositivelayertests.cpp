@@ -2039,6 +2039,28 @@ TEST_F(VkPositiveLayerTest, LoosePointSizeWrite) {
     m_errorMonitor->VerifyNotFound();
 }
 
+TEST_F(VkPositiveLayerTest, CopyBufferInterleavedRegions) {
+    TEST_DESCRIPTION("Copy within a buffer with source and destination regions interleaved, but not overlapping.");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    VkBufferObj buffer;
+    buffer.init_as_src_and_dst(*m_device, 1024, 0);
+
+    // The sources and destinations span the same bytes, [0, 1024), without any source region overlapping a destination
+    std::vector<VkBufferCopy> regions;
+    for (VkDeviceSize offset = 0; offset < 1024; offset += 128) {
+        regions.push_back({offset, offset + 64, 64});
+    }
+
+    m_errorMonitor->ExpectSuccess();
+    m_commandBuffer->begin();
+    vk::CmdCopyBuffer(m_commandBuffer->handle(), buffer.handle(), buffer.handle(), static_cast<uint32_t>(regions.size()),
+                      regions.data());
+    m_commandBuffer->end();
+    m_errorMonitor->VerifyNotFound();
+}
+
 TEST_F(VkPositiveLayerTest, UncompressedToCompressedImageCopy) {
     TEST_DESCRIPTION("Image copies between compressed and uncompressed images");
     ASSERT_NO_FATAL_FAILURE(Init());
@@ -2157,6 +2179,60 @@ TEST_F(VkPositiveLayerTest, DeleteDescriptorSetLayoutsBeforeDescriptorSets) {
     m_errorMonitor->VerifyNotFound();
 }
 
+TEST_F(VkPositiveLayerTest, ResetDescriptorPoolAndReallocate) {
+    TEST_DESCRIPTION("Fill a descriptor pool that can't free sets individually, reset it, and fill it again.");
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    m_errorMonitor->ExpectSuccess();
+
+    const uint32_t set_count = 4;
+    VkDescriptorPoolSize ds_type_count = {};
+    ds_type_count.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    ds_type_count.descriptorCount = 2 * set_count;
+
+    VkDescriptorPoolCreateInfo ds_pool_ci = {};
+    ds_pool_ci.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    ds_pool_ci.flags = 0;
+    ds_pool_ci.maxSets = set_count;
+    ds_pool_ci.poolSizeCount = 1;
+    ds_pool_ci.pPoolSizes = &ds_type_count;
+    VkDescriptorPool ds_pool;
+    ASSERT_VK_SUCCESS(vk::CreateDescriptorPool(m_device->device(), &ds_pool_ci, nullptr, &ds_pool));
+
+    const VkDescriptorSetLayoutObj ds_layout(m_device, {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 2, VK_SHADER_STAGE_ALL, nullptr}});
+    std::vector<VkDescriptorSetLayout> set_layouts(set_count, ds_layout.handle());
+
+    VkBufferObj buffer;
+    buffer.init(*m_device, 256, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    VkDescriptorBufferInfo buffer_infos[2] = {{buffer.handle(), 0, VK_WHOLE_SIZE}, {buffer.handle(), 0, VK_WHOLE_SIZE}};
+
+    for (uint32_t cycle = 0; cycle < 3; ++cycle) {
+        VkDescriptorSetAllocateInfo alloc_info = {};
+        alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        alloc_info.descriptorSetCount = set_count;
+        alloc_info.descriptorPool = ds_pool;
+        alloc_info.pSetLayouts = set_layouts.data();
+        VkDescriptorSet descriptor_sets[set_count];
+        ASSERT_VK_SUCCESS(vk::AllocateDescriptorSets(m_device->device(), &alloc_info, descriptor_sets));
+
+        for (uint32_t i = 0; i < set_count; ++i) {
+            VkWriteDescriptorSet descriptor_write = {};
+            descriptor_write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            descriptor_write.dstSet = descriptor_sets[i];
+            descriptor_write.dstBinding = 0;
+            descriptor_write.descriptorCount = 2;
+            descriptor_write.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+            descriptor_write.pBufferInfo = buffer_infos;
+            vk::UpdateDescriptorSets(m_device->device(), 1, &descriptor_write, 0, nullptr);
+        }
+
+        ASSERT_VK_SUCCESS(vk::ResetDescriptorPool(m_device->device(), ds_pool, 0));
+    }
+
+    vk::DestroyDescriptorPool(m_device->device(), ds_pool, nullptr);
+    m_errorMonitor->VerifyNotFound();
+}
+
 TEST_F(VkPositiveLayerTest, CommandPoolDeleteWithReferences) {
     TEST_DESCRIPTION("Ensure the validation layers bookkeeping tracks the implicit command buffer frees.");
     ASSERT_NO_FATAL_FAILURE(Init());
@@ -11006,3 +11082,49 @@ void main() {
     pipe.CreateGraphicsPipeline();
     m_errorMonitor->VerifyNotFound();
 }
+
+#if defined(__linux__)
+TEST_F(VkPositiveLayerTest, MappedMemoryFlushedWrite) {
+    TEST_DESCRIPTION("Write to mapped non-coherent memory and flush it before submitting.");
+
+    VkLayerSettingValueDataEXT enables_value{};
+    enables_value.arrayString.pCharArray = "VALIDATION_CHECK_ENABLE_MAPPED_MEMORY_WRITE_TRACKING";
+    enables_value.arrayString.count = sizeof(enables_value.arrayString.pCharArray);
+    VkLayerSettingValueEXT enables_setting = {"enables", VK_LAYER_SETTING_VALUE_TYPE_STRING_ARRAY_EXT, enables_value};
+    VkLayerSettingsEXT layer_settings{static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr, 1,
+                                      &enables_setting};
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, &layer_settings));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    VkMemoryAllocateInfo alloc_info = LvlInitStruct<VkMemoryAllocateInfo>();
+    alloc_info.allocationSize = 1024 * 1024;
+    if (!m_device->phy().set_memory_type(0xFFFFFFFF, &alloc_info, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+                                         VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)) {
+        printf("%s No non-coherent host visible memory type, skipping test.\n", kSkipPrefix);
+        return;
+    }
+    VkDeviceMemory mem;
+    ASSERT_VK_SUCCESS(vk::AllocateMemory(m_device->device(), &alloc_info, nullptr, &mem));
+
+    m_errorMonitor->ExpectSuccess();
+    uint8_t *data = nullptr;
+    ASSERT_VK_SUCCESS(vk::MapMemory(m_device->device(), mem, 0, VK_WHOLE_SIZE, 0, reinterpret_cast<void **>(&data)));
+    data[alloc_info.allocationSize / 2] = 1;
+
+    VkMappedMemoryRange range = LvlInitStruct<VkMappedMemoryRange>();
+    range.memory = mem;
+    range.offset = 0;
+    range.size = VK_WHOLE_SIZE;
+    vk::FlushMappedMemoryRanges(m_device->device(), 1, &range);
+    vk::QueueSubmit(m_device->m_queue, 0, nullptr, VK_NULL_HANDLE);
+
+    // Writing again after the flush faults again, and a second flush covers it
+    data[alloc_info.allocationSize / 2] = 2;
+    vk::FlushMappedMemoryRanges(m_device->device(), 1, &range);
+    vk::QueueSubmit(m_device->m_queue, 0, nullptr, VK_NULL_HANDLE);
+
+    vk::UnmapMemory(m_device->device(), mem);
+    vk::FreeMemory(m_device->device(), mem, nullptr);
+    m_errorMonitor->VerifyNotFound();
+}
+#endif  // defined(__linux__)
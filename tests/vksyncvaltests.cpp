@@ -27,6 +27,7 @@
 
 #include "cast_utils.h"
 #include "layer_validation_tests.h"
+#include "range_vector.h"
 
 TEST_F(VkSyncValTest, SyncBufferCopyHazards) {
     ASSERT_NO_FATAL_FAILURE(InitSyncValFramework());
@@ -165,6 +166,69 @@ TEST_F(VkSyncValTest, SyncBufferCopyHazards) {
     }
 }
 
+TEST_F(VkSyncValTest, SyncFragmentedBufferCopies) {
+    ASSERT_NO_FATAL_FAILURE(InitSyncValFramework());
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    VkBufferObj buffer_a;
+    VkBufferObj buffer_b;
+    VkBufferObj buffer_c;
+    VkMemoryPropertyFlags mem_prop = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    buffer_a.init_as_src_and_dst(*m_device, 256, mem_prop);
+    buffer_b.init_as_src_and_dst(*m_device, 256, mem_prop);
+    buffer_c.init_as_src_and_dst(*m_device, 256, mem_prop);
+
+    // Each region of a copy gets its own range in the access maps, but all of them share the copy's tag. So 64 abutting
+    // regions leave 64 equal ranges in both the source and the destination, well past the 16 ranges needed to merge them.
+    std::vector<VkBufferCopy> fragments;
+    for (VkDeviceSize offset = 0; offset < 256; offset += 4) {
+        fragments.push_back({offset, offset, 4});
+    }
+    const uint32_t fragment_count = static_cast<uint32_t>(fragments.size());
+
+    auto mem_barrier = LvlInitStruct<VkMemoryBarrier>();
+    mem_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    mem_barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+
+    auto cb = m_commandBuffer->handle();
+    m_commandBuffer->begin();
+
+    // The barriers merge the ranges, the second round fragments the merged maps again past twice their merged size
+    m_errorMonitor->ExpectSuccess();
+    vk::CmdCopyBuffer(cb, buffer_b.handle(), buffer_a.handle(), fragment_count, fragments.data());
+    vk::CmdPipelineBarrier(cb, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &mem_barrier, 0, nullptr, 0,
+                           nullptr);
+    vk::CmdCopyBuffer(cb, buffer_c.handle(), buffer_a.handle(), fragment_count, fragments.data());
+    vk::CmdPipelineBarrier(cb, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &mem_barrier, 0, nullptr, 0,
+                           nullptr);
+    m_errorMonitor->VerifyNotFound();
+
+    // The merged state must still track the last write, which the barriers only make visible to later writes
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "SYNC-HAZARD-READ_AFTER_WRITE");
+    VkBufferCopy back = {128, 0, 128};
+    vk::CmdCopyBuffer(cb, buffer_a.handle(), buffer_b.handle(), 1, &back);
+    m_errorMonitor->VerifyFound();
+
+    m_commandBuffer->end();
+
+    // The access maps aren't visible through the API, so check the merge the layer relies on with the same fragmentation
+    using RangeMap = sparse_container::range_map<VkDeviceSize, uint32_t>;
+    using Range = RangeMap::key_type;
+    RangeMap map;
+    for (const auto &fragment : fragments) {
+        map.insert(std::make_pair(Range(fragment.dstOffset, fragment.dstOffset + fragment.size), 1U));
+    }
+    map.insert(std::make_pair(Range(256, 260), 2U));
+    const size_t ranges_before = map.size();
+    ASSERT_EQ(ranges_before, fragments.size() + 1);
+    const size_t removed = sparse_container::consolidate(map);
+    ASSERT_EQ(map.size(), ranges_before - removed);
+    ASSERT_LT(map.size(), ranges_before);
+    // Abutting ranges with different state stay separate
+    ASSERT_EQ(map.size(), 2U);
+    ASSERT_EQ(map.begin()->first, Range(0, 256));
+}
+
 TEST_F(VkSyncValTest, SyncCopyOptimalImageHazards) {
     ASSERT_NO_FATAL_FAILURE(InitSyncValFramework());
     ASSERT_NO_FATAL_FAILURE(InitState(nullptr, nullptr, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT));
@@ -1859,6 +1923,81 @@ TEST_F(VkSyncValTest, RenderPassLoadHazardVsInitialLayout) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(VkSyncValTest, SharedRenderPassAnalysisAfterDestroy) {
+    TEST_DESCRIPTION("Use a render pass after destroying an identical one that shares its subpass analysis.");
+
+    ASSERT_NO_FATAL_FAILURE(InitSyncValFramework());
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    VkFormat format = VK_FORMAT_R8G8B8A8_UNORM;
+    VkImageObj image(m_device);
+    image.Init(32, 32, 1, format, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT, VK_IMAGE_TILING_OPTIMAL);
+    ASSERT_TRUE(image.initialized());
+    VkImageView view = image.targetView(format);
+
+    const VkAttachmentDescription attachment = {0,
+                                                format,
+                                                VK_SAMPLE_COUNT_1_BIT,
+                                                VK_ATTACHMENT_LOAD_OP_CLEAR,
+                                                VK_ATTACHMENT_STORE_OP_STORE,
+                                                VK_ATTACHMENT_LOAD_OP_DONT_CARE,
+                                                VK_ATTACHMENT_STORE_OP_DONT_CARE,
+                                                VK_IMAGE_LAYOUT_UNDEFINED,
+                                                VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL};
+    const VkAttachmentReference color_ref = {0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL};
+    const VkSubpassDescription subpass = {0, VK_PIPELINE_BIND_POINT_GRAPHICS, 0, nullptr, 1, &color_ref, nullptr, nullptr, 0,
+                                          nullptr};
+    const VkSubpassDependency dependency = {VK_SUBPASS_EXTERNAL,
+                                            0,
+                                            VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+                                            VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+                                            0,
+                                            VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+                                            0};
+    const VkRenderPassCreateInfo rpci = {
+        VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO, nullptr, 0, 1, &attachment, 1, &subpass, 1, &dependency};
+
+    // Both render passes are created with the same values, so they share one analysis
+    VkRenderPass destroyed_rp;
+    VkRenderPass rp;
+    ASSERT_VK_SUCCESS(vk::CreateRenderPass(device(), &rpci, nullptr, &destroyed_rp));
+    ASSERT_VK_SUCCESS(vk::CreateRenderPass(device(), &rpci, nullptr, &rp));
+    vk::DestroyRenderPass(device(), destroyed_rp, nullptr);
+
+    VkFramebuffer fb;
+    const VkFramebufferCreateInfo fbci = {VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO, nullptr, 0, rp, 1, &view, 32, 32, 1};
+    ASSERT_VK_SUCCESS(vk::CreateFramebuffer(device(), &fbci, nullptr, &fb));
+
+    VkClearValue clear_value = {};
+    m_renderPassBeginInfo.renderArea = {{0, 0}, {32, 32}};
+    m_renderPassBeginInfo.renderPass = rp;
+    m_renderPassBeginInfo.framebuffer = fb;
+    m_renderPassBeginInfo.clearValueCount = 1;
+    m_renderPassBeginInfo.pClearValues = &clear_value;
+
+    m_errorMonitor->ExpectSuccess();
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+    m_commandBuffer->QueueCommandBuffer();
+    m_errorMonitor->VerifyNotFound();
+
+    // Without a barrier, the layout transition of a second pass in the same command buffer follows the store of the first
+    m_commandBuffer->reset();
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    m_commandBuffer->EndRenderPass();
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "SYNC-HAZARD-WRITE_AFTER_WRITE");
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    m_errorMonitor->VerifyFound();
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+
+    vk::DestroyFramebuffer(device(), fb, nullptr);
+    vk::DestroyRenderPass(device(), rp, nullptr);
+}
+
 TEST_F(VkSyncValTest, SyncRenderPassWithWrongDepthStencilInitialLayout) {
     ASSERT_NO_FATAL_FAILURE(InitSyncValFramework());
     ASSERT_NO_FATAL_FAILURE(InitState());